@@ -0,0 +1,98 @@
+#include <string>
+#include <ranges>
+#include <cstddef>
+#include <cstdint>
+#include <chrono>
+#include <random>
+#include <iostream>
+#include <algorithm>
+#include "offbynull/aligner/graphs/pairwise_global_alignment_graph.h"
+#include "offbynull/aligner/graphs/pairwise_local_alignment_graph.h"
+#include "offbynull/aligner/scorers/simple_scorer.h"
+#include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/backtracker.h"
+#include "offbynull/aligner/backtrackers/anti_diagonal_pairwise_alignment_graph_backtracker/backtracker.h"
+
+// Compares the anti-diagonal backtracker (what the dynamic programming aligners default to for 1-deep graphs with numeric weights)
+// against the generic backtracker, on the same graphs. Each is timed as the fastest of several runs. The local alignment graph is kept
+// smaller because of how many free-ride edges feed into its leaf.
+int main(int /*argc*/, char** /*argv*/) {
+    using offbynull::aligner::graphs::pairwise_global_alignment_graph::create_pairwise_global_alignment_graph;
+    using offbynull::aligner::graphs::pairwise_local_alignment_graph::create_pairwise_local_alignment_graph;
+    using offbynull::aligner::scorers::simple_scorer::simple_scorer;
+
+    constexpr std::size_t global_seq_len { 1000zu };
+    constexpr std::size_t local_seq_len { 200zu };
+    constexpr std::size_t repeat_cnt { 5zu };
+
+    std::mt19937_64 rand { 12345 };
+    std::uniform_int_distribution<int> char_dist { 0, 3 };
+    std::string down {};
+    std::string right {};
+    for ([[maybe_unused]] auto _ : std::views::iota(0zu, global_seq_len)) {
+        down += static_cast<char>('a' + char_dist(rand));
+        right += static_cast<char>('a' + char_dist(rand));
+    }
+    std::string local_down { down.substr(0zu, local_seq_len) };
+    std::string local_right { right.substr(0zu, local_seq_len) };
+    auto substitution_scorer { simple_scorer<false, std::size_t, char, char, std::int32_t>::create_substitution(2, -1) };
+    auto gap_scorer { simple_scorer<false, std::size_t, char, char, std::int32_t>::create_gap(-1) };
+    auto freeride_scorer { simple_scorer<false, std::size_t, char, char, std::int32_t>::create_freeride(0) };
+    auto global_graph { create_pairwise_global_alignment_graph<false, std::size_t>(down, right, substitution_scorer, gap_scorer) };
+    auto local_graph {
+        create_pairwise_local_alignment_graph<false, std::size_t>(
+            local_down,
+            local_right,
+            substitution_scorer,
+            gap_scorer,
+            freeride_scorer
+        )
+    };
+
+    volatile std::int32_t unused {}; // variable used to prevent the compiler from optimizing important stuff out
+    auto time {
+        [&](const char* name, const auto& find_max_path) {
+            std::chrono::steady_clock::duration duration { std::chrono::steady_clock::duration::max() };
+            for ([[maybe_unused]] auto _ : std::views::iota(0zu, repeat_cnt)) {
+                auto before_tp { std::chrono::steady_clock::now() };
+                auto path { find_max_path() };
+                auto after_tp { std::chrono::steady_clock::now() };
+                unused = unused + std::get<1>(path);
+                duration = std::min(duration, after_tp - before_tp);
+            }
+            std::cout << name << ": " << std::chrono::round<std::chrono::milliseconds>(duration) << std::endl;
+        }
+    };
+    time(
+        "global generic",
+        [&]() {
+            return offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtracker::heap_find_max_path<
+                false, std::size_t, std::size_t, true
+            >(global_graph);
+        }
+    );
+    time(
+        "global anti-diagonal",
+        [&]() {
+            return offbynull::aligner::backtrackers::anti_diagonal_pairwise_alignment_graph_backtracker::backtracker::heap_find_max_path<
+                false, std::size_t, std::size_t, true
+            >(global_graph);
+        }
+    );
+    time(
+        "local generic",
+        [&]() {
+            return offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtracker::heap_find_max_path<
+                false, std::size_t, std::size_t, true
+            >(local_graph);
+        }
+    );
+    time(
+        "local anti-diagonal",
+        [&]() {
+            return offbynull::aligner::backtrackers::anti_diagonal_pairwise_alignment_graph_backtracker::backtracker::heap_find_max_path<
+                false, std::size_t, std::size_t, true
+            >(local_graph);
+        }
+    );
+    return 0;
+}
@@ -0,0 +1,105 @@
+#include <string>
+#include <vector>
+#include <ranges>
+#include <cstddef>
+#include <cstdint>
+#include <chrono>
+#include <random>
+#include <iostream>
+#include <algorithm>
+#include "offbynull/aligner/graphs/pairwise_global_alignment_graph.h"
+#include "offbynull/aligner/scorers/qwerty_scorer.h"
+#include "offbynull/aligner/scorers/constant_scorer.h"
+#include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/backtracker.h"
+#include "offbynull/aligner/backtrackers/batch_pairwise_alignment_graph_backtracker/backtracker.h"
+
+// Compares the batch backtracker against backtracking each graph individually, on the same kind of tiny 4x4 global alignments that
+// benchmark-tiny-alignment walks. Each is timed as the fastest of several runs.
+int main(int /*argc*/, char** /*argv*/) {
+    using offbynull::aligner::graphs::pairwise_global_alignment_graph::create_pairwise_global_alignment_graph;
+    using offbynull::aligner::scorers::qwerty_scorer::qwerty_scorer;
+    using offbynull::aligner::scorers::constant_scorer::constant_scorer;
+
+    constexpr std::size_t seq_len { 4zu };
+    constexpr std::size_t graph_cnt { 100000zu };
+    constexpr std::size_t lane_cnt { 16zu };
+    constexpr std::size_t repeat_cnt { 5zu };
+
+    qwerty_scorer<false, std::size_t, float> substitution_scorer {};
+    constant_scorer<false, std::size_t, char, char, float> indel_scorer { 0.0f };
+    const std::string chars { "abcdefghijklmnopqrstuvwxyz0123456789" };
+    std::mt19937_64 rand { 12345 };
+    std::uniform_int_distribution<std::size_t> char_dist { 0zu, chars.size() - 1zu };
+    std::vector<std::string> downs {};
+    std::vector<std::string> rights {};
+    for ([[maybe_unused]] auto _ : std::views::iota(0zu, graph_cnt)) {
+        std::string down {};
+        std::string right {};
+        for ([[maybe_unused]] auto __ : std::views::iota(0zu, seq_len)) {
+            down += chars[char_dist(rand)];
+            right += chars[char_dist(rand)];
+        }
+        downs.push_back(down);
+        rights.push_back(right);
+    }
+    const auto create_graph {
+        [&](const std::size_t i) {
+            return create_pairwise_global_alignment_graph<false, std::size_t>(downs[i], rights[i], substitution_scorer, indel_scorer);
+        }
+    };
+    using G = decltype(create_graph(0zu));
+
+    volatile float unused {}; // variable used to prevent the compiler from optimizing important stuff out
+    auto time {
+        [&](const char* name, const auto& find_max_paths) {
+            std::chrono::steady_clock::duration duration { std::chrono::steady_clock::duration::max() };
+            for ([[maybe_unused]] auto _ : std::views::iota(0zu, repeat_cnt)) {
+                auto before_tp { std::chrono::steady_clock::now() };
+                unused = unused + find_max_paths();
+                auto after_tp { std::chrono::steady_clock::now() };
+                duration = std::min(duration, after_tp - before_tp);
+            }
+            std::cout << name << ": " << std::chrono::round<std::chrono::milliseconds>(duration) << std::endl;
+        }
+    };
+    time(
+        "individual",
+        [&]() {
+            float weight_sum { 0.0f };
+            for (std::size_t i { 0zu }; i < graph_cnt; ++i) {
+                const G g { create_graph(i) };
+                const auto& [path, weight] {
+                    offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtracker::stack_find_max_path<
+                        false, std::uint8_t, std::uint8_t, seq_len + 1zu, seq_len + 1zu, 1zu, seq_len * 2zu
+                    >(g)
+                };
+                weight_sum += weight;
+            }
+            return weight_sum;
+        }
+    );
+    time(
+        "batch",
+        [&]() {
+            float weight_sum { 0.0f };
+            std::vector<G> batch {};
+            batch.reserve(lane_cnt);
+            for (std::size_t i { 0zu }; i < graph_cnt; i += lane_cnt) {
+                batch.clear();
+                for (std::size_t j { i }; j < std::min(i + lane_cnt, graph_cnt); ++j) {
+                    batch.push_back(create_graph(j));
+                }
+                const auto results {
+                    offbynull::aligner::backtrackers::batch_pairwise_alignment_graph_backtracker::backtracker::stack_find_max_paths<
+                        false, std::uint8_t, lane_cnt, seq_len + 1zu, seq_len + 1zu, seq_len * 2zu
+                    >(batch)
+                };
+                for (const auto& [path, weight] : results) {
+                    weight_sum += weight;
+                }
+            }
+            return weight_sum;
+        }
+    );
+    return 0;
+}
@@ -0,0 +1,242 @@
+#ifndef OFFBYNULL_ALIGNER_ALIGNERS_ALIGN_MANY_H
+#define OFFBYNULL_ALIGNER_ALIGNERS_ALIGN_MANY_H
+
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <ranges>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "offbynull/helpers/unordered_thread_pool.h"
+#include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/backtracker_workspace.h"
+
+namespace offbynull::aligner::aligners::align_many {
+    using offbynull::helpers::unordered_thread_pool::unordered_thread_pool;
+    using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtracker_workspace::backtracker_workspace;
+
+    /**
+     * Order in which @ref offbynull::aligner::aligners::align_many::align_many hands results over to its sink.
+     */
+    enum class result_order : std::uint8_t {
+        /** Results are handed over as soon as they're available. */
+        COMPLETION,
+        /** Results are handed over in the same order as the pairs they're for, buffering any that complete early. */
+        INPUT
+    };
+
+    /**
+     * Align many pairs of sequences across a thread pool, where each pair is aligned by a worker created via `create_worker`.
+     *
+     * Pairs are split into chunks which are queued onto an
+     * @ref offbynull::helpers::unordered_thread_pool::unordered_thread_pool of `concurrency` threads. At most `concurrency` workers get
+     * created, and a worker is only ever used by one thread at a time, meaning each worker can hold on to (and reuse) whatever state it
+     * needs between alignments (e.g., an aligner and its backtracker workspace) without synchronization.
+     *
+     * `sink` is invoked as `sink(idx, result)` once per pair, where `idx` is the pair's index within `pairs` and `result` is an rvalue of
+     * whatever the worker returned. Invocations of `sink` are serialized (never concurrent), but may happen on any thread.
+     *
+     * If any worker or `sink` invocation throws, the remaining chunks are skipped and the first exception is rethrown once all threads are
+     * done. Any results already handed over to `sink` remain handed over.
+     *
+     * The behavior of this function is undefined if `pairs` is modified or destroyed before this function returns, or if results returned
+     * by workers reference the worker that produced them.
+     *
+     * @tparam debug_mode `true` to enable debugging logic, `false` otherwise.
+     * @param pairs Random access range of sequence pairs, where `std::get<0>` of an element is the down sequence and `std::get<1>` of an
+     *     element is the right sequence.
+     * @param sink Result consumer.
+     * @param concurrency Number of threads to align on (must be greater than 0).
+     * @param order Order in which results are handed over to `sink`.
+     * @param create_worker Worker factory, where a worker is invoked as `worker(down, right)` and returns the alignment result.
+     * @throws std::runtime_error If debug mode is enabled and `concurrency` is 0.
+     */
+    template<bool debug_mode>
+    void align_many_with_workers(
+        const std::ranges::random_access_range auto& pairs,
+        auto&& sink,
+        const std::size_t concurrency,
+        const result_order order,
+        auto&& create_worker
+    )
+    requires std::ranges::sized_range<decltype(pairs)> {
+        if constexpr (debug_mode) {
+            if (concurrency == 0zu) {
+                throw std::runtime_error { "Concurrency must be > 0" };
+            }
+        }
+        const std::size_t pair_cnt { std::ranges::size(pairs) };
+        if (pair_cnt == 0zu) {
+            return;
+        }
+        const auto pairs_it { std::ranges::begin(pairs) };
+        using WORKER = std::remove_cvref_t<decltype(create_worker())>;
+        using RESULT = std::remove_cvref_t<
+            decltype(std::declval<WORKER&>()(std::get<0>(pairs_it[0]), std::get<1>(pairs_it[0])))
+        >;
+
+        // Workers are handed out to chunks via a free list. Since there are as many workers as there are threads, a chunk never has to
+        // wait on a worker. Workers are created lazily, the first time they're handed out.
+        const std::size_t thread_cnt { std::min(concurrency, pair_cnt) };
+        std::vector<std::optional<WORKER>> workers(thread_cnt);
+        std::vector<std::size_t> free_worker_idxes {};
+        for (std::size_t i { 0zu }; i < thread_cnt; ++i) {
+            free_worker_idxes.push_back(i);
+        }
+        std::mutex worker_mutex {};
+
+        // Results completed ahead of the next expected one are buffered when results are handed over in input order.
+        std::vector<std::optional<RESULT>> buffered_results {};
+        if (order == result_order::INPUT) {
+            buffered_results.resize(pair_cnt);
+        }
+        std::size_t next_result_idx { 0zu };
+        std::mutex sink_mutex {};
+        const auto deliver {
+            [&](const std::size_t idx, RESULT&& result) {
+                std::unique_lock lock { sink_mutex };
+                if (order == result_order::COMPLETION) {
+                    sink(idx, std::move(result));
+                    return;
+                }
+                buffered_results[idx].emplace(std::move(result));
+                while (next_result_idx < pair_cnt && buffered_results[next_result_idx].has_value()) {
+                    sink(next_result_idx, std::move(*buffered_results[next_result_idx]));
+                    buffered_results[next_result_idx].reset();
+                    ++next_result_idx;
+                }
+            }
+        };
+
+        // Pairs are split into several chunks per thread. The thread pool doesn't guarantee which thread a chunk lands on, so having more
+        // chunks than threads keeps threads from sitting idle while others still have a backlog.
+        constexpr std::size_t chunks_per_thread { 8zu };
+        const std::size_t chunk_cnt { std::min(pair_cnt, thread_cnt * chunks_per_thread) };
+        const std::size_t chunk_size { pair_cnt / chunk_cnt + (pair_cnt % chunk_cnt == 0zu ? 0zu : 1zu) };
+        std::atomic_flag failed {};
+        unordered_thread_pool<debug_mode, void> thread_pool { thread_cnt };
+        std::vector<std::future<void>> futures {};
+        for (std::size_t chunk_begin { 0zu }; chunk_begin < pair_cnt; chunk_begin += chunk_size) {
+            const std::size_t chunk_end { std::min(pair_cnt, chunk_begin + chunk_size) };
+            auto future {
+                thread_pool.queue(
+                    [&, chunk_begin, chunk_end](unordered_thread_pool<debug_mode, void>&) {
+                        if (failed.test(std::memory_order_acquire)) {
+                            return;
+                        }
+                        std::size_t worker_idx { 0zu };
+                        {
+                            std::unique_lock lock { worker_mutex };
+                            worker_idx = free_worker_idxes.back();
+                            free_worker_idxes.pop_back();
+                        }
+                        try {
+                            if (!workers[worker_idx].has_value()) {
+                                workers[worker_idx].emplace(create_worker());
+                            }
+                            WORKER& worker { *workers[worker_idx] };
+                            for (std::size_t idx { chunk_begin }; idx < chunk_end && !failed.test(std::memory_order_acquire); ++idx) {
+                                const auto& pair { pairs_it[idx] };
+                                deliver(idx, worker(std::get<0>(pair), std::get<1>(pair)));
+                            }
+                        } catch (...) {
+                            failed.test_and_set(std::memory_order_release);
+                            std::unique_lock lock { worker_mutex };
+                            free_worker_idxes.push_back(worker_idx);
+                            throw;
+                        }
+                        std::unique_lock lock { worker_mutex };
+                        free_worker_idxes.push_back(worker_idx);
+                    }
+                )
+            };
+            if constexpr (debug_mode) {
+                if (!future.has_value()) {
+                    throw std::runtime_error { "Thread pool closed" };
+                }
+            }
+            futures.push_back(std::move(*future));
+        }
+        std::exception_ptr failure {};
+        for (auto& future : futures) {
+            try {
+                future.get();
+            } catch (...) {
+                if (!failure) {
+                    failure = std::current_exception();
+                }
+            }
+        }
+        if (failure) {
+            std::rethrow_exception(failure);
+        }
+    }
+
+    /**
+     * Align many pairs of sequences across a thread pool using an aligner type, such as
+     * @ref offbynull::aligner::aligners::global_dynamic_programming_heap_aligner::global_dynamic_programming_heap_aligner or any of the
+     * other aligners within this namespace. Each thread gets its own `ALIGNER` instance, which is invoked as
+     * `aligner.align(down, right, scorers...)`. If `ALIGNER` is constructible from a
+     * @ref offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtracker_workspace::backtracker_workspace pointer,
+     * each thread's instance is constructed with its own workspace, meaning that once a thread has aligned its largest pair, its
+     * alignments stop allocating the backtracker's containers. See
+     * @ref offbynull::aligner::aligners::align_many::align_many_with_workers for details on how pairs are distributed and how results are
+     * handed over to `sink`.
+     *
+     * @tparam debug_mode `true` to enable debugging logic, `false` otherwise.
+     * @tparam ALIGNER Aligner type (must be default constructible).
+     * @param pairs Random access range of sequence pairs, where `std::get<0>` of an element is the down sequence and `std::get<1>` of an
+     *     element is the right sequence.
+     * @param sink Result consumer, invoked as `sink(idx, result)` where `result` is what `align()` returned for `pairs[idx]`.
+     * @param concurrency Number of threads to align on (must be greater than 0).
+     * @param order Order in which results are handed over to `sink`.
+     * @param scorers Scorers passed to `align()` after the sequences (e.g., substitution scorer and gap scorer for a global aligner).
+     *     Scorers are shared across threads, so they must be safe to invoke concurrently.
+     * @throws std::runtime_error If debug mode is enabled and `concurrency` is 0.
+     */
+    template<bool debug_mode, typename ALIGNER>
+    void align_many(
+        const std::ranges::random_access_range auto& pairs,
+        auto&& sink,
+        const std::size_t concurrency,
+        const result_order order,
+        const auto&... scorers
+    )
+    requires std::ranges::sized_range<decltype(pairs)> && std::is_default_constructible_v<ALIGNER> {
+        align_many_with_workers<debug_mode>(
+            pairs,
+            sink,
+            concurrency,
+            order,
+            [&]() {
+                // The workspace is heap allocated so that the aligner's pointer to it survives the worker being moved around.
+                auto workspace { std::make_unique<backtracker_workspace>() };
+                auto create_aligner {
+                    [&]() {
+                        if constexpr (std::is_constructible_v<ALIGNER, backtracker_workspace*>) {
+                            return ALIGNER { workspace.get() };
+                        } else {
+                            return ALIGNER {};
+                        }
+                    }
+                };
+                return [aligner = create_aligner(), workspace_ = std::move(workspace), &scorers...](
+                    const auto& down,
+                    const auto& right
+                ) mutable {
+                    return aligner.align(down, right, scorers...);
+                };
+            }
+        );
+    }
+}
+
+#endif //OFFBYNULL_ALIGNER_ALIGNERS_ALIGN_MANY_H
@@ -0,0 +1,138 @@
+#include <cstddef>
+#include <random>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+#include "offbynull/aligner/aligners/align_many.h"
+#include "offbynull/aligner/aligners/global_dynamic_programming_heap_aligner.h"
+#include "offbynull/aligner/aligners/local_dynamic_programming_heap_aligner.h"
+#include "offbynull/aligner/scorers/simple_scorer.h"
+#include "offbynull/utils.h"
+#include "gtest/gtest.h"
+
+namespace {
+    using offbynull::aligner::aligners::align_many::align_many;
+    using offbynull::aligner::aligners::align_many::align_many_with_workers;
+    using offbynull::aligner::aligners::align_many::result_order;
+    using offbynull::aligner::aligners::global_dynamic_programming_heap_aligner::global_dynamic_programming_heap_aligner;
+    using offbynull::aligner::aligners::local_dynamic_programming_heap_aligner::local_dynamic_programming_heap_aligner;
+    using offbynull::aligner::scorers::simple_scorer::simple_scorer;
+    using offbynull::utils::copy_to_vector;
+    using offbynull::utils::is_debug_mode;
+
+    std::vector<std::pair<std::string, std::string>> random_pairs(std::size_t cnt) {
+        std::mt19937_64 rand { 12345 };
+        auto random_string {
+            [&]() {
+                std::string ret {};
+                for ([[maybe_unused]] auto _ : std::views::iota(0zu, std::uniform_int_distribution<std::size_t>(0zu, 20zu)(rand))) {
+                    ret += std::uniform_int_distribution<char>('a', 'd')(rand);
+                }
+                return ret;
+            }
+        };
+        std::vector<std::pair<std::string, std::string>> ret {};
+        for ([[maybe_unused]] auto _ : std::views::iota(0zu, cnt)) {
+            ret.emplace_back(random_string(), random_string());
+        }
+        return ret;
+    }
+
+    TEST(OAAAlignManyTest, InputOrderMatchesSingleAlignments) {
+        auto substitution_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, int>::create_substitution(1, -1) };
+        auto gap_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, int>::create_gap(-1) };
+        const auto pairs { random_pairs(300zu) };
+
+        global_dynamic_programming_heap_aligner<is_debug_mode()> aligner {};
+        std::size_t expected_idx { 0zu };
+        align_many<is_debug_mode(), global_dynamic_programming_heap_aligner<is_debug_mode()>>(
+            pairs,
+            [&](std::size_t idx, auto&& result) {
+                EXPECT_EQ(idx, expected_idx);
+                ++expected_idx;
+                const auto& [down, right] { pairs[idx] };
+                const auto& [expected_alignment, expected_score] { aligner.align(down, right, substitution_scorer, gap_scorer) };
+                const auto& [alignment, score] { result };
+                EXPECT_EQ(copy_to_vector(alignment), copy_to_vector(expected_alignment));
+                EXPECT_EQ(score, expected_score);
+            },
+            4zu,
+            result_order::INPUT,
+            substitution_scorer,
+            gap_scorer
+        );
+        EXPECT_EQ(expected_idx, pairs.size());
+    }
+
+    TEST(OAAAlignManyTest, CompletionOrderDeliversEachPairOnce) {
+        auto substitution_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, int>::create_substitution(1, -1) };
+        auto gap_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, int>::create_gap(-1) };
+        auto freeride_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, int>::create_freeride() };
+        const auto pairs { random_pairs(300zu) };
+
+        local_dynamic_programming_heap_aligner<is_debug_mode()> aligner {};
+        std::vector<std::size_t> delivered_cnts(pairs.size());
+        align_many<is_debug_mode(), local_dynamic_programming_heap_aligner<is_debug_mode()>>(
+            pairs,
+            [&](std::size_t idx, auto&& result) {
+                ++delivered_cnts[idx];
+                const auto& [down, right] { pairs[idx] };
+                const auto& [expected_alignment, expected_score] {
+                    aligner.align(down, right, substitution_scorer, gap_scorer, freeride_scorer)
+                };
+                EXPECT_EQ(std::get<1>(result), expected_score);
+            },
+            3zu,
+            result_order::COMPLETION,
+            substitution_scorer,
+            gap_scorer,
+            freeride_scorer
+        );
+        for (std::size_t delivered_cnt : delivered_cnts) {
+            EXPECT_EQ(delivered_cnt, 1zu);
+        }
+    }
+
+    TEST(OAAAlignManyTest, CustomWorkersAndExceptionPropagation) {
+        const auto pairs { random_pairs(100zu) };
+
+        std::vector<std::size_t> results(pairs.size());
+        align_many_with_workers<is_debug_mode()>(
+            pairs,
+            [&](std::size_t idx, std::size_t result) { results[idx] = result; },
+            4zu,
+            result_order::INPUT,
+            []() {
+                return [](const std::string& down, const std::string& right) {
+                    return down.size() + right.size();
+                };
+            }
+        );
+        for (std::size_t i { 0zu }; i < pairs.size(); ++i) {
+            EXPECT_EQ(results[i], pairs[i].first.size() + pairs[i].second.size());
+        }
+
+        EXPECT_THROW(
+            (
+                align_many_with_workers<is_debug_mode()>(
+                    pairs,
+                    [&](std::size_t, std::size_t) {},
+                    4zu,
+                    result_order::COMPLETION,
+                    [&]() {
+                        return [&](const std::string& down, const std::string&) {
+                            if (&down == &pairs[42zu].first) {
+                                throw std::runtime_error { "failure" };
+                            }
+                            return 0zu;
+                        };
+                    }
+                )
+            ),
+            std::runtime_error
+        );
+    }
+}
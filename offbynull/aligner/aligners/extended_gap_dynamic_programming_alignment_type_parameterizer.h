@@ -6,10 +6,12 @@
 #include <limits>
 #include "offbynull/concepts.h"
 #include "offbynull/utils.h"
+#include "offbynull/aligner/aligners/internal_utils.h"
 
 namespace offbynull::aligner::aligners::extended_gap_dynamic_programming_alignment_type_parameterizer {
     using offbynull::concepts::widenable_to_size_t;
     using offbynull::utils::narrowest_type_for_indexing;
+    using offbynull::aligner::aligners::internal_utils::saturating_multiply;
 
     /**
      * Parameters for dynamic programming extended gap alignment.
@@ -35,7 +37,9 @@ namespace offbynull::aligner::aligners::extended_gap_dynamic_programming_alignme
         using PARENT_COUNT = typename narrowest_type_for_indexing<max_parents>::type;
 
     private:
-        static constexpr std::size_t max_slots { max_index * max_index * 3zu };  // down * right * depth
+        static constexpr std::size_t max_slots {
+            saturating_multiply(saturating_multiply(max_index, max_index), 3zu)  // down * right * depth
+        };
 
     public:
         /**
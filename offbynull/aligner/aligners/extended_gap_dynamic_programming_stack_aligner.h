@@ -10,6 +10,7 @@
 #include "offbynull/aligner/sequence/sequence.h"
 #include "offbynull/aligner/scorer/scorer.h"
 #include "offbynull/aligner/scorers/widening_scorer.h"
+#include "offbynull/aligner/scorers/transposing_scorer.h"
 #include "offbynull/aligner/graphs/pairwise_extended_gap_alignment_graph.h"
 #include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/backtracker.h"
 #include "offbynull/aligner/aligners/extended_gap_dynamic_programming_alignment_type_parameterizer.h"
@@ -27,6 +28,7 @@ namespace offbynull::aligner::aligners::extended_gap_dynamic_programming_stack_a
     using offbynull::aligner::scorer::scorer::scorer;
     using offbynull::aligner::scorer::scorer::scorer_without_explicit_weight_or_seq_index;
     using offbynull::aligner::scorers::widening_scorer::widening_scorer;
+    using offbynull::aligner::scorers::transposing_scorer::transposing_scorer;
     using offbynull::aligner::concepts::weight;
     using offbynull::aligner::graphs::pairwise_extended_gap_alignment_graph::pairwise_extended_gap_alignment_graph;
     using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtracker_stack_container_creator_pack
@@ -36,6 +38,7 @@ namespace offbynull::aligner::aligners::extended_gap_dynamic_programming_stack_a
     ::extended_gap_dynamic_programming_alignment_type_parameterizer;
     using offbynull::aligner::aligners::concepts::alignment_result;
     using offbynull::aligner::aligners::internal_utils::validate_align_and_extract_widest_weight;
+    using offbynull::aligner::aligners::internal_utils::stack_find_max_path_weight;
 
     /**
      * Extended gap pairwise aligner using dynamic programming algorithm (see
@@ -258,6 +261,277 @@ namespace offbynull::aligner::aligners::extended_gap_dynamic_programming_stack_a
                 path_weight
             );
         }
+
+        /**
+         * Score two sequences without aligning them. The alignment graph is walked one row at a time (see
+         * @ref offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::forward_walker::forward_walker::forward_walker),
+         * meaning that only the rows being walked are held in memory rather than the entire graph.
+         *
+         * If `max_down_seq_size` is less than `max_right_seq_size`, the graph is transposed such that its rows span the shorter
+         * sequence.
+         *
+         * @tparam max_down_seq_size Maximum allowed length for downward sequence.
+         * @tparam max_right_seq_size Maximum allowed length for rightward sequence.
+         * @tparam N_INDEX Alignment graph node coordinate type (must be wide enough to hold `std::max(down.size(), right.size()) + 1zu`).
+         * @param down Sequence 1.
+         * @param right Sequence 2.
+         * @param substitution_scorer Match/mismatch (substitution) scorer.
+         * @param initial_gap_scorer Initial gap (indel) scorer.
+         * @param extended_gap_scorer Extended gap (indel) scorer.
+         * @param freeride_scorer Freeride scorer.
+         * @return Score of the extended gap alignment of `down` vs `right`.
+         */
+        template<
+            std::size_t max_down_seq_size,
+            std::size_t max_right_seq_size,
+            widenable_to_size_t N_INDEX = std::size_t
+        >
+        auto score_only(
+            const sequence auto& down,
+            const sequence auto& right,
+            const scorer_without_explicit_weight_or_seq_index<
+                std::remove_cvref_t<decltype(down[0])>,
+                std::remove_cvref_t<decltype(right[0])>
+            > auto& substitution_scorer,
+            const scorer_without_explicit_weight_or_seq_index<
+                std::remove_cvref_t<decltype(down[0])>,
+                std::remove_cvref_t<decltype(right[0])>
+            > auto& initial_gap_scorer,
+            const scorer_without_explicit_weight_or_seq_index<
+                std::remove_cvref_t<decltype(down[0])>,
+                std::remove_cvref_t<decltype(right[0])>
+            > auto& extended_gap_scorer,
+            const scorer_without_explicit_weight_or_seq_index<
+                std::remove_cvref_t<decltype(down[0])>,
+                std::remove_cvref_t<decltype(right[0])>
+            > auto& freeride_scorer
+        ) {
+            auto widest_weight_type_tagger {
+                validate_align_and_extract_widest_weight<
+                    debug_mode,
+                    N_INDEX,
+                    std::remove_cvref_t<decltype(substitution_scorer)>,
+                    std::remove_cvref_t<decltype(initial_gap_scorer)>,
+                    std::remove_cvref_t<decltype(extended_gap_scorer)>,
+                    std::remove_cvref_t<decltype(freeride_scorer)>
+                >(down, right)
+            };
+            using WEIGHT = typename decltype(widest_weight_type_tagger)::type;
+
+            // Wrap scorers into ones that'll cast from N_INDEX to the scorer's SEQ_INDEX (widens, doesn't narrow). Likewise, the
+            // wrapped scorer's result will be cast to WEIGHT type derived above (widens). This is to make it easier for the user
+            // (e.g., they submit scorers with mismatching N_INDEX / WEIGHT).
+            using DOWN_ELEM = std::remove_cvref_t<decltype(down[0])>;
+            using RIGHT_ELEM = std::remove_cvref_t<decltype(right[0])>;
+            const widening_scorer<
+                debug_mode,
+                N_INDEX,
+                DOWN_ELEM,
+                RIGHT_ELEM,
+                WEIGHT,
+                std::remove_cvref_t<decltype(substitution_scorer)>
+            > widened_substitution_scorer {
+                substitution_scorer
+            };
+            const widening_scorer<
+                debug_mode,
+                N_INDEX,
+                DOWN_ELEM,
+                RIGHT_ELEM,
+                WEIGHT,
+                std::remove_cvref_t<decltype(initial_gap_scorer)>
+            > widened_initial_gap_scorer {
+                initial_gap_scorer
+            };
+            const widening_scorer<
+                debug_mode,
+                N_INDEX,
+                DOWN_ELEM,
+                RIGHT_ELEM,
+                WEIGHT,
+                std::remove_cvref_t<decltype(extended_gap_scorer)>
+            > widened_extended_gap_scorer {
+                extended_gap_scorer
+            };
+            const widening_scorer<
+                debug_mode,
+                N_INDEX,
+                DOWN_ELEM,
+                RIGHT_ELEM,
+                WEIGHT,
+                std::remove_cvref_t<decltype(freeride_scorer)>
+            > widened_freeride_scorer {
+                freeride_scorer
+            };
+
+            return score_only_strict<N_INDEX, WEIGHT, max_down_seq_size, max_right_seq_size>(
+                down,
+                right,
+                widened_substitution_scorer,
+                widened_initial_gap_scorer,
+                widened_extended_gap_scorer,
+                widened_freeride_scorer
+            );
+        }
+
+        /**
+         * Score two sequences without aligning them. The alignment graph is walked one row at a time (see
+         * @ref offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::forward_walker::forward_walker::forward_walker),
+         * meaning that only the rows being walked are held in memory rather than the entire graph.
+         *
+         * If `max_down_seq_size` is less than `max_right_seq_size`, the graph is transposed such that its rows span the shorter
+         * sequence.
+         *
+         * @tparam max_down_seq_size Maximum allowed length for downward sequence.
+         * @tparam max_right_seq_size Maximum allowed length for rightward sequence.
+         * @tparam WEIGHT Alignment graph edge weight type.
+         * @tparam N_INDEX Alignment graph node coordinate type (must be wide enough to hold `std::max(down.size(), right.size()) + 1zu`).
+         * @param down Sequence 1.
+         * @param right Sequence 2.
+         * @param substitution_scorer Match/mismatch (substitution) scorer.
+         * @param initial_gap_scorer Initial gap (indel) scorer.
+         * @param extended_gap_scorer Extended gap (indel) scorer.
+         * @param freeride_scorer Freeride scorer.
+         * @return Score of the extended gap alignment of `down` vs `right`.
+         */
+        template<
+            widenable_to_size_t N_INDEX,
+            weight WEIGHT,
+            std::size_t max_down_seq_size,
+            std::size_t max_right_seq_size
+        >
+        WEIGHT score_only_strict(
+            const sequence auto& down,
+            const sequence auto& right,
+            const scorer<
+                N_INDEX,
+                std::remove_cvref_t<decltype(down[0])>,
+                std::remove_cvref_t<decltype(right[0])>,
+                WEIGHT
+            > auto& substitution_scorer,
+            const scorer<
+                N_INDEX,
+                std::remove_cvref_t<decltype(down[0])>,
+                std::remove_cvref_t<decltype(right[0])>,
+                WEIGHT
+            > auto& initial_gap_scorer,
+            const scorer<
+                N_INDEX,
+                std::remove_cvref_t<decltype(down[0])>,
+                std::remove_cvref_t<decltype(right[0])>,
+                WEIGHT
+            > auto& extended_gap_scorer,
+            const scorer<
+                N_INDEX,
+                std::remove_cvref_t<decltype(down[0])>,
+                std::remove_cvref_t<decltype(right[0])>,
+                WEIGHT
+            > auto& freeride_scorer
+        ) {
+            if constexpr (debug_mode) {
+                if (down.size() > max_down_seq_size || right.size() > max_right_seq_size) {
+                    throw std::runtime_error { "Sequence length larger than expected (for stack allocation)" };
+                }
+            }
+            if constexpr (max_down_seq_size < max_right_seq_size) {
+                using DOWN_ELEM = std::remove_cvref_t<decltype(down[0])>;
+                using RIGHT_ELEM = std::remove_cvref_t<decltype(right[0])>;
+                const transposing_scorer<
+                    debug_mode,
+                    N_INDEX,
+                    DOWN_ELEM,
+                    RIGHT_ELEM,
+                    WEIGHT,
+                    std::remove_cvref_t<decltype(substitution_scorer)>
+                > transposed_substitution_scorer {
+                    substitution_scorer
+                };
+                const transposing_scorer<
+                    debug_mode,
+                    N_INDEX,
+                    DOWN_ELEM,
+                    RIGHT_ELEM,
+                    WEIGHT,
+                    std::remove_cvref_t<decltype(initial_gap_scorer)>
+                > transposed_initial_gap_scorer {
+                    initial_gap_scorer
+                };
+                const transposing_scorer<
+                    debug_mode,
+                    N_INDEX,
+                    DOWN_ELEM,
+                    RIGHT_ELEM,
+                    WEIGHT,
+                    std::remove_cvref_t<decltype(extended_gap_scorer)>
+                > transposed_extended_gap_scorer {
+                    extended_gap_scorer
+                };
+                const transposing_scorer<
+                    debug_mode,
+                    N_INDEX,
+                    DOWN_ELEM,
+                    RIGHT_ELEM,
+                    WEIGHT,
+                    std::remove_cvref_t<decltype(freeride_scorer)>
+                > transposed_freeride_scorer {
+                    freeride_scorer
+                };
+                return find_max_path_weight<N_INDEX, WEIGHT, max_down_seq_size>(
+                    right,
+                    down,
+                    transposed_substitution_scorer,
+                    transposed_initial_gap_scorer,
+                    transposed_extended_gap_scorer,
+                    transposed_freeride_scorer
+                );
+            } else {
+                return find_max_path_weight<N_INDEX, WEIGHT, max_right_seq_size>(
+                    down,
+                    right,
+                    substitution_scorer,
+                    initial_gap_scorer,
+                    extended_gap_scorer,
+                    freeride_scorer
+                );
+            }
+        }
+
+    private:
+
+        template<
+            widenable_to_size_t N_INDEX,
+            weight WEIGHT,
+            std::size_t max_right_seq_size
+        >
+        WEIGHT find_max_path_weight(
+            const sequence auto& down,
+            const sequence auto& right,
+            const auto& substitution_scorer,
+            const auto& initial_gap_scorer,
+            const auto& extended_gap_scorer,
+            const auto& freeride_scorer
+        ) {
+            using G = pairwise_extended_gap_alignment_graph<
+                debug_mode,
+                N_INDEX,
+                WEIGHT,
+                std::remove_cvref_t<decltype(down)>,
+                std::remove_cvref_t<decltype(right)>,
+                std::remove_cvref_t<decltype(substitution_scorer)>,
+                std::remove_cvref_t<decltype(initial_gap_scorer)>,
+                std::remove_cvref_t<decltype(extended_gap_scorer)>,
+                std::remove_cvref_t<decltype(freeride_scorer)>
+            >;
+            G graph {
+                down,
+                right,
+                substitution_scorer,
+                initial_gap_scorer,
+                extended_gap_scorer,
+                freeride_scorer
+            };
+            return stack_find_max_path_weight<debug_mode, max_right_seq_size>(graph);
+        }
     };
 
 }
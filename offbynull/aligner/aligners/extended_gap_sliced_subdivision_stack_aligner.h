@@ -10,9 +10,11 @@
 #include "offbynull/aligner/sequence/sequence.h"
 #include "offbynull/aligner/scorer/scorer.h"
 #include "offbynull/aligner/scorers/widening_scorer.h"
+#include "offbynull/aligner/scorers/transposing_scorer.h"
 #include "offbynull/aligner/graphs/pairwise_extended_gap_alignment_graph.h"
 #include "offbynull/aligner/backtrackers/sliceable_pairwise_alignment_graph_backtracker/backtracker.h"
 #include "offbynull/concepts.h"
+#include "offbynull/helpers/forkable_thread_pool.h"
 #include "offbynull/utils.h"
 #include "offbynull/aligner/aligners/concepts.h"
 #include "offbynull/aligner/aligners/internal_utils.h"
@@ -26,13 +28,16 @@ namespace offbynull::aligner::aligners::extended_gap_sliced_subdivision_stack_al
     using offbynull::aligner::scorer::scorer::scorer;
     using offbynull::aligner::scorer::scorer::scorer_without_explicit_weight_or_seq_index;
     using offbynull::aligner::scorers::widening_scorer::widening_scorer;
+    using offbynull::aligner::scorers::transposing_scorer::transposing_scorer;
     using offbynull::aligner::concepts::weight;
     using offbynull::aligner::graphs::pairwise_extended_gap_alignment_graph::pairwise_extended_gap_alignment_graph;
     using offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::backtracker_stack_container_creator_pack
         ::backtracker_stack_container_creator_pack;
     using offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::backtracker::backtracker;
+    using offbynull::helpers::forkable_thread_pool::forkable_thread_pool;
     using offbynull::aligner::aligners::concepts::alignment_result;
     using offbynull::aligner::aligners::internal_utils::validate_align_and_extract_widest_weight;
+    using offbynull::aligner::aligners::internal_utils::stack_find_max_path_weight;
 
     /**
      * Extended gap pairwise aligner using sliced subdivision algorithm (see
@@ -42,7 +47,36 @@ namespace offbynull::aligner::aligners::extended_gap_sliced_subdivision_stack_al
      */
     template<bool debug_mode>
     class extended_gap_sliced_subdivision_stack_aligner {
+    private:
+        /**
+         * Thread pool that sliced subdivision runs on, or `nullptr` to run it on the thread calling `align()`.
+         */
+        forkable_thread_pool<debug_mode, void>* thread_pool;
+
+        /**
+         * Node count below which a segment is subdivided on the thread calling `align()` rather than being queued onto `thread_pool`.
+         */
+        std::size_t serial_node_cnt;
+
     public:
+        /**
+         * Construct an
+         * @ref offbynull::aligner::aligners::extended_gap_sliced_subdivision_stack_aligner::extended_gap_sliced_subdivision_stack_aligner
+         * instance.
+         *
+         * @param thread_pool_ Thread pool to run sliced subdivision on (see
+         *     @ref offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::backtracker::backtracker::find_max_path),
+         *     or `nullptr` to run it on the thread calling `align()`. If set, the thread pool must not be closed while `align()` runs and
+         *     `align()` must not be called from one of the thread pool's threads.
+         * @param serial_node_cnt_ Node count below which a segment is subdivided on the thread calling `align()` rather than being queued
+         *     onto `thread_pool_`.
+         */
+        extended_gap_sliced_subdivision_stack_aligner(
+            forkable_thread_pool<debug_mode, void>* thread_pool_ = nullptr,
+            std::size_t serial_node_cnt_ = 65536zu
+        )
+        : thread_pool { thread_pool_ }
+        , serial_node_cnt { serial_node_cnt_ } {}
 
         /**
          * Align two sequences.
@@ -253,7 +287,9 @@ namespace offbynull::aligner::aligners::extended_gap_sliced_subdivision_stack_al
                 CONTAINER_CREATOR_PACK
             > backtracker_ {};
             auto&& [path, path_weight] {  // Use auto&& vs const auto&, otherwise move() below fails
-                backtracker_.find_max_path(graph, max_path_weight_comparison_tolerance)
+                thread_pool == nullptr
+                    ? backtracker_.find_max_path(graph, max_path_weight_comparison_tolerance)
+                    : backtracker_.find_max_path(graph, *thread_pool, max_path_weight_comparison_tolerance, serial_node_cnt)
             };
             return std::make_pair(
                 std::move(path)  // move() needed to ensure that transform operation below owns path
@@ -265,6 +301,277 @@ namespace offbynull::aligner::aligners::extended_gap_sliced_subdivision_stack_al
                 path_weight
             );
         }
+
+        /**
+         * Score two sequences without aligning them. The alignment graph is walked one row at a time (see
+         * @ref offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::forward_walker::forward_walker::forward_walker),
+         * meaning that only the rows being walked are held in memory rather than the entire graph.
+         *
+         * If `max_down_seq_size` is less than `max_right_seq_size`, the graph is transposed such that its rows span the shorter
+         * sequence.
+         *
+         * @tparam max_down_seq_size Maximum allowed length for downward sequence.
+         * @tparam max_right_seq_size Maximum allowed length for rightward sequence.
+         * @tparam N_INDEX Alignment graph node coordinate type (must be wide enough to hold `std::max(down.size(), right.size()) + 1zu`).
+         * @param down Sequence 1.
+         * @param right Sequence 2.
+         * @param substitution_scorer Match/mismatch (substitution) scorer.
+         * @param initial_gap_scorer Initial gap (indel) scorer.
+         * @param extended_gap_scorer Extended gap (indel) scorer.
+         * @param freeride_scorer Freeride scorer.
+         * @return Score of the extended gap alignment of `down` vs `right`.
+         */
+        template<
+            std::size_t max_down_seq_size,
+            std::size_t max_right_seq_size,
+            widenable_to_size_t N_INDEX = std::size_t
+        >
+        auto score_only(
+            const sequence auto& down,
+            const sequence auto& right,
+            const scorer_without_explicit_weight_or_seq_index<
+                std::remove_cvref_t<decltype(down[0])>,
+                std::remove_cvref_t<decltype(right[0])>
+            > auto& substitution_scorer,
+            const scorer_without_explicit_weight_or_seq_index<
+                std::remove_cvref_t<decltype(down[0])>,
+                std::remove_cvref_t<decltype(right[0])>
+            > auto& initial_gap_scorer,
+            const scorer_without_explicit_weight_or_seq_index<
+                std::remove_cvref_t<decltype(down[0])>,
+                std::remove_cvref_t<decltype(right[0])>
+            > auto& extended_gap_scorer,
+            const scorer_without_explicit_weight_or_seq_index<
+                std::remove_cvref_t<decltype(down[0])>,
+                std::remove_cvref_t<decltype(right[0])>
+            > auto& freeride_scorer
+        ) {
+            auto widest_weight_type_tagger {
+                validate_align_and_extract_widest_weight<
+                    debug_mode,
+                    N_INDEX,
+                    std::remove_cvref_t<decltype(substitution_scorer)>,
+                    std::remove_cvref_t<decltype(initial_gap_scorer)>,
+                    std::remove_cvref_t<decltype(extended_gap_scorer)>,
+                    std::remove_cvref_t<decltype(freeride_scorer)>
+                >(down, right)
+            };
+            using WEIGHT = typename decltype(widest_weight_type_tagger)::type;
+
+            // Wrap scorers into ones that'll cast from N_INDEX to the scorer's SEQ_INDEX (widens, doesn't narrow). Likewise, the
+            // wrapped scorer's result will be cast to WEIGHT type derived above (widens). This is to make it easier for the user
+            // (e.g., they submit scorers with mismatching N_INDEX / WEIGHT).
+            using DOWN_ELEM = std::remove_cvref_t<decltype(down[0])>;
+            using RIGHT_ELEM = std::remove_cvref_t<decltype(right[0])>;
+            const widening_scorer<
+                debug_mode,
+                N_INDEX,
+                DOWN_ELEM,
+                RIGHT_ELEM,
+                WEIGHT,
+                std::remove_cvref_t<decltype(substitution_scorer)>
+            > widened_substitution_scorer {
+                substitution_scorer
+            };
+            const widening_scorer<
+                debug_mode,
+                N_INDEX,
+                DOWN_ELEM,
+                RIGHT_ELEM,
+                WEIGHT,
+                std::remove_cvref_t<decltype(initial_gap_scorer)>
+            > widened_initial_gap_scorer {
+                initial_gap_scorer
+            };
+            const widening_scorer<
+                debug_mode,
+                N_INDEX,
+                DOWN_ELEM,
+                RIGHT_ELEM,
+                WEIGHT,
+                std::remove_cvref_t<decltype(extended_gap_scorer)>
+            > widened_extended_gap_scorer {
+                extended_gap_scorer
+            };
+            const widening_scorer<
+                debug_mode,
+                N_INDEX,
+                DOWN_ELEM,
+                RIGHT_ELEM,
+                WEIGHT,
+                std::remove_cvref_t<decltype(freeride_scorer)>
+            > widened_freeride_scorer {
+                freeride_scorer
+            };
+
+            return score_only_strict<N_INDEX, WEIGHT, max_down_seq_size, max_right_seq_size>(
+                down,
+                right,
+                widened_substitution_scorer,
+                widened_initial_gap_scorer,
+                widened_extended_gap_scorer,
+                widened_freeride_scorer
+            );
+        }
+
+        /**
+         * Score two sequences without aligning them. The alignment graph is walked one row at a time (see
+         * @ref offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::forward_walker::forward_walker::forward_walker),
+         * meaning that only the rows being walked are held in memory rather than the entire graph.
+         *
+         * If `max_down_seq_size` is less than `max_right_seq_size`, the graph is transposed such that its rows span the shorter
+         * sequence.
+         *
+         * @tparam max_down_seq_size Maximum allowed length for downward sequence.
+         * @tparam max_right_seq_size Maximum allowed length for rightward sequence.
+         * @tparam WEIGHT Alignment graph edge weight type.
+         * @tparam N_INDEX Alignment graph node coordinate type (must be wide enough to hold `std::max(down.size(), right.size()) + 1zu`).
+         * @param down Sequence 1.
+         * @param right Sequence 2.
+         * @param substitution_scorer Match/mismatch (substitution) scorer.
+         * @param initial_gap_scorer Initial gap (indel) scorer.
+         * @param extended_gap_scorer Extended gap (indel) scorer.
+         * @param freeride_scorer Freeride scorer.
+         * @return Score of the extended gap alignment of `down` vs `right`.
+         */
+        template<
+            widenable_to_size_t N_INDEX,
+            weight WEIGHT,
+            std::size_t max_down_seq_size,
+            std::size_t max_right_seq_size
+        >
+        WEIGHT score_only_strict(
+            const sequence auto& down,
+            const sequence auto& right,
+            const scorer<
+                N_INDEX,
+                std::remove_cvref_t<decltype(down[0])>,
+                std::remove_cvref_t<decltype(right[0])>,
+                WEIGHT
+            > auto& substitution_scorer,
+            const scorer<
+                N_INDEX,
+                std::remove_cvref_t<decltype(down[0])>,
+                std::remove_cvref_t<decltype(right[0])>,
+                WEIGHT
+            > auto& initial_gap_scorer,
+            const scorer<
+                N_INDEX,
+                std::remove_cvref_t<decltype(down[0])>,
+                std::remove_cvref_t<decltype(right[0])>,
+                WEIGHT
+            > auto& extended_gap_scorer,
+            const scorer<
+                N_INDEX,
+                std::remove_cvref_t<decltype(down[0])>,
+                std::remove_cvref_t<decltype(right[0])>,
+                WEIGHT
+            > auto& freeride_scorer
+        ) {
+            if constexpr (debug_mode) {
+                if (down.size() > max_down_seq_size || right.size() > max_right_seq_size) {
+                    throw std::runtime_error { "Sequence length larger than expected (for stack allocation)" };
+                }
+            }
+            if constexpr (max_down_seq_size < max_right_seq_size) {
+                using DOWN_ELEM = std::remove_cvref_t<decltype(down[0])>;
+                using RIGHT_ELEM = std::remove_cvref_t<decltype(right[0])>;
+                const transposing_scorer<
+                    debug_mode,
+                    N_INDEX,
+                    DOWN_ELEM,
+                    RIGHT_ELEM,
+                    WEIGHT,
+                    std::remove_cvref_t<decltype(substitution_scorer)>
+                > transposed_substitution_scorer {
+                    substitution_scorer
+                };
+                const transposing_scorer<
+                    debug_mode,
+                    N_INDEX,
+                    DOWN_ELEM,
+                    RIGHT_ELEM,
+                    WEIGHT,
+                    std::remove_cvref_t<decltype(initial_gap_scorer)>
+                > transposed_initial_gap_scorer {
+                    initial_gap_scorer
+                };
+                const transposing_scorer<
+                    debug_mode,
+                    N_INDEX,
+                    DOWN_ELEM,
+                    RIGHT_ELEM,
+                    WEIGHT,
+                    std::remove_cvref_t<decltype(extended_gap_scorer)>
+                > transposed_extended_gap_scorer {
+                    extended_gap_scorer
+                };
+                const transposing_scorer<
+                    debug_mode,
+                    N_INDEX,
+                    DOWN_ELEM,
+                    RIGHT_ELEM,
+                    WEIGHT,
+                    std::remove_cvref_t<decltype(freeride_scorer)>
+                > transposed_freeride_scorer {
+                    freeride_scorer
+                };
+                return find_max_path_weight<N_INDEX, WEIGHT, max_down_seq_size>(
+                    right,
+                    down,
+                    transposed_substitution_scorer,
+                    transposed_initial_gap_scorer,
+                    transposed_extended_gap_scorer,
+                    transposed_freeride_scorer
+                );
+            } else {
+                return find_max_path_weight<N_INDEX, WEIGHT, max_right_seq_size>(
+                    down,
+                    right,
+                    substitution_scorer,
+                    initial_gap_scorer,
+                    extended_gap_scorer,
+                    freeride_scorer
+                );
+            }
+        }
+
+    private:
+
+        template<
+            widenable_to_size_t N_INDEX,
+            weight WEIGHT,
+            std::size_t max_right_seq_size
+        >
+        WEIGHT find_max_path_weight(
+            const sequence auto& down,
+            const sequence auto& right,
+            const auto& substitution_scorer,
+            const auto& initial_gap_scorer,
+            const auto& extended_gap_scorer,
+            const auto& freeride_scorer
+        ) {
+            using G = pairwise_extended_gap_alignment_graph<
+                debug_mode,
+                N_INDEX,
+                WEIGHT,
+                std::remove_cvref_t<decltype(down)>,
+                std::remove_cvref_t<decltype(right)>,
+                std::remove_cvref_t<decltype(substitution_scorer)>,
+                std::remove_cvref_t<decltype(initial_gap_scorer)>,
+                std::remove_cvref_t<decltype(extended_gap_scorer)>,
+                std::remove_cvref_t<decltype(freeride_scorer)>
+            >;
+            G graph {
+                down,
+                right,
+                substitution_scorer,
+                initial_gap_scorer,
+                extended_gap_scorer,
+                freeride_scorer
+            };
+            return stack_find_max_path_weight<debug_mode, max_right_seq_size>(graph);
+        }
     };
 
 }
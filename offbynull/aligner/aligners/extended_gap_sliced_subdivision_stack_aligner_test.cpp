@@ -85,4 +85,28 @@ namespace {
         // EXPECT_EQ(-15, (align_.operator()<std::size_t, std::float32_t>()));
         EXPECT_EQ(-15, (align_.operator()<std::size_t, std::float64_t>()));
     }
+
+    TEST(OAAExtendedGapSlicedSubdivisionStackAlignerTest, ScoreOnlyTest) {
+        extended_gap_sliced_subdivision_stack_aligner<is_debug_mode()> aligner {};
+        auto substitution_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, int>::create_substitution(10, -10) };
+        auto initial_gap_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, int>::create_gap(-10) };
+        auto extended_gap_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, int>::create_gap(-1) };
+        auto freeride_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, int>::create_freeride() };
+        std::string down { "TGGCGG" };
+        std::string right { "TCCCCCAGG" };
+        const auto& score1 {
+            aligner.score_only<6zu, 9zu>(down, right, substitution_scorer, initial_gap_scorer, extended_gap_scorer, freeride_scorer)
+        };
+        const auto& score2 {
+            aligner.score_only<9zu, 6zu>(right, down, substitution_scorer, initial_gap_scorer, extended_gap_scorer, freeride_scorer)
+        };
+        const auto& [alignment1, expected_score1] {
+            aligner.align<6zu, 9zu>(down, right, substitution_scorer, initial_gap_scorer, extended_gap_scorer, freeride_scorer, 0)
+        };
+        const auto& [alignment2, expected_score2] {
+            aligner.align<9zu, 6zu>(right, down, substitution_scorer, initial_gap_scorer, extended_gap_scorer, freeride_scorer, 0)
+        };
+        EXPECT_EQ(expected_score1, score1);
+        EXPECT_EQ(expected_score2, score2);
+    }
 }
\ No newline at end of file
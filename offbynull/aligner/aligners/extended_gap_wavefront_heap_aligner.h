@@ -0,0 +1,243 @@
+#ifndef OFFBYNULL_ALIGNER_ALIGNERS_EXTENDED_GAP_WAVEFRONT_HEAP_ALIGNER_H
+#define OFFBYNULL_ALIGNER_ALIGNERS_EXTENDED_GAP_WAVEFRONT_HEAP_ALIGNER_H
+
+#include <utility>
+#include <type_traits>
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <stdexcept>
+#include <optional>
+#include <vector>
+#include "offbynull/aligner/sequence/sequence.h"
+#include "offbynull/aligner/backtrackers/wavefront_alignment_backtracker/backtracker.h"
+#include "offbynull/aligner/backtrackers/wavefront_alignment_backtracker/penalties.h"
+#include "offbynull/aligner/backtrackers/wavefront_alignment_backtracker/concepts.h"
+#include "offbynull/concepts.h"
+#include "offbynull/aligner/aligners/concepts.h"
+#include "offbynull/aligner/aligners/internal_utils.h"
+
+namespace offbynull::aligner::aligners::extended_gap_wavefront_heap_aligner {
+    using offbynull::concepts::widenable_to_size_t;
+    using offbynull::aligner::sequence::sequence::sequence;
+    using offbynull::aligner::backtrackers::wavefront_alignment_backtracker::backtracker::create_heap_backtracker;
+    using offbynull::aligner::backtrackers::wavefront_alignment_backtracker::penalties::scaled_penalties;
+    using offbynull::aligner::backtrackers::wavefront_alignment_backtracker::penalties::to_penalties;
+    using offbynull::aligner::backtrackers::wavefront_alignment_backtracker::concepts::wavefront_scorer;
+    using offbynull::aligner::aligners::concepts::alignment_result;
+    using offbynull::aligner::aligners::internal_utils::validate_align_and_extract_widest_weight;
+
+    /**
+     * Extended gap pairwise aligner using the wavefront alignment algorithm (see
+     * @ref offbynull::aligner::backtrackers::wavefront_alignment_backtracker::backtracker::backtracker) and heap allocation.
+     *
+     * Scorers must weigh steps only by whether elements match / are missing (e.g.,
+     * @ref offbynull::aligner::scorers::simple_scorer::simple_scorer), such that alignment weights can be turned into gap-affine
+     * penalties. Alignments and scores are the same as those of
+     * @ref offbynull::aligner::aligners::extended_gap_dynamic_programming_heap_aligner::extended_gap_dynamic_programming_heap_aligner
+     * (including the free ride step that follows each gap), but the work done scales with how different the sequences are rather than
+     * with the product of their lengths.
+     *
+     * @tparam debug_mode `true` to enable debugging logic, `false` otherwise.
+     */
+    template<bool debug_mode>
+    class extended_gap_wavefront_heap_aligner {
+    public:
+        /**
+         * Align two sequences, keeping every wavefront in memory.
+         *
+         * @tparam minimize_allocations `true` to force certain internal containers to reserve (preallocate) elements thereby
+         *     removing/reducing the need for adhoc reallocations, `false` otherwise.
+         * @tparam N_INDEX Sequence offset type (must be wide enough to hold `std::max(down.size(), right.size()) + 1zu`).
+         * @param down Sequence 1.
+         * @param right Sequence 2.
+         * @param substitution_scorer Match/mismatch (substitution) scorer.
+         * @param initial_gap_scorer Initial gap (indel) scorer.
+         * @param extended_gap_scorer Extended gap (indel) scorer.
+         * @param freeride_scorer Freeride scorer.
+         * @return Extended gap alignment of `down` vs `right` along with the score of that alignment.
+         * @throws std::runtime_error If the scorers' weights don't map to valid penalties (see
+         *     @ref offbynull::aligner::backtrackers::wavefront_alignment_backtracker::penalties::to_penalties).
+         */
+        template<
+            bool minimize_allocations = true,
+            widenable_to_size_t N_INDEX = std::size_t
+        >
+        alignment_result auto align(
+            const sequence auto& down,
+            const sequence auto& right,
+            const wavefront_scorer auto& substitution_scorer,
+            const wavefront_scorer auto& initial_gap_scorer,
+            const wavefront_scorer auto& extended_gap_scorer,
+            const wavefront_scorer auto& freeride_scorer
+        ) {
+            auto widest_weight_type_tagger {
+                validate_align_and_extract_widest_weight<
+                    debug_mode,
+                    N_INDEX,
+                    std::remove_cvref_t<decltype(substitution_scorer)>,
+                    std::remove_cvref_t<decltype(initial_gap_scorer)>,
+                    std::remove_cvref_t<decltype(extended_gap_scorer)>,
+                    std::remove_cvref_t<decltype(freeride_scorer)>
+                >(down, right)
+            };
+            using WEIGHT = typename decltype(widest_weight_type_tagger)::type;
+            const scaled_penalties scaled {
+                create_penalties(substitution_scorer, initial_gap_scorer, extended_gap_scorer, freeride_scorer)
+            };
+            const auto& [path, cost] {
+                create_heap_backtracker<debug_mode, N_INDEX, minimize_allocations>(scaled.costs).find_global_path(down, right)
+            };
+            return std::make_pair(
+                add_freerides<N_INDEX>(path),
+                static_cast<WEIGHT>(scaled.to_weight(down.size(), right.size(), cost))
+            );
+        }
+
+        /**
+         * Align two sequences, walking wavefronts from both ends such that only the most recent few are held in memory (BiWFA). Roughly
+         * twice the work of `align()`, but memory grows with the alignment's score rather than with its square.
+         *
+         * @tparam minimize_allocations `true` to force certain internal containers to reserve (preallocate) elements thereby
+         *     removing/reducing the need for adhoc reallocations, `false` otherwise.
+         * @tparam N_INDEX Sequence offset type (must be wide enough to hold `std::max(down.size(), right.size()) + 1zu`).
+         * @param down Sequence 1.
+         * @param right Sequence 2.
+         * @param substitution_scorer Match/mismatch (substitution) scorer.
+         * @param initial_gap_scorer Initial gap (indel) scorer.
+         * @param extended_gap_scorer Extended gap (indel) scorer.
+         * @param freeride_scorer Freeride scorer.
+         * @return Extended gap alignment of `down` vs `right` along with the score of that alignment.
+         * @throws std::runtime_error If the scorers' weights don't map to valid penalties (see
+         *     @ref offbynull::aligner::backtrackers::wavefront_alignment_backtracker::penalties::to_penalties).
+         */
+        template<
+            bool minimize_allocations = true,
+            widenable_to_size_t N_INDEX = std::size_t
+        >
+        alignment_result auto align_bidirectional(
+            const sequence auto& down,
+            const sequence auto& right,
+            const wavefront_scorer auto& substitution_scorer,
+            const wavefront_scorer auto& initial_gap_scorer,
+            const wavefront_scorer auto& extended_gap_scorer,
+            const wavefront_scorer auto& freeride_scorer
+        ) {
+            auto widest_weight_type_tagger {
+                validate_align_and_extract_widest_weight<
+                    debug_mode,
+                    N_INDEX,
+                    std::remove_cvref_t<decltype(substitution_scorer)>,
+                    std::remove_cvref_t<decltype(initial_gap_scorer)>,
+                    std::remove_cvref_t<decltype(extended_gap_scorer)>,
+                    std::remove_cvref_t<decltype(freeride_scorer)>
+                >(down, right)
+            };
+            using WEIGHT = typename decltype(widest_weight_type_tagger)::type;
+            const scaled_penalties scaled {
+                create_penalties(substitution_scorer, initial_gap_scorer, extended_gap_scorer, freeride_scorer)
+            };
+            const auto& [path, cost] {
+                create_heap_backtracker<debug_mode, N_INDEX, minimize_allocations>(scaled.costs).find_global_path_bidirectional(
+                    down,
+                    right
+                )
+            };
+            return std::make_pair(
+                add_freerides<N_INDEX>(path),
+                static_cast<WEIGHT>(scaled.to_weight(down.size(), right.size(), cost))
+            );
+        }
+
+        /**
+         * Score two sequences without aligning them. Only the wavefronts reachable by the largest penalty are held in memory.
+         *
+         * @tparam minimize_allocations `true` to force certain internal containers to reserve (preallocate) elements thereby
+         *     removing/reducing the need for adhoc reallocations, `false` otherwise.
+         * @tparam N_INDEX Sequence offset type (must be wide enough to hold `std::max(down.size(), right.size()) + 1zu`).
+         * @param down Sequence 1.
+         * @param right Sequence 2.
+         * @param substitution_scorer Match/mismatch (substitution) scorer.
+         * @param initial_gap_scorer Initial gap (indel) scorer.
+         * @param extended_gap_scorer Extended gap (indel) scorer.
+         * @param freeride_scorer Freeride scorer.
+         * @return Score of the extended gap alignment of `down` vs `right`.
+         * @throws std::runtime_error If the scorers' weights don't map to valid penalties (see
+         *     @ref offbynull::aligner::backtrackers::wavefront_alignment_backtracker::penalties::to_penalties).
+         */
+        template<
+            bool minimize_allocations = true,
+            widenable_to_size_t N_INDEX = std::size_t
+        >
+        auto score_only(
+            const sequence auto& down,
+            const sequence auto& right,
+            const wavefront_scorer auto& substitution_scorer,
+            const wavefront_scorer auto& initial_gap_scorer,
+            const wavefront_scorer auto& extended_gap_scorer,
+            const wavefront_scorer auto& freeride_scorer
+        ) {
+            auto widest_weight_type_tagger {
+                validate_align_and_extract_widest_weight<
+                    debug_mode,
+                    N_INDEX,
+                    std::remove_cvref_t<decltype(substitution_scorer)>,
+                    std::remove_cvref_t<decltype(initial_gap_scorer)>,
+                    std::remove_cvref_t<decltype(extended_gap_scorer)>,
+                    std::remove_cvref_t<decltype(freeride_scorer)>
+                >(down, right)
+            };
+            using WEIGHT = typename decltype(widest_weight_type_tagger)::type;
+            const scaled_penalties scaled {
+                create_penalties(substitution_scorer, initial_gap_scorer, extended_gap_scorer, freeride_scorer)
+            };
+            const std::int64_t cost {
+                create_heap_backtracker<debug_mode, N_INDEX, minimize_allocations>(scaled.costs).find_global_cost(down, right)
+            };
+            return static_cast<WEIGHT>(scaled.to_weight(down.size(), right.size(), cost));
+        }
+
+    private:
+        // A gap scorer's right missing weight is for steps consuming downward elements alone (down gaps), and vice versa.
+        static scaled_penalties create_penalties(
+            const wavefront_scorer auto& substitution_scorer,
+            const wavefront_scorer auto& initial_gap_scorer,
+            const wavefront_scorer auto& extended_gap_scorer,
+            const wavefront_scorer auto& freeride_scorer
+        ) {
+            return to_penalties(
+                static_cast<std::int64_t>(substitution_scorer.get_match_weight()),
+                static_cast<std::int64_t>(substitution_scorer.get_mismatch_weight()),
+                static_cast<std::int64_t>(initial_gap_scorer.get_right_missing_weight()),
+                static_cast<std::int64_t>(initial_gap_scorer.get_down_missing_weight()),
+                static_cast<std::int64_t>(extended_gap_scorer.get_right_missing_weight()),
+                static_cast<std::int64_t>(extended_gap_scorer.get_down_missing_weight()),
+                static_cast<std::int64_t>(freeride_scorer.get_both_missing_weight())
+            );
+        }
+
+        // The extended gap alignment graph leaves each gap through a free ride edge, which maps to an empty step. Add those in after each
+        // run of gap steps.
+        template<widenable_to_size_t N_INDEX>
+        static auto add_freerides(const auto& path) {
+            using ELEMENT_OFFSETS = std::optional<std::pair<std::optional<N_INDEX>, std::optional<N_INDEX>>>;
+            const auto gap_kind {
+                [](const ELEMENT_OFFSETS& step) {
+                    return !step->first.has_value() ? 1 : (!step->second.has_value() ? 2 : 0);
+                }
+            };
+            std::vector<ELEMENT_OFFSETS> ret {};
+            ret.reserve(path.size() * 2zu);
+            for (std::size_t i { 0zu }; i < path.size(); ++i) {
+                ret.push_back(path[i]);
+                const int kind { gap_kind(path[i]) };
+                if (kind != 0 && (i + 1zu == path.size() || gap_kind(path[i + 1zu]) != kind)) {
+                    ret.push_back(std::nullopt);
+                }
+            }
+            return ret;
+        }
+    };
+}
+
+#endif //OFFBYNULL_ALIGNER_ALIGNERS_EXTENDED_GAP_WAVEFRONT_HEAP_ALIGNER_H
@@ -0,0 +1,124 @@
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <ostream>
+#include <string>
+#include <random>
+#include <ranges>
+#include "offbynull/aligner/aligners/extended_gap_wavefront_heap_aligner.h"
+#include "offbynull/aligner/aligners/extended_gap_dynamic_programming_heap_aligner.h"
+#include "offbynull/aligner/scorers/simple_scorer.h"
+#include "offbynull/aligner/aligners/utils.h"
+#include "offbynull/aligner/aligners/concepts.h"
+#include "offbynull/utils.h"
+#include "gtest/gtest.h"
+
+namespace {
+    using offbynull::aligner::aligners::extended_gap_wavefront_heap_aligner::extended_gap_wavefront_heap_aligner;
+    using offbynull::aligner::aligners::extended_gap_dynamic_programming_heap_aligner::extended_gap_dynamic_programming_heap_aligner;
+    using offbynull::aligner::scorers::simple_scorer::simple_scorer;
+    using offbynull::aligner::aligners::utils::alignment_to_stacked_string;
+    using offbynull::utils::copy_to_vector;
+    using offbynull::utils::is_debug_mode;
+
+    TEST(OAAExtendedGapWavefrontHeapAlignerTest, SanityTest) {
+        extended_gap_wavefront_heap_aligner<is_debug_mode()> aligner {};
+        auto substitution_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, int>::create_substitution(10, -10) };
+        auto initial_gap_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, int>::create_gap(-10) };
+        auto extended_gap_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, int>::create_gap(-1) };
+        auto freeride_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, int>::create_freeride() };
+        std::string down { "TGGCGG" };
+        std::string right { "TCCCCC" };
+        const auto& [alignment, score] {
+            aligner.align(down, right, substitution_scorer, initial_gap_scorer, extended_gap_scorer, freeride_scorer)
+        };
+        EXPECT_EQ(-15, score);
+        std::cout << score << std::endl;
+        std::cout << alignment_to_stacked_string<is_debug_mode()>(down, right, alignment) << std::endl;
+        const auto& [bidi_alignment, bidi_score] {
+            aligner.align_bidirectional(down, right, substitution_scorer, initial_gap_scorer, extended_gap_scorer, freeride_scorer)
+        };
+        EXPECT_EQ(-15, bidi_score);
+        EXPECT_EQ(-15, aligner.score_only(down, right, substitution_scorer, initial_gap_scorer, extended_gap_scorer, freeride_scorer));
+    }
+
+    TEST(OAAExtendedGapWavefrontHeapAlignerTest, FreerideTest) {
+        extended_gap_wavefront_heap_aligner<is_debug_mode()> aligner {};
+        extended_gap_dynamic_programming_heap_aligner<is_debug_mode()> dp_aligner {};
+        auto substitution_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, int>::create_substitution(1, -1) };
+        auto initial_gap_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, int>::create_gap(-4) };
+        auto extended_gap_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, int>::create_gap(-1) };
+        auto freeride_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, int>::create_freeride() };
+        // A single unambiguous gap in the middle, and another at the end
+        std::string down { "abcdefghijklmnop" };
+        std::string right { "abcdefgxxxxhijklmnopyyy" };
+        const auto& [dp_alignment, dp_score] {
+            dp_aligner.align(down, right, substitution_scorer, initial_gap_scorer, extended_gap_scorer, freeride_scorer)
+        };
+        const auto& [alignment, score] {
+            aligner.align(down, right, substitution_scorer, initial_gap_scorer, extended_gap_scorer, freeride_scorer)
+        };
+        EXPECT_EQ(dp_score, score);
+        EXPECT_EQ(copy_to_vector(dp_alignment), copy_to_vector(alignment));
+    }
+
+    TEST(OAAExtendedGapWavefrontHeapAlignerTest, MatchesDynamicProgrammingTest) {
+        extended_gap_wavefront_heap_aligner<is_debug_mode()> aligner {};
+        extended_gap_dynamic_programming_heap_aligner<is_debug_mode()> dp_aligner {};
+        std::mt19937_64 rand { 12345 };
+        auto random_integer { [&](auto a, auto b) -> decltype(a) { return std::uniform_int_distribution<decltype(a)>(a,b)(rand); } };
+        auto random_string {
+            [&](std::size_t max_len) {
+                std::string ret {};
+                for ([[maybe_unused]] auto _ : std::views::iota(0zu, random_integer(0zu, max_len))) {
+                    ret += random_integer('a', 'd');
+                }
+                return ret;
+            }
+        };
+        using SCORER = simple_scorer<is_debug_mode(), std::size_t, char, char, std::int32_t>;
+        auto substitution_scorer { SCORER::create_substitution(2, -3) };
+        auto initial_gap_scorer { SCORER::create_gap(-5) };
+        auto extended_gap_scorer { SCORER::create_gap(-1) };
+        auto asymmetric_initial_gap_scorer { SCORER { 0, 0, -6, -3, 0 } };
+        auto asymmetric_extended_gap_scorer { SCORER { 0, 0, -2, -1, 0 } };
+        auto freeride_scorer { SCORER::create_freeride() };
+        auto penalized_freeride_scorer { SCORER::create_freeride(-1) };
+        auto check {
+            [&](
+                const std::string& down,
+                const std::string& right,
+                const auto& initial_gap_scorer_,
+                const auto& extended_gap_scorer_,
+                const auto& freeride_scorer_
+            ) {
+                const auto& [dp_alignment, dp_score] {
+                    dp_aligner.align(down, right, substitution_scorer, initial_gap_scorer_, extended_gap_scorer_, freeride_scorer_)
+                };
+                const auto& [alignment, score] {
+                    aligner.align(down, right, substitution_scorer, initial_gap_scorer_, extended_gap_scorer_, freeride_scorer_)
+                };
+                const auto& [bidi_alignment, bidi_score] {
+                    aligner.align_bidirectional(
+                        down, right, substitution_scorer, initial_gap_scorer_, extended_gap_scorer_, freeride_scorer_
+                    )
+                };
+                EXPECT_EQ(dp_score, score);
+                EXPECT_EQ(dp_score, bidi_score);
+                EXPECT_EQ(
+                    dp_score,
+                    aligner.score_only(down, right, substitution_scorer, initial_gap_scorer_, extended_gap_scorer_, freeride_scorer_)
+                );
+            }
+        };
+        for ([[maybe_unused]] auto _ : std::views::iota(0u, 20u)) {
+            std::string down { random_string(40zu) };
+            std::string right { random_string(40zu) };
+            check(down, right, initial_gap_scorer, extended_gap_scorer, freeride_scorer);
+            check(down, right, asymmetric_initial_gap_scorer, asymmetric_extended_gap_scorer, freeride_scorer);
+            check(down, right, initial_gap_scorer, extended_gap_scorer, penalized_freeride_scorer);
+        }
+        check("", "abc", initial_gap_scorer, extended_gap_scorer, freeride_scorer);
+        check("abc", "", initial_gap_scorer, extended_gap_scorer, penalized_freeride_scorer);
+    }
+}
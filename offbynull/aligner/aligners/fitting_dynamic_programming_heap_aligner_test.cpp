@@ -3,9 +3,12 @@
 #include <stdfloat>
 #include <iostream>
 #include <ostream>
+#include <random>
+#include <ranges>
 #include <string>
 #include "offbynull/aligner/aligners/fitting_dynamic_programming_heap_aligner.h"
 #include "offbynull/aligner/scorers/simple_scorer.h"
+#include "offbynull/aligner/scorers/levenshtein_scorer.h"
 #include "offbynull/aligner/aligners/utils.h"
 #include "offbynull/aligner/aligners/concepts.h"
 #include "offbynull/utils.h"
@@ -14,7 +17,9 @@
 namespace {
     using offbynull::aligner::aligners::fitting_dynamic_programming_heap_aligner::fitting_dynamic_programming_heap_aligner;
     using offbynull::aligner::scorers::simple_scorer::simple_scorer;
+    using offbynull::aligner::scorers::levenshtein_scorer::levenshtein_scorer;
     using offbynull::aligner::aligners::utils::alignment_to_stacked_string;
+    using offbynull::utils::copy_to_vector;
     using offbynull::utils::is_debug_mode;
 
     TEST(OAAFittingDynamicProgrammingHeapAlignerTest, SanityTest) {
@@ -76,4 +81,83 @@ namespace {
         EXPECT_EQ(3, (align_.operator()<std::size_t, std::float32_t>()));
         EXPECT_EQ(3, (align_.operator()<std::size_t, std::float64_t>()));
     }
-}
\ No newline at end of file
+
+    TEST(OAAFittingDynamicProgrammingHeapAlignerTest, LevenshteinTest) {
+        fitting_dynamic_programming_heap_aligner<is_debug_mode()> aligner {};
+        levenshtein_scorer<is_debug_mode(), std::size_t, char, char, int> levenshtein {};
+        auto substitution_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, int>::create_substitution(0, -1) };
+        auto gap_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, int>::create_gap(-1) };
+        std::mt19937_64 rand { 12345 };
+        auto random_integer { [&](auto a, auto b) -> decltype(a) { return std::uniform_int_distribution<decltype(a)>(a,b)(rand); } };
+        auto random_string {
+            [&](std::size_t max_len) {
+                std::string ret {};
+                for ([[maybe_unused]] auto _ : std::views::iota(0zu, random_integer(1zu, max_len))) {
+                    ret += random_integer('a', 'c');
+                }
+                return ret;
+            }
+        };
+        // Levenshtein scorers get scored via bit-vectors (unless the free ride weight can't be represented by bit-vectors, in which case
+        // the graph is used) but always get aligned via the graph, so the path (including how ties are broken) must be exactly the same
+        // as the path for the equivalent simple scorers
+        for (const int freeride_weight : { 0, -1, -5 }) {
+            auto freeride_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, int>::create_freeride(freeride_weight) };
+            for ([[maybe_unused]] auto _ : std::views::iota(0u, 50u)) {
+                std::string down { random_string(80zu) };
+                std::string right { random_string(40zu) };
+                const auto& [alignment, score] { aligner.align(down, right, levenshtein, levenshtein, freeride_scorer) };
+                const auto& [expected_alignment, expected_score] {
+                    aligner.align(down, right, substitution_scorer, gap_scorer, freeride_scorer)
+                };
+                EXPECT_EQ(copy_to_vector(expected_alignment), copy_to_vector(alignment));
+                EXPECT_EQ(expected_score, score);
+                EXPECT_EQ(expected_score, aligner.score_only(down, right, levenshtein, levenshtein, freeride_scorer));
+            }
+        }
+    }
+
+    TEST(OAAFittingDynamicProgrammingHeapAlignerTest, ScoreOnlyTest) {
+        fitting_dynamic_programming_heap_aligner<is_debug_mode()> aligner {};
+        auto substitution_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, int>::create_substitution(1, -1) };
+        auto gap_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, int>::create_gap(-1) };
+        auto freeride_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, int>::create_freeride() };
+        std::string down { "panama" };
+        std::string right { "bananarama" };
+        const auto& score1 {
+            aligner.score_only(down, right, substitution_scorer, gap_scorer, freeride_scorer)
+        };
+        const auto& score2 {
+            aligner.score_only(right, down, substitution_scorer, gap_scorer, freeride_scorer)
+        };
+        const auto& [alignment1, expected_score1] {
+            aligner.align(down, right, substitution_scorer, gap_scorer, freeride_scorer)
+        };
+        const auto& [alignment2, expected_score2] {
+            aligner.align(right, down, substitution_scorer, gap_scorer, freeride_scorer)
+        };
+        EXPECT_EQ(expected_score1, score1);
+        EXPECT_EQ(expected_score2, score2);
+    }
+
+    TEST(OAAFittingDynamicProgrammingHeapAlignerTest, XDropTest) {
+        fitting_dynamic_programming_heap_aligner<is_debug_mode()> aligner {};
+        auto substitution_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, int>::create_substitution(1, -1) };
+        auto gap_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, int>::create_gap(-1) };
+        auto freeride_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, int>::create_freeride() };
+        std::string down { "zzzabcdefghzzz" };
+        std::string right { "abcdxfgh" };
+        const auto& [expected_alignment, expected_score] {
+            aligner.align(down, right, substitution_scorer, gap_scorer, freeride_scorer)
+        };
+        EXPECT_EQ(6, expected_score);
+        for (const int xdrop : { 1, 100 }) {
+            const auto& [alignment, score] {
+                aligner.align(down, right, substitution_scorer, gap_scorer, freeride_scorer, xdrop)
+            };
+            EXPECT_EQ(expected_score, score);
+            std::cout << score << std::endl;
+            std::cout << alignment_to_stacked_string<is_debug_mode()>(down, right, alignment) << std::endl;
+        }
+    }
+}
@@ -76,4 +76,48 @@ namespace {
         EXPECT_EQ(3, (align_.operator()<std::size_t, std::float32_t>()));
         EXPECT_EQ(3, (align_.operator()<std::size_t, std::float64_t>()));
     }
+
+    TEST(OAAFittingDynamicProgrammingStackAlignerTest, ScoreOnlyTest) {
+        fitting_dynamic_programming_stack_aligner<is_debug_mode()> aligner {};
+        auto substitution_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, int>::create_substitution(1, -1) };
+        auto gap_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, int>::create_gap(-1) };
+        auto freeride_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, int>::create_freeride() };
+        std::string down { "panama" };
+        std::string right { "bananarama" };
+        const auto& score1 {
+            aligner.score_only<6zu, 10zu>(down, right, substitution_scorer, gap_scorer, freeride_scorer)
+        };
+        const auto& score2 {
+            aligner.score_only<10zu, 6zu>(right, down, substitution_scorer, gap_scorer, freeride_scorer)
+        };
+        const auto& [alignment1, expected_score1] {
+            aligner.align<6zu, 10zu>(down, right, substitution_scorer, gap_scorer, freeride_scorer)
+        };
+        const auto& [alignment2, expected_score2] {
+            aligner.align<10zu, 6zu>(right, down, substitution_scorer, gap_scorer, freeride_scorer)
+        };
+        EXPECT_EQ(expected_score1, score1);
+        EXPECT_EQ(expected_score2, score2);
+    }
+
+    TEST(OAAFittingDynamicProgrammingStackAlignerTest, XDropTest) {
+        fitting_dynamic_programming_stack_aligner<is_debug_mode()> aligner {};
+        auto substitution_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, int>::create_substitution(1, -1) };
+        auto gap_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, int>::create_gap(-1) };
+        auto freeride_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, int>::create_freeride() };
+        std::string down { "zzzabcdefghzzz" };
+        std::string right { "abcdxfgh" };
+        const auto& [expected_alignment, expected_score] {
+            aligner.align<14zu, 8zu>(down, right, substitution_scorer, gap_scorer, freeride_scorer)
+        };
+        EXPECT_EQ(6, expected_score);
+        for (const int xdrop : { 1, 100 }) {
+            const auto& [alignment, score] {
+                aligner.align<14zu, 8zu>(down, right, substitution_scorer, gap_scorer, freeride_scorer, xdrop)
+            };
+            EXPECT_EQ(expected_score, score);
+            std::cout << score << std::endl;
+            std::cout << alignment_to_stacked_string<is_debug_mode()>(down, right, alignment) << std::endl;
+        }
+    }
 }
\ No newline at end of file
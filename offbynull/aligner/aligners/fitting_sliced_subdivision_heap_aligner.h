@@ -4,6 +4,7 @@
 #include <utility>
 #include <type_traits>
 #include <cstddef>
+#include <memory_resource>
 #include <algorithm>
 #include <ranges>
 #include <stdexcept>
@@ -12,7 +13,9 @@
 #include "offbynull/aligner/scorers/widening_scorer.h"
 #include "offbynull/aligner/graphs/pairwise_fitting_alignment_graph.h"
 #include "offbynull/aligner/backtrackers/sliceable_pairwise_alignment_graph_backtracker/backtracker.h"
+#include "offbynull/aligner/backtrackers/sliceable_pairwise_alignment_graph_backtracker/backtracker_arena_container_creator_pack.h"
 #include "offbynull/concepts.h"
+#include "offbynull/helpers/forkable_thread_pool.h"
 #include "offbynull/utils.h"
 #include "offbynull/aligner/aligners/concepts.h"
 #include "offbynull/aligner/aligners/internal_utils.h"
@@ -28,11 +31,13 @@ namespace offbynull::aligner::aligners::fitting_sliced_subdivision_heap_aligner
     using offbynull::aligner::scorers::widening_scorer::widening_scorer;
     using offbynull::aligner::concepts::weight;
     using offbynull::aligner::graphs::pairwise_fitting_alignment_graph::pairwise_fitting_alignment_graph;
-    using offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::backtracker_heap_container_creator_pack
-        ::backtracker_heap_container_creator_pack;
+    using offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::backtracker_arena_container_creator_pack
+        ::backtracker_arena_container_creator_pack;
     using offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::backtracker::backtracker;
+    using offbynull::helpers::forkable_thread_pool::forkable_thread_pool;
     using offbynull::aligner::aligners::concepts::alignment_result;
     using offbynull::aligner::aligners::internal_utils::validate_align_and_extract_widest_weight;
+    using offbynull::aligner::aligners::internal_utils::heap_find_max_path_weight;
 
     /**
      * Fitting pairwise aligner using sliced subdivision algorithm (see
@@ -42,7 +47,61 @@ namespace offbynull::aligner::aligners::fitting_sliced_subdivision_heap_aligner
      */
     template<bool debug_mode>
     class fitting_sliced_subdivision_heap_aligner {
+    private:
+        /**
+         * Memory resource that the backtracker's internal containers are allocated from.
+         */
+        std::pmr::memory_resource* resource;
+
+        /**
+         * Thread pool that sliced subdivision runs on, or `nullptr` to run it on the thread calling `align()`.
+         */
+        forkable_thread_pool<debug_mode, void>* thread_pool;
+
+        /**
+         * Node count below which a segment is subdivided on the thread calling `align()` rather than being queued onto `thread_pool`.
+         */
+        std::size_t serial_node_cnt;
+
+        /**
+         * Node count at or below which a segment is solved in a single walk rather than subdivided further.
+         */
+        std::size_t full_dp_node_cnt;
+
     public:
+        /**
+         * Construct an
+         * @ref offbynull::aligner::aligners::fitting_sliced_subdivision_heap_aligner::fitting_sliced_subdivision_heap_aligner
+         * instance.
+         *
+         * @param resource_ Memory resource to allocate the backtracker's internal containers from (e.g., a
+         *     `std::pmr::unsynchronized_pool_resource` kept around across many calls to `align()`), or the default memory resource to
+         *     allocate them on the heap. Returned alignments are never allocated from this resource, meaning it can be released between
+         *     calls to `align()`. The resource must not be shared by multiple threads unless it's thread-safe, which includes being used
+         *     with `thread_pool_`.
+         * @param thread_pool_ Thread pool to run sliced subdivision on (see
+         *     @ref offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::backtracker::backtracker::find_max_path),
+         *     or `nullptr` to run it on the thread calling `align()`. If set, the thread pool must not be closed while `align()` runs and
+         *     `align()` must not be called from one of the thread pool's threads.
+         * @param serial_node_cnt_ Node count below which a segment is subdivided on the thread calling `align()` rather than being queued
+         *     onto `thread_pool_`.
+         * @param full_dp_node_cnt_ Node count at or below which a segment is solved in a single walk rather than subdivided further (see
+         *     @ref offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::sliced_subdivider::sliced_subdivider::sliced_subdivider),
+         *     or 0 (the default) to always subdivide. Segments solved this way hold onto a slot for each of their nodes, allocated on the
+         *     heap rather than from `resource_`, and may break ties between maximally-weighted paths differently than subdivision does. A
+         *     cutoff of roughly 16384 (a segment of 128x128 nodes) skips the deepest, most expensive levels of subdivision while keeping
+         *     the memory held onto at once small.
+         */
+        fitting_sliced_subdivision_heap_aligner(
+            std::pmr::memory_resource* resource_ = std::pmr::get_default_resource(),
+            forkable_thread_pool<debug_mode, void>* thread_pool_ = nullptr,
+            std::size_t serial_node_cnt_ = 65536zu,
+            std::size_t full_dp_node_cnt_ = 0zu
+        )
+        : resource { resource_ }
+        , thread_pool { thread_pool_ }
+        , serial_node_cnt { serial_node_cnt_ }
+        , full_dp_node_cnt { full_dp_node_cnt_ } {}
 
         /**
          * Align two sequences.
@@ -204,7 +263,7 @@ namespace offbynull::aligner::aligners::fitting_sliced_subdivision_heap_aligner
                 freeride_scorer
             };
             ;
-            using CONTAINER_CREATOR_PACK = backtracker_heap_container_creator_pack<
+            using CONTAINER_CREATOR_PACK = backtracker_arena_container_creator_pack<
                 debug_mode,
                 typename G::N,
                 typename G::E,
@@ -215,9 +274,11 @@ namespace offbynull::aligner::aligners::fitting_sliced_subdivision_heap_aligner
                 debug_mode,
                 G,
                 CONTAINER_CREATOR_PACK
-            > backtracker_ {};
+            > backtracker_ { {}, { resource }, full_dp_node_cnt };
             auto&& [path, path_weight] {  // Use auto&& vs const auto&, otherwise move() below fails
-                backtracker_.find_max_path(graph, max_path_weight_comparison_tolerance)
+                thread_pool == nullptr
+                    ? backtracker_.find_max_path(graph, max_path_weight_comparison_tolerance)
+                    : backtracker_.find_max_path(graph, *thread_pool, max_path_weight_comparison_tolerance, serial_node_cnt)
             };
             return std::make_pair(
                 std::move(path)  // move() needed to ensure that transform operation below owns path
@@ -229,6 +290,160 @@ namespace offbynull::aligner::aligners::fitting_sliced_subdivision_heap_aligner
                 path_weight
             );
         }
+
+        /**
+         * Score two sequences without aligning them. The alignment graph is walked one row at a time (see
+         * @ref offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::forward_walker::forward_walker::forward_walker),
+         * meaning that only the rows being walked are held in memory rather than the entire graph.
+         *
+         * @tparam minimize_allocations `true` to force certain internal containers to reserve (preallocate) elements thereby
+         *     removing/reducing the need for adhoc reallocations, `false` otherwise.
+         * @tparam N_INDEX Alignment graph node coordinate type (must be wide enough to hold `std::max(down.size(), right.size()) + 1zu`).
+         * @param down Sequence 1 (sequence to fit against).
+         * @param right Sequence 2 (sequence to fit).
+         * @param substitution_scorer Match/mismatch (substitution) scorer.
+         * @param gap_scorer Gap (indel) scorer.
+         * @param freeride_scorer Freeride scorer.
+         * @return Score of the fitting alignment of `down` vs `right`.
+         */
+        template<
+            bool minimize_allocations = true,
+            widenable_to_size_t N_INDEX = std::size_t
+        >
+        auto score_only(
+            const sequence auto& down,
+            const sequence auto& right,
+            const scorer_without_explicit_weight_or_seq_index<
+                std::remove_cvref_t<decltype(down[0])>,
+                std::remove_cvref_t<decltype(right[0])>
+            > auto& substitution_scorer,
+            const scorer_without_explicit_weight_or_seq_index<
+                std::remove_cvref_t<decltype(down[0])>,
+                std::remove_cvref_t<decltype(right[0])>
+            > auto& gap_scorer,
+            const scorer_without_explicit_weight_or_seq_index<
+                std::remove_cvref_t<decltype(down[0])>,
+                std::remove_cvref_t<decltype(right[0])>
+            > auto& freeride_scorer
+        ) {
+            auto widest_weight_type_tagger {
+                validate_align_and_extract_widest_weight<
+                    debug_mode,
+                    N_INDEX,
+                    std::remove_cvref_t<decltype(substitution_scorer)>,
+                    std::remove_cvref_t<decltype(gap_scorer)>,
+                    std::remove_cvref_t<decltype(freeride_scorer)>
+                >(down, right)
+            };
+            using WEIGHT = typename decltype(widest_weight_type_tagger)::type;
+
+            // Wrap scorers into ones that'll cast from N_INDEX to the scorer's SEQ_INDEX (widens, doesn't narrow). Likewise, the
+            // wrapped scorer's result will be cast to WEIGHT type derived above (widens). This is to make it easier for the user
+            // (e.g., they submit scorers with mismatching N_INDEX / WEIGHT).
+            using DOWN_ELEM = std::remove_cvref_t<decltype(down[0])>;
+            using RIGHT_ELEM = std::remove_cvref_t<decltype(right[0])>;
+            const widening_scorer<
+                debug_mode,
+                N_INDEX,
+                DOWN_ELEM,
+                RIGHT_ELEM,
+                WEIGHT,
+                std::remove_cvref_t<decltype(substitution_scorer)>
+            > widened_substitution_scorer {
+                substitution_scorer
+            };
+            const widening_scorer<
+                debug_mode,
+                N_INDEX,
+                DOWN_ELEM,
+                RIGHT_ELEM,
+                WEIGHT,
+                std::remove_cvref_t<decltype(gap_scorer)>
+            > widened_gap_scorer {
+                gap_scorer
+            };
+            const widening_scorer<
+                debug_mode,
+                N_INDEX,
+                DOWN_ELEM,
+                RIGHT_ELEM,
+                WEIGHT,
+                std::remove_cvref_t<decltype(freeride_scorer)>
+            > widened_freeride_scorer {
+                freeride_scorer
+            };
+
+            return score_only_strict<N_INDEX, WEIGHT, minimize_allocations>(
+                down,
+                right,
+                widened_substitution_scorer,
+                widened_gap_scorer,
+                widened_freeride_scorer
+            );
+        }
+
+        /**
+         * Score two sequences without aligning them. The alignment graph is walked one row at a time (see
+         * @ref offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::forward_walker::forward_walker::forward_walker),
+         * meaning that only the rows being walked are held in memory rather than the entire graph.
+         *
+         * @tparam minimize_allocations `true` to force certain internal containers to reserve (preallocate) elements thereby
+         *     removing/reducing the need for adhoc reallocations, `false` otherwise.
+         * @tparam WEIGHT Alignment graph edge weight type.
+         * @tparam N_INDEX Alignment graph node coordinate type (must be wide enough to hold `std::max(down.size(), right.size()) + 1zu`).
+         * @param down Sequence 1 (sequence to fit against).
+         * @param right Sequence 2 (sequence to fit).
+         * @param substitution_scorer Match/mismatch (substitution) scorer.
+         * @param gap_scorer Gap (indel) scorer.
+         * @param freeride_scorer Freeride scorer.
+         * @return Score of the fitting alignment of `down` vs `right`.
+         */
+        template<
+            widenable_to_size_t N_INDEX,
+            weight WEIGHT,
+            bool minimize_allocations = true
+        >
+        WEIGHT score_only_strict(
+            const sequence auto& down,
+            const sequence auto& right,
+            const scorer<
+                N_INDEX,
+                std::remove_cvref_t<decltype(down[0])>,
+                std::remove_cvref_t<decltype(right[0])>,
+                WEIGHT
+            > auto& substitution_scorer,
+            const scorer<
+                N_INDEX,
+                std::remove_cvref_t<decltype(down[0])>,
+                std::remove_cvref_t<decltype(right[0])>,
+                WEIGHT
+            > auto& gap_scorer,
+            const scorer<
+                N_INDEX,
+                std::remove_cvref_t<decltype(down[0])>,
+                std::remove_cvref_t<decltype(right[0])>,
+                WEIGHT
+            > auto& freeride_scorer
+        ) {
+            using G = pairwise_fitting_alignment_graph<
+                debug_mode,
+                N_INDEX,
+                WEIGHT,
+                std::remove_cvref_t<decltype(down)>,
+                std::remove_cvref_t<decltype(right)>,
+                std::remove_cvref_t<decltype(substitution_scorer)>,
+                std::remove_cvref_t<decltype(gap_scorer)>,
+                std::remove_cvref_t<decltype(freeride_scorer)>
+            >;
+            G graph {
+                down,
+                right,
+                substitution_scorer,
+                gap_scorer,
+                freeride_scorer
+            };
+            return heap_find_max_path_weight<debug_mode, minimize_allocations>(graph);
+        }
     };
 
 }
@@ -78,4 +78,27 @@ namespace {
         // EXPECT_EQ(3, (align_.operator()<std::size_t, std::float32_t>()));
         EXPECT_EQ(3, (align_.operator()<std::size_t, std::float64_t>()));
     }
+
+    TEST(OAAFittingSlicedSubdivisionHeapAlignerTest, ScoreOnlyTest) {
+        fitting_sliced_subdivision_heap_aligner<is_debug_mode()> aligner {};
+        auto substitution_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, int>::create_substitution(1, -1) };
+        auto gap_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, int>::create_gap(-1) };
+        auto freeride_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, int>::create_freeride() };
+        std::string down { "panama" };
+        std::string right { "bananarama" };
+        const auto& score1 {
+            aligner.score_only(down, right, substitution_scorer, gap_scorer, freeride_scorer)
+        };
+        const auto& score2 {
+            aligner.score_only(right, down, substitution_scorer, gap_scorer, freeride_scorer)
+        };
+        const auto& [alignment1, expected_score1] {
+            aligner.align(down, right, substitution_scorer, gap_scorer, freeride_scorer, 0)
+        };
+        const auto& [alignment2, expected_score2] {
+            aligner.align(right, down, substitution_scorer, gap_scorer, freeride_scorer, 0)
+        };
+        EXPECT_EQ(expected_score1, score1);
+        EXPECT_EQ(expected_score2, score2);
+    }
 }
\ No newline at end of file
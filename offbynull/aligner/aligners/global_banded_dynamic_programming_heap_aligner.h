@@ -0,0 +1,333 @@
+#ifndef OFFBYNULL_ALIGNER_ALIGNERS_GLOBAL_BANDED_DYNAMIC_PROGRAMMING_HEAP_ALIGNER_H
+#define OFFBYNULL_ALIGNER_ALIGNERS_GLOBAL_BANDED_DYNAMIC_PROGRAMMING_HEAP_ALIGNER_H
+
+#include <utility>
+#include <type_traits>
+#include <cstddef>
+#include <algorithm>
+#include <optional>
+#include <ranges>
+#include <vector>
+#include "offbynull/aligner/sequence/sequence.h"
+#include "offbynull/aligner/scorer/scorer.h"
+#include "offbynull/aligner/scorers/widening_scorer.h"
+#include "offbynull/aligner/graphs/pairwise_global_alignment_graph.h"
+#include "offbynull/aligner/graphs/banded_sliceable_pairwise_alignment_graph.h"
+#include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/backtracker.h"
+#include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/backtracker_banded_container_creator_pack.h"
+#include "offbynull/aligner/aligners/global_dynamic_programming_alignment_type_parameterizer.h"
+#include "offbynull/concepts.h"
+#include "offbynull/aligner/aligners/concepts.h"
+#include "offbynull/aligner/aligners/internal_utils.h"
+
+namespace offbynull::aligner::aligners::global_banded_dynamic_programming_heap_aligner {
+    using offbynull::concepts::widenable_to_size_t;
+    using offbynull::aligner::sequence::sequence::sequence;
+    using offbynull::aligner::scorer::scorer::scorer;
+    using offbynull::aligner::scorer::scorer::scorer_without_explicit_weight_or_seq_index;
+    using offbynull::aligner::scorers::widening_scorer::widening_scorer;
+    using offbynull::aligner::concepts::weight;
+    using offbynull::aligner::graphs::pairwise_global_alignment_graph::pairwise_global_alignment_graph;
+    using offbynull::aligner::graphs::banded_sliceable_pairwise_alignment_graph::banded_sliceable_pairwise_alignment_graph;
+    using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtracker_banded_container_creator_pack
+        ::backtracker_banded_container_creator_pack;
+    using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtracker::backtracker;
+    using offbynull::aligner::aligners::global_dynamic_programming_alignment_type_parameterizer
+        ::global_dynamic_programming_alignment_type_parameterizer;
+    using offbynull::aligner::aligners::concepts::alignment_result;
+    using offbynull::aligner::aligners::internal_utils::validate_align_and_extract_widest_weight;
+
+    /**
+     * Global pairwise aligner using dynamic programming algorithm (see
+     * @ref offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtracker) and heap allocation, where only a
+     * diagonal band of the alignment graph gets walked (see
+     * @ref offbynull::aligner::graphs::banded_sliceable_pairwise_alignment_graph::banded_sliceable_pairwise_alignment_graph).
+     *
+     * The band starts narrow and is doubled until the maximally-weighted path within the band is proven to be the maximally-weighted path
+     * within the entire alignment graph, meaning that results are identical to
+     * @ref offbynull::aligner::aligners::global_dynamic_programming_heap_aligner::global_dynamic_programming_heap_aligner (same alignment,
+     * same score). A band is accepted once the path found within it ...
+     *
+     *  * doesn't touch the band's edges.
+     *  * has a weight strictly greater than an upper bound on the weight of any path that strays outside the band.
+     *
+     * That upper bound is derived from the gap weights (collected for each element in `O(down.size() + right.size())`) and a
+     * caller-supplied ceiling on substitution weights. Similar sequences typically get accepted after walking a small fraction of the
+     * alignment graph, while dissimilar sequences eventually fall back to a band covering the entire alignment graph.
+     *
+     * @tparam debug_mode `true` to enable debugging logic, `false` otherwise.
+     */
+    template<bool debug_mode>
+    class global_banded_dynamic_programming_heap_aligner {
+    public:
+
+        /**
+         * Align two sequences.
+         *
+         * The behavior of this function is undefined if `substitution_weight_ceiling` is less than any weight `substitution_scorer` can
+         * return for `down` vs `right`.
+         *
+         * @tparam N_INDEX Alignment graph node coordinate type (must be wide enough to hold `std::max(down.size(), right.size()) + 1zu`).
+         * @param down Sequence 1.
+         * @param right Sequence 2.
+         * @param substitution_scorer Match/mismatch (substitution) scorer.
+         * @param gap_scorer Gap (indel) scorer.
+         * @param substitution_weight_ceiling Highest weight `substitution_scorer` can return (e.g., the match weight of a
+         *     @ref offbynull::aligner::scorers::simple_scorer::simple_scorer).
+         * @param initial_band_extent Number of diagonals on either side of the band's initial diagonals (the diagonals connecting the root
+         *     node to the leaf node).
+         * @return Global alignment of `down` vs `right` along with the score of that alignment.
+         */
+        template<
+            widenable_to_size_t N_INDEX = std::size_t
+        >
+        alignment_result auto align(
+            const sequence auto& down,
+            const sequence auto& right,
+            const scorer_without_explicit_weight_or_seq_index<
+                std::remove_cvref_t<decltype(down[0])>,
+                std::remove_cvref_t<decltype(right[0])>
+            > auto& substitution_scorer,
+            const scorer_without_explicit_weight_or_seq_index<
+                std::remove_cvref_t<decltype(down[0])>,
+                std::remove_cvref_t<decltype(right[0])>
+            > auto& gap_scorer,
+            const weight auto substitution_weight_ceiling,
+            const std::size_t initial_band_extent = 16zu
+        ) {
+            auto widest_weight_type_tagger {
+                validate_align_and_extract_widest_weight<
+                    debug_mode,
+                    N_INDEX,
+                    std::remove_cvref_t<decltype(substitution_scorer)>,
+                    std::remove_cvref_t<decltype(gap_scorer)>
+                >(down, right)
+            };
+            using WEIGHT = typename decltype(widest_weight_type_tagger)::type;
+            using DOWN_ELEM = std::remove_cvref_t<decltype(down[0])>;
+            using RIGHT_ELEM = std::remove_cvref_t<decltype(right[0])>;
+
+            // Wrap scorers into ones that'll cast from N_INDEX to the scorer's SEQ_INDEX (widens, doesn't narrow). Likewise, the
+            // wrapped scorer's result will be cast to WEIGHT type derived above (widens). This is to make it easier for the user
+            // (e.g., they submit scorers with mismatching N_INDEX / WEIGHT).
+            const widening_scorer<
+                debug_mode,
+                N_INDEX,
+                DOWN_ELEM,
+                RIGHT_ELEM,
+                WEIGHT,
+                std::remove_cvref_t<decltype(substitution_scorer)>
+            > widened_substitution_scorer {
+                substitution_scorer
+            };
+            const widening_scorer<
+                debug_mode,
+                N_INDEX,
+                DOWN_ELEM,
+                RIGHT_ELEM,
+                WEIGHT,
+                std::remove_cvref_t<decltype(gap_scorer)>
+            > widened_gap_scorer {
+                gap_scorer
+            };
+
+            return align_strict<N_INDEX, WEIGHT>(
+                down,
+                right,
+                widened_substitution_scorer,
+                widened_gap_scorer,
+                static_cast<WEIGHT>(substitution_weight_ceiling),
+                initial_band_extent
+            );
+        }
+
+        /**
+         * Align two sequences.
+         *
+         * The behavior of this function is undefined if `substitution_weight_ceiling` is less than any weight `substitution_scorer` can
+         * return for `down` vs `right`.
+         *
+         * @tparam WEIGHT Alignment graph edge weight type.
+         * @tparam N_INDEX Alignment graph node coordinate type (must be wide enough to hold `std::max(down.size(), right.size()) + 1zu`).
+         * @param down Sequence 1.
+         * @param right Sequence 2.
+         * @param substitution_scorer Match/mismatch (substitution) scorer.
+         * @param gap_scorer Gap (indel) scorer.
+         * @param substitution_weight_ceiling Highest weight `substitution_scorer` can return (e.g., the match weight of a
+         *     @ref offbynull::aligner::scorers::simple_scorer::simple_scorer).
+         * @param initial_band_extent Number of diagonals on either side of the band's initial diagonals (the diagonals connecting the root
+         *     node to the leaf node).
+         * @return Global alignment of `down` vs `right` along with the score of that alignment.
+         */
+        template<
+            widenable_to_size_t N_INDEX,
+            weight WEIGHT
+        >
+        alignment_result auto align_strict(
+            const sequence auto& down,
+            const sequence auto& right,
+            const scorer<
+                N_INDEX,
+                std::remove_cvref_t<decltype(down[0])>,
+                std::remove_cvref_t<decltype(right[0])>,
+                WEIGHT
+            > auto& substitution_scorer,
+            const scorer<
+                N_INDEX,
+                std::remove_cvref_t<decltype(down[0])>,
+                std::remove_cvref_t<decltype(right[0])>,
+                WEIGHT
+            > auto& gap_scorer,
+            const WEIGHT substitution_weight_ceiling,
+            const std::size_t initial_band_extent = 16zu
+        ) {
+            using G = pairwise_global_alignment_graph<
+                debug_mode,
+                N_INDEX,
+                WEIGHT,
+                std::remove_cvref_t<decltype(down)>,
+                std::remove_cvref_t<decltype(right)>,
+                std::remove_cvref_t<decltype(substitution_scorer)>,
+                std::remove_cvref_t<decltype(gap_scorer)>
+            >;
+            using N = typename G::N;
+            using E = typename G::E;
+            using BANDED_G = banded_sliceable_pairwise_alignment_graph<debug_mode, G>;
+            using PARENT_COUNT = typename global_dynamic_programming_alignment_type_parameterizer<N_INDEX>::PARENT_COUNT;
+            using SLOT_INDEX = typename global_dynamic_programming_alignment_type_parameterizer<N_INDEX>::SLOT_INDEX;
+            using CONTAINER_CREATOR_PACK = backtracker_banded_container_creator_pack<
+                debug_mode,
+                N,
+                E,
+                WEIGHT,
+                PARENT_COUNT,
+                SLOT_INDEX
+            >;
+            G graph {
+                down,
+                right,
+                substitution_scorer,
+                gap_scorer
+            };
+
+            const std::size_t down_size { down.size() };
+            const std::size_t right_size { right.size() };
+            const std::size_t down_lead { down_size > right_size ? down_size - right_size : 0zu };
+            const std::size_t right_lead { right_size > down_size ? right_size - down_size : 0zu };
+
+            // A gap's weight only depends on the element being skipped over. Sorting those weights from highest to lowest and summing
+            // them up means that the first k sums are the highest weight that any k gaps can have.
+            auto to_gap_weight_prefix_sums {
+                [](std::vector<WEIGHT> gap_weights) {
+                    std::ranges::sort(gap_weights, [](const WEIGHT& a, const WEIGHT& b) { return b < a; });
+                    std::vector<WEIGHT> prefix_sums {};
+                    prefix_sums.reserve(gap_weights.size() + 1zu);
+                    prefix_sums.push_back(WEIGHT {});
+                    for (const WEIGHT& gap_weight : gap_weights) {
+                        prefix_sums.push_back(static_cast<WEIGHT>(prefix_sums.back() + gap_weight));
+                    }
+                    return prefix_sums;
+                }
+            };
+            std::vector<WEIGHT> down_gap_weights {};
+            down_gap_weights.reserve(down_size);
+            for (std::size_t i { 0zu }; i < down_size; ++i) {
+                const N_INDEX down_offset { static_cast<N_INDEX>(i) };
+                down_gap_weights.push_back(
+                    graph.get_edge_data(E { N { down_offset, N_INDEX {} }, N { static_cast<N_INDEX>(i + 1zu), N_INDEX {} } })
+                );
+            }
+            std::vector<WEIGHT> right_gap_weights {};
+            right_gap_weights.reserve(right_size);
+            for (std::size_t i { 0zu }; i < right_size; ++i) {
+                const N_INDEX right_offset { static_cast<N_INDEX>(i) };
+                right_gap_weights.push_back(
+                    graph.get_edge_data(E { N { N_INDEX {}, right_offset }, N { N_INDEX {}, static_cast<N_INDEX>(i + 1zu) } })
+                );
+            }
+            const std::vector<WEIGHT> down_gap_prefix_sums { to_gap_weight_prefix_sums(std::move(down_gap_weights)) };
+            const std::vector<WEIGHT> right_gap_prefix_sums { to_gap_weight_prefix_sums(std::move(right_gap_weights)) };
+
+            // Upper bound on the weight of any path that strays outside of the band. A path with h right gaps has v = h - right_size +
+            // down_size down gaps and right_size - h substitutions. Straying above the band requires h > band_right_extent, while
+            // straying below the band requires v > band_down_extent.
+            auto find_escaping_weight_ceiling {
+                [&](const std::size_t band_down_extent, const std::size_t band_right_extent) {
+                    std::optional<WEIGHT> ceiling {};
+                    auto test {
+                        [&](const std::size_t h, const std::size_t v) {
+                            const WEIGHT weight_ {
+                                static_cast<WEIGHT>(
+                                    static_cast<WEIGHT>(right_size - h) * substitution_weight_ceiling
+                                        + right_gap_prefix_sums[h]
+                                        + down_gap_prefix_sums[v]
+                                )
+                            };
+                            if (!ceiling.has_value() || *ceiling < weight_) {
+                                ceiling = { weight_ };
+                            }
+                        }
+                    };
+                    for (std::size_t h { std::max(band_right_extent + 1zu, right_lead) }; h <= right_size; ++h) {
+                        test(h, h + down_size - right_size);
+                    }
+                    for (std::size_t v { std::max(band_down_extent + 1zu, down_lead) }; v <= down_size; ++v) {
+                        test(v + right_size - down_size, v);
+                    }
+                    return ceiling;
+                }
+            };
+
+            std::size_t band_extent { initial_band_extent };
+            while (true) {
+                const std::size_t band_down_extent { band_extent + down_lead };
+                const std::size_t band_right_extent { band_extent + right_lead };
+                const BANDED_G banded_graph { graph, band_down_extent, band_right_extent };
+                backtracker<
+                    debug_mode,
+                    BANDED_G,
+                    PARENT_COUNT,
+                    SLOT_INDEX,
+                    CONTAINER_CREATOR_PACK
+                > backtracker_ { WEIGHT {}, CONTAINER_CREATOR_PACK { banded_graph.band_width } };
+                // Use auto&& vs const auto&, otherwise move() below fails
+                auto&& [path, path_weight] { backtracker_.find_max_path(banded_graph) };
+
+                const bool band_covers_graph { band_down_extent >= down_size && band_right_extent >= right_size };
+                bool accepted { band_covers_graph };
+                if (!accepted) {
+                    bool touches_band_edge { false };
+                    for (const E& edge : path) {
+                        const N& node { graph.get_edge_to(edge) };
+                        const std::size_t node_down { node.down };
+                        const std::size_t node_right { node.right };
+                        if ((band_right_extent < right_size && node_right == node_down + band_right_extent)
+                            || (band_down_extent < down_size && node_down == node_right + band_down_extent)) {
+                            touches_band_edge = true;
+                            break;
+                        }
+                    }
+                    const std::optional<WEIGHT> escaping_weight_ceiling {
+                        find_escaping_weight_ceiling(band_down_extent, band_right_extent)
+                    };
+                    accepted = !touches_band_edge
+                        && (!escaping_weight_ceiling.has_value() || *escaping_weight_ceiling < path_weight);
+                }
+                if (accepted) {
+                    return std::make_pair(
+                        std::move(path)  // move() needed to ensure that transform operation below owns path
+                            | std::views::transform(
+                                [graph](const E& edge) {  // WARNING: Lambda capture of "graph" must be copy/move to avoid dangling ref.
+                                    return graph.edge_to_element_offsets(edge);
+                                }
+                            ),
+                        path_weight
+                    );
+                }
+                band_extent = band_extent == 0zu ? 1zu : band_extent * 2zu;
+            }
+        }
+    };
+}
+
+#endif //OFFBYNULL_ALIGNER_ALIGNERS_GLOBAL_BANDED_DYNAMIC_PROGRAMMING_HEAP_ALIGNER_H
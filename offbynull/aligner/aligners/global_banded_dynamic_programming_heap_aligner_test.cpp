@@ -0,0 +1,110 @@
+#include <cstddef>
+#include <cstdint>
+#include <stdfloat>
+#include <iostream>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+#include "offbynull/aligner/aligners/global_banded_dynamic_programming_heap_aligner.h"
+#include "offbynull/aligner/aligners/global_dynamic_programming_heap_aligner.h"
+#include "offbynull/aligner/scorers/simple_scorer.h"
+#include "offbynull/aligner/aligners/utils.h"
+#include "offbynull/aligner/aligners/concepts.h"
+#include "offbynull/utils.h"
+#include "gtest/gtest.h"
+
+namespace {
+    using offbynull::aligner::aligners::global_banded_dynamic_programming_heap_aligner::global_banded_dynamic_programming_heap_aligner;
+    using offbynull::aligner::aligners::global_dynamic_programming_heap_aligner::global_dynamic_programming_heap_aligner;
+    using offbynull::aligner::scorers::simple_scorer::simple_scorer;
+    using offbynull::aligner::aligners::utils::alignment_to_stacked_string;
+    using offbynull::utils::copy_to_vector;
+    using offbynull::utils::is_debug_mode;
+
+    TEST(OAAGlobalBandedDynamicProgrammingHeapAlignerTest, SanityTest) {
+        global_banded_dynamic_programming_heap_aligner<is_debug_mode()> aligner {};
+        auto substitution_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, int>::create_substitution(1, -1) };
+        auto gap_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, int>::create_gap(-1) };
+        std::string down { "panama" };
+        std::string right { "banana" };
+        const auto& [alignment, score] {
+            aligner.align(down, right, substitution_scorer, gap_scorer, 1, 0zu)
+        };
+        EXPECT_EQ(2, score);
+        std::cout << score << std::endl;
+        std::cout << alignment_to_stacked_string<is_debug_mode()>(down, right, alignment) << std::endl;
+    }
+
+    TEST(OAAGlobalBandedDynamicProgrammingHeapAlignerTest, MatchesUnbandedTest) {
+        global_banded_dynamic_programming_heap_aligner<is_debug_mode()> banded_aligner {};
+        global_dynamic_programming_heap_aligner<is_debug_mode()> aligner {};
+        auto substitution_scorer {
+            simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_substitution(1.0f64, -1.0f64)
+        };
+        auto gap_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_gap(-1.0f64) };
+
+        const std::vector<std::pair<std::string, std::string>> seq_pairs {
+            // near-identical
+            { "thequickbrownfoxjumpsoverthelazydog", "thequickbrownfoxjumpedoverthelazydog" },
+            // shifted
+            { "aaaaaaaaaaaaaaaabbbbbbbbbbbbbbbb", "bbbbbbbbbbbbbbbbcccccccccccccccc" },
+            // lengths differ
+            { "abcdefghijklmnopqrstuvwxyz", "abcdxyz" },
+            { "hello", "helloworldhelloworld" },
+            // unrelated
+            { "zzzzzzzzzzzz", "aaaaaaaaaaaa" },
+            // empty
+            { "", "abc" },
+            { "abc", "" }
+        };
+        for (const auto& [down, right] : seq_pairs) {
+            for (const std::size_t initial_band_extent : { 0zu, 1zu, 4zu, 100zu }) {
+                const auto& [banded_alignment, banded_score] {
+                    banded_aligner.align(down, right, substitution_scorer, gap_scorer, 1.0f64, initial_band_extent)
+                };
+                const auto& [alignment, score] {
+                    aligner.align(down, right, substitution_scorer, gap_scorer)
+                };
+                EXPECT_EQ(score, banded_score);
+                EXPECT_EQ(copy_to_vector(alignment), copy_to_vector(banded_alignment));
+            }
+        }
+    }
+
+    TEST(OAAGlobalBandedDynamicProgrammingHeapAlignerTest, ParameterizationTest) {
+        global_banded_dynamic_programming_heap_aligner<is_debug_mode()> aligner {};
+
+        std::string down { "panama" };
+        std::string right { "banana" };
+
+        auto align_ {
+            [&]<typename N_INDEX, typename WEIGHT>() {
+                auto substitution_scorer {
+                    simple_scorer<is_debug_mode(), N_INDEX, char, char, WEIGHT>::create_substitution(
+                        static_cast<WEIGHT>(1),
+                        static_cast<WEIGHT>(-1)
+                    )
+                };
+                auto gap_scorer {
+                    simple_scorer<is_debug_mode(), N_INDEX, char, char, WEIGHT>::create_gap(
+                        static_cast<WEIGHT>(-1)
+                    )
+                };
+                const auto& [alignment, score] {
+                    aligner.align_strict<N_INDEX, WEIGHT>(down, right, substitution_scorer, gap_scorer, static_cast<WEIGHT>(1), 0zu)
+                };
+                return score;
+            }
+        };
+
+        // small index type
+        EXPECT_EQ(2, (align_.operator()<std::uint8_t, std::int8_t>()));
+        EXPECT_EQ(2, (align_.operator()<std::uint8_t, std::int64_t>()));
+        EXPECT_EQ(2, (align_.operator()<std::uint8_t, std::float64_t>()));
+        // large index type
+        EXPECT_EQ(2, (align_.operator()<std::size_t, std::int8_t>()));
+        EXPECT_EQ(2, (align_.operator()<std::size_t, std::int64_t>()));
+        EXPECT_EQ(2, (align_.operator()<std::size_t, std::float64_t>()));
+    }
+}
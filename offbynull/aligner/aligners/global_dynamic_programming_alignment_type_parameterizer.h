@@ -6,10 +6,12 @@
 #include <limits>
 #include "offbynull/concepts.h"
 #include "offbynull/utils.h"
+#include "offbynull/aligner/aligners/internal_utils.h"
 
 namespace offbynull::aligner::aligners::global_dynamic_programming_alignment_type_parameterizer {
     using offbynull::concepts::widenable_to_size_t;
     using offbynull::utils::narrowest_type_for_indexing;
+    using offbynull::aligner::aligners::internal_utils::saturating_multiply;
 
     /**
      * Parameters for dynamic programming global alignment.
@@ -28,7 +30,7 @@ namespace offbynull::aligner::aligners::global_dynamic_programming_alignment_typ
 
     private:
         static constexpr std::size_t max_index { std::numeric_limits<N_INDEX>::max() };
-        static constexpr std::size_t max_slots { max_index * max_index * 1zu };  // down * right * depth
+        static constexpr std::size_t max_slots { saturating_multiply(max_index, max_index) };  // down * right * depth
 
     public:
         /**
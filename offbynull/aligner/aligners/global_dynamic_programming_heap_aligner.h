@@ -9,8 +9,15 @@
 #include "offbynull/aligner/sequence/sequence.h"
 #include "offbynull/aligner/scorer/scorer.h"
 #include "offbynull/aligner/scorers/widening_scorer.h"
+#include "offbynull/aligner/scorers/transposing_scorer.h"
 #include "offbynull/aligner/graphs/pairwise_global_alignment_graph.h"
 #include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/backtracker.h"
+#include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/backtracker_workspace.h"
+#include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/backtracker_workspace_container_creator_pack.h"
+#include "offbynull/aligner/backtrackers/anti_diagonal_pairwise_alignment_graph_backtracker/backtracker.h"
+#include "offbynull/aligner/backtrackers/anti_diagonal_pairwise_alignment_graph_backtracker/backtracker_workspace_container_creator_pack.h"
+#include "offbynull/aligner/backtrackers/bit_parallel_edit_distance_backtracker/backtracker.h"
+#include "offbynull/aligner/backtrackers/bit_parallel_edit_distance_backtracker/concepts.h"
 #include "offbynull/aligner/aligners/global_dynamic_programming_alignment_type_parameterizer.h"
 #include "offbynull/concepts.h"
 #include "offbynull/utils.h"
@@ -26,25 +33,56 @@ namespace offbynull::aligner::aligners::global_dynamic_programming_heap_aligner
     using offbynull::aligner::scorer::scorer::scorer;
     using offbynull::aligner::scorer::scorer::scorer_without_explicit_weight_or_seq_index;
     using offbynull::aligner::scorers::widening_scorer::widening_scorer;
+    using offbynull::aligner::scorers::transposing_scorer::transposing_scorer;
     using offbynull::aligner::concepts::weight;
     using offbynull::aligner::graphs::pairwise_global_alignment_graph::pairwise_global_alignment_graph;
-    using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtracker_heap_container_creator_pack
-        ::backtracker_heap_container_creator_pack;
+    using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtracker_workspace_container_creator_pack
+        ::backtracker_workspace_container_creator_pack;
+    using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtracker_workspace::backtracker_workspace;
     using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtracker::backtracker;
+    using offbynull::aligner::backtrackers::anti_diagonal_pairwise_alignment_graph_backtracker::concepts::anti_diagonal_backtrackable_graph;
+    using offbynull::aligner::backtrackers::bit_parallel_edit_distance_backtracker::concepts::bit_parallel_alignable;
+    using offbynull::aligner::backtrackers::bit_parallel_edit_distance_backtracker::backtracker::create_heap_backtracker;
     using offbynull::aligner::aligners::global_dynamic_programming_alignment_type_parameterizer
         ::global_dynamic_programming_alignment_type_parameterizer;
     using offbynull::aligner::aligners::concepts::alignment_result;
     using offbynull::aligner::aligners::internal_utils::validate_align_and_extract_widest_weight;
+    using offbynull::aligner::aligners::internal_utils::heap_find_max_path_weight;
 
     /**
      * Global pairwise aligner using dynamic programming algorithm (see
      * @ref offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtracker) and heap allocation.
      *
+     * When aligning sequences of single byte elements scored by
+     * @ref offbynull::aligner::scorers::levenshtein_scorer::levenshtein_scorer, `score_only()` instead uses
+     * @ref offbynull::aligner::backtrackers::bit_parallel_edit_distance_backtracker::backtracker::backtracker. `align()` doesn't, since
+     * the bit-parallel traceback may pick a different path than this aligner's backtracker when multiple paths tie for the same score.
+     *
      * @tparam debug_mode `true` to enable debugging logic, `false` otherwise.
      */
     template<bool debug_mode>
     class global_dynamic_programming_heap_aligner {
+    private:
+        /**
+         * Workspace that backtrackers lease their internal containers from, or `nullptr` to allocate them anew on each call.
+         */
+        backtracker_workspace* workspace;
+
     public:
+        /**
+         * Construct an
+         * @ref offbynull::aligner::aligners::global_dynamic_programming_heap_aligner::global_dynamic_programming_heap_aligner
+         * instance.
+         *
+         * Workspaces (see
+         * @ref offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtracker_workspace::backtracker_workspace) aren't
+         * thread-safe, meaning that an instance constructed with a workspace must not be used by multiple threads at once.
+         *
+         * @param workspace_ Workspace to lease backtracker containers from, such that repeated calls to `align()` reuse the same storage,
+         *     or `nullptr` to allocate them anew on each call.
+         */
+        global_dynamic_programming_heap_aligner(backtracker_workspace* workspace_ = nullptr)
+        : workspace { workspace_ } {}
 
         /**
          * Align two sequences.
@@ -167,23 +205,51 @@ namespace offbynull::aligner::aligners::global_dynamic_programming_heap_aligner
                 substitution_scorer,
                 gap_scorer
             };
-            using CONTAINER_CREATOR_PACK = backtracker_heap_container_creator_pack<
-                debug_mode,
-                typename G::N,
-                typename G::E,
-                typename G::ED,
-                typename global_dynamic_programming_alignment_type_parameterizer<N_INDEX>::PARENT_COUNT,
-                typename global_dynamic_programming_alignment_type_parameterizer<N_INDEX>::SLOT_INDEX,
-                minimize_allocations
-            >;
-            backtracker<
-                debug_mode,
-                G,
-                typename global_dynamic_programming_alignment_type_parameterizer<N_INDEX>::PARENT_COUNT,
-                typename global_dynamic_programming_alignment_type_parameterizer<N_INDEX>::SLOT_INDEX,
-                CONTAINER_CREATOR_PACK
-            > backtracker_ {};
-            auto&& [path, path_weight] { backtracker_.find_max_path(graph) };  // Use auto&& vs const auto&, otherwise move() below fails
+            // Graphs with numeric weights get walked one anti-diagonal at a time, while anything else falls back to the generic
+            // backtracker.
+            auto find_max_path {
+                [&]() {
+                    if constexpr (anti_diagonal_backtrackable_graph<G>) {
+                        using CONTAINER_CREATOR_PACK = offbynull::aligner::backtrackers::anti_diagonal_pairwise_alignment_graph_backtracker
+                            ::backtracker_workspace_container_creator_pack::backtracker_workspace_container_creator_pack<
+                            debug_mode,
+                            typename G::N,
+                            typename G::E,
+                            typename G::ED,
+                            typename global_dynamic_programming_alignment_type_parameterizer<N_INDEX>::PARENT_COUNT,
+                            typename global_dynamic_programming_alignment_type_parameterizer<N_INDEX>::SLOT_INDEX,
+                            minimize_allocations
+                        >;
+                        offbynull::aligner::backtrackers::anti_diagonal_pairwise_alignment_graph_backtracker::backtracker::backtracker<
+                            debug_mode,
+                            G,
+                            typename global_dynamic_programming_alignment_type_parameterizer<N_INDEX>::PARENT_COUNT,
+                            typename global_dynamic_programming_alignment_type_parameterizer<N_INDEX>::SLOT_INDEX,
+                            CONTAINER_CREATOR_PACK
+                        > backtracker_ { {}, { workspace } };
+                        return backtracker_.find_max_path(graph);
+                    } else {
+                        using CONTAINER_CREATOR_PACK = backtracker_workspace_container_creator_pack<
+                            debug_mode,
+                            typename G::N,
+                            typename G::E,
+                            typename G::ED,
+                            typename global_dynamic_programming_alignment_type_parameterizer<N_INDEX>::PARENT_COUNT,
+                            typename global_dynamic_programming_alignment_type_parameterizer<N_INDEX>::SLOT_INDEX,
+                            minimize_allocations
+                        >;
+                        backtracker<
+                            debug_mode,
+                            G,
+                            typename global_dynamic_programming_alignment_type_parameterizer<N_INDEX>::PARENT_COUNT,
+                            typename global_dynamic_programming_alignment_type_parameterizer<N_INDEX>::SLOT_INDEX,
+                            CONTAINER_CREATOR_PACK
+                        > backtracker_ { {}, { workspace } };
+                        return backtracker_.find_max_path(graph);
+                    }
+                }
+            };
+            auto&& [path, path_weight] { find_max_path() };  // Use auto&& vs const auto&, otherwise move() below fails
             return std::make_pair(
                 std::move(path)  // move() needed to ensure that transform operation below owns path
                     | std::views::transform(
@@ -194,6 +260,204 @@ namespace offbynull::aligner::aligners::global_dynamic_programming_heap_aligner
                 path_weight
             );
         }
+
+        /**
+         * Score two sequences without aligning them. The alignment graph is walked one row at a time (see
+         * @ref offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::forward_walker::forward_walker::forward_walker),
+         * meaning that only the rows being walked are held in memory rather than the entire graph.
+         *
+         * If `down` is shorter than `right`, the graph is transposed such that its rows span the shorter sequence.
+         *
+         * @tparam minimize_allocations `true` to force certain internal containers to reserve (preallocate) elements thereby
+         *     removing/reducing the need for adhoc reallocations, `false` otherwise.
+         * @tparam N_INDEX Alignment graph node coordinate type (must be wide enough to hold `std::max(down.size(), right.size()) + 1zu`).
+         * @param down Sequence 1.
+         * @param right Sequence 2.
+         * @param substitution_scorer Match/mismatch (substitution) scorer.
+         * @param gap_scorer Gap (indel) scorer.
+         * @return Score of the global alignment of `down` vs `right`.
+         */
+        template<
+            bool minimize_allocations = true,
+            widenable_to_size_t N_INDEX = std::size_t
+        >
+        auto score_only(
+            const sequence auto& down,
+            const sequence auto& right,
+            const scorer_without_explicit_weight_or_seq_index<
+                std::remove_cvref_t<decltype(down[0])>,
+                std::remove_cvref_t<decltype(right[0])>
+            > auto& substitution_scorer,
+            const scorer_without_explicit_weight_or_seq_index<
+                std::remove_cvref_t<decltype(down[0])>,
+                std::remove_cvref_t<decltype(right[0])>
+            > auto& gap_scorer
+        ) {
+            auto widest_weight_type_tagger {
+                validate_align_and_extract_widest_weight<
+                    debug_mode,
+                    N_INDEX,
+                    std::remove_cvref_t<decltype(substitution_scorer)>,
+                    std::remove_cvref_t<decltype(gap_scorer)>
+                >(down, right)
+            };
+            using WEIGHT = typename decltype(widest_weight_type_tagger)::type;
+            using DOWN_ELEM = std::remove_cvref_t<decltype(down[0])>;
+            using RIGHT_ELEM = std::remove_cvref_t<decltype(right[0])>;
+
+            // Levenshtein scoring over single byte elements is an edit distance, which bit-parallel column walks compute without
+            // materializing the alignment graph.
+            if constexpr (
+                bit_parallel_alignable<
+                    DOWN_ELEM,
+                    RIGHT_ELEM,
+                    std::remove_cvref_t<decltype(substitution_scorer)>,
+                    std::remove_cvref_t<decltype(gap_scorer)>
+                >
+            ) {
+                return static_cast<WEIGHT>(
+                    -create_heap_backtracker<debug_mode, N_INDEX, minimize_allocations>().find_global_cost(down, right)
+                );
+            } else {
+                // Wrap scorers into ones that'll cast from N_INDEX to the scorer's SEQ_INDEX (widens, doesn't narrow). Likewise, the
+                // wrapped scorer's result will be cast to WEIGHT type derived above (widens). This is to make it easier for the user
+                // (e.g., they submit scorers with mismatching N_INDEX / WEIGHT).
+                const widening_scorer<
+                    debug_mode,
+                    N_INDEX,
+                    DOWN_ELEM,
+                    RIGHT_ELEM,
+                    WEIGHT,
+                    std::remove_cvref_t<decltype(substitution_scorer)>
+                > widened_substitution_scorer {
+                    substitution_scorer
+                };
+                const widening_scorer<
+                    debug_mode,
+                    N_INDEX,
+                    DOWN_ELEM,
+                    RIGHT_ELEM,
+                    WEIGHT,
+                    std::remove_cvref_t<decltype(gap_scorer)>
+                > widened_gap_scorer {
+                    gap_scorer
+                };
+
+                return score_only_strict<N_INDEX, WEIGHT, minimize_allocations>(
+                    down,
+                    right,
+                    widened_substitution_scorer,
+                    widened_gap_scorer
+                );
+            }
+        }
+
+        /**
+         * Score two sequences without aligning them. The alignment graph is walked one row at a time (see
+         * @ref offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::forward_walker::forward_walker::forward_walker),
+         * meaning that only the rows being walked are held in memory rather than the entire graph.
+         *
+         * If `down` is shorter than `right`, the graph is transposed such that its rows span the shorter sequence.
+         *
+         * @tparam minimize_allocations `true` to force certain internal containers to reserve (preallocate) elements thereby
+         *     removing/reducing the need for adhoc reallocations, `false` otherwise.
+         * @tparam WEIGHT Alignment graph edge weight type.
+         * @tparam N_INDEX Alignment graph node coordinate type (must be wide enough to hold `std::max(down.size(), right.size()) + 1zu`).
+         * @param down Sequence 1.
+         * @param right Sequence 2.
+         * @param substitution_scorer Match/mismatch (substitution) scorer.
+         * @param gap_scorer Gap (indel) scorer.
+         * @return Score of the global alignment of `down` vs `right`.
+         */
+        template<
+            widenable_to_size_t N_INDEX,
+            weight WEIGHT,
+            bool minimize_allocations = true
+        >
+        WEIGHT score_only_strict(
+            const sequence auto& down,
+            const sequence auto& right,
+            const scorer<
+                N_INDEX,
+                std::remove_cvref_t<decltype(down[0])>,
+                std::remove_cvref_t<decltype(right[0])>,
+                WEIGHT
+            > auto& substitution_scorer,
+            const scorer<
+                N_INDEX,
+                std::remove_cvref_t<decltype(down[0])>,
+                std::remove_cvref_t<decltype(right[0])>,
+                WEIGHT
+            > auto& gap_scorer
+        ) {
+            if (down.size() < right.size()) {
+                using DOWN_ELEM = std::remove_cvref_t<decltype(down[0])>;
+                using RIGHT_ELEM = std::remove_cvref_t<decltype(right[0])>;
+                const transposing_scorer<
+                    debug_mode,
+                    N_INDEX,
+                    DOWN_ELEM,
+                    RIGHT_ELEM,
+                    WEIGHT,
+                    std::remove_cvref_t<decltype(substitution_scorer)>
+                > transposed_substitution_scorer {
+                    substitution_scorer
+                };
+                const transposing_scorer<
+                    debug_mode,
+                    N_INDEX,
+                    DOWN_ELEM,
+                    RIGHT_ELEM,
+                    WEIGHT,
+                    std::remove_cvref_t<decltype(gap_scorer)>
+                > transposed_gap_scorer {
+                    gap_scorer
+                };
+                return find_max_path_weight<N_INDEX, WEIGHT, minimize_allocations>(
+                    right,
+                    down,
+                    transposed_substitution_scorer,
+                    transposed_gap_scorer
+                );
+            }
+            return find_max_path_weight<N_INDEX, WEIGHT, minimize_allocations>(
+                down,
+                right,
+                substitution_scorer,
+                gap_scorer
+            );
+        }
+
+    private:
+
+        template<
+            widenable_to_size_t N_INDEX,
+            weight WEIGHT,
+            bool minimize_allocations
+        >
+        WEIGHT find_max_path_weight(
+            const sequence auto& down,
+            const sequence auto& right,
+            const auto& substitution_scorer,
+            const auto& gap_scorer
+        ) {
+            using G = pairwise_global_alignment_graph<
+                debug_mode,
+                N_INDEX,
+                WEIGHT,
+                std::remove_cvref_t<decltype(down)>,
+                std::remove_cvref_t<decltype(right)>,
+                std::remove_cvref_t<decltype(substitution_scorer)>,
+                std::remove_cvref_t<decltype(gap_scorer)>
+            >;
+            G graph {
+                down,
+                right,
+                substitution_scorer,
+                gap_scorer
+            };
+            return heap_find_max_path_weight<debug_mode, minimize_allocations>(graph);
+        }
     };
 
 }
@@ -3,18 +3,26 @@
 #include <stdfloat>
 #include <iostream>
 #include <ostream>
+#include <random>
+#include <ranges>
 #include <string>
+#include <utility>
 #include "offbynull/aligner/aligners/global_dynamic_programming_heap_aligner.h"
 #include "offbynull/aligner/scorers/simple_scorer.h"
+#include "offbynull/aligner/scorers/levenshtein_scorer.h"
 #include "offbynull/aligner/aligners/utils.h"
 #include "offbynull/aligner/aligners/concepts.h"
+#include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/backtracker_workspace.h"
 #include "offbynull/utils.h"
 #include "gtest/gtest.h"
 
 namespace {
     using offbynull::aligner::aligners::global_dynamic_programming_heap_aligner::global_dynamic_programming_heap_aligner;
     using offbynull::aligner::scorers::simple_scorer::simple_scorer;
+    using offbynull::aligner::scorers::levenshtein_scorer::levenshtein_scorer;
     using offbynull::aligner::aligners::utils::alignment_to_stacked_string;
+    using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtracker_workspace::backtracker_workspace;
+    using offbynull::utils::copy_to_vector;
     using offbynull::utils::is_debug_mode;
 
     TEST(OAAGlobalDynamicProgrammingHeapAlignerTest, SanityTest) {
@@ -82,4 +90,94 @@ namespace {
         EXPECT_EQ(4zu, (align_.operator()<std::size_t, std::float32_t>()));
         EXPECT_EQ(4zu, (align_.operator()<std::size_t, std::float64_t>()));
     }
-}
\ No newline at end of file
+
+    TEST(OAAGlobalDynamicProgrammingHeapAlignerTest, LevenshteinTest) {
+        global_dynamic_programming_heap_aligner<is_debug_mode()> aligner {};
+        levenshtein_scorer<is_debug_mode(), std::size_t, char, char, int> levenshtein {};
+        auto substitution_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, int>::create_substitution(0, -1) };
+        auto gap_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, int>::create_gap(-1) };
+        std::string down { "kitten" };
+        std::string right { "sitting" };
+        const auto& [alignment, score] { aligner.align(down, right, levenshtein, levenshtein) };
+        EXPECT_EQ(-3, score);
+        std::cout << alignment_to_stacked_string<is_debug_mode()>(down, right, alignment) << std::endl;
+        // Levenshtein scorers get scored via bit-vectors but still get aligned via the graph, so the path (including how ties are broken)
+        // must be exactly the same as the path for the equivalent simple scorers
+        std::mt19937_64 rand { 12345 };
+        auto random_integer { [&](auto a, auto b) -> decltype(a) { return std::uniform_int_distribution<decltype(a)>(a,b)(rand); } };
+        auto random_string {
+            [&](std::size_t max_len) {
+                std::string ret {};
+                for ([[maybe_unused]] auto _ : std::views::iota(0zu, random_integer(1zu, max_len))) {
+                    ret += random_integer('a', 'c');
+                }
+                return ret;
+            }
+        };
+        for ([[maybe_unused]] auto _ : std::views::iota(0u, 100u)) {
+            std::string seq1 { random_string(80zu) };
+            std::string seq2 { random_string(80zu) };
+            const auto& [actual_alignment, actual_score] { aligner.align(seq1, seq2, levenshtein, levenshtein) };
+            const auto& [expected_alignment, expected_score] { aligner.align(seq1, seq2, substitution_scorer, gap_scorer) };
+            EXPECT_EQ(copy_to_vector(expected_alignment), copy_to_vector(actual_alignment));
+            EXPECT_EQ(expected_score, actual_score);
+            EXPECT_EQ(expected_score, aligner.score_only(seq1, seq2, levenshtein, levenshtein));
+        }
+    }
+
+    TEST(OAAGlobalDynamicProgrammingHeapAlignerTest, ScoreOnlyTest) {
+        global_dynamic_programming_heap_aligner<is_debug_mode()> aligner {};
+        auto substitution_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, std::size_t>::create_substitution(1zu, 0zu) };
+        auto gap_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, std::size_t>::create_gap(0zu) };
+        std::string down { "panama" };
+        std::string right { "bananarama" };
+        const auto& score1 {
+            aligner.score_only(down, right, substitution_scorer, gap_scorer)
+        };
+        const auto& score2 {
+            aligner.score_only(right, down, substitution_scorer, gap_scorer)
+        };
+        const auto& [alignment1, expected_score1] {
+            aligner.align(down, right, substitution_scorer, gap_scorer)
+        };
+        const auto& [alignment2, expected_score2] {
+            aligner.align(right, down, substitution_scorer, gap_scorer)
+        };
+        EXPECT_EQ(expected_score1, score1);
+        EXPECT_EQ(expected_score2, score2);
+    }
+
+    TEST(OAAGlobalDynamicProgrammingHeapAlignerTest, WorkspaceTest) {
+        global_dynamic_programming_heap_aligner<is_debug_mode()> aligner {};
+        auto substitution_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, std::int32_t>::create_substitution(1, -1) };
+        auto gap_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, std::int32_t>::create_gap(-1) };
+        auto float_substitution_scorer {
+            simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_substitution(1.0f64, -0.5f64)
+        };
+        auto float_gap_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_gap(-1.0f64) };
+        // A single workspace is shared across differently sized sequences and different weight types.
+        backtracker_workspace workspace {};
+        global_dynamic_programming_heap_aligner<is_debug_mode()> workspace_aligner { &workspace };
+        for (const auto& [down, right] : {
+            std::pair<std::string, std::string> { "panama", "banana" },
+            std::pair<std::string, std::string> { "panamacanal", "bananaramacanal" },
+            std::pair<std::string, std::string> { "a", "c" },
+            std::pair<std::string, std::string> { "panamacanal", "bananaramacanal" }
+        }) {
+            {
+                const auto& [expected_alignment, expected_score] { aligner.align(down, right, substitution_scorer, gap_scorer) };
+                const auto& [alignment, score] { workspace_aligner.align(down, right, substitution_scorer, gap_scorer) };
+                EXPECT_EQ(copy_to_vector(alignment), copy_to_vector(expected_alignment));
+                EXPECT_EQ(score, expected_score);
+            }
+            {
+                const auto& [expected_alignment, expected_score] {
+                    aligner.align(down, right, float_substitution_scorer, float_gap_scorer)
+                };
+                const auto& [alignment, score] { workspace_aligner.align(down, right, float_substitution_scorer, float_gap_scorer) };
+                EXPECT_EQ(copy_to_vector(alignment), copy_to_vector(expected_alignment));
+                EXPECT_EQ(score, expected_score);
+            }
+        }
+    }
+}
@@ -2,13 +2,17 @@
 #include <iostream>
 #include <ostream>
 #include <string>
+#include <limits>
 #include <stdfloat>
 #include <cstdint>
+#include <memory_resource>
+#include <utility>
 #include "offbynull/aligner/aligners/global_sliced_subdivision_heap_aligner.h"
 #include "offbynull/aligner/scorers/simple_scorer.h"
 #include "offbynull/aligner/aligners/utils.h"
 #include "offbynull/aligner/aligners/concepts.h"
 #include "offbynull/utils.h"
+#include "offbynull/helpers/forkable_thread_pool.h"
 #include "gtest/gtest.h"
 
 namespace {
@@ -16,6 +20,8 @@ namespace {
     using offbynull::aligner::scorers::simple_scorer::simple_scorer;
     using offbynull::aligner::aligners::utils::alignment_to_stacked_string;
     using offbynull::utils::is_debug_mode;
+    using offbynull::utils::copy_to_vector;
+    using offbynull::helpers::forkable_thread_pool::forkable_thread_pool;
 
     TEST(OAAGlobalSlicedSubdivisionHeapAlignerTest, SanityTest) {
         global_sliced_subdivision_heap_aligner<is_debug_mode()> aligner {};
@@ -84,4 +90,132 @@ namespace {
         // EXPECT_EQ(4zu, (align_.operator()<std::size_t, std::float32_t>()));
         EXPECT_EQ(4zu, (align_.operator()<std::size_t, std::float64_t>()));
     }
-}
\ No newline at end of file
+
+    TEST(OAAGlobalSlicedSubdivisionHeapAlignerTest, ScoreOnlyTest) {
+        global_sliced_subdivision_heap_aligner<is_debug_mode()> aligner {};
+        auto substitution_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, std::size_t>::create_substitution(1zu, 0zu) };
+        auto gap_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, std::size_t>::create_gap(0zu) };
+        std::string down { "panama" };
+        std::string right { "bananarama" };
+        const auto& score1 {
+            aligner.score_only(down, right, substitution_scorer, gap_scorer)
+        };
+        const auto& score2 {
+            aligner.score_only(right, down, substitution_scorer, gap_scorer)
+        };
+        const auto& [alignment1, expected_score1] {
+            aligner.align(down, right, substitution_scorer, gap_scorer, 0zu)
+        };
+        const auto& [alignment2, expected_score2] {
+            aligner.align(right, down, substitution_scorer, gap_scorer, 0zu)
+        };
+        EXPECT_EQ(expected_score1, score1);
+        EXPECT_EQ(expected_score2, score2);
+    }
+
+    TEST(OAAGlobalSlicedSubdivisionHeapAlignerTest, ArenaTest) {
+        global_sliced_subdivision_heap_aligner<is_debug_mode()> aligner {};
+        // A single pool is shared across alignments, with the backtracker's scratch containers recycling its memory.
+        std::pmr::unsynchronized_pool_resource resource {};
+        global_sliced_subdivision_heap_aligner<is_debug_mode()> arena_aligner { &resource };
+        auto substitution_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, std::int32_t>::create_substitution(1, -1) };
+        auto gap_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, std::int32_t>::create_gap(-1) };
+        for (const auto& [down, right] : {
+            std::pair<std::string, std::string> { "panama", "banana" },
+            std::pair<std::string, std::string> { "panamacanal", "bananaramacanal" },
+            std::pair<std::string, std::string> { "a", "c" },
+            std::pair<std::string, std::string> { "panamacanal", "bananaramacanal" }
+        }) {
+            const auto& [expected_alignment, expected_score] { aligner.align(down, right, substitution_scorer, gap_scorer, 0) };
+            const auto& [alignment, score] { arena_aligner.align(down, right, substitution_scorer, gap_scorer, 0) };
+            resource.release();  // Returned alignments don't come from the resource, so they survive this
+            EXPECT_EQ(copy_to_vector(alignment), copy_to_vector(expected_alignment));
+            EXPECT_EQ(score, expected_score);
+        }
+    }
+
+    TEST(OAAGlobalSlicedSubdivisionHeapAlignerTest, ThreadPoolTest) {
+        global_sliced_subdivision_heap_aligner<is_debug_mode()> aligner {};
+        forkable_thread_pool<is_debug_mode(), void> thread_pool { 4zu };
+        auto substitution_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, std::int32_t>::create_substitution(1, -1) };
+        auto gap_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, std::int32_t>::create_gap(-1) };
+        for (const auto& [down, right] : {
+            std::pair<std::string, std::string> { "panama", "banana" },
+            std::pair<std::string, std::string> { "panamacanal", "bananaramacanal" },
+            std::pair<std::string, std::string> { "a", "" },
+            std::pair<std::string, std::string> {
+                "thequickbrownfoxjumpsoverthelazydogthequickbrownfoxjumpsoverthelazydog",
+                "aquickbrowndogjumpedoverthelazyfoxesthequickbrowncatjumpsoverthedog"
+            }
+        }) {
+            const auto& [expected_alignment, expected_score] { aligner.align(down, right, substitution_scorer, gap_scorer, 0) };
+            for (std::size_t serial_node_cnt : { 0zu, 16zu, 65536zu }) {
+                global_sliced_subdivision_heap_aligner<is_debug_mode()> parallel_aligner {
+                    std::pmr::get_default_resource(),
+                    &thread_pool,
+                    serial_node_cnt
+                };
+                const auto& [alignment, score] { parallel_aligner.align(down, right, substitution_scorer, gap_scorer, 0) };
+                EXPECT_EQ(copy_to_vector(alignment), copy_to_vector(expected_alignment));
+                EXPECT_EQ(score, expected_score);
+            }
+        }
+    }
+
+    TEST(OAAGlobalSlicedSubdivisionHeapAlignerTest, FullDpTest) {
+        auto substitution_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, int>::create_substitution(1, -1) };
+        auto gap_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, int>::create_gap(-1) };
+        // Alignment's score, recomputed from its elements (free rides have no elements and score 0).
+        auto rescore {
+            [](const std::string& down, const std::string& right, const auto& alignment) {
+                int ret { 0 };
+                for (const auto& element : alignment) {
+                    if (!element.has_value()) {
+                        continue;
+                    }
+                    const auto& [down_idx, right_idx] { *element };
+                    if (down_idx.has_value() && right_idx.has_value()) {
+                        ret += down[*down_idx] == right[*right_idx] ? 1 : -1;
+                    } else {
+                        ret += -1;
+                    }
+                }
+                return ret;
+            }
+        };
+        for (const auto& [down, right] : {
+            std::pair<std::string, std::string> { "panamacanal", "bananaramacanal" },
+            std::pair<std::string, std::string> {
+                "thequickbrownfoxjumpsoverthelazydogthequickbrownfoxjumpsoverthelazydog",
+                "aquickbrowndogjumpedoverthelazyfoxesthequickbrowncatjumpsoverthedog"
+            }
+        }) {
+            const auto& [expected_alignment, expected_score] {
+                global_sliced_subdivision_heap_aligner<is_debug_mode()> { std::pmr::get_default_resource(), nullptr, 65536zu, 0zu }.align(
+                    down,
+                    right,
+                    substitution_scorer,
+                    gap_scorer,
+                    0
+                )
+            };
+            EXPECT_EQ(rescore(down, right, expected_alignment), expected_score);
+            // Cutoffs that solve only the smallest segments / roughly 128x128 segments / the whole graph in a single walk
+            for (std::size_t full_dp_node_cnt : { 1zu, 64zu, 16384zu, std::numeric_limits<std::size_t>::max() }) {
+                global_sliced_subdivision_heap_aligner<is_debug_mode()> aligner {
+                    std::pmr::get_default_resource(),
+                    nullptr,
+                    65536zu,
+                    full_dp_node_cnt
+                };
+                const auto& [alignment, score] { aligner.align(down, right, substitution_scorer, gap_scorer, 0) };
+                EXPECT_EQ(score, expected_score);
+                EXPECT_EQ(rescore(down, right, alignment), expected_score);
+            }
+            global_sliced_subdivision_heap_aligner<is_debug_mode()> default_aligner {};
+            const auto& [alignment, score] { default_aligner.align(down, right, substitution_scorer, gap_scorer, 0) };
+            EXPECT_EQ(copy_to_vector(alignment), copy_to_vector(expected_alignment));  // Cutoff is off by default, so path is unchanged
+            EXPECT_EQ(score, expected_score);
+        }
+    }
+}
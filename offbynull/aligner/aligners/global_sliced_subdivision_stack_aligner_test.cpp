@@ -90,4 +90,26 @@ namespace {
         // EXPECT_EQ(4zu, (align_.operator()<std::size_t, std::float32_t>()));
         EXPECT_EQ(4zu, (align_.operator()<std::size_t, std::float64_t>()));
     }
+
+    TEST(OAAGlobalSlicedSubdivisionStackAlignerTest, ScoreOnlyTest) {
+        global_sliced_subdivision_stack_aligner<is_debug_mode()> aligner {};
+        auto substitution_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, std::size_t>::create_substitution(1zu, 0zu) };
+        auto gap_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, std::size_t>::create_gap(0zu) };
+        std::string down { "panama" };
+        std::string right { "bananarama" };
+        const auto& score1 {
+            aligner.score_only<6zu, 10zu>(down, right, substitution_scorer, gap_scorer)
+        };
+        const auto& score2 {
+            aligner.score_only<10zu, 6zu>(right, down, substitution_scorer, gap_scorer)
+        };
+        const auto& [alignment1, expected_score1] {
+            aligner.align<6zu, 10zu>(down, right, substitution_scorer, gap_scorer, 0zu)
+        };
+        const auto& [alignment2, expected_score2] {
+            aligner.align<10zu, 6zu>(right, down, substitution_scorer, gap_scorer, 0zu)
+        };
+        EXPECT_EQ(expected_score1, score1);
+        EXPECT_EQ(expected_score2, score2);
+    }
 }
\ No newline at end of file
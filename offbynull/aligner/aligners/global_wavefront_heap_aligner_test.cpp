@@ -0,0 +1,93 @@
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <ostream>
+#include <string>
+#include <random>
+#include <ranges>
+#include <stdexcept>
+#include "offbynull/aligner/aligners/global_wavefront_heap_aligner.h"
+#include "offbynull/aligner/aligners/global_dynamic_programming_heap_aligner.h"
+#include "offbynull/aligner/scorers/simple_scorer.h"
+#include "offbynull/aligner/scorers/levenshtein_scorer.h"
+#include "offbynull/aligner/aligners/utils.h"
+#include "offbynull/aligner/aligners/concepts.h"
+#include "offbynull/utils.h"
+#include "gtest/gtest.h"
+
+namespace {
+    using offbynull::aligner::aligners::global_wavefront_heap_aligner::global_wavefront_heap_aligner;
+    using offbynull::aligner::aligners::global_dynamic_programming_heap_aligner::global_dynamic_programming_heap_aligner;
+    using offbynull::aligner::scorers::simple_scorer::simple_scorer;
+    using offbynull::aligner::scorers::levenshtein_scorer::levenshtein_scorer;
+    using offbynull::aligner::aligners::utils::alignment_to_stacked_string;
+    using offbynull::utils::is_debug_mode;
+
+    TEST(OAAGlobalWavefrontHeapAlignerTest, SanityTest) {
+        global_wavefront_heap_aligner<is_debug_mode()> aligner {};
+        auto substitution_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, int>::create_substitution(1, -1) };
+        auto gap_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, int>::create_gap(-1) };
+        std::string down { "panama" };
+        std::string right { "banana" };
+        const auto& [alignment, score] {
+            aligner.align(down, right, substitution_scorer, gap_scorer)
+        };
+        EXPECT_EQ(2, score);
+        std::cout << score << std::endl;
+        std::cout << alignment_to_stacked_string<is_debug_mode()>(down, right, alignment) << std::endl;
+        const auto& [bidi_alignment, bidi_score] {
+            aligner.align_bidirectional(down, right, substitution_scorer, gap_scorer)
+        };
+        EXPECT_EQ(2, bidi_score);
+        EXPECT_EQ(2, aligner.score_only(down, right, substitution_scorer, gap_scorer));
+    }
+
+    TEST(OAAGlobalWavefrontHeapAlignerTest, InvalidScorersTest) {
+        global_wavefront_heap_aligner<is_debug_mode()> aligner {};
+        auto substitution_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, int>::create_substitution(1, 1) };
+        auto gap_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, int>::create_gap(-1) };
+        std::string down { "panama" };
+        std::string right { "banana" };
+        EXPECT_THROW(aligner.align(down, right, substitution_scorer, gap_scorer), std::runtime_error);
+    }
+
+    TEST(OAAGlobalWavefrontHeapAlignerTest, MatchesDynamicProgrammingTest) {
+        global_wavefront_heap_aligner<is_debug_mode()> aligner {};
+        global_dynamic_programming_heap_aligner<is_debug_mode()> dp_aligner {};
+        std::mt19937_64 rand { 12345 };
+        auto random_integer { [&](auto a, auto b) -> decltype(a) { return std::uniform_int_distribution<decltype(a)>(a,b)(rand); } };
+        auto random_string {
+            [&](std::size_t max_len) {
+                std::string ret {};
+                for ([[maybe_unused]] auto _ : std::views::iota(0zu, random_integer(0zu, max_len))) {
+                    ret += random_integer('a', 'd');
+                }
+                return ret;
+            }
+        };
+        auto check {
+            [&](const std::string& down, const std::string& right, const auto& substitution_scorer, const auto& gap_scorer) {
+                const auto& [dp_alignment, dp_score] { dp_aligner.align(down, right, substitution_scorer, gap_scorer) };
+                const auto& [alignment, score] { aligner.align(down, right, substitution_scorer, gap_scorer) };
+                const auto& [bidi_alignment, bidi_score] { aligner.align_bidirectional(down, right, substitution_scorer, gap_scorer) };
+                EXPECT_EQ(dp_score, score);
+                EXPECT_EQ(dp_score, bidi_score);
+                EXPECT_EQ(dp_score, aligner.score_only(down, right, substitution_scorer, gap_scorer));
+            }
+        };
+        auto substitution_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, std::int32_t>::create_substitution(2, -3) };
+        auto gap_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, std::int32_t>::create_gap(-2) };
+        auto asymmetric_gap_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, std::int32_t> { 0, 0, -1, -4, 0 } };
+        levenshtein_scorer<is_debug_mode(), std::size_t, char, char, std::int32_t> levenshtein {};
+        for ([[maybe_unused]] auto _ : std::views::iota(0u, 30u)) {
+            std::string down { random_string(60zu) };
+            std::string right { random_string(60zu) };
+            check(down, right, substitution_scorer, gap_scorer);
+            check(down, right, substitution_scorer, asymmetric_gap_scorer);
+            check(down, right, levenshtein, levenshtein);
+        }
+        check("", "", substitution_scorer, gap_scorer);
+        check("", "abc", substitution_scorer, gap_scorer);
+        check("abc", "", substitution_scorer, asymmetric_gap_scorer);
+    }
+}
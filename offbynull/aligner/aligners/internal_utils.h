@@ -5,6 +5,10 @@
 #include "offbynull/utils.h"
 #include "offbynull/aligner/sequence/sequence.h"
 #include "offbynull/aligner/graph/pairwise_alignment_graph.h"
+#include "offbynull/aligner/graph/sliceable_pairwise_alignment_graph.h"
+#include "offbynull/aligner/backtrackers/sliceable_pairwise_alignment_graph_backtracker/forward_walker/forward_walker.h"
+#include "offbynull/aligner/backtrackers/sliceable_pairwise_alignment_graph_backtracker/forward_walker/forward_walker_heap_container_creator_pack.h"
+#include "offbynull/aligner/backtrackers/sliceable_pairwise_alignment_graph_backtracker/forward_walker/forward_walker_stack_container_creator_pack.h"
 #include "offbynull/aligner/aligners/concepts.h"
 #include <type_traits>
 #include <algorithm>
@@ -21,6 +25,12 @@ namespace offbynull::aligner::aligners::internal_utils {
     using offbynull::aligner::aligners::concepts::alignment_result;
     using offbynull::aligner::sequence::sequence::sequence;
     using offbynull::aligner::graph::pairwise_alignment_graph::pairwise_alignment_graph;
+    using offbynull::aligner::graph::sliceable_pairwise_alignment_graph::sliceable_pairwise_alignment_graph;
+    using offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::forward_walker::forward_walker::forward_walker;
+    using offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::forward_walker
+        ::forward_walker_heap_container_creator_pack::forward_walker_heap_container_creator_pack;
+    using offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::forward_walker
+        ::forward_walker_stack_container_creator_pack::forward_walker_stack_container_creator_pack;
 
     template<typename... Ts>
     struct widest_scorer_weight;
@@ -78,6 +88,107 @@ namespace offbynull::aligner::aligners::internal_utils {
         static_assert((numeric<typename std::remove_cvref_t<scorers_>::WEIGHT> && ...), "weight must be numeric");
         return widest_scorer_weight<scorers_...> {};
     }
+
+    /**
+     * Add `a` and `b`, clamping to `std::numeric_limits<std::size_t>::max()` rather than wrapping around on overflow.
+     *
+     * @param a Left-hand operand.
+     * @param b Right-hand operand.
+     * @return `a + b`, or `std::numeric_limits<std::size_t>::max()` if the sum doesn't fit.
+     */
+    constexpr std::size_t saturating_add(std::size_t a, std::size_t b) {
+        return a > std::numeric_limits<std::size_t>::max() - b ? std::numeric_limits<std::size_t>::max() : a + b;
+    }
+
+    /**
+     * Multiply `a` by `b`, clamping to `std::numeric_limits<std::size_t>::max()` rather than wrapping around on overflow. Type
+     * parameterizers use this to size containers based on the maximum value of a grid coordinate type, where an `N_INDEX` as wide as
+     * `std::size_t` would otherwise wrap (e.g., `std::size_t`'s max squared wraps around to 1).
+     *
+     * @param a Left-hand operand.
+     * @param b Right-hand operand.
+     * @return `a * b`, or `std::numeric_limits<std::size_t>::max()` if the product doesn't fit.
+     */
+    constexpr std::size_t saturating_multiply(std::size_t a, std::size_t b) {
+        return b != 0zu && a > std::numeric_limits<std::size_t>::max() / b ? std::numeric_limits<std::size_t>::max() : a * b;
+    }
+
+    /**
+     * Walk `g` from its root node to its leaf node one row at a time (see
+     * @ref offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::forward_walker::forward_walker::forward_walker),
+     * holding on to only the rows being walked (along with resident nodes) rather than the entire graph.
+     *
+     * @tparam debug_mode `true` to enable debugging logic, `false` otherwise.
+     * @tparam minimize_allocations `true` to force certain internal containers to reserve (preallocate) elements thereby
+     *     removing/reducing the need for adhoc reallocations, `false` otherwise.
+     * @tparam G Graph type.
+     * @param g Graph.
+     * @param zero_weight Initial weight, equivalent to 0 for numeric weights.
+     * @return Weight of the maximally-weighted path between `g`'s root node and leaf node.
+     */
+    template<
+        bool debug_mode,
+        bool minimize_allocations,
+        sliceable_pairwise_alignment_graph G
+    >
+    typename G::ED heap_find_max_path_weight(
+        const G& g,
+        const typename G::ED zero_weight = {}
+    ) {
+        using CONTAINER_CREATOR_PACK = forward_walker_heap_container_creator_pack<
+            debug_mode,
+            typename G::N,
+            typename G::E,
+            typename G::ED,
+            minimize_allocations
+        >;
+        auto walker {
+            forward_walker<debug_mode, G, CONTAINER_CREATOR_PACK>::create_and_initialize(
+                g,
+                static_cast<typename G::N_INDEX>(g.grid_down_cnt - 1zu),
+                zero_weight
+            )
+        };
+        return walker.find(g.get_leaf_node()).backtracking_weight;
+    }
+
+    /**
+     * Equivalent to @ref offbynull::aligner::aligners::internal_utils::heap_find_max_path_weight, but with rows allocated on the stack.
+     *
+     * @tparam debug_mode `true` to enable debugging logic, `false` otherwise.
+     * @tparam max_right_seq_size Maximum allowed length for `g`'s rightward sequence.
+     * @tparam G Graph type.
+     * @param g Graph.
+     * @param zero_weight Initial weight, equivalent to 0 for numeric weights.
+     * @return Weight of the maximally-weighted path between `g`'s root node and leaf node.
+     */
+    template<
+        bool debug_mode,
+        std::size_t max_right_seq_size,
+        sliceable_pairwise_alignment_graph G
+    >
+    typename G::ED stack_find_max_path_weight(
+        const G& g,
+        const typename G::ED zero_weight = {}
+    ) {
+        using CONTAINER_CREATOR_PACK = forward_walker_stack_container_creator_pack<
+            debug_mode,
+            typename G::N,
+            typename G::E,
+            typename G::ED,
+            G::axis_node_length(max_right_seq_size),
+            G::grid_depth_cnt,
+            G::resident_nodes_capacity
+        >;
+        auto walker {
+            forward_walker<debug_mode, G, CONTAINER_CREATOR_PACK>::create_and_initialize(
+                g,
+                static_cast<typename G::N_INDEX>(g.grid_down_cnt - 1zu),
+                zero_weight
+            )
+        };
+        return walker.find(g.get_leaf_node()).backtracking_weight;
+    }
 }
 
 #endif //OFFBYNULL_ALIGNER_ALIGNERS_INTERNAL_UTILS_H
@@ -9,8 +9,14 @@
 #include "offbynull/aligner/sequence/sequence.h"
 #include "offbynull/aligner/scorer/scorer.h"
 #include "offbynull/aligner/scorers/widening_scorer.h"
+#include "offbynull/aligner/scorers/transposing_scorer.h"
 #include "offbynull/aligner/graphs/pairwise_local_alignment_graph.h"
 #include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/backtracker.h"
+#include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/backtracker_workspace.h"
+#include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/backtracker_workspace_container_creator_pack.h"
+#include "offbynull/aligner/backtrackers/anti_diagonal_pairwise_alignment_graph_backtracker/backtracker.h"
+#include "offbynull/aligner/backtrackers/anti_diagonal_pairwise_alignment_graph_backtracker/backtracker_workspace_container_creator_pack.h"
+#include "offbynull/aligner/backtrackers/striped_pairwise_local_alignment_graph_backtracker/backtracker.h"
 #include "offbynull/aligner/aligners/local_dynamic_programming_alignment_type_parameterizer.h"
 #include "offbynull/concepts.h"
 #include "offbynull/utils.h"
@@ -26,15 +32,21 @@ namespace offbynull::aligner::aligners::local_dynamic_programming_heap_aligner {
     using offbynull::aligner::scorer::scorer::scorer;
     using offbynull::aligner::scorer::scorer::scorer_without_explicit_weight_or_seq_index;
     using offbynull::aligner::scorers::widening_scorer::widening_scorer;
+    using offbynull::aligner::scorers::transposing_scorer::transposing_scorer;
     using offbynull::aligner::concepts::weight;
     using offbynull::aligner::graphs::pairwise_local_alignment_graph::pairwise_local_alignment_graph;
-    using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtracker_heap_container_creator_pack
-        ::backtracker_heap_container_creator_pack;
+    using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtracker_workspace_container_creator_pack
+        ::backtracker_workspace_container_creator_pack;
+    using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtracker_workspace::backtracker_workspace;
     using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtracker::backtracker;
+    using offbynull::aligner::backtrackers::anti_diagonal_pairwise_alignment_graph_backtracker::concepts::anti_diagonal_backtrackable_graph;
+    using offbynull::aligner::backtrackers::striped_pairwise_local_alignment_graph_backtracker::concepts::striped_backtrackable_graph;
+    using offbynull::aligner::backtrackers::striped_pairwise_local_alignment_graph_backtracker::concepts::profilable_sequence;
     using offbynull::aligner::aligners::local_dynamic_programming_alignment_type_parameterizer
         ::local_dynamic_programming_alignment_type_parameterizer;
     using offbynull::aligner::aligners::concepts::alignment_result;
     using offbynull::aligner::aligners::internal_utils::validate_align_and_extract_widest_weight;
+    using offbynull::aligner::aligners::internal_utils::heap_find_max_path_weight;
 
     /**
      * Local pairwise aligner using dynamic programming algorithm (see
@@ -44,7 +56,27 @@ namespace offbynull::aligner::aligners::local_dynamic_programming_heap_aligner {
      */
     template<bool debug_mode>
     class local_dynamic_programming_heap_aligner {
+    private:
+        /**
+         * Workspace that backtrackers lease their internal containers from, or `nullptr` to allocate them anew on each call.
+         */
+        backtracker_workspace* workspace;
+
     public:
+        /**
+         * Construct an
+         * @ref offbynull::aligner::aligners::local_dynamic_programming_heap_aligner::local_dynamic_programming_heap_aligner
+         * instance.
+         *
+         * Workspaces (see
+         * @ref offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtracker_workspace::backtracker_workspace) aren't
+         * thread-safe, meaning that an instance constructed with a workspace must not be used by multiple threads at once.
+         *
+         * @param workspace_ Workspace to lease backtracker containers from, such that repeated calls to `align()` reuse the same storage,
+         *     or `nullptr` to allocate them anew on each call.
+         */
+        local_dynamic_programming_heap_aligner(backtracker_workspace* workspace_ = nullptr)
+        : workspace { workspace_ } {}
 
         /**
          * Align two sequences.
@@ -193,7 +225,247 @@ namespace offbynull::aligner::aligners::local_dynamic_programming_heap_aligner {
                 gap_scorer,
                 freeride_scorer
             };
-            using CONTAINER_CREATOR_PACK = backtracker_heap_container_creator_pack<
+            // Graphs with integer weights get walked one column at a time in narrow striped lanes, graphs with other numeric weights
+            // get walked one anti-diagonal at a time, and anything else falls back to the generic backtracker.
+            auto find_max_path {
+                [&]() {
+                    if constexpr (striped_backtrackable_graph<G>) {
+                        using CONTAINER_CREATOR_PACK = offbynull::aligner::backtrackers::striped_pairwise_local_alignment_graph_backtracker
+                            ::backtracker_heap_container_creator_pack::backtracker_heap_container_creator_pack<
+                            debug_mode,
+                            typename G::N,
+                            typename G::E,
+                            typename G::ED,
+                            typename local_dynamic_programming_alignment_type_parameterizer<N_INDEX>::PARENT_COUNT,
+                            typename local_dynamic_programming_alignment_type_parameterizer<N_INDEX>::SLOT_INDEX,
+                            minimize_allocations
+                        >;
+                        offbynull::aligner::backtrackers::striped_pairwise_local_alignment_graph_backtracker::backtracker::backtracker<
+                            debug_mode,
+                            G,
+                            typename local_dynamic_programming_alignment_type_parameterizer<N_INDEX>::PARENT_COUNT,
+                            typename local_dynamic_programming_alignment_type_parameterizer<N_INDEX>::SLOT_INDEX,
+                            CONTAINER_CREATOR_PACK
+                        > backtracker_ {};
+                        if constexpr (profilable_sequence<std::remove_cvref_t<decltype(right)>>) {
+                            return backtracker_.find_max_path(graph, right);
+                        } else {
+                            return backtracker_.find_max_path(graph);
+                        }
+                    } else if constexpr (anti_diagonal_backtrackable_graph<G>) {
+                        using CONTAINER_CREATOR_PACK = offbynull::aligner::backtrackers::anti_diagonal_pairwise_alignment_graph_backtracker
+                            ::backtracker_workspace_container_creator_pack::backtracker_workspace_container_creator_pack<
+                            debug_mode,
+                            typename G::N,
+                            typename G::E,
+                            typename G::ED,
+                            typename local_dynamic_programming_alignment_type_parameterizer<N_INDEX>::PARENT_COUNT,
+                            typename local_dynamic_programming_alignment_type_parameterizer<N_INDEX>::SLOT_INDEX,
+                            minimize_allocations
+                        >;
+                        offbynull::aligner::backtrackers::anti_diagonal_pairwise_alignment_graph_backtracker::backtracker::backtracker<
+                            debug_mode,
+                            G,
+                            typename local_dynamic_programming_alignment_type_parameterizer<N_INDEX>::PARENT_COUNT,
+                            typename local_dynamic_programming_alignment_type_parameterizer<N_INDEX>::SLOT_INDEX,
+                            CONTAINER_CREATOR_PACK
+                        > backtracker_ { {}, { workspace } };
+                        return backtracker_.find_max_path(graph);
+                    } else {
+                        using CONTAINER_CREATOR_PACK = backtracker_workspace_container_creator_pack<
+                            debug_mode,
+                            typename G::N,
+                            typename G::E,
+                            typename G::ED,
+                            typename local_dynamic_programming_alignment_type_parameterizer<N_INDEX>::PARENT_COUNT,
+                            typename local_dynamic_programming_alignment_type_parameterizer<N_INDEX>::SLOT_INDEX,
+                            minimize_allocations
+                        >;
+                        backtracker<
+                            debug_mode,
+                            G,
+                            typename local_dynamic_programming_alignment_type_parameterizer<N_INDEX>::PARENT_COUNT,
+                            typename local_dynamic_programming_alignment_type_parameterizer<N_INDEX>::SLOT_INDEX,
+                            CONTAINER_CREATOR_PACK
+                        > backtracker_ { {}, { workspace } };
+                        return backtracker_.find_max_path(graph);
+                    }
+                }
+            };
+            auto&& [path, path_weight] { find_max_path() };  // Use auto&& vs const auto&, otherwise move() below fails
+            return std::make_pair(
+                std::move(path)  // move() needed to ensure that transform operation below owns path
+                    | std::views::transform(
+                        [graph](const typename G::E& edge) {  // WARNING: Lambda capture of "graph" must be copy/move to avoid dangling ref.
+                            return graph.edge_to_element_offsets(edge);
+                        }
+                    ),
+                path_weight
+            );
+        }
+
+        /**
+         * Align two sequences using X-drop pruning. While the alignment graph is walked, any part of it whose score falls more than
+         * `xdrop` below the best score seen so far is pruned rather than extended further, which skips over regions that are unlikely to
+         * rejoin the optimal alignment (see
+         * @ref offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtracker::backtracker). The result may not be
+         * the optimal alignment if `xdrop` is too small.
+         *
+         * @tparam minimize_allocations `true` to force certain internal containers to reserve (preallocate) elements thereby
+         *     removing/reducing the need for adhoc reallocations, `false` otherwise.
+         * @tparam N_INDEX Alignment graph node coordinate type (must be wide enough to hold `std::max(down.size(), right.size()) + 1zu`).
+         * @param down Sequence 1.
+         * @param right Sequence 2.
+         * @param substitution_scorer Match/mismatch (substitution) scorer.
+         * @param gap_scorer Gap (indel) scorer.
+         * @param freeride_scorer Freeride scorer.
+         * @param xdrop Maximum amount a score may trail the best score seen so far before being pruned.
+         * @return Local alignment of `down` vs `right` along with the score of that alignment.
+         */
+        template<
+            bool minimize_allocations = true,
+            widenable_to_size_t N_INDEX = std::size_t
+        >
+        alignment_result auto align(
+            const sequence auto& down,
+            const sequence auto& right,
+            const scorer_without_explicit_weight_or_seq_index<
+                std::remove_cvref_t<decltype(down[0])>,
+                std::remove_cvref_t<decltype(right[0])>
+            > auto& substitution_scorer,
+            const scorer_without_explicit_weight_or_seq_index<
+                std::remove_cvref_t<decltype(down[0])>,
+                std::remove_cvref_t<decltype(right[0])>
+            > auto& gap_scorer,
+            const scorer_without_explicit_weight_or_seq_index<
+                std::remove_cvref_t<decltype(down[0])>,
+                std::remove_cvref_t<decltype(right[0])>
+            > auto& freeride_scorer,
+            const weight auto xdrop
+        ) {
+            auto widest_weight_type_tagger {
+                validate_align_and_extract_widest_weight<
+                    debug_mode,
+                    N_INDEX,
+                    std::remove_cvref_t<decltype(substitution_scorer)>,
+                    std::remove_cvref_t<decltype(gap_scorer)>,
+                    std::remove_cvref_t<decltype(freeride_scorer)>
+                >(down, right)
+            };
+            using WEIGHT = typename decltype(widest_weight_type_tagger)::type;
+
+            // Wrap scorers into ones that'll cast from N_INDEX to the scorer's SEQ_INDEX (widens, doesn't narrow). Likewise, the
+            // wrapped scorer's result will be cast to WEIGHT type derived above (widens). This is to make it easier for the user
+            // (e.g., they submit scorers with mismatching N_INDEX / WEIGHT).
+            using DOWN_ELEM = std::remove_cvref_t<decltype(down[0])>;
+            using RIGHT_ELEM = std::remove_cvref_t<decltype(right[0])>;
+            const widening_scorer<
+                debug_mode,
+                N_INDEX,
+                DOWN_ELEM,
+                RIGHT_ELEM,
+                WEIGHT,
+                std::remove_cvref_t<decltype(substitution_scorer)>
+            > widened_substitution_scorer {
+                substitution_scorer
+            };
+            const widening_scorer<
+                debug_mode,
+                N_INDEX,
+                DOWN_ELEM,
+                RIGHT_ELEM,
+                WEIGHT,
+                std::remove_cvref_t<decltype(gap_scorer)>
+            > widened_gap_scorer {
+                gap_scorer
+            };
+            const widening_scorer<
+                debug_mode,
+                N_INDEX,
+                DOWN_ELEM,
+                RIGHT_ELEM,
+                WEIGHT,
+                std::remove_cvref_t<decltype(freeride_scorer)>
+            > widened_freeride_scorer {
+                freeride_scorer
+            };
+
+            return align_strict<N_INDEX, WEIGHT, minimize_allocations>(
+                down,
+                right,
+                widened_substitution_scorer,
+                widened_gap_scorer,
+                widened_freeride_scorer,
+                static_cast<WEIGHT>(xdrop)
+            );
+        }
+
+        /**
+         * Align two sequences using X-drop pruning. While the alignment graph is walked, any part of it whose score falls more than
+         * `xdrop` below the best score seen so far is pruned rather than extended further, which skips over regions that are unlikely to
+         * rejoin the optimal alignment (see
+         * @ref offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtracker::backtracker). The result may not be
+         * the optimal alignment if `xdrop` is too small.
+         *
+         * @tparam minimize_allocations `true` to force certain internal containers to reserve (preallocate) elements thereby
+         *     removing/reducing the need for adhoc reallocations, `false` otherwise.
+         * @tparam WEIGHT Alignment graph edge weight type.
+         * @tparam N_INDEX Alignment graph node coordinate type (must be wide enough to hold `std::max(down.size(), right.size()) + 1zu`).
+         * @param down Sequence 1.
+         * @param right Sequence 2.
+         * @param substitution_scorer Match/mismatch (substitution) scorer.
+         * @param gap_scorer Gap (indel) scorer.
+         * @param freeride_scorer Freeride scorer.
+         * @param xdrop Maximum amount a score may trail the best score seen so far before being pruned.
+         * @return Local alignment of `down` vs `right` along with the score of that alignment.
+         */
+        template<
+            widenable_to_size_t N_INDEX,
+            weight WEIGHT,
+            bool minimize_allocations = true
+        >
+        alignment_result auto align_strict(
+            const sequence auto& down,
+            const sequence auto& right,
+            const scorer<
+                N_INDEX,
+                std::remove_cvref_t<decltype(down[0])>,
+                std::remove_cvref_t<decltype(right[0])>,
+                WEIGHT
+            > auto& substitution_scorer,
+            const scorer<
+                N_INDEX,
+                std::remove_cvref_t<decltype(down[0])>,
+                std::remove_cvref_t<decltype(right[0])>,
+                WEIGHT
+            > auto& gap_scorer,
+            const scorer<
+                N_INDEX,
+                std::remove_cvref_t<decltype(down[0])>,
+                std::remove_cvref_t<decltype(right[0])>,
+                WEIGHT
+            > auto& freeride_scorer,
+            const WEIGHT xdrop
+        ) {
+            using G = pairwise_local_alignment_graph<
+                debug_mode,
+                N_INDEX,
+                WEIGHT,
+                std::remove_cvref_t<decltype(down)>,
+                std::remove_cvref_t<decltype(right)>,
+                std::remove_cvref_t<decltype(substitution_scorer)>,
+                std::remove_cvref_t<decltype(gap_scorer)>,
+                std::remove_cvref_t<decltype(freeride_scorer)>
+            >;
+            G graph {
+                down,
+                right,
+                substitution_scorer,
+                gap_scorer,
+                freeride_scorer
+            };
+            // X-drop pruning is only supported by the generic backtracker.
+            using CONTAINER_CREATOR_PACK = backtracker_workspace_container_creator_pack<
                 debug_mode,
                 typename G::N,
                 typename G::E,
@@ -208,8 +480,9 @@ namespace offbynull::aligner::aligners::local_dynamic_programming_heap_aligner {
                 typename local_dynamic_programming_alignment_type_parameterizer<N_INDEX>::PARENT_COUNT,
                 typename local_dynamic_programming_alignment_type_parameterizer<N_INDEX>::SLOT_INDEX,
                 CONTAINER_CREATOR_PACK
-            > backtracker_ {};
-            auto&& [path, path_weight] { backtracker_.find_max_path(graph) };  // Use auto&& vs const auto&, otherwise move() below fails
+            > backtracker_ { {}, { workspace } };
+            // Use auto&& vs const auto&, otherwise move() below fails
+            auto&& [path, path_weight] { backtracker_.find_max_path(graph, xdrop) };
             return std::make_pair(
                 std::move(path)  // move() needed to ensure that transform operation below owns path
                     | std::views::transform(
@@ -220,6 +493,228 @@ namespace offbynull::aligner::aligners::local_dynamic_programming_heap_aligner {
                 path_weight
             );
         }
+
+        /**
+         * Score two sequences without aligning them. The alignment graph is walked one row at a time (see
+         * @ref offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::forward_walker::forward_walker::forward_walker),
+         * meaning that only the rows being walked are held in memory rather than the entire graph.
+         *
+         * If `down` is shorter than `right`, the graph is transposed such that its rows span the shorter sequence.
+         *
+         * @tparam minimize_allocations `true` to force certain internal containers to reserve (preallocate) elements thereby
+         *     removing/reducing the need for adhoc reallocations, `false` otherwise.
+         * @tparam N_INDEX Alignment graph node coordinate type (must be wide enough to hold `std::max(down.size(), right.size()) + 1zu`).
+         * @param down Sequence 1.
+         * @param right Sequence 2.
+         * @param substitution_scorer Match/mismatch (substitution) scorer.
+         * @param gap_scorer Gap (indel) scorer.
+         * @param freeride_scorer Freeride scorer.
+         * @return Score of the local alignment of `down` vs `right`.
+         */
+        template<
+            bool minimize_allocations = true,
+            widenable_to_size_t N_INDEX = std::size_t
+        >
+        auto score_only(
+            const sequence auto& down,
+            const sequence auto& right,
+            const scorer_without_explicit_weight_or_seq_index<
+                std::remove_cvref_t<decltype(down[0])>,
+                std::remove_cvref_t<decltype(right[0])>
+            > auto& substitution_scorer,
+            const scorer_without_explicit_weight_or_seq_index<
+                std::remove_cvref_t<decltype(down[0])>,
+                std::remove_cvref_t<decltype(right[0])>
+            > auto& gap_scorer,
+            const scorer_without_explicit_weight_or_seq_index<
+                std::remove_cvref_t<decltype(down[0])>,
+                std::remove_cvref_t<decltype(right[0])>
+            > auto& freeride_scorer
+        ) {
+            auto widest_weight_type_tagger {
+                validate_align_and_extract_widest_weight<
+                    debug_mode,
+                    N_INDEX,
+                    std::remove_cvref_t<decltype(substitution_scorer)>,
+                    std::remove_cvref_t<decltype(gap_scorer)>,
+                    std::remove_cvref_t<decltype(freeride_scorer)>
+                >(down, right)
+            };
+            using WEIGHT = typename decltype(widest_weight_type_tagger)::type;
+
+            // Wrap scorers into ones that'll cast from N_INDEX to the scorer's SEQ_INDEX (widens, doesn't narrow). Likewise, the
+            // wrapped scorer's result will be cast to WEIGHT type derived above (widens). This is to make it easier for the user
+            // (e.g., they submit scorers with mismatching N_INDEX / WEIGHT).
+            using DOWN_ELEM = std::remove_cvref_t<decltype(down[0])>;
+            using RIGHT_ELEM = std::remove_cvref_t<decltype(right[0])>;
+            const widening_scorer<
+                debug_mode,
+                N_INDEX,
+                DOWN_ELEM,
+                RIGHT_ELEM,
+                WEIGHT,
+                std::remove_cvref_t<decltype(substitution_scorer)>
+            > widened_substitution_scorer {
+                substitution_scorer
+            };
+            const widening_scorer<
+                debug_mode,
+                N_INDEX,
+                DOWN_ELEM,
+                RIGHT_ELEM,
+                WEIGHT,
+                std::remove_cvref_t<decltype(gap_scorer)>
+            > widened_gap_scorer {
+                gap_scorer
+            };
+            const widening_scorer<
+                debug_mode,
+                N_INDEX,
+                DOWN_ELEM,
+                RIGHT_ELEM,
+                WEIGHT,
+                std::remove_cvref_t<decltype(freeride_scorer)>
+            > widened_freeride_scorer {
+                freeride_scorer
+            };
+
+            return score_only_strict<N_INDEX, WEIGHT, minimize_allocations>(
+                down,
+                right,
+                widened_substitution_scorer,
+                widened_gap_scorer,
+                widened_freeride_scorer
+            );
+        }
+
+        /**
+         * Score two sequences without aligning them. The alignment graph is walked one row at a time (see
+         * @ref offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::forward_walker::forward_walker::forward_walker),
+         * meaning that only the rows being walked are held in memory rather than the entire graph.
+         *
+         * If `down` is shorter than `right`, the graph is transposed such that its rows span the shorter sequence.
+         *
+         * @tparam minimize_allocations `true` to force certain internal containers to reserve (preallocate) elements thereby
+         *     removing/reducing the need for adhoc reallocations, `false` otherwise.
+         * @tparam WEIGHT Alignment graph edge weight type.
+         * @tparam N_INDEX Alignment graph node coordinate type (must be wide enough to hold `std::max(down.size(), right.size()) + 1zu`).
+         * @param down Sequence 1.
+         * @param right Sequence 2.
+         * @param substitution_scorer Match/mismatch (substitution) scorer.
+         * @param gap_scorer Gap (indel) scorer.
+         * @param freeride_scorer Freeride scorer.
+         * @return Score of the local alignment of `down` vs `right`.
+         */
+        template<
+            widenable_to_size_t N_INDEX,
+            weight WEIGHT,
+            bool minimize_allocations = true
+        >
+        WEIGHT score_only_strict(
+            const sequence auto& down,
+            const sequence auto& right,
+            const scorer<
+                N_INDEX,
+                std::remove_cvref_t<decltype(down[0])>,
+                std::remove_cvref_t<decltype(right[0])>,
+                WEIGHT
+            > auto& substitution_scorer,
+            const scorer<
+                N_INDEX,
+                std::remove_cvref_t<decltype(down[0])>,
+                std::remove_cvref_t<decltype(right[0])>,
+                WEIGHT
+            > auto& gap_scorer,
+            const scorer<
+                N_INDEX,
+                std::remove_cvref_t<decltype(down[0])>,
+                std::remove_cvref_t<decltype(right[0])>,
+                WEIGHT
+            > auto& freeride_scorer
+        ) {
+            if (down.size() < right.size()) {
+                using DOWN_ELEM = std::remove_cvref_t<decltype(down[0])>;
+                using RIGHT_ELEM = std::remove_cvref_t<decltype(right[0])>;
+                const transposing_scorer<
+                    debug_mode,
+                    N_INDEX,
+                    DOWN_ELEM,
+                    RIGHT_ELEM,
+                    WEIGHT,
+                    std::remove_cvref_t<decltype(substitution_scorer)>
+                > transposed_substitution_scorer {
+                    substitution_scorer
+                };
+                const transposing_scorer<
+                    debug_mode,
+                    N_INDEX,
+                    DOWN_ELEM,
+                    RIGHT_ELEM,
+                    WEIGHT,
+                    std::remove_cvref_t<decltype(gap_scorer)>
+                > transposed_gap_scorer {
+                    gap_scorer
+                };
+                const transposing_scorer<
+                    debug_mode,
+                    N_INDEX,
+                    DOWN_ELEM,
+                    RIGHT_ELEM,
+                    WEIGHT,
+                    std::remove_cvref_t<decltype(freeride_scorer)>
+                > transposed_freeride_scorer {
+                    freeride_scorer
+                };
+                return find_max_path_weight<N_INDEX, WEIGHT, minimize_allocations>(
+                    right,
+                    down,
+                    transposed_substitution_scorer,
+                    transposed_gap_scorer,
+                    transposed_freeride_scorer
+                );
+            }
+            return find_max_path_weight<N_INDEX, WEIGHT, minimize_allocations>(
+                down,
+                right,
+                substitution_scorer,
+                gap_scorer,
+                freeride_scorer
+            );
+        }
+
+    private:
+
+        template<
+            widenable_to_size_t N_INDEX,
+            weight WEIGHT,
+            bool minimize_allocations
+        >
+        WEIGHT find_max_path_weight(
+            const sequence auto& down,
+            const sequence auto& right,
+            const auto& substitution_scorer,
+            const auto& gap_scorer,
+            const auto& freeride_scorer
+        ) {
+            using G = pairwise_local_alignment_graph<
+                debug_mode,
+                N_INDEX,
+                WEIGHT,
+                std::remove_cvref_t<decltype(down)>,
+                std::remove_cvref_t<decltype(right)>,
+                std::remove_cvref_t<decltype(substitution_scorer)>,
+                std::remove_cvref_t<decltype(gap_scorer)>,
+                std::remove_cvref_t<decltype(freeride_scorer)>
+            >;
+            G graph {
+                down,
+                right,
+                substitution_scorer,
+                gap_scorer,
+                freeride_scorer
+            };
+            return heap_find_max_path_weight<debug_mode, minimize_allocations>(graph);
+        }
     };
 
 }
@@ -76,4 +76,56 @@ namespace {
         EXPECT_EQ(3, (align_.operator()<std::size_t, std::float32_t>()));
         EXPECT_EQ(3, (align_.operator()<std::size_t, std::float64_t>()));
     }
+
+    TEST(OAALocalDynamicProgrammingHeapAlignerTest, ScoreOnlyTest) {
+        local_dynamic_programming_heap_aligner<is_debug_mode()> aligner {};
+        auto substitution_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, int>::create_substitution(1, -1) };
+        auto gap_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, int>::create_gap(-1) };
+        auto freeride_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, int>::create_freeride() };
+        std::string down { "panama" };
+        std::string right { "bananarama" };
+        const auto& score1 {
+            aligner.score_only(down, right, substitution_scorer, gap_scorer, freeride_scorer)
+        };
+        const auto& score2 {
+            aligner.score_only(right, down, substitution_scorer, gap_scorer, freeride_scorer)
+        };
+        const auto& [alignment1, expected_score1] {
+            aligner.align(down, right, substitution_scorer, gap_scorer, freeride_scorer)
+        };
+        const auto& [alignment2, expected_score2] {
+            aligner.align(right, down, substitution_scorer, gap_scorer, freeride_scorer)
+        };
+        EXPECT_EQ(expected_score1, score1);
+        EXPECT_EQ(expected_score2, score2);
+    }
+
+    TEST(OAALocalDynamicProgrammingHeapAlignerTest, XDropTest) {
+        local_dynamic_programming_heap_aligner<is_debug_mode()> aligner {};
+        auto substitution_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, int>::create_substitution(1, -1) };
+        auto gap_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, int>::create_gap(-1) };
+        auto freeride_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, int>::create_freeride() };
+        std::string down { "abcdwxyzabcdefghij" };
+        std::string right { "abcdstuvabcdefghij" };
+        const auto& [expected_alignment, expected_score] {
+            aligner.align(down, right, substitution_scorer, gap_scorer, freeride_scorer)
+        };
+        EXPECT_EQ(10, expected_score);
+        // X-drop too small to make it past the mismatching middle, meaning only the leading "abcd" gets aligned
+        {
+            const auto& [alignment, score] {
+                aligner.align(down, right, substitution_scorer, gap_scorer, freeride_scorer, 2)
+            };
+            EXPECT_EQ(4, score);
+            std::cout << score << std::endl;
+            std::cout << alignment_to_stacked_string<is_debug_mode()>(down, right, alignment) << std::endl;
+        }
+        // X-drop large enough to make it past the mismatching middle
+        {
+            const auto& [alignment, score] {
+                aligner.align(down, right, substitution_scorer, gap_scorer, freeride_scorer, 4)
+            };
+            EXPECT_EQ(expected_score, score);
+        }
+    }
 }
\ No newline at end of file
@@ -2,6 +2,9 @@
 #include <iostream>
 #include <ostream>
 #include <string>
+#include <utility>
+#include <limits>
+#include <memory_resource>
 #include <stdfloat>
 #include <cstdint>
 #include "offbynull/aligner/aligners/local_sliced_subdivision_heap_aligner.h"
@@ -16,6 +19,7 @@ namespace {
     using offbynull::aligner::scorers::simple_scorer::simple_scorer;
     using offbynull::aligner::aligners::utils::alignment_to_stacked_string;
     using offbynull::utils::is_debug_mode;
+    using offbynull::utils::copy_to_vector;
 
     TEST(OAALocalSlicedSubdivisionHeapAlignerTest, SanityTest) {
         local_sliced_subdivision_heap_aligner<is_debug_mode()> aligner {};
@@ -78,4 +82,85 @@ namespace {
         // EXPECT_EQ(3, (align_.operator()<std::size_t, std::float32_t>()));
         EXPECT_EQ(3, (align_.operator()<std::size_t, std::float64_t>()));
     }
-}
\ No newline at end of file
+
+    TEST(OAALocalSlicedSubdivisionHeapAlignerTest, ScoreOnlyTest) {
+        local_sliced_subdivision_heap_aligner<is_debug_mode()> aligner {};
+        auto substitution_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, int>::create_substitution(1, -1) };
+        auto gap_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, int>::create_gap(-1) };
+        auto freeride_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, int>::create_freeride() };
+        std::string down { "panama" };
+        std::string right { "bananarama" };
+        const auto& score1 {
+            aligner.score_only(down, right, substitution_scorer, gap_scorer, freeride_scorer)
+        };
+        const auto& score2 {
+            aligner.score_only(right, down, substitution_scorer, gap_scorer, freeride_scorer)
+        };
+        const auto& [alignment1, expected_score1] {
+            aligner.align(down, right, substitution_scorer, gap_scorer, freeride_scorer, 0)
+        };
+        const auto& [alignment2, expected_score2] {
+            aligner.align(right, down, substitution_scorer, gap_scorer, freeride_scorer, 0)
+        };
+        EXPECT_EQ(expected_score1, score1);
+        EXPECT_EQ(expected_score2, score2);
+    }
+
+    TEST(OAALocalSlicedSubdivisionHeapAlignerTest, FullDpTest) {
+        auto substitution_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, int>::create_substitution(1, -1) };
+        auto gap_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, int>::create_gap(-1) };
+        auto freeride_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, int>::create_freeride() };
+        // Alignment's score, recomputed from its elements (free rides have no elements and score 0).
+        auto rescore {
+            [](const std::string& down, const std::string& right, const auto& alignment) {
+                int ret { 0 };
+                for (const auto& element : alignment) {
+                    if (!element.has_value()) {
+                        continue;
+                    }
+                    const auto& [down_idx, right_idx] { *element };
+                    if (down_idx.has_value() && right_idx.has_value()) {
+                        ret += down[*down_idx] == right[*right_idx] ? 1 : -1;
+                    } else {
+                        ret += -1;
+                    }
+                }
+                return ret;
+            }
+        };
+        for (const auto& [down, right] : {
+            std::pair<std::string, std::string> { "panamacanal", "bananaramacanal" },
+            std::pair<std::string, std::string> {
+                "thequickbrownfoxjumpsoverthelazydogthequickbrownfoxjumpsoverthelazydog",
+                "aquickbrowndogjumpedoverthelazyfoxesthequickbrowncatjumpsoverthedog"
+            }
+        }) {
+            const auto& [expected_alignment, expected_score] {
+                local_sliced_subdivision_heap_aligner<is_debug_mode()> { std::pmr::get_default_resource(), nullptr, 65536zu, 0zu }.align(
+                    down,
+                    right,
+                    substitution_scorer,
+                    gap_scorer, freeride_scorer,
+                    0
+                )
+            };
+            EXPECT_EQ(rescore(down, right, expected_alignment), expected_score);
+            // Cutoffs that solve only the smallest segments / roughly 128x128 segments / the whole graph in a single walk
+            for (std::size_t full_dp_node_cnt : { 1zu, 64zu, 16384zu, std::numeric_limits<std::size_t>::max() }) {
+                local_sliced_subdivision_heap_aligner<is_debug_mode()> aligner {
+                    std::pmr::get_default_resource(),
+                    nullptr,
+                    65536zu,
+                    full_dp_node_cnt
+                };
+                const auto& [alignment, score] { aligner.align(down, right, substitution_scorer, gap_scorer, freeride_scorer, 0) };
+                EXPECT_EQ(score, expected_score);
+                EXPECT_EQ(rescore(down, right, alignment), expected_score);
+            }
+            local_sliced_subdivision_heap_aligner<is_debug_mode()> default_aligner {};
+            const auto& [alignment, score] { default_aligner.align(down, right, substitution_scorer, gap_scorer, freeride_scorer, 0) };
+            EXPECT_EQ(copy_to_vector(alignment), copy_to_vector(expected_alignment));  // Cutoff is off by default, so path is unchanged
+            EXPECT_EQ(score, expected_score);
+        }
+    }
+}
@@ -4,11 +4,13 @@
 #include <string>
 #include <cstdint>
 #include <stdfloat>
+#include <utility>
 #include "offbynull/aligner/aligners/local_sliced_subdivision_stack_aligner.h"
 #include "offbynull/aligner/scorers/simple_scorer.h"
 #include "offbynull/aligner/aligners/utils.h"
 #include "offbynull/aligner/aligners/concepts.h"
 #include "offbynull/utils.h"
+#include "offbynull/helpers/forkable_thread_pool.h"
 #include "gtest/gtest.h"
 
 namespace {
@@ -16,6 +18,8 @@ namespace {
     using offbynull::aligner::scorers::simple_scorer::simple_scorer;
     using offbynull::aligner::aligners::utils::alignment_to_stacked_string;
     using offbynull::utils::is_debug_mode;
+    using offbynull::utils::copy_to_vector;
+    using offbynull::helpers::forkable_thread_pool::forkable_thread_pool;
 
     TEST(OAALocalSlicedSubdivisionStackAlignerTest, SanityTest) {
         local_sliced_subdivision_stack_aligner<is_debug_mode()> aligner {};
@@ -79,4 +83,50 @@ namespace {
         // EXPECT_EQ(3, (align_.operator()<std::size_t, std::float32_t>()));
         EXPECT_EQ(3, (align_.operator()<std::size_t, std::float64_t>()));
     }
-}
\ No newline at end of file
+
+    TEST(OAALocalSlicedSubdivisionStackAlignerTest, ScoreOnlyTest) {
+        local_sliced_subdivision_stack_aligner<is_debug_mode()> aligner {};
+        auto substitution_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, int>::create_substitution(1, -1) };
+        auto gap_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, int>::create_gap(-1) };
+        auto freeride_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, int>::create_freeride() };
+        std::string down { "panama" };
+        std::string right { "bananarama" };
+        const auto& score1 {
+            aligner.score_only<6zu, 10zu>(down, right, substitution_scorer, gap_scorer, freeride_scorer)
+        };
+        const auto& score2 {
+            aligner.score_only<10zu, 6zu>(right, down, substitution_scorer, gap_scorer, freeride_scorer)
+        };
+        const auto& [alignment1, expected_score1] {
+            aligner.align<6zu, 10zu>(down, right, substitution_scorer, gap_scorer, freeride_scorer, 0)
+        };
+        const auto& [alignment2, expected_score2] {
+            aligner.align<10zu, 6zu>(right, down, substitution_scorer, gap_scorer, freeride_scorer, 0)
+        };
+        EXPECT_EQ(expected_score1, score1);
+        EXPECT_EQ(expected_score2, score2);
+    }
+
+    TEST(OAALocalSlicedSubdivisionStackAlignerTest, ThreadPoolTest) {
+        local_sliced_subdivision_stack_aligner<is_debug_mode()> aligner {};
+        forkable_thread_pool<is_debug_mode(), void> thread_pool { 4zu };
+        local_sliced_subdivision_stack_aligner<is_debug_mode()> parallel_aligner { &thread_pool, 0zu };
+        auto substitution_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, int>::create_substitution(1, -1) };
+        auto gap_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, int>::create_gap(-1) };
+        auto freeride_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, int>::create_freeride() };
+        for (const auto& [down, right] : {
+            std::pair<std::string, std::string> { "panama", "banana" },
+            std::pair<std::string, std::string> { "panamacanal", "bananaramacanal" },
+            std::pair<std::string, std::string> { "a", "" }
+        }) {
+            const auto& [expected_alignment, expected_score] {
+                aligner.align<15zu, 15zu>(down, right, substitution_scorer, gap_scorer, freeride_scorer, 0)
+            };
+            const auto& [alignment, score] {
+                parallel_aligner.align<15zu, 15zu>(down, right, substitution_scorer, gap_scorer, freeride_scorer, 0)
+            };
+            EXPECT_EQ(copy_to_vector(alignment), copy_to_vector(expected_alignment));
+            EXPECT_EQ(score, expected_score);
+        }
+    }
+}
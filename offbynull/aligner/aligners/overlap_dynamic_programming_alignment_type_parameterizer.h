@@ -7,10 +7,13 @@
 #include <algorithm>
 #include "offbynull/concepts.h"
 #include "offbynull/utils.h"
+#include "offbynull/aligner/aligners/internal_utils.h"
 
 namespace offbynull::aligner::aligners::overlap_dynamic_programming_alignment_type_parameterizer {
     using offbynull::concepts::widenable_to_size_t;
     using offbynull::utils::narrowest_type_for_indexing;
+    using offbynull::aligner::aligners::internal_utils::saturating_add;
+    using offbynull::aligner::aligners::internal_utils::saturating_multiply;
 
     /**
      * Parameters for dynamic programming overlap alignment.
@@ -30,8 +33,8 @@ namespace offbynull::aligner::aligners::overlap_dynamic_programming_alignment_ty
         //  * all other nodes have incoming edges of at most 4: 3 from nodes immediately preceding and 1 freeride coming from bottom left
         static constexpr std::size_t max_parents {
             std::max({
-                (max_index - 1zu) + 3zu,
-                (max_index - 1zu) + 3zu,
+                saturating_add(max_index - 1zu, 3zu),
+                saturating_add(max_index - 1zu, 3zu),
                 3zu + 1zu
             })
         };
@@ -44,7 +47,7 @@ namespace offbynull::aligner::aligners::overlap_dynamic_programming_alignment_ty
         using PARENT_COUNT = typename narrowest_type_for_indexing<max_parents>::type;
 
     private:
-        static constexpr std::size_t max_slots { max_index * max_index * 1zu };  // down * right * depth
+        static constexpr std::size_t max_slots { saturating_multiply(max_index, max_index) };  // down * right * depth
 
     public:
         /**
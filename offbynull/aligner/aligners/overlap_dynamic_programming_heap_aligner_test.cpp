@@ -5,6 +5,7 @@
 #include <ostream>
 #include <string>
 #include "offbynull/aligner/aligners/overlap_dynamic_programming_heap_aligner.h"
+#include "offbynull/aligner/aligners/overlap_dynamic_programming_alignment_type_parameterizer.h"
 #include "offbynull/aligner/scorers/simple_scorer.h"
 #include "offbynull/aligner/aligners/utils.h"
 #include "offbynull/aligner/aligners/concepts.h"
@@ -13,6 +14,8 @@
 
 namespace {
     using offbynull::aligner::aligners::overlap_dynamic_programming_heap_aligner::overlap_dynamic_programming_heap_aligner;
+    using offbynull::aligner::aligners::overlap_dynamic_programming_alignment_type_parameterizer
+        ::overlap_dynamic_programming_alignment_type_parameterizer;
     using offbynull::aligner::scorers::simple_scorer::simple_scorer;
     using offbynull::aligner::aligners::utils::alignment_to_stacked_string;
     using offbynull::utils::is_debug_mode;
@@ -76,4 +79,37 @@ namespace {
         EXPECT_EQ(3, (align_.operator()<std::size_t, std::float32_t>()));
         EXPECT_EQ(3, (align_.operator()<std::size_t, std::float64_t>()));
     }
-}
\ No newline at end of file
+
+    TEST(OAAOverlapDynamicProgrammingHeapAlignerTest, ScoreOnlyTest) {
+        overlap_dynamic_programming_heap_aligner<is_debug_mode()> aligner {};
+        auto substitution_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, int>::create_substitution(1, -1) };
+        auto gap_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, int>::create_gap(-1) };
+        auto freeride_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, int>::create_freeride() };
+        std::string down { "panama" };
+        std::string right { "bananarama" };
+        const auto& score1 {
+            aligner.score_only(down, right, substitution_scorer, gap_scorer, freeride_scorer)
+        };
+        const auto& score2 {
+            aligner.score_only(right, down, substitution_scorer, gap_scorer, freeride_scorer)
+        };
+        const auto& [alignment1, expected_score1] {
+            aligner.align(down, right, substitution_scorer, gap_scorer, freeride_scorer)
+        };
+        const auto& [alignment2, expected_score2] {
+            aligner.align(right, down, substitution_scorer, gap_scorer, freeride_scorer)
+        };
+        EXPECT_EQ(expected_score1, score1);
+        EXPECT_EQ(expected_score2, score2);
+    }
+
+    TEST(OAAOverlapDynamicProgrammingHeapAlignerTest, TypeParameterizerSaturatesForWideIndex) {
+        // std::size_t's max squared wraps around to 1, which would otherwise make SLOT_INDEX and PARENT_COUNT too narrow.
+        using PARAMS = overlap_dynamic_programming_alignment_type_parameterizer<std::size_t>;
+        EXPECT_EQ(sizeof(std::size_t), sizeof(typename PARAMS::SLOT_INDEX));
+        EXPECT_EQ(sizeof(std::size_t), sizeof(typename PARAMS::PARENT_COUNT));
+        using NARROW_PARAMS = overlap_dynamic_programming_alignment_type_parameterizer<std::uint8_t>;
+        EXPECT_EQ(sizeof(std::uint16_t), sizeof(typename NARROW_PARAMS::SLOT_INDEX));
+        EXPECT_EQ(sizeof(std::uint16_t), sizeof(typename NARROW_PARAMS::PARENT_COUNT));
+    }
+}
@@ -15,6 +15,8 @@
 #include "offbynull/aligner/scorers/consumption_gating_scorer.h"
 #include "offbynull/aligner/graphs/pairwise_fitting_alignment_graph.h"
 #include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/backtracker.h"
+#include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/backtracker_workspace.h"
+#include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/backtracker_workspace_container_creator_pack.h"
 #include "offbynull/aligner/aligners/fitting_dynamic_programming_alignment_type_parameterizer.h"
 #include "offbynull/concepts.h"
 #include "offbynull/utils.h"
@@ -35,13 +37,15 @@ namespace offbynull::aligner::aligners::rotational_dynamic_programming_heap_alig
     using offbynull::aligner::sequences::repeat_sequence::repeat_sequence;
     using offbynull::aligner::concepts::weight;
     using offbynull::aligner::graphs::pairwise_fitting_alignment_graph::pairwise_fitting_alignment_graph;
-    using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtracker_heap_container_creator_pack
-        ::backtracker_heap_container_creator_pack;
+    using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtracker_workspace_container_creator_pack
+        ::backtracker_workspace_container_creator_pack;
+    using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtracker_workspace::backtracker_workspace;
     using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtracker::backtracker;
     using offbynull::aligner::aligners::fitting_dynamic_programming_alignment_type_parameterizer
         ::fitting_dynamic_programming_alignment_type_parameterizer;
     using offbynull::aligner::aligners::concepts::alignment_result;
     using offbynull::aligner::aligners::internal_utils::validate_align_and_extract_widest_weight;
+    using offbynull::aligner::aligners::internal_utils::heap_find_max_path_weight;
 
     /**
      * Rotational pairwise aligner using dynamic programming algorithm (see
@@ -51,7 +55,27 @@ namespace offbynull::aligner::aligners::rotational_dynamic_programming_heap_alig
      */
     template<bool debug_mode>
     class rotational_dynamic_programming_heap_aligner {
+    private:
+        /**
+         * Workspace that backtrackers lease their internal containers from, or `nullptr` to allocate them anew on each call.
+         */
+        backtracker_workspace* workspace;
+
     public:
+        /**
+         * Construct an
+         * @ref offbynull::aligner::aligners::rotational_dynamic_programming_heap_aligner::rotational_dynamic_programming_heap_aligner
+         * instance.
+         *
+         * Workspaces (see
+         * @ref offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtracker_workspace::backtracker_workspace) aren't
+         * thread-safe, meaning that an instance constructed with a workspace must not be used by multiple threads at once.
+         *
+         * @param workspace_ Workspace to lease backtracker containers from, such that repeated calls to `align()` reuse the same storage,
+         *     or `nullptr` to allocate them anew on each call.
+         */
+        rotational_dynamic_programming_heap_aligner(backtracker_workspace* workspace_ = nullptr)
+        : workspace { workspace_ } {}
 
         /**
          * Align two sequences.
@@ -239,7 +263,7 @@ namespace offbynull::aligner::aligners::rotational_dynamic_programming_heap_alig
                 gated_gap_scorer,
                 gated_freeride_scorer
             };
-            using CONTAINER_CREATOR_PACK = backtracker_heap_container_creator_pack<
+            using CONTAINER_CREATOR_PACK = backtracker_workspace_container_creator_pack<
                 debug_mode,
                 typename G::N,
                 typename G::E,
@@ -265,7 +289,8 @@ namespace offbynull::aligner::aligners::rotational_dynamic_programming_heap_alig
                 typename fitting_dynamic_programming_alignment_type_parameterizer<N_INDEX>::SLOT_INDEX,
                 CONTAINER_CREATOR_PACK
             > backtracker_ {
-                zero_weight
+                zero_weight,
+                { workspace }
             };
             auto&& [path, path_weight] { backtracker_.find_max_path(graph) };  // Use auto&& vs const auto&, otherwise move() below fails
             N_INDEX down_single_size {
@@ -298,6 +323,209 @@ namespace offbynull::aligner::aligners::rotational_dynamic_programming_heap_alig
                 path_weight.real_weight
             );
         }
+
+        /**
+         * Score two sequences without aligning them. The alignment graph is walked one row at a time (see
+         * @ref offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::forward_walker::forward_walker::forward_walker),
+         * meaning that only the rows being walked are held in memory rather than the entire graph.
+         *
+         * @tparam minimize_allocations `true` to force certain internal containers to reserve (preallocate) elements thereby
+         *     removing/reducing the need for adhoc reallocations, `false` otherwise.
+         * @tparam N_INDEX Alignment graph node coordinate type (must be wide enough to hold `std::max(down.size(), right.size()) + 1zu`).
+         * @param down Sequence 1 (sequence to rotate).
+         * @param right Sequence 2 (sequence to fit).
+         * @param substitution_scorer Match/mismatch (substitution) scorer.
+         * @param gap_scorer Gap (indel) scorer.
+         * @param freeride_scorer Freeride scorer.
+         * @return Score of the rotational alignment of `down` vs `right`.
+         */
+        template<
+            bool minimize_allocations = true,
+            widenable_to_size_t N_INDEX = std::size_t
+        >
+        auto score_only(
+            const sequence auto& down,
+            const sequence auto& right,
+            const scorer_without_explicit_weight_or_seq_index<
+                std::remove_cvref_t<decltype(down[0])>,
+                std::remove_cvref_t<decltype(right[0])>
+            > auto& substitution_scorer,
+            const scorer_without_explicit_weight_or_seq_index<
+                std::remove_cvref_t<decltype(down[0])>,
+                std::remove_cvref_t<decltype(right[0])>
+            > auto& gap_scorer,
+            const scorer_without_explicit_weight_or_seq_index<
+                std::remove_cvref_t<decltype(down[0])>,
+                std::remove_cvref_t<decltype(right[0])>
+            > auto& freeride_scorer
+        ) {
+            auto widest_weight_type_tagger {
+                validate_align_and_extract_widest_weight<
+                    debug_mode,
+                    N_INDEX,
+                    std::remove_cvref_t<decltype(substitution_scorer)>,
+                    std::remove_cvref_t<decltype(gap_scorer)>,
+                    std::remove_cvref_t<decltype(freeride_scorer)>
+                >(down, right)
+            };
+            using WEIGHT = typename decltype(widest_weight_type_tagger)::type;
+
+            // Wrap scorers into ones that'll cast from N_INDEX to the scorer's SEQ_INDEX (widens, doesn't narrow). Likewise, the
+            // wrapped scorer's result will be cast to WEIGHT type derived above (widens). This is to make it easier for the user
+            // (e.g., they submit scorers with mismatching N_INDEX / WEIGHT).
+            using DOWN_ELEM = std::remove_cvref_t<decltype(down[0])>;
+            using RIGHT_ELEM = std::remove_cvref_t<decltype(right[0])>;
+            const widening_scorer<
+                debug_mode,
+                N_INDEX,
+                DOWN_ELEM,
+                RIGHT_ELEM,
+                WEIGHT,
+                std::remove_cvref_t<decltype(substitution_scorer)>
+            > widened_substitution_scorer {
+                substitution_scorer
+            };
+            const widening_scorer<
+                debug_mode,
+                N_INDEX,
+                DOWN_ELEM,
+                RIGHT_ELEM,
+                WEIGHT,
+                std::remove_cvref_t<decltype(gap_scorer)>
+            > widened_gap_scorer {
+                gap_scorer
+            };
+            const widening_scorer<
+                debug_mode,
+                N_INDEX,
+                DOWN_ELEM,
+                RIGHT_ELEM,
+                WEIGHT,
+                std::remove_cvref_t<decltype(freeride_scorer)>
+            > widened_freeride_scorer {
+                freeride_scorer
+            };
+
+            return score_only_strict<N_INDEX, WEIGHT, minimize_allocations>(
+                down,
+                right,
+                widened_substitution_scorer,
+                widened_gap_scorer,
+                widened_freeride_scorer
+            );
+        }
+
+        /**
+         * Score two sequences without aligning them. The alignment graph is walked one row at a time (see
+         * @ref offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::forward_walker::forward_walker::forward_walker),
+         * meaning that only the rows being walked are held in memory rather than the entire graph.
+         *
+         * @tparam minimize_allocations `true` to force certain internal containers to reserve (preallocate) elements thereby
+         *     removing/reducing the need for adhoc reallocations, `false` otherwise.
+         * @tparam WEIGHT Alignment graph edge weight type.
+         * @tparam N_INDEX Alignment graph node coordinate type (must be wide enough to hold `std::max(down.size(), right.size()) + 1zu`).
+         * @param down Sequence 1 (sequence to rotate).
+         * @param right Sequence 2 (sequence to fit).
+         * @param substitution_scorer Match/mismatch (substitution) scorer.
+         * @param gap_scorer Gap (indel) scorer.
+         * @param freeride_scorer Freeride scorer.
+         * @return Score of the rotational alignment of `down` vs `right`.
+         */
+        template<
+            widenable_to_size_t N_INDEX,
+            weight WEIGHT,
+            bool minimize_allocations = true
+        >
+        WEIGHT score_only_strict(
+            const sequence auto& down,
+            const sequence auto& right,
+            const scorer<
+                N_INDEX,
+                std::remove_cvref_t<decltype(down[0])>,
+                std::remove_cvref_t<decltype(right[0])>,
+                WEIGHT
+            > auto& substitution_scorer,
+            const scorer<
+                N_INDEX,
+                std::remove_cvref_t<decltype(down[0])>,
+                std::remove_cvref_t<decltype(right[0])>,
+                WEIGHT
+            > auto& gap_scorer,
+            const scorer<
+                N_INDEX,
+                std::remove_cvref_t<decltype(down[0])>,
+                std::remove_cvref_t<decltype(right[0])>,
+                WEIGHT
+            > auto& freeride_scorer
+        ) {
+            using DOWN_ELEM = std::remove_cvref_t<decltype(down[0])>;
+            using RIGHT_ELEM = std::remove_cvref_t<decltype(right[0])>;
+            repeat_sequence<
+                debug_mode,
+                std::remove_cvref_t<decltype(down)>
+            > down_double { down, 2zu };
+            consumption_gating_scorer<
+                debug_mode,
+                DOWN_ELEM,
+                RIGHT_ELEM,
+                std::remove_cvref_t<decltype(substitution_scorer)>
+            > gated_substitution_scorer {
+                static_cast<N_INDEX>(down.size()),  // down_double's being consumed (2x down), but once it consumes just 1x, kill the scorer
+                static_cast<N_INDEX>(right.size()),
+                substitution_scorer
+            };
+            consumption_gating_scorer<
+                debug_mode,
+                DOWN_ELEM,
+                RIGHT_ELEM,
+                std::remove_cvref_t<decltype(gap_scorer)>
+            > gated_gap_scorer {
+                static_cast<N_INDEX>(down.size()),  // down_double's being consumed (2x down), but once it consumes just 1x, kill the scorer
+                static_cast<N_INDEX>(right.size()),
+                gap_scorer
+            };
+            // NOTE: No gating for free rides, but wrapping below so all weights come out to the same type. The wrapper won't get because
+            //       only freerides are being passed to it.
+            consumption_gating_scorer<
+                debug_mode,
+                DOWN_ELEM,
+                RIGHT_ELEM,
+                std::remove_cvref_t<decltype(freeride_scorer)>
+            > gated_freeride_scorer {
+                static_cast<N_INDEX>(down.size()),
+                static_cast<N_INDEX>(right.size()),
+                freeride_scorer
+            };
+            using GATED_WEIGHT = typename decltype(gated_freeride_scorer)::WEIGHT;
+            using G = pairwise_fitting_alignment_graph<
+                debug_mode,
+                N_INDEX,
+                GATED_WEIGHT,
+                std::remove_cvref_t<decltype(down_double)>,
+                std::remove_cvref_t<decltype(right)>,
+                std::remove_cvref_t<decltype(gated_substitution_scorer)>,
+                std::remove_cvref_t<decltype(gated_gap_scorer)>,
+                std::remove_cvref_t<decltype(gated_freeride_scorer)>
+            >;
+            G graph {
+                down_double,
+                right,
+                gated_substitution_scorer,
+                gated_gap_scorer,
+                gated_freeride_scorer
+            };
+            consumption_gating_limits<debug_mode, N_INDEX> gating_limits {
+                static_cast<N_INDEX>(down.size()),
+                static_cast<N_INDEX>(right.size())
+            };
+            GATED_WEIGHT zero_weight {
+                static_cast<WEIGHT>(0uz),
+                static_cast<N_INDEX>(0uz),
+                static_cast<N_INDEX>(0uz),
+                { gating_limits }
+            };
+            return heap_find_max_path_weight<debug_mode, minimize_allocations>(graph, zero_weight).real_weight;
+        }
     };
 
 }
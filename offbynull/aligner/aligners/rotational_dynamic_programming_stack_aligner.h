@@ -43,6 +43,7 @@ namespace offbynull::aligner::aligners::rotational_dynamic_programming_stack_ali
         ::fitting_dynamic_programming_alignment_type_parameterizer;
     using offbynull::aligner::aligners::concepts::alignment_result;
     using offbynull::aligner::aligners::internal_utils::validate_align_and_extract_widest_weight;
+    using offbynull::aligner::aligners::internal_utils::stack_find_max_path_weight;
 
     /**
      * Rotational pairwise aligner using dynamic programming algorithm (see
@@ -310,6 +311,216 @@ namespace offbynull::aligner::aligners::rotational_dynamic_programming_stack_ali
                 path_weight.real_weight
             );
         }
+
+        /**
+         * Score two sequences without aligning them. The alignment graph is walked one row at a time (see
+         * @ref offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::forward_walker::forward_walker::forward_walker),
+         * meaning that only the rows being walked are held in memory rather than the entire graph.
+         *
+         * @tparam max_down_seq_size Maximum allowed length for downward sequence.
+         * @tparam max_right_seq_size Maximum allowed length for rightward sequence.
+         * @tparam N_INDEX Alignment graph node coordinate type (must be wide enough to hold `std::max(down.size(), right.size()) + 1zu`).
+         * @param down Sequence 1 (sequence to rotate).
+         * @param right Sequence 2 (sequence to fit).
+         * @param substitution_scorer Match/mismatch (substitution) scorer.
+         * @param gap_scorer Gap (indel) scorer.
+         * @param freeride_scorer Freeride scorer.
+         * @return Score of the rotational alignment of `down` vs `right`.
+         */
+        template<
+            std::size_t max_down_seq_size,
+            std::size_t max_right_seq_size,
+            widenable_to_size_t N_INDEX = std::size_t
+        >
+        auto score_only(
+            const sequence auto& down,
+            const sequence auto& right,
+            const scorer_without_explicit_weight_or_seq_index<
+                std::remove_cvref_t<decltype(down[0])>,
+                std::remove_cvref_t<decltype(right[0])>
+            > auto& substitution_scorer,
+            const scorer_without_explicit_weight_or_seq_index<
+                std::remove_cvref_t<decltype(down[0])>,
+                std::remove_cvref_t<decltype(right[0])>
+            > auto& gap_scorer,
+            const scorer_without_explicit_weight_or_seq_index<
+                std::remove_cvref_t<decltype(down[0])>,
+                std::remove_cvref_t<decltype(right[0])>
+            > auto& freeride_scorer
+        ) {
+            auto widest_weight_type_tagger {
+                validate_align_and_extract_widest_weight<
+                    debug_mode,
+                    N_INDEX,
+                    std::remove_cvref_t<decltype(substitution_scorer)>,
+                    std::remove_cvref_t<decltype(gap_scorer)>,
+                    std::remove_cvref_t<decltype(freeride_scorer)>
+                >(down, right)
+            };
+            using WEIGHT = typename decltype(widest_weight_type_tagger)::type;
+
+            // Wrap scorers into ones that'll cast from N_INDEX to the scorer's SEQ_INDEX (widens, doesn't narrow). Likewise, the
+            // wrapped scorer's result will be cast to WEIGHT type derived above (widens). This is to make it easier for the user
+            // (e.g., they submit scorers with mismatching N_INDEX / WEIGHT).
+            using DOWN_ELEM = std::remove_cvref_t<decltype(down[0])>;
+            using RIGHT_ELEM = std::remove_cvref_t<decltype(right[0])>;
+            const widening_scorer<
+                debug_mode,
+                N_INDEX,
+                DOWN_ELEM,
+                RIGHT_ELEM,
+                WEIGHT,
+                std::remove_cvref_t<decltype(substitution_scorer)>
+            > widened_substitution_scorer {
+                substitution_scorer
+            };
+            const widening_scorer<
+                debug_mode,
+                N_INDEX,
+                DOWN_ELEM,
+                RIGHT_ELEM,
+                WEIGHT,
+                std::remove_cvref_t<decltype(gap_scorer)>
+            > widened_gap_scorer {
+                gap_scorer
+            };
+            const widening_scorer<
+                debug_mode,
+                N_INDEX,
+                DOWN_ELEM,
+                RIGHT_ELEM,
+                WEIGHT,
+                std::remove_cvref_t<decltype(freeride_scorer)>
+            > widened_freeride_scorer {
+                freeride_scorer
+            };
+
+            return score_only_strict<N_INDEX, WEIGHT, max_down_seq_size, max_right_seq_size>(
+                down,
+                right,
+                widened_substitution_scorer,
+                widened_gap_scorer,
+                widened_freeride_scorer
+            );
+        }
+
+        /**
+         * Score two sequences without aligning them. The alignment graph is walked one row at a time (see
+         * @ref offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::forward_walker::forward_walker::forward_walker),
+         * meaning that only the rows being walked are held in memory rather than the entire graph.
+         *
+         * @tparam max_down_seq_size Maximum allowed length for downward sequence.
+         * @tparam max_right_seq_size Maximum allowed length for rightward sequence.
+         * @tparam WEIGHT Alignment graph edge weight type.
+         * @tparam N_INDEX Alignment graph node coordinate type (must be wide enough to hold `std::max(down.size(), right.size()) + 1zu`).
+         * @param down Sequence 1 (sequence to rotate).
+         * @param right Sequence 2 (sequence to fit).
+         * @param substitution_scorer Match/mismatch (substitution) scorer.
+         * @param gap_scorer Gap (indel) scorer.
+         * @param freeride_scorer Freeride scorer.
+         * @return Score of the rotational alignment of `down` vs `right`.
+         */
+        template<
+            widenable_to_size_t N_INDEX,
+            weight WEIGHT,
+            std::size_t max_down_seq_size,
+            std::size_t max_right_seq_size
+        >
+        WEIGHT score_only_strict(
+            const sequence auto& down,
+            const sequence auto& right,
+            const scorer<
+                N_INDEX,
+                std::remove_cvref_t<decltype(down[0])>,
+                std::remove_cvref_t<decltype(right[0])>,
+                WEIGHT
+            > auto& substitution_scorer,
+            const scorer<
+                N_INDEX,
+                std::remove_cvref_t<decltype(down[0])>,
+                std::remove_cvref_t<decltype(right[0])>,
+                WEIGHT
+            > auto& gap_scorer,
+            const scorer<
+                N_INDEX,
+                std::remove_cvref_t<decltype(down[0])>,
+                std::remove_cvref_t<decltype(right[0])>,
+                WEIGHT
+            > auto& freeride_scorer
+        ) {
+            if constexpr (debug_mode) {
+                if (down.size() > max_down_seq_size || right.size() > max_right_seq_size) {
+                    throw std::runtime_error { "Sequence length larger than expected (for stack allocation)" };
+                }
+            }
+            using DOWN_ELEM = std::remove_cvref_t<decltype(down[0])>;
+            using RIGHT_ELEM = std::remove_cvref_t<decltype(right[0])>;
+            repeat_sequence<
+                debug_mode,
+                std::remove_cvref_t<decltype(down)>
+            > down_double { down, 2zu };
+            consumption_gating_scorer<
+                debug_mode,
+                DOWN_ELEM,
+                RIGHT_ELEM,
+                std::remove_cvref_t<decltype(substitution_scorer)>
+            > gated_substitution_scorer {
+                static_cast<N_INDEX>(down.size()),  // down_double's being consumed (2x down), but once it consumes just 1x, kill the scorer
+                static_cast<N_INDEX>(right.size()),
+                substitution_scorer
+            };
+            consumption_gating_scorer<
+                debug_mode,
+                DOWN_ELEM,
+                RIGHT_ELEM,
+                std::remove_cvref_t<decltype(gap_scorer)>
+            > gated_gap_scorer {
+                static_cast<N_INDEX>(down.size()),  // down_double's being consumed (2x down), but once it consumes just 1x, kill the scorer
+                static_cast<N_INDEX>(right.size()),
+                gap_scorer
+            };
+            // NOTE: No gating for free rides, but wrapping below so all weights come out to the same type. The wrapper won't get because
+            //       only freerides are being passed to it.
+            consumption_gating_scorer<
+                debug_mode,
+                DOWN_ELEM,
+                RIGHT_ELEM,
+                std::remove_cvref_t<decltype(freeride_scorer)>
+            > gated_freeride_scorer {
+                static_cast<N_INDEX>(down.size()),
+                static_cast<N_INDEX>(right.size()),
+                freeride_scorer
+            };
+            using GATED_WEIGHT = typename decltype(gated_freeride_scorer)::WEIGHT;
+            using G = pairwise_fitting_alignment_graph<
+                debug_mode,
+                N_INDEX,
+                GATED_WEIGHT,
+                std::remove_cvref_t<decltype(down_double)>,
+                std::remove_cvref_t<decltype(right)>,
+                std::remove_cvref_t<decltype(gated_substitution_scorer)>,
+                std::remove_cvref_t<decltype(gated_gap_scorer)>,
+                std::remove_cvref_t<decltype(gated_freeride_scorer)>
+            >;
+            G graph {
+                down_double,
+                right,
+                gated_substitution_scorer,
+                gated_gap_scorer,
+                gated_freeride_scorer
+            };
+            consumption_gating_limits<debug_mode, N_INDEX> gating_limits {
+                static_cast<N_INDEX>(down.size()),
+                static_cast<N_INDEX>(right.size())
+            };
+            GATED_WEIGHT zero_weight {
+                static_cast<WEIGHT>(0uz),
+                static_cast<N_INDEX>(0uz),
+                static_cast<N_INDEX>(0uz),
+                { gating_limits }
+            };
+            return stack_find_max_path_weight<debug_mode, max_right_seq_size>(graph, zero_weight).real_weight;
+        }
     };
 
 }
@@ -0,0 +1,601 @@
+#ifndef OFFBYNULL_ALIGNER_BACKTRACKERS_ANTI_DIAGONAL_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_BACKTRACKER_H
+#define OFFBYNULL_ALIGNER_BACKTRACKERS_ANTI_DIAGONAL_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_BACKTRACKER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <ranges>
+#include <utility>
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+#include <concepts>
+#include "offbynull/aligner/backtrackers/anti_diagonal_pairwise_alignment_graph_backtracker/concepts.h"
+#include "offbynull/aligner/backtrackers/anti_diagonal_pairwise_alignment_graph_backtracker/backtracker_container_creator_pack.h"
+#include "offbynull/aligner/backtrackers/anti_diagonal_pairwise_alignment_graph_backtracker/backtracker_heap_container_creator_pack.h"
+#include "offbynull/aligner/backtrackers/anti_diagonal_pairwise_alignment_graph_backtracker/backtracker_stack_container_creator_pack.h"
+#include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/slot_container/sweep_slot.h"
+#include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/slot_container/slot_container.h"
+#include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/concepts.h"
+#include "offbynull/aligner/graph/pairwise_alignment_graph.h"
+#include "offbynull/aligner/graphs/grid_graph.h"
+#include "offbynull/concepts.h"
+
+namespace offbynull::aligner::backtrackers::anti_diagonal_pairwise_alignment_graph_backtracker::backtracker {
+    using offbynull::aligner::graph::pairwise_alignment_graph::pairwise_alignment_graph;
+    using offbynull::aligner::backtrackers::anti_diagonal_pairwise_alignment_graph_backtracker::concepts::anti_diagonal_backtrackable_graph;
+    using offbynull::aligner::backtrackers::anti_diagonal_pairwise_alignment_graph_backtracker::concepts::grid_addressable_graph;
+    using offbynull::aligner::graphs::grid_graph::edge;
+    using offbynull::aligner::backtrackers::anti_diagonal_pairwise_alignment_graph_backtracker::backtracker_container_creator_pack
+        ::backtracker_container_creator_pack;
+    using offbynull::aligner::backtrackers::anti_diagonal_pairwise_alignment_graph_backtracker::backtracker_heap_container_creator_pack
+        ::backtracker_heap_container_creator_pack;
+    using offbynull::aligner::backtrackers::anti_diagonal_pairwise_alignment_graph_backtracker::backtracker_stack_container_creator_pack
+        ::backtracker_stack_container_creator_pack;
+    using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::slot_container::sweep_slot::sweep_slot;
+    using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::slot_container::slot_container::slot_container;
+    using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::concepts::backtracking_result;
+    using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::concepts::backtracking_result_without_explicit_weight;
+    using offbynull::concepts::widenable_to_size_t;
+
+    /**
+     * Backtracker for @ref offbynull::aligner::graph::pairwise_alignment_graph::pairwise_alignment_graph implementations that are 1 node
+     * deep and have numeric edge weights (e.g., global, local, overlap, and fitting alignment graphs). Results are identical to
+     * @ref offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtracker::backtracker (including which path is
+     * picked when multiple maximally-weighted paths exist), but the way in which nodes are walked is different.
+     *
+     * Rather than walking nodes in the order they become ready (tracked via an in-degree pre-pass and a ready queue), nodes are walked one
+     * anti-diagonal at a time (all nodes where `down + right` is the same value). Every edge in these graphs either connects a node to a
+     * neighbour on one of the 2 preceding anti-diagonals or is a free-ride edge from the root / to the leaf, so the nodes on an
+     * anti-diagonal never depend on each other. The grid is cut into horizontal strips of a fixed number of rows, and anti-diagonals are
+     * walked strip by strip (the row just above a strip is all that's carried over from the previous strip), which keeps the slots
+     * written for an anti-diagonal close together in memory. Each anti-diagonal is processed in 3 passes ...
+     *
+     *  1. gather: each node's incoming edges are bucketed into down / right / diagonal / other lanes, scoring each edge once. If `G`
+     *     satisfies
+     *     @ref offbynull::aligner::backtrackers::anti_diagonal_pairwise_alignment_graph_backtracker::concepts::grid_addressable_graph,
+     *     the down / right / diagonal edges of non-resident nodes are constructed straight from grid offsets, and only edges coming from
+     *     resident nodes (e.g., free-rides) are enumerated.
+     *  2. kernel: each node's maximum is computed over contiguous lane arrays and the 2 preceding anti-diagonals' weights using
+     *     branch-free selects, which compilers are able to auto-vectorize.
+     *  3. scatter: winning edges and weights are written to the slot container so that backtracking is unchanged. Winning edges that
+     *     were constructed from grid offsets are constructed again here rather than being stored per lane.
+     *
+     * ```
+     *  anti-diagonal walk order
+     *
+     *    0     1     2     3
+     *  *---->*---->*---->*
+     *  |'.   |'.   |'.   |
+     *  |  '. |  '. |  '. |
+     *  v    vv    vv    vv
+     *  *---->*---->*---->*
+     *    1     2     3     4
+     * ```
+     *
+     * @tparam debug_mode `true` to enable debugging logic, `false` otherwise.
+     * @tparam G Graph type.
+     * @tparam PARENT_COUNT Graph node incoming edge counter type. Must be wide enough to hold the maximum number of incoming edges across
+     *      all nodes in the underlying pairwise alignment graph instance (e.g., across all nodes in any global pairwise alignment graph, a
+     *      node can have at most 3 incoming edges).
+     * @tparam SLOT_INDEX Slot indexer type. Must be wide enough to hold the value `grid_down_cnt * grid_right_cnt * grid_depth_cnt`
+     *     (variables being multiplied are the dimensions of the `G` instance).
+     * @tparam CONTAINER_CREATOR_PACK Container factory type.
+     */
+    template<
+        bool debug_mode,
+        anti_diagonal_backtrackable_graph G,
+        widenable_to_size_t PARENT_COUNT,
+        widenable_to_size_t SLOT_INDEX,
+        backtracker_container_creator_pack<
+            typename G::N,
+            typename G::E,
+            typename G::ED,
+            PARENT_COUNT,
+            SLOT_INDEX
+        > CONTAINER_CREATOR_PACK = backtracker_heap_container_creator_pack<
+            debug_mode,
+            typename G::N,
+            typename G::E,
+            typename G::ED,
+            PARENT_COUNT,
+            SLOT_INDEX,
+            true
+        >
+    >
+    class backtracker {
+    public:
+        /** `G`'s node identifier type. */
+        using N = typename G::N;
+        /** `G`'s edge identifier type. */
+        using E = typename G::E;
+        /** `G`'s edge data type. */
+        using ED = typename G::ED;
+        /** `G`'s grid coordinate type. For example, `std::uint8_t` will allow up to 255 nodes on both the down and right axis. */
+        using N_INDEX = typename G::N_INDEX;
+
+        /**
+         * @ref offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::slot_container::slot_container::slot_container
+         * container factory type used by this backtracker implementation.
+         */
+        using SLOT_CONTAINER_CONTAINER_CREATOR_PACK =
+            decltype(std::declval<CONTAINER_CREATOR_PACK>().create_slot_container_container_creator_pack());
+        /**
+         * @ref offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::slot_container::slot_container::slot_container type
+         * used by this backtracker implementation.
+         */
+        using SLOT_CONTAINER = slot_container<
+            debug_mode,
+            G,
+            PARENT_COUNT,
+            SLOT_INDEX,
+            SLOT_CONTAINER_CONTAINER_CREATOR_PACK,
+            sweep_slot<N, E, ED>
+        >;
+        /**
+         * Path container type used by this backtracker implementation.
+         */
+        using PATH_CONTAINER = decltype(std::declval<CONTAINER_CREATOR_PACK>().create_path_container(0zu));
+
+    private:
+        using WEIGHT_CONTAINER = decltype(std::declval<CONTAINER_CREATOR_PACK>().create_weight_container(0zu, std::declval<ED>()));
+        using EDGE_CONTAINER = decltype(std::declval<CONTAINER_CREATOR_PACK>().create_edge_container(0zu));
+        using RANK_CONTAINER = decltype(std::declval<CONTAINER_CREATOR_PACK>().create_rank_container(0zu));
+        using CODE_CONTAINER = decltype(std::declval<CONTAINER_CREATOR_PACK>().create_code_container(0zu));
+
+        static constexpr PARENT_COUNT PC0 { static_cast<PARENT_COUNT>(0zu) };
+        static constexpr PARENT_COUNT PC1 { static_cast<PARENT_COUNT>(1zu) };
+
+        // Lane groups. Candidate arrays are laid out group-major (group * lane_capacity + lane).
+        static constexpr std::uint8_t GROUP_OTHER { 0u };
+        static constexpr std::uint8_t GROUP_DOWN { 1u };
+        static constexpr std::uint8_t GROUP_RIGHT { 2u };
+        static constexpr std::uint8_t GROUP_DIAGONAL { 3u };
+        static constexpr std::uint8_t GROUP_NONE { 4u };
+        static constexpr std::uint8_t GROUP_CNT { 4u };
+        // Presence bit flagging that a lane's down / right / diagonal edges were never stored (they're reconstructed from grid offsets
+        // once the winner is known).
+        static constexpr std::uint8_t GRID_ADDRESSED { 1u << 4u };
+
+        // Rows per strip. Anti-diagonals are walked within horizontal strips of the grid rather than across the entire grid, such that
+        // the slots written for each anti-diagonal stay within a handful of rows (cache / TLB friendly) rather than hopping one row per
+        // node.
+        static constexpr std::size_t STRIP_HEIGHT { 64zu };
+
+        /**
+         * Initial edge weight (e.g., 0).
+         */
+        ED zero_weight;
+
+        /**
+         * Container factory.
+         */
+        CONTAINER_CREATOR_PACK container_creator_pack;
+
+    public:
+        /**
+         * Construct an
+         * @ref offbynull::aligner::backtrackers::anti_diagonal_pairwise_alignment_graph_backtracker::backtracker::backtracker instance.
+         *
+         * @param zero_weight_ Initial weight, equivalent to 0 for numeric weights. Defaults to `ED`'s default constructor, assuming it
+         *     exists.
+         * @param container_creator_pack_ Container factory.
+         */
+        backtracker(
+            ED zero_weight_ = {},
+            CONTAINER_CREATOR_PACK container_creator_pack_ = {}
+        )
+        : zero_weight { zero_weight_ }
+        , container_creator_pack { container_creator_pack_ } {}
+
+        /**
+         * Determine the maximally-weighted path (path with the highest sum of edge weights) connecting a pairwise alignment graph's root
+         * node and leaf node.
+         *
+         * If `g` contains edges with non-finite weights, the behavior of this function is undefined.
+         *
+         * @param g Graph.
+         * @return Maximally weighted path from `g`'s root node to `g`'s leaf node, along with that path's weight.
+         */
+        backtracking_result<ED> auto find_max_path(
+            const G& g
+        ) {
+            auto slots { populate_weights_and_backtrack_pointers(g) };
+            auto path { backtrack(g, slots) };  // NOTE: Don't use const auto& or auto&& - can't end up as const due to std::move() below
+            const auto& leaf_node { g.get_leaf_node() };
+            const auto& weight { slots.find_ref(leaf_node).backtracking_weight };
+            return std::make_pair(
+                std::move(path),
+                weight
+            );  // NOTE: No dangling issues - make_pair() stores values, not refs.
+        }
+
+    private:
+        static N node_at(const G& g, std::size_t down, std::size_t right) {
+            if constexpr (grid_addressable_graph<G>) {
+                return N { static_cast<N_INDEX>(down), static_cast<N_INDEX>(right) };
+            }
+            const auto& nodes { g.grid_offset_to_nodes(static_cast<N_INDEX>(down), static_cast<N_INDEX>(right)) };
+            if constexpr (debug_mode) {
+                if (std::ranges::distance(nodes.begin(), nodes.end()) != 1z) {
+                    throw std::runtime_error { "Expected exactly 1 node per grid position" };
+                }
+            }
+            return *nodes.begin();
+        }
+
+        static bool is_resident(const G& g, const N& node) requires grid_addressable_graph<G> {
+            for (const N& resident_node : g.resident_nodes()) {
+                if (resident_node == node) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        static E grid_edge(std::size_t src_down, std::size_t src_right, std::size_t dst_down, std::size_t dst_right)
+        requires grid_addressable_graph<G> {
+            const N src { static_cast<N_INDEX>(src_down), static_cast<N_INDEX>(src_right) };
+            const N dst { static_cast<N_INDEX>(dst_down), static_cast<N_INDEX>(dst_right) };
+            if constexpr (std::same_as<E, edge<N_INDEX>>) {
+                return E { src, dst };
+            } else {
+                return E { decltype(E::type)::NORMAL, { src, dst } };
+            }
+        }
+
+        SLOT_CONTAINER populate_weights_and_backtrack_pointers(
+            const G& g
+        ) {
+            // Create "slots" list
+            // -------------------
+            // Unlike the ready queue based backtracker, the walk order is known ahead of time, so there's no need to count each node's
+            // unprocessed parents. Slots start off with a weight of zero_weight, which is what the walk below expects of any node it has
+            // yet to reach, so there's no need to fill them in from get_nodes() either.
+            auto no_slots { std::views::empty<sweep_slot<N, E, ED>> };
+            SLOT_CONTAINER slots {
+                g,
+                no_slots.begin(),
+                no_slots.end(),
+                zero_weight,
+                container_creator_pack.create_slot_container_container_creator_pack()
+            };
+
+            const std::size_t grid_down_cnt { g.grid_down_cnt };
+            const std::size_t grid_right_cnt { g.grid_right_cnt };
+            const std::size_t max_strip_height { std::min(grid_down_cnt, STRIP_HEIGHT) };
+            const std::size_t lane_capacity { std::min(max_strip_height, grid_right_cnt) };
+            // Weights for the last 3 anti-diagonals of the strip, each indexed by the strip's down offset + 1. Index 0 holds the weight of
+            // the node just above the strip that feeds the lane for down offset 0 (the "down" neighbour for the anti-diagonal after, the
+            // "diagonal" neighbour for the anti-diagonal after that), such that lanes never have to special-case the strip's top row.
+            const std::size_t row_stride { max_strip_height + 1zu };
+            WEIGHT_CONTAINER anti_diagonal_weights { container_creator_pack.create_weight_container(3zu * row_stride, zero_weight) };
+            // Weights for the row just above the strip, indexed by right offset. Each column gets overwritten by the strip's bottom row
+            // only once the strip no longer needs it.
+            WEIGHT_CONTAINER row_above_weights { container_creator_pack.create_weight_container(grid_right_cnt, zero_weight) };
+            WEIGHT_CONTAINER lane_weights { container_creator_pack.create_weight_container(GROUP_CNT * lane_capacity, zero_weight) };
+            EDGE_CONTAINER lane_edges { container_creator_pack.create_edge_container(GROUP_CNT * lane_capacity) };
+            RANK_CONTAINER lane_ranks { container_creator_pack.create_rank_container(GROUP_CNT * lane_capacity) };
+            CODE_CONTAINER lane_codes { container_creator_pack.create_code_container(2zu * lane_capacity) };  // presence bits + selected
+
+            for (std::size_t strip_top { 0zu }; strip_top < grid_down_cnt; strip_top += max_strip_height) {
+                const std::size_t strip_height { std::min(max_strip_height, grid_down_cnt - strip_top) };
+                const std::size_t anti_diagonal_cnt { strip_height + grid_right_cnt - 1zu };
+                anti_diagonal_weights[2zu * row_stride] = row_above_weights[0zu];  // "down" neighbour of the strip's first node
+                for (std::size_t anti_diagonal { 0zu }; anti_diagonal < anti_diagonal_cnt; ++anti_diagonal) {
+                    const std::size_t cur_base { (anti_diagonal % 3zu) * row_stride };
+                    const std::size_t prev1_base { ((anti_diagonal + 2zu) % 3zu) * row_stride };
+                    const std::size_t prev2_base { ((anti_diagonal + 1zu) % 3zu) * row_stride };
+                    const std::size_t down_lo { anti_diagonal >= grid_right_cnt ? anti_diagonal - (grid_right_cnt - 1zu) : 0zu };
+                    const std::size_t down_hi { std::min(anti_diagonal, strip_height - 1zu) };
+                    const std::size_t lane_cnt { down_hi - down_lo + 1zu };
+                    anti_diagonal_weights[cur_base] = {
+                        anti_diagonal + 1zu < grid_right_cnt ? row_above_weights[anti_diagonal + 1zu] : zero_weight
+                    };
+
+                    // Gather
+                    // ------
+                    // Bucket each node's incoming edges into lanes. The first edge from each of the 3 neighbouring nodes goes into its own
+                    // lane group, and anything else (e.g., free-ride edges) gets resolved here to the best "other" candidate. Edge ranks
+                    // (position within get_inputs()) are recorded so that ties are broken exactly like std::ranges::max_element() would.
+                    for (std::size_t lane { 0zu }; lane < lane_cnt; ++lane) {
+                        const std::size_t right { anti_diagonal - (down_lo + lane) };
+                        const std::size_t down { strip_top + down_lo + lane };
+                        const N node { node_at(g, down, right) };
+                        std::uint8_t presence { 0u };
+                        for (std::uint8_t group { GROUP_DOWN }; group < GROUP_CNT; ++group) {
+                            lane_weights[group * lane_capacity + lane] = zero_weight;
+                        }
+                        PARENT_COUNT rank { PC0 };
+                        const auto take_other {
+                            [&](const E& edge, const N& src_node) {
+                                const std::size_t lane_idx { GROUP_OTHER * lane_capacity + lane };
+                                const ED candidate_weight { slots.find_ref(src_node).backtracking_weight + g.get_edge_data(edge) };
+                                if ((presence & (1u << GROUP_OTHER)) == 0u || candidate_weight > lane_weights[lane_idx]) {
+                                    lane_weights[lane_idx] = candidate_weight;
+                                    lane_edges[lane_idx] = edge;
+                                    lane_ranks[lane_idx] = rank;
+                                    presence = static_cast<std::uint8_t>(presence | (1u << GROUP_OTHER));
+                                }
+                            }
+                        };
+                        if constexpr (grid_addressable_graph<G>) {
+                            if (!is_resident(g, node)) {
+                                // Grid edges are added in the same order as they appear in get_inputs() (from the left, from above, then
+                                // diagonal), followed by edges from resident nodes, such that ranks match the other gather below.
+                                const auto take_grid {
+                                    [&](const std::uint8_t group, const std::size_t src_down, const std::size_t src_right) {
+                                        const std::size_t lane_idx { group * lane_capacity + lane };
+                                        lane_weights[lane_idx] = g.get_edge_data(grid_edge(src_down, src_right, down, right));
+                                        lane_ranks[lane_idx] = rank;
+                                        presence = static_cast<std::uint8_t>(presence | (1u << group));
+                                        rank = static_cast<PARENT_COUNT>(rank + PC1);
+                                    }
+                                };
+                                if (right > 0zu) {
+                                    take_grid(GROUP_RIGHT, down, right - 1zu);
+                                }
+                                if (down > 0zu) {
+                                    take_grid(GROUP_DOWN, down - 1zu, right);
+                                }
+                                if (down > 0zu && right > 0zu) {
+                                    take_grid(GROUP_DIAGONAL, down - 1zu, right - 1zu);
+                                }
+                                for (const auto& edge : g.inputs_from_residents(node)) {
+                                    const N src_node { g.get_edge_from(edge) };
+                                    // A resident node neighbouring this node (e.g., root) also feeds in through a grid edge, already taken
+                                    // above.
+                                    if (edge == grid_edge(src_node.down, src_node.right, down, right)) {
+                                        continue;
+                                    }
+                                    take_other(edge, src_node);
+                                    rank = static_cast<PARENT_COUNT>(rank + PC1);
+                                }
+                                if constexpr (debug_mode) {
+                                    if (static_cast<std::size_t>(rank) != g.get_in_degree(node)) {
+                                        throw std::runtime_error { "Non-resident node has inputs not from grid neighbours or residents" };
+                                    }
+                                }
+                                lane_codes[lane] = static_cast<std::uint8_t>(presence | GRID_ADDRESSED);
+                                continue;
+                            }
+                        }
+                        for (const auto& edge : g.get_inputs(node)) {
+                            const auto& src_node { g.get_edge_from(edge) };
+                            const auto& [src_down_, src_right_, src_depth_] { g.node_to_grid_offset(src_node) };
+                            const std::size_t src_down { src_down_ };
+                            const std::size_t src_right { src_right_ };
+                            std::uint8_t group { GROUP_OTHER };
+                            if (src_down + 1zu == down && src_right == right && (presence & (1u << GROUP_DOWN)) == 0u) {
+                                group = GROUP_DOWN;
+                            } else if (src_down == down && src_right + 1zu == right && (presence & (1u << GROUP_RIGHT)) == 0u) {
+                                group = GROUP_RIGHT;
+                            } else if (src_down + 1zu == down && src_right + 1zu == right && (presence & (1u << GROUP_DIAGONAL)) == 0u) {
+                                group = GROUP_DIAGONAL;
+                            }
+                            const std::size_t lane_idx { group * lane_capacity + lane };
+                            if (group != GROUP_OTHER) {
+                                lane_weights[lane_idx] = g.get_edge_data(edge);
+                                lane_edges[lane_idx] = edge;
+                                lane_ranks[lane_idx] = rank;
+                                presence = static_cast<std::uint8_t>(presence | (1u << group));
+                            } else {
+                                if constexpr (debug_mode) {
+                                    if (src_down > down || src_down + src_right >= down + right) {
+                                        throw std::runtime_error { "Source node not above-left of destination node" };
+                                    }
+                                }
+                                take_other(edge, src_node);
+                            }
+                            rank = static_cast<PARENT_COUNT>(rank + PC1);
+                        }
+                        lane_codes[lane] = presence;
+                    }
+
+                    // Kernel
+                    // ------
+                    // Everything read / written here is contiguous and the loop body has no data-dependent branches, which lets compilers
+                    // vectorize it for arithmetic edge weights.
+                    for (std::size_t lane { 0zu }; lane < lane_cnt; ++lane) {
+                        const std::size_t down { down_lo + lane };
+                        const std::uint8_t presence { lane_codes[lane] };
+                        bool best_present { (presence & (1u << GROUP_OTHER)) != 0u };
+                        ED best_weight { lane_weights[GROUP_OTHER * lane_capacity + lane] };
+                        PARENT_COUNT best_rank { lane_ranks[GROUP_OTHER * lane_capacity + lane] };
+                        std::uint8_t best_group { best_present ? GROUP_OTHER : GROUP_NONE };
+                        const ED down_weight {
+                            anti_diagonal_weights[prev1_base + down] + lane_weights[GROUP_DOWN * lane_capacity + lane]
+                        };
+                        const ED right_weight {
+                            anti_diagonal_weights[prev1_base + down + 1zu] + lane_weights[GROUP_RIGHT * lane_capacity + lane]
+                        };
+                        const ED diagonal_weight {
+                            anti_diagonal_weights[prev2_base + down] + lane_weights[GROUP_DIAGONAL * lane_capacity + lane]
+                        };
+                        const auto select {
+                            [&](const std::uint8_t group, const ED candidate_weight) {
+                                const bool present { (presence & (1u << group)) != 0u };
+                                const PARENT_COUNT candidate_rank { lane_ranks[group * lane_capacity + lane] };
+                                const bool take {
+                                    present
+                                    && (
+                                        !best_present
+                                        || candidate_weight > best_weight
+                                        || (candidate_weight == best_weight && candidate_rank < best_rank)
+                                    )
+                                };
+                                best_weight = take ? candidate_weight : best_weight;
+                                best_rank = take ? candidate_rank : best_rank;
+                                best_group = take ? group : best_group;
+                                best_present = best_present || present;
+                            }
+                        };
+                        select(GROUP_DOWN, down_weight);
+                        select(GROUP_RIGHT, right_weight);
+                        select(GROUP_DIAGONAL, diagonal_weight);
+                        anti_diagonal_weights[cur_base + down + 1zu] = best_present ? best_weight : zero_weight;
+                        lane_codes[lane_capacity + lane] = best_group;
+                    }
+
+                    // Scatter
+                    // -------
+                    for (std::size_t lane { 0zu }; lane < lane_cnt; ++lane) {
+                        const std::size_t down { down_lo + lane };
+                        const std::size_t right { anti_diagonal - down };
+                        const std::uint8_t best_group { lane_codes[lane_capacity + lane] };
+                        if (best_group == GROUP_NONE) {  // if no incoming nodes found, it's a root node
+                            continue;
+                        }
+                        auto& current_slot { slots.find_ref(node_at(g, strip_top + down, right)) };
+                        if constexpr (grid_addressable_graph<G>) {
+                            if ((lane_codes[lane] & GRID_ADDRESSED) != 0u && best_group != GROUP_OTHER) {
+                                const std::size_t src_down { strip_top + down - (best_group == GROUP_RIGHT ? 0zu : 1zu) };
+                                const std::size_t src_right { right - (best_group == GROUP_DOWN ? 0zu : 1zu) };
+                                current_slot.backtracking_edge = grid_edge(src_down, src_right, strip_top + down, right);
+                            } else {
+                                current_slot.backtracking_edge = lane_edges[best_group * lane_capacity + lane];
+                            }
+                        } else {
+                            current_slot.backtracking_edge = lane_edges[best_group * lane_capacity + lane];
+                        }
+                        current_slot.backtracking_weight = anti_diagonal_weights[cur_base + down + 1zu];
+                    }
+                    if (down_hi == strip_height - 1zu) {  // strip's bottom row becomes the row above the next strip
+                        row_above_weights[anti_diagonal - down_hi] = anti_diagonal_weights[cur_base + down_hi + 1zu];
+                    }
+                }
+            }
+            // Return slots container, which can go on to be used for backtracking
+            return slots;
+        }
+
+        auto backtrack(
+            const G& g,
+            const SLOT_CONTAINER& slots
+        ) {
+            auto next_node { g.get_leaf_node() };
+            PATH_CONTAINER path {
+                container_creator_pack.create_path_container(
+                    g.path_edge_capacity
+                )
+            };
+            while (true) {
+                auto node { next_node };
+                if (!g.has_inputs(node)) {
+                    break;
+                }
+                const auto& node_slot { slots.find_ref(node) };
+                path.push_back(node_slot.backtracking_edge);
+                next_node = g.get_edge_from(node_slot.backtracking_edge);
+            }
+            // At this point, path is in reverse order (from last to first). Reverse it (view) to get it into forward order.
+            return std::move(path) | std::views::reverse;
+        }
+    };
+
+    /**
+     * Helper function that constructs an
+     * @ref offbynull::aligner::backtrackers::anti_diagonal_pairwise_alignment_graph_backtracker::backtracker::backtracker instance
+     * utilizing the heap for storage / computations and invokes `find_max_path(g)` on it.
+     *
+     * @tparam debug_mode `true` to enable debugging logic, `false` otherwise.
+     * @tparam PARENT_COUNT Graph node incoming edge counter type. Must be wide enough to hold the maximum number of incoming edges across
+     *      all nodes in the underlying pairwise alignment graph instance (e.g., across all nodes in any global pairwise alignment graph, a
+     *      node can have at most 3 incoming edges).
+     * @tparam SLOT_INDEX Slot indexer type. Must be wide enough to hold the value `grid_down_cnt * grid_right_cnt * grid_depth_cnt`
+     *     (variables being multiplied are the dimensions of `g`).
+     * @tparam minimize_allocations `true` to force the path container to reserve `g.path_edge_capacity` elements, thereby
+     *     removing/reducing the need for adhoc reallocations.
+     * @param g Graph.
+     * @return `find_max_path(g)` result.
+     */
+    template<
+        bool debug_mode,
+        widenable_to_size_t PARENT_COUNT,
+        widenable_to_size_t SLOT_INDEX,
+        bool minimize_allocations
+    >
+    backtracking_result_without_explicit_weight auto heap_find_max_path(
+        const anti_diagonal_backtrackable_graph auto& g
+    ) {
+        using G = std::remove_cvref_t<decltype(g)>;
+        return backtracker<
+            debug_mode,
+            G,
+            PARENT_COUNT,
+            SLOT_INDEX,
+            backtracker_heap_container_creator_pack<
+                debug_mode,
+                typename G::N,
+                typename G::E,
+                typename G::ED,
+                PARENT_COUNT,
+                SLOT_INDEX,
+                minimize_allocations
+            >
+        > {}.find_max_path(g);
+    }
+
+    /**
+     * Helper function that constructs an
+     * @ref offbynull::aligner::backtrackers::anti_diagonal_pairwise_alignment_graph_backtracker::backtracker::backtracker instance
+     * utilizing the stack for storage / computations and invokes `find_max_path(g)` on it.
+     *
+     * @tparam debug_mode `true` to enable debugging logic, `false` otherwise.
+     * @tparam PARENT_COUNT Graph node incoming edge counter type. Must be wide enough to hold the maximum number of incoming edges across
+     *      all nodes in the underlying pairwise alignment graph instance (e.g., across all nodes in any global pairwise alignment graph, a
+     *      node can have at most 3 incoming edges).
+     * @tparam SLOT_INDEX Slot indexer type. Must be wide enough to hold the value `grid_down_cnt * grid_right_cnt * grid_depth_cnt`
+     *     (variables being multiplied are the dimensions of `g`).
+     * @tparam grid_down_cnt `g`'s down dimension of the underlying pairwise alignment graph instance.
+     * @tparam grid_right_cnt `g`'s right dimension of the underlying pairwise alignment graph instance.
+     * @tparam grid_depth_cnt `g'`s depth dimension of the underlying pairwise alignment graph instance.
+     * @tparam path_edge_capacity Of all paths between root and leaf within `g`, the maximum number of edges.
+     * @param g Graph.
+     * @return `find_max_path(g)` result.
+     */
+    template<
+        bool debug_mode,
+        widenable_to_size_t PARENT_COUNT,
+        widenable_to_size_t SLOT_INDEX,
+        std::size_t grid_down_cnt,
+        std::size_t grid_right_cnt,
+        std::size_t grid_depth_cnt,
+        std::size_t path_edge_capacity
+    >
+    backtracking_result_without_explicit_weight auto stack_find_max_path(
+        const anti_diagonal_backtrackable_graph auto& g
+    ) {
+        using G = std::remove_cvref_t<decltype(g)>;
+        using N = typename G::N;
+        using E = typename G::E;
+        using ED = typename G::ED;
+        if constexpr (debug_mode) {
+            if (g.grid_down_cnt != grid_down_cnt
+                || g.grid_right_cnt != grid_right_cnt
+                || g.grid_depth_cnt != grid_depth_cnt
+                || g.path_edge_capacity != path_edge_capacity) {
+                throw std::runtime_error { "Unexpected graph dimensions" };
+            }
+        }
+        return backtracker<
+            debug_mode,
+            G,
+            PARENT_COUNT,
+            SLOT_INDEX,
+            backtracker_stack_container_creator_pack<
+                debug_mode,
+                N,
+                E,
+                ED,
+                PARENT_COUNT,
+                SLOT_INDEX,
+                grid_down_cnt,
+                grid_right_cnt,
+                grid_depth_cnt,
+                path_edge_capacity
+            >
+        > {}.find_max_path(g);
+    }
+}
+
+#endif //OFFBYNULL_ALIGNER_BACKTRACKERS_ANTI_DIAGONAL_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_BACKTRACKER_H
@@ -0,0 +1,158 @@
+#ifndef OFFBYNULL_ALIGNER_BACKTRACKERS_ANTI_DIAGONAL_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_BACKTRACKER_STACK_CONTAINER_CREATOR_PACK_H
+#define OFFBYNULL_ALIGNER_BACKTRACKERS_ANTI_DIAGONAL_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_BACKTRACKER_STACK_CONTAINER_CREATOR_PACK_H
+
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <stdexcept>
+#include "offbynull/aligner/concepts.h"
+#include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/backtrackable_node.h"
+#include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/backtrackable_edge.h"
+#include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/slot_container/slot_container_stack_container_creator_pack.h"
+#include "offbynull/aligner/backtrackers/anti_diagonal_pairwise_alignment_graph_backtracker/unimplemented_backtracker_container_creator_pack.h"
+#include "offbynull/concepts.h"
+#include "offbynull/utils.h"
+
+namespace offbynull::aligner::backtrackers::anti_diagonal_pairwise_alignment_graph_backtracker::backtracker_stack_container_creator_pack {
+    using offbynull::aligner::concepts::weight;
+    using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtrackable_node::backtrackable_node;
+    using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtrackable_edge::backtrackable_edge;
+    using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::slot_container
+        ::slot_container_stack_container_creator_pack::slot_container_stack_container_creator_pack;
+    using offbynull::concepts::widenable_to_size_t;
+    using offbynull::utils::static_vector_typer;
+
+    /**
+     * @ref offbynull::aligner::backtrackers::anti_diagonal_pairwise_alignment_graph_backtracker::backtracker_container_creator_pack::backtracker_container_creator_pack
+     * that allocates its containers on the stack.
+     *
+     * @tparam debug_mode `true` to enable debugging logic, `false` otherwise.
+     * @tparam N Graph node identifier type.
+     * @tparam E Graph edge identifier type.
+     * @tparam ED Graph edge data type (edge weight).
+     * @tparam PARENT_COUNT Graph node incoming edge counter type. Must be wide enough to hold the maximum number of incoming edges across
+     *     all nodes in the underlying pairwise alignment graph instance (e.g., across all nodes in any global pairwise alignment graph, a
+     *     node can have at most 3 incoming edges).
+     * @tparam SLOT_INDEX Slot indexer type. Must be wide enough to hold the value `grid_down_cnt * grid_right_cnt * grid_depth_cnt`
+     *     (variables being multiplied are the dimensions of the underlying graph).
+     * @tparam grid_down_cnt Expected down dimension of the underlying pairwise alignment graph instance.
+     * @tparam grid_right_cnt Expected right dimension of the underlying pairwise alignment graph instance.
+     * @tparam grid_depth_cnt Expected depth dimension of the underlying pairwise alignment graph instance.
+     * @tparam path_edge_capacity Of all paths between root and leaf within the underlying pairwise alignment graph, the maximum number of
+     *     edges.
+     */
+    template<
+        bool debug_mode,
+        backtrackable_node N,
+        backtrackable_edge E,
+        weight ED,
+        widenable_to_size_t PARENT_COUNT,
+        widenable_to_size_t SLOT_INDEX,
+        std::size_t grid_down_cnt,
+        std::size_t grid_right_cnt,
+        std::size_t grid_depth_cnt,
+        std::size_t path_edge_capacity
+    >
+    struct backtracker_stack_container_creator_pack {
+        /**
+         * @copydoc offbynull::aligner::backtrackers::anti_diagonal_pairwise_alignment_graph_backtracker::unimplemented_backtracker_container_creator_pack::unimplemented_backtracker_container_creator_pack::create_slot_container_container_creator_pack
+         */
+        slot_container_stack_container_creator_pack<
+            debug_mode,
+            N,
+            E,
+            ED,
+            PARENT_COUNT,
+            SLOT_INDEX,
+            grid_down_cnt,
+            grid_right_cnt,
+            grid_depth_cnt
+        > create_slot_container_container_creator_pack() const {
+            return {};
+        }
+
+        /**
+         * Maximum number of elements any of the lane containers will need to hold. Weight containers hold 3 padded anti-diagonals (each
+         * at most `grid_down_cnt + 1` elements), 4 candidates per lane (an anti-diagonal has at most `grid_down_cnt` lanes), or the row
+         * above the strip being walked (`grid_right_cnt` elements).
+         */
+        static constexpr std::size_t LANE_ELEM_COUNT { 4zu * (std::max(grid_down_cnt, grid_right_cnt) + 1zu) };
+
+        /** `create_weight_container()` return type. */
+        using WEIGHT_CONTAINER_TYPE = typename static_vector_typer<debug_mode, ED, LANE_ELEM_COUNT>::type;
+
+        /**
+         * @copydoc offbynull::aligner::backtrackers::anti_diagonal_pairwise_alignment_graph_backtracker::unimplemented_backtracker_container_creator_pack::unimplemented_backtracker_container_creator_pack::create_weight_container
+         */
+        WEIGHT_CONTAINER_TYPE create_weight_container(std::size_t cnt, ED zero_weight) const {
+            if constexpr (debug_mode) {
+                if (cnt > LANE_ELEM_COUNT) {
+                    throw std::runtime_error { "Bad element count" };
+                }
+            }
+            return WEIGHT_CONTAINER_TYPE(cnt, zero_weight);
+        }
+
+        /** `create_edge_container()` return type. */
+        using EDGE_CONTAINER_TYPE = typename static_vector_typer<debug_mode, E, LANE_ELEM_COUNT>::type;
+
+        /**
+         * @copydoc offbynull::aligner::backtrackers::anti_diagonal_pairwise_alignment_graph_backtracker::unimplemented_backtracker_container_creator_pack::unimplemented_backtracker_container_creator_pack::create_edge_container
+         */
+        EDGE_CONTAINER_TYPE create_edge_container(std::size_t cnt) const {
+            if constexpr (debug_mode) {
+                if (cnt > LANE_ELEM_COUNT) {
+                    throw std::runtime_error { "Bad element count" };
+                }
+            }
+            return EDGE_CONTAINER_TYPE(cnt);
+        }
+
+        /** `create_rank_container()` return type. */
+        using RANK_CONTAINER_TYPE = typename static_vector_typer<debug_mode, PARENT_COUNT, LANE_ELEM_COUNT>::type;
+
+        /**
+         * @copydoc offbynull::aligner::backtrackers::anti_diagonal_pairwise_alignment_graph_backtracker::unimplemented_backtracker_container_creator_pack::unimplemented_backtracker_container_creator_pack::create_rank_container
+         */
+        RANK_CONTAINER_TYPE create_rank_container(std::size_t cnt) const {
+            if constexpr (debug_mode) {
+                if (cnt > LANE_ELEM_COUNT) {
+                    throw std::runtime_error { "Bad element count" };
+                }
+            }
+            return RANK_CONTAINER_TYPE(cnt);
+        }
+
+        /** `create_code_container()` return type. */
+        using CODE_CONTAINER_TYPE = typename static_vector_typer<debug_mode, std::uint8_t, LANE_ELEM_COUNT>::type;
+
+        /**
+         * @copydoc offbynull::aligner::backtrackers::anti_diagonal_pairwise_alignment_graph_backtracker::unimplemented_backtracker_container_creator_pack::unimplemented_backtracker_container_creator_pack::create_code_container
+         */
+        CODE_CONTAINER_TYPE create_code_container(std::size_t cnt) const {
+            if constexpr (debug_mode) {
+                if (cnt > LANE_ELEM_COUNT) {
+                    throw std::runtime_error { "Bad element count" };
+                }
+            }
+            return CODE_CONTAINER_TYPE(cnt);
+        }
+
+        /** `create_path_container()` return type. */
+        using PATH_CONTAINER_TYPE = typename static_vector_typer<debug_mode, E, path_edge_capacity>::type;
+
+        /**
+         * @copydoc offbynull::aligner::backtrackers::anti_diagonal_pairwise_alignment_graph_backtracker::unimplemented_backtracker_container_creator_pack::unimplemented_backtracker_container_creator_pack::create_path_container
+         */
+        PATH_CONTAINER_TYPE create_path_container(std::size_t path_edge_capacity_) const {
+            if constexpr (debug_mode) {
+                if (path_edge_capacity_ > path_edge_capacity) {
+                    throw std::runtime_error { "Path edge capacity too large" };
+                }
+            }
+            return {};
+        }
+    };
+}
+
+#endif //OFFBYNULL_ALIGNER_BACKTRACKERS_ANTI_DIAGONAL_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_BACKTRACKER_STACK_CONTAINER_CREATOR_PACK_H
@@ -0,0 +1,342 @@
+#include "offbynull/aligner/graphs/pairwise_global_alignment_graph.h"
+#include "offbynull/aligner/graphs/pairwise_local_alignment_graph.h"
+#include "offbynull/aligner/graphs/pairwise_overlap_alignment_graph.h"
+#include "offbynull/aligner/graphs/pairwise_fitting_alignment_graph.h"
+#include "offbynull/aligner/graphs/pairwise_extended_gap_alignment_graph.h"
+#include "offbynull/aligner/backtrackers/anti_diagonal_pairwise_alignment_graph_backtracker/backtracker.h"
+#include "offbynull/aligner/backtrackers/anti_diagonal_pairwise_alignment_graph_backtracker/concepts.h"
+#include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/backtracker.h"
+#include "offbynull/aligner/scorers/simple_scorer.h"
+#include "offbynull/utils.h"
+#include "gtest/gtest.h"
+#include <cstddef>
+#include <cstdint>
+#include <stdfloat>
+#include <string>
+#include <vector>
+#include <random>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+namespace {
+    using offbynull::aligner::backtrackers::anti_diagonal_pairwise_alignment_graph_backtracker::backtracker::backtracker;
+    using offbynull::aligner::backtrackers::anti_diagonal_pairwise_alignment_graph_backtracker::backtracker::heap_find_max_path;
+    using offbynull::aligner::backtrackers::anti_diagonal_pairwise_alignment_graph_backtracker::backtracker::stack_find_max_path;
+    using offbynull::aligner::backtrackers::anti_diagonal_pairwise_alignment_graph_backtracker::concepts::anti_diagonal_backtrackable_graph;
+    using offbynull::aligner::backtrackers::anti_diagonal_pairwise_alignment_graph_backtracker::concepts::grid_addressable_graph;
+    using offbynull::aligner::graphs::pairwise_global_alignment_graph::pairwise_global_alignment_graph;
+    using offbynull::aligner::graphs::pairwise_global_alignment_graph::create_pairwise_global_alignment_graph;
+    using offbynull::aligner::graphs::pairwise_local_alignment_graph::pairwise_local_alignment_graph;
+    using offbynull::aligner::graphs::pairwise_local_alignment_graph::create_pairwise_local_alignment_graph;
+    using offbynull::aligner::graphs::pairwise_overlap_alignment_graph::create_pairwise_overlap_alignment_graph;
+    using offbynull::aligner::graphs::pairwise_fitting_alignment_graph::create_pairwise_fitting_alignment_graph;
+    using offbynull::aligner::graphs::pairwise_extended_gap_alignment_graph::pairwise_extended_gap_alignment_graph;
+    using offbynull::aligner::scorers::simple_scorer::simple_scorer;
+    using offbynull::utils::copy_to_vector;
+    using offbynull::utils::is_debug_mode;
+
+    auto expected_max_path(const auto& g) {
+        using G = std::remove_cvref_t<decltype(g)>;
+        const auto& [path, weight] {
+            offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtracker::backtracker<
+                is_debug_mode(),
+                G,
+                std::size_t,
+                std::size_t
+            > {}.find_max_path(g)
+        };
+        return std::make_pair(copy_to_vector(path), weight);
+    }
+
+    auto actual_max_path(const auto& g) {
+        using G = std::remove_cvref_t<decltype(g)>;
+        const auto& [path, weight] {
+            backtracker<
+                is_debug_mode(),
+                G,
+                std::size_t,
+                std::size_t
+            > {}.find_max_path(g)
+        };
+        return std::make_pair(copy_to_vector(path), weight);
+    }
+
+    TEST(OABABacktrackerTest, ConceptCheck) {
+        auto substitution_scorer {
+            simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_substitution(1.0f64, -1.0f64)
+        };
+        auto gap_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_gap(0.0f64) };
+        auto freeride_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_freeride() };
+        using G1 = pairwise_global_alignment_graph<
+            is_debug_mode(),
+            std::size_t,
+            std::float64_t,
+            std::string,
+            std::string,
+            decltype(substitution_scorer),
+            decltype(gap_scorer)
+        >;
+        static_assert(anti_diagonal_backtrackable_graph<G1>);
+        static_assert(grid_addressable_graph<G1>);
+        using G2 = pairwise_extended_gap_alignment_graph<
+            is_debug_mode(),
+            std::size_t,
+            std::float64_t,
+            std::string,
+            std::string,
+            decltype(substitution_scorer),
+            decltype(gap_scorer),
+            decltype(gap_scorer),
+            decltype(freeride_scorer)
+        >;
+        static_assert(!anti_diagonal_backtrackable_graph<G2>);  // 3 nodes deep
+    }
+
+    TEST(OABABacktrackerTest, FindMaxPathOnGridGraph) {
+        auto substitution_scorer {
+            simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_substitution(1.0f64, -1.0f64)
+        };
+        auto gap_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_gap(0.0f64) };
+
+        std::string seq1 { "a" };
+        std::string seq2 { "ac" };
+        pairwise_global_alignment_graph<
+            is_debug_mode(),
+            std::size_t,
+            std::float64_t,
+            decltype(seq1),
+            decltype(seq2),
+            decltype(substitution_scorer),
+            decltype(gap_scorer)
+        > g {
+            seq1,
+            seq2,
+            substitution_scorer,
+            gap_scorer
+        };
+
+        using E = decltype(g)::E;
+
+        const auto& [path, weight] { actual_max_path(g) };
+        EXPECT_EQ(
+            path,
+            (std::vector<E> {
+                E { { 0zu, 0zu }, { 1zu, 1zu } },
+                E { { 1zu, 1zu }, { 1zu, 2zu } }
+            })
+        );
+        EXPECT_EQ(weight, 1.0);
+    }
+
+    TEST(OABABacktrackerTest, FindMaxPathViaHelpers) {
+        auto substitution_scorer {
+            simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_substitution(1.0f64, -1.0f64)
+        };
+        auto gap_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_gap(0.0f64) };
+
+        std::string seq1 { "a" };
+        std::string seq2 { "ac" };
+        pairwise_global_alignment_graph<
+            is_debug_mode(),
+            std::size_t,
+            std::float64_t,
+            decltype(seq1),
+            decltype(seq2),
+            decltype(substitution_scorer),
+            decltype(gap_scorer)
+        > g {
+            seq1,
+            seq2,
+            substitution_scorer,
+            gap_scorer
+        };
+
+        using E = decltype(g)::E;
+
+        {
+            const auto& [path, weight] { heap_find_max_path<is_debug_mode(), std::size_t, std::size_t, true>(g) };
+            EXPECT_EQ(
+                copy_to_vector(path),
+                (std::vector<E> {
+                    E { { 0zu, 0zu }, { 1zu, 1zu } },
+                    E { { 1zu, 1zu }, { 1zu, 2zu } }
+                })
+            );
+            EXPECT_EQ(weight, 1.0);
+        }
+        {
+            const auto& [path, weight] {
+                stack_find_max_path<
+                    is_debug_mode(),
+                    std::size_t,
+                    std::size_t,
+                    2zu /*grid_down_cnt*/,
+                    3zu /*grid_right_cnt*/,
+                    1zu /*grid_depth_cnt*/,
+                    (2zu - 1zu) + (3zu - 1zu) /*path_edge_capacity*/
+                >(g)
+            };
+            EXPECT_EQ(
+                copy_to_vector(path),
+                (std::vector<E> {
+                    E { { 0zu, 0zu }, { 1zu, 1zu } },
+                    E { { 1zu, 1zu }, { 1zu, 2zu } }
+                })
+            );
+            EXPECT_EQ(weight, 1.0);
+        }
+    }
+
+    TEST(OABABacktrackerTest, RandomizedTestingAgainstReadyQueueBacktracker) {
+        std::mt19937_64 rand { 12345 };
+        auto random_integer { [&](auto a, auto b) -> decltype(a) { return std::uniform_int_distribution<decltype(a)>(a,b)(rand); } };
+        auto random_string {
+            [&](std::size_t max_len) {
+                std::string ret {};
+                for ([[maybe_unused]] auto _ : std::views::iota(0zu, random_integer(1zu, max_len))) {
+                    ret += random_integer('a', 'd');
+                }
+                return ret;
+            }
+        };
+        for ([[maybe_unused]] auto _ : std::views::iota(0u, 250u)) {
+            // Integer weights from a tiny range to force lots of ties, making sure ties get broken the same way
+            auto substitution_scorer {
+                simple_scorer<is_debug_mode(), std::size_t, char, char, std::int32_t>::create_substitution(
+                    random_integer(-2, 2),
+                    random_integer(-2, 2)
+                )
+            };
+            auto gap_scorer {
+                simple_scorer<is_debug_mode(), std::size_t, char, char, std::int32_t>::create_gap(random_integer(-2, 2))
+            };
+            auto freeride_scorer {
+                simple_scorer<is_debug_mode(), std::size_t, char, char, std::int32_t>::create_freeride(random_integer(-2, 2))
+            };
+            std::string seq1 { random_string(12zu) };
+            std::string seq2 { random_string(12zu) };
+            {
+                auto g {
+                    create_pairwise_global_alignment_graph<is_debug_mode(), std::size_t>(seq1, seq2, substitution_scorer, gap_scorer)
+                };
+                EXPECT_EQ(expected_max_path(g), actual_max_path(g));
+            }
+            {
+                auto g {
+                    create_pairwise_local_alignment_graph<is_debug_mode(), std::size_t>(
+                        seq1, seq2, substitution_scorer, gap_scorer, freeride_scorer
+                    )
+                };
+                EXPECT_EQ(expected_max_path(g), actual_max_path(g));
+            }
+            {
+                auto g {
+                    create_pairwise_overlap_alignment_graph<is_debug_mode(), std::size_t>(
+                        seq1, seq2, substitution_scorer, gap_scorer, freeride_scorer
+                    )
+                };
+                EXPECT_EQ(expected_max_path(g), actual_max_path(g));
+            }
+            {
+                auto g {
+                    create_pairwise_fitting_alignment_graph<is_debug_mode(), std::size_t>(
+                        seq1, seq2, substitution_scorer, gap_scorer, freeride_scorer
+                    )
+                };
+                EXPECT_EQ(expected_max_path(g), actual_max_path(g));
+            }
+        }
+    }
+
+    TEST(OABABacktrackerTest, RandomizedTestingAgainstReadyQueueBacktrackerAcrossStrips) {
+        // Sequences long enough that the grid gets walked as multiple strips, with a strip boundary landing at varying columns.
+        std::mt19937_64 rand { 54321 };
+        auto random_integer { [&](auto a, auto b) -> decltype(a) { return std::uniform_int_distribution<decltype(a)>(a,b)(rand); } };
+        auto random_string {
+            [&](std::size_t min_len, std::size_t max_len) {
+                std::string ret {};
+                for ([[maybe_unused]] auto _ : std::views::iota(0zu, random_integer(min_len, max_len))) {
+                    ret += random_integer('a', 'd');
+                }
+                return ret;
+            }
+        };
+        for ([[maybe_unused]] auto _ : std::views::iota(0u, 10u)) {
+            auto substitution_scorer {
+                simple_scorer<is_debug_mode(), std::size_t, char, char, std::int32_t>::create_substitution(
+                    random_integer(0, 2),
+                    random_integer(-2, 0)
+                )
+            };
+            auto gap_scorer {
+                simple_scorer<is_debug_mode(), std::size_t, char, char, std::int32_t>::create_gap(random_integer(-2, 0))
+            };
+            auto freeride_scorer {
+                simple_scorer<is_debug_mode(), std::size_t, char, char, std::int32_t>::create_freeride(0)
+            };
+            std::string seq1 { random_string(65zu, 100zu) };
+            std::string seq2 { random_string(1zu, 100zu) };
+            {
+                auto g {
+                    create_pairwise_global_alignment_graph<is_debug_mode(), std::size_t>(seq1, seq2, substitution_scorer, gap_scorer)
+                };
+                EXPECT_EQ(expected_max_path(g), actual_max_path(g));
+            }
+            {
+                auto g {
+                    create_pairwise_local_alignment_graph<is_debug_mode(), std::size_t>(
+                        seq1, seq2, substitution_scorer, gap_scorer, freeride_scorer
+                    )
+                };
+                EXPECT_EQ(expected_max_path(g), actual_max_path(g));
+            }
+            {
+                auto g {
+                    create_pairwise_fitting_alignment_graph<is_debug_mode(), std::size_t>(
+                        seq1, seq2, substitution_scorer, gap_scorer, freeride_scorer
+                    )
+                };
+                EXPECT_EQ(expected_max_path(g), actual_max_path(g));
+            }
+        }
+    }
+
+    // Local alignment graph that counts how many times get_inputs() gets invoked.
+    template<typename G>
+    struct input_counting_graph : G {
+        using G::G;
+        mutable std::size_t get_inputs_cnt { 0zu };
+
+        auto get_inputs(const typename G::N& n) const {
+            ++get_inputs_cnt;
+            return G::get_inputs(n);
+        }
+    };
+
+    TEST(OABABacktrackerTest, GridAddressableGraphOnlyEnumeratesResidentInputs) {
+        auto substitution_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, std::int32_t>::create_substitution(2, -1) };
+        auto gap_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, std::int32_t>::create_gap(-1) };
+        auto freeride_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, std::int32_t>::create_freeride(0) };
+        std::string seq1 { "abcdabcdabcdabcdabcd" };
+        std::string seq2 { "dcbaabcddcbaabcd" };
+        using G = input_counting_graph<
+            pairwise_local_alignment_graph<
+                is_debug_mode(),
+                std::size_t,
+                std::int32_t,
+                std::string,
+                std::string,
+                decltype(substitution_scorer),
+                decltype(gap_scorer),
+                decltype(freeride_scorer)
+            >
+        >;
+        static_assert(grid_addressable_graph<G>);
+        G g { seq1, seq2, substitution_scorer, gap_scorer, freeride_scorer };
+        const auto actual { actual_max_path(g) };
+        // Only the resident nodes get their inputs enumerated: root (no inputs) and leaf (free-rides from every other node).
+        EXPECT_EQ(2zu, g.get_inputs_cnt);
+        EXPECT_EQ(expected_max_path(g), actual);
+    }
+}
@@ -0,0 +1,129 @@
+#ifndef OFFBYNULL_ALIGNER_BACKTRACKERS_ANTI_DIAGONAL_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_BACKTRACKER_WORKSPACE_CONTAINER_CREATOR_PACK_H
+#define OFFBYNULL_ALIGNER_BACKTRACKERS_ANTI_DIAGONAL_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_BACKTRACKER_WORKSPACE_CONTAINER_CREATOR_PACK_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "offbynull/aligner/concepts.h"
+#include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/backtrackable_node.h"
+#include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/backtrackable_edge.h"
+#include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/backtracker_workspace.h"
+#include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/slot_container/slot_container_workspace_container_creator_pack.h"
+#include "offbynull/aligner/backtrackers/anti_diagonal_pairwise_alignment_graph_backtracker/unimplemented_backtracker_container_creator_pack.h"
+#include "offbynull/concepts.h"
+
+namespace offbynull::aligner::backtrackers::anti_diagonal_pairwise_alignment_graph_backtracker
+        ::backtracker_workspace_container_creator_pack {
+    using offbynull::aligner::concepts::weight;
+    using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtrackable_node::backtrackable_node;
+    using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtrackable_edge::backtrackable_edge;
+    using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::slot_container
+        ::slot_container_workspace_container_creator_pack::slot_container_workspace_container_creator_pack;
+    using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtracker_workspace::backtracker_workspace;
+    using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtracker_workspace::workspace_buffer;
+    using offbynull::concepts::widenable_to_size_t;
+
+    /**
+     * @ref offbynull::aligner::backtrackers::anti_diagonal_pairwise_alignment_graph_backtracker::backtracker_container_creator_pack::backtracker_container_creator_pack
+     * that leases its slot and lane containers from a
+     * @ref offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtracker_workspace::backtracker_workspace, such that
+     * repeated invocations of the same backtracker reuse the same storage rather than allocating anew. If no workspace is set, containers
+     * are allocated on the heap.
+     *
+     * Path containers are always allocated on the heap, since they're handed over to the caller as part of the result (which may outlive
+     * the workspace).
+     *
+     * @tparam debug_mode `true` to enable debugging logic, `false` otherwise.
+     * @tparam N Graph node identifier type.
+     * @tparam E Graph edge identifier type.
+     * @tparam ED Graph edge data type (edge weight).
+     * @tparam PARENT_COUNT Graph node incoming edge counter type. Must be wide enough to hold the maximum number of incoming edges across
+     *     all nodes in the underlying pairwise alignment graph instance (e.g., across all nodes in any global pairwise alignment graph, a
+     *     node can have at most 3 incoming edges).
+     * @tparam SLOT_INDEX Slot indexer type. Must be wide enough to hold the value `grid_down_cnt * grid_right_cnt * grid_depth_cnt`
+     *     (variables being multiplied are the dimensions of the underlying graph).
+     * @tparam minimize_allocations `true` to force `create_path_container()` to reserve `path_edge_capacity` elements, thereby
+     *     removing/reducing the need for adhoc reallocations.
+     */
+    template<
+        bool debug_mode,
+        backtrackable_node N,
+        backtrackable_edge E,
+        weight ED,
+        widenable_to_size_t PARENT_COUNT,
+        widenable_to_size_t SLOT_INDEX,
+        bool minimize_allocations
+    >
+    struct backtracker_workspace_container_creator_pack {
+        /**
+         * Workspace to lease containers from, or `nullptr` to allocate containers on the heap.
+         */
+        backtracker_workspace* workspace { nullptr };
+
+        /**
+         * @copydoc offbynull::aligner::backtrackers::anti_diagonal_pairwise_alignment_graph_backtracker::unimplemented_backtracker_container_creator_pack::unimplemented_backtracker_container_creator_pack::create_slot_container_container_creator_pack
+         */
+        slot_container_workspace_container_creator_pack<
+            debug_mode,
+            N,
+            E,
+            ED,
+            PARENT_COUNT,
+            SLOT_INDEX
+        > create_slot_container_container_creator_pack() const {
+            return { workspace };
+        }
+
+        /**
+         * @copydoc offbynull::aligner::backtrackers::anti_diagonal_pairwise_alignment_graph_backtracker::unimplemented_backtracker_container_creator_pack::unimplemented_backtracker_container_creator_pack::create_weight_container
+         */
+        workspace_buffer<ED> create_weight_container(std::size_t cnt, ED zero_weight) const {
+            return lease<ED>(cnt, zero_weight);
+        }
+
+        /**
+         * @copydoc offbynull::aligner::backtrackers::anti_diagonal_pairwise_alignment_graph_backtracker::unimplemented_backtracker_container_creator_pack::unimplemented_backtracker_container_creator_pack::create_edge_container
+         */
+        workspace_buffer<E> create_edge_container(std::size_t cnt) const {
+            return lease<E>(cnt, E {});
+        }
+
+        /**
+         * @copydoc offbynull::aligner::backtrackers::anti_diagonal_pairwise_alignment_graph_backtracker::unimplemented_backtracker_container_creator_pack::unimplemented_backtracker_container_creator_pack::create_rank_container
+         */
+        workspace_buffer<PARENT_COUNT> create_rank_container(std::size_t cnt) const {
+            return lease<PARENT_COUNT>(cnt, PARENT_COUNT {});
+        }
+
+        /**
+         * @copydoc offbynull::aligner::backtrackers::anti_diagonal_pairwise_alignment_graph_backtracker::unimplemented_backtracker_container_creator_pack::unimplemented_backtracker_container_creator_pack::create_code_container
+         */
+        workspace_buffer<std::uint8_t> create_code_container(std::size_t cnt) const {
+            return lease<std::uint8_t>(cnt, std::uint8_t {});
+        }
+
+        /**
+         * @copydoc offbynull::aligner::backtrackers::anti_diagonal_pairwise_alignment_graph_backtracker::unimplemented_backtracker_container_creator_pack::unimplemented_backtracker_container_creator_pack::create_path_container
+         */
+        std::vector<E> create_path_container(std::size_t path_edge_capacity) const {
+            std::vector<E> ret {};
+            if constexpr (minimize_allocations) {
+                ret.reserve(path_edge_capacity);
+            }
+            return ret;
+        }
+
+    private:
+        template<typename T>
+        workspace_buffer<T> lease(std::size_t cnt, const T& value) const {
+            workspace_buffer<T> ret {};
+            if (workspace != nullptr) {
+                ret = workspace->lease<T>();
+            }
+            ret.assign(cnt, value);  // Only reallocates if larger than previous leases
+            return ret;
+        }
+    };
+}
+
+#endif //OFFBYNULL_ALIGNER_BACKTRACKERS_ANTI_DIAGONAL_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_BACKTRACKER_WORKSPACE_CONTAINER_CREATOR_PACK_H
@@ -0,0 +1,72 @@
+#ifndef OFFBYNULL_ALIGNER_BACKTRACKERS_ANTI_DIAGONAL_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_CONCEPTS_H
+#define OFFBYNULL_ALIGNER_BACKTRACKERS_ANTI_DIAGONAL_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_CONCEPTS_H
+
+#include <concepts>
+#include "offbynull/concepts.h"
+#include "offbynull/aligner/graph/pairwise_alignment_graph.h"
+#include "offbynull/aligner/graph/sliceable_pairwise_alignment_graph.h"
+#include "offbynull/aligner/graphs/grid_graph.h"
+#include "offbynull/aligner/graphs/pairwise_local_alignment_graph.h"
+#include "offbynull/aligner/graphs/pairwise_overlap_alignment_graph.h"
+#include "offbynull/aligner/graphs/pairwise_fitting_alignment_graph.h"
+#include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/backtrackable_node.h"
+#include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/backtrackable_edge.h"
+
+namespace offbynull::aligner::backtrackers::anti_diagonal_pairwise_alignment_graph_backtracker::concepts {
+    using offbynull::concepts::numeric;
+    using offbynull::aligner::graph::pairwise_alignment_graph::pairwise_alignment_graph;
+    using offbynull::aligner::graph::sliceable_pairwise_alignment_graph::sliceable_pairwise_alignment_graph;
+    using offbynull::aligner::graphs::grid_graph::node;
+    using offbynull::aligner::graphs::grid_graph::edge;
+    using offbynull::aligner::graphs::pairwise_local_alignment_graph::local_edge;
+    using offbynull::aligner::graphs::pairwise_overlap_alignment_graph::overlap_edge;
+    using offbynull::aligner::graphs::pairwise_fitting_alignment_graph::fitting_edge;
+    using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtrackable_node::backtrackable_node;
+    using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtrackable_edge::backtrackable_edge;
+
+    /**
+     * Concept that's satisfied if `G` can be walked by
+     * @ref offbynull::aligner::backtrackers::anti_diagonal_pairwise_alignment_graph_backtracker::backtracker::backtracker. That is, `G` is
+     * a @ref offbynull::aligner::graph::pairwise_alignment_graph::pairwise_alignment_graph where ...
+     *
+     *  * the grid is exactly 1 node deep (e.g., global, local, overlap, and fitting alignment graphs, but not extended gap alignment
+     *    graphs).
+     *  * edge weights are numeric (arithmetic types), such that the per-cell maximum can be computed over contiguous arrays.
+     *
+     * @tparam G Type to check.
+     */
+    template<typename G>
+    concept anti_diagonal_backtrackable_graph =
+        pairwise_alignment_graph<G>
+        && backtrackable_node<typename G::N>
+        && backtrackable_edge<typename G::E>
+        && numeric<typename G::ED>
+        && G::grid_depth_cnt == static_cast<typename G::N_INDEX>(1zu);
+
+    /**
+     * Concept that's satisfied if `G` satisfies
+     * @ref offbynull::aligner::backtrackers::anti_diagonal_pairwise_alignment_graph_backtracker::concepts::anti_diagonal_backtrackable_graph
+     * and ...
+     *
+     *  * it's a @ref offbynull::aligner::graph::sliceable_pairwise_alignment_graph::sliceable_pairwise_alignment_graph, such that every
+     *    edge feeding into a non-resident node is either a grid edge from one of its down / right / diagonal neighbours or an edge from a
+     *    resident node.
+     *  * its node and edge identifiers are those of the global, local, overlap, or fitting alignment graphs, such that the grid edge
+     *    between any 2 neighbouring grid positions can be constructed directly rather than enumerated via `get_inputs()`.
+     *
+     * @tparam G Type to check.
+     */
+    template<typename G>
+    concept grid_addressable_graph =
+        anti_diagonal_backtrackable_graph<G>
+        && sliceable_pairwise_alignment_graph<G>
+        && std::same_as<typename G::N, node<typename G::N_INDEX>>
+        && (
+            std::same_as<typename G::E, edge<typename G::N_INDEX>>
+            || std::same_as<typename G::E, local_edge<typename G::N_INDEX>>
+            || std::same_as<typename G::E, overlap_edge<typename G::N_INDEX>>
+            || std::same_as<typename G::E, fitting_edge<typename G::N_INDEX>>
+        );
+}
+
+#endif //OFFBYNULL_ALIGNER_BACKTRACKERS_ANTI_DIAGONAL_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_CONCEPTS_H
@@ -0,0 +1,70 @@
+#ifndef OFFBYNULL_ALIGNER_BACKTRACKERS_ANTI_DIAGONAL_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_UNIMPLEMENTED_BACKTRACKER_CONTAINER_CREATOR_PACK_H
+#define OFFBYNULL_ALIGNER_BACKTRACKERS_ANTI_DIAGONAL_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_UNIMPLEMENTED_BACKTRACKER_CONTAINER_CREATOR_PACK_H
+
+#include <cstddef>
+#include "offbynull/aligner/backtrackers/anti_diagonal_pairwise_alignment_graph_backtracker/backtracker_container_creator_pack.h"
+
+namespace offbynull::aligner::backtrackers::anti_diagonal_pairwise_alignment_graph_backtracker
+        ::unimplemented_backtracker_container_creator_pack {
+    /**
+     * Unimplemented
+     * @ref offbynull::aligner::backtrackers::anti_diagonal_pairwise_alignment_graph_backtracker::backtracker_container_creator_pack::backtracker_container_creator_pack,
+     * intended for documentation.
+     */
+    struct unimplemented_backtracker_container_creator_pack {
+        /**
+         * Create @ref offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::slot_container::slot_container container
+         * creator pack.
+         *
+         * @return @ref offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::slot_container::slot_container container
+         * creator pack.
+         */
+        auto create_slot_container_container_creator_pack() const;
+
+        /**
+         * Create random access container of edge weights, used to hold the accumulated weights of the last few anti-diagonals, the
+         * accumulated weights of the row above the strip being walked, as well as per-lane candidate weights for the anti-diagonal being
+         * computed.
+         *
+         * @param cnt Number of elements.
+         * @param zero_weight Initial weight, equivalent to 0 for numeric weights.
+         * @return Random access container of `cnt` elements, each initialized to `zero_weight`.
+         */
+        auto create_weight_container(std::size_t cnt, auto zero_weight) const;
+
+        /**
+         * Create random access container of edges, used to hold per-lane candidate edges for the anti-diagonal being computed.
+         *
+         * @param cnt Number of elements.
+         * @return Random access container of `cnt` default-initialized elements.
+         */
+        auto create_edge_container(std::size_t cnt) const;
+
+        /**
+         * Create random access container of incoming edge ranks (position of each candidate edge within `get_inputs()`), used to break
+         * ties between equally-weighted candidates the same way
+         * @ref offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtracker::backtracker does.
+         *
+         * @param cnt Number of elements.
+         * @return Random access container of `cnt` zero-initialized elements.
+         */
+        auto create_rank_container(std::size_t cnt) const;
+
+        /**
+         * Create random access container of per-lane codes (which candidate edges exist / which candidate edge was selected).
+         *
+         * @param cnt Number of elements.
+         * @return Random access container of `cnt` zero-initialized elements.
+         */
+        auto create_code_container(std::size_t cnt) const;
+
+        /**
+         * Create random access container used to store path within a graph (sequence of graph edges).
+         *
+         * @return Empty random access container.
+         */
+        auto create_path_container() const;
+    };
+}
+
+#endif //OFFBYNULL_ALIGNER_BACKTRACKERS_ANTI_DIAGONAL_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_UNIMPLEMENTED_BACKTRACKER_CONTAINER_CREATOR_PACK_H
@@ -0,0 +1,569 @@
+#ifndef OFFBYNULL_ALIGNER_BACKTRACKERS_BATCH_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_BACKTRACKER_H
+#define OFFBYNULL_ALIGNER_BACKTRACKERS_BATCH_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_BACKTRACKER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <array>
+#include <ranges>
+#include <utility>
+#include <algorithm>
+#include <limits>
+#include <concepts>
+#include <stdexcept>
+#include <type_traits>
+#include "offbynull/aligner/backtrackers/anti_diagonal_pairwise_alignment_graph_backtracker/concepts.h"
+#include "offbynull/aligner/graphs/grid_graph.h"
+#include "offbynull/aligner/backtrackers/batch_pairwise_alignment_graph_backtracker/backtracker_container_creator_pack.h"
+#include "offbynull/aligner/backtrackers/batch_pairwise_alignment_graph_backtracker/backtracker_heap_container_creator_pack.h"
+#include "offbynull/aligner/backtrackers/batch_pairwise_alignment_graph_backtracker/backtracker_stack_container_creator_pack.h"
+#include "offbynull/concepts.h"
+
+namespace offbynull::aligner::backtrackers::batch_pairwise_alignment_graph_backtracker::backtracker {
+    using offbynull::aligner::backtrackers::anti_diagonal_pairwise_alignment_graph_backtracker::concepts::anti_diagonal_backtrackable_graph;
+    using offbynull::aligner::backtrackers::anti_diagonal_pairwise_alignment_graph_backtracker::concepts::grid_addressable_graph;
+    using offbynull::aligner::graphs::grid_graph::edge;
+    using offbynull::aligner::backtrackers::batch_pairwise_alignment_graph_backtracker::backtracker_container_creator_pack
+        ::backtracker_container_creator_pack;
+    using offbynull::aligner::backtrackers::batch_pairwise_alignment_graph_backtracker::backtracker_heap_container_creator_pack
+        ::backtracker_heap_container_creator_pack;
+    using offbynull::aligner::backtrackers::batch_pairwise_alignment_graph_backtracker::backtracker_stack_container_creator_pack
+        ::backtracker_stack_container_creator_pack;
+    using offbynull::concepts::widenable_to_size_t;
+
+    /**
+     * Concept that's satisfied if `R` is a sized random access range of `G` instances, suitable as a batch for
+     * @ref offbynull::aligner::backtrackers::batch_pairwise_alignment_graph_backtracker::backtracker::backtracker.
+     *
+     * @tparam R Type to check.
+     * @tparam G Graph type.
+     */
+    template<typename R, typename G>
+    concept graph_batch =
+        std::ranges::random_access_range<R>
+        && std::ranges::sized_range<R>
+        && std::same_as<std::remove_cvref_t<std::ranges::range_reference_t<R>>, G>;
+
+    /**
+     * Backtracker that walks a batch of up to `lane_cnt` independent pairwise alignment graphs at once, one graph per lane. Intended for
+     * workloads made up of a large number of tiny alignments (e.g., 4x4 to 64x64), where the per-call overhead of backtracking each graph
+     * individually dominates the actual arithmetic. Results for each graph are identical to
+     * @ref offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtracker::backtracker (including which path is
+     * picked when multiple maximally-weighted paths exist).
+     *
+     * All graphs in the batch are walked in lockstep, grid position by grid position in row-major order, where each grid position is
+     * processed in 2 passes ...
+     *
+     *  1. gather: each lane's incoming edges are bucketed into down / right / diagonal / other lanes, scoring each edge once. Lanes whose
+     *     graph is smaller than the grid position being walked (or lanes without a graph) are padding, and get masked out. If `G`
+     *     satisfies
+     *     @ref offbynull::aligner::backtrackers::anti_diagonal_pairwise_alignment_graph_backtracker::concepts::grid_addressable_graph,
+     *     the down / right / diagonal edges of non-resident nodes are constructed straight from grid offsets, and only edges coming from
+     *     resident nodes (e.g., free-rides) are enumerated.
+     *  2. kernel: each lane's maximum is computed over contiguous lane arrays using branch-free selects, which compilers are able to
+     *     auto-vectorize (one graph per vector lane).
+     *
+     * ```
+     *  lane-interleaved weight layout (lane_cnt=4)
+     *
+     *  grid position:  (0,0)        (0,1)        (0,2)
+     *  lane:          0  1  2  3 | 0  1  2  3 | 0  1  2  3 | ...
+     * ```
+     *
+     * Each node's selected incoming edge is recorded as its position within `get_inputs()`, which is what gets walked to produce a path.
+     *
+     * @tparam debug_mode `true` to enable debugging logic, `false` otherwise.
+     * @tparam G Graph type.
+     * @tparam CODE Backtracking code type. Must be wide enough to hold the maximum number of incoming edges across all nodes in the
+     *     underlying pairwise alignment graph instances (e.g., `std::uint8_t` suffices for global alignment graphs, but local alignment
+     *     graphs need enough room for the leaf node's free-ride edges).
+     * @tparam lane_cnt Maximum number of graphs walked at once (e.g., 16 or 32).
+     * @tparam CONTAINER_CREATOR_PACK Container factory type.
+     */
+    template<
+        bool debug_mode,
+        anti_diagonal_backtrackable_graph G,
+        widenable_to_size_t CODE,
+        std::size_t lane_cnt = 16zu,
+        backtracker_container_creator_pack<
+            typename G::E,
+            typename G::ED,
+            CODE
+        > CONTAINER_CREATOR_PACK = backtracker_heap_container_creator_pack<
+            debug_mode,
+            typename G::E,
+            typename G::ED,
+            CODE,
+            true
+        >
+    >
+    requires (lane_cnt > 0zu)
+    class backtracker {
+    public:
+        /** `G`'s node identifier type. */
+        using N = typename G::N;
+        /** `G`'s edge identifier type. */
+        using E = typename G::E;
+        /** `G`'s edge data type. */
+        using ED = typename G::ED;
+        /** `G`'s grid coordinate type. For example, `std::uint8_t` will allow up to 255 nodes on both the down and right axis. */
+        using N_INDEX = typename G::N_INDEX;
+
+        /**
+         * Path container type used by this backtracker implementation.
+         */
+        using PATH_CONTAINER = decltype(std::declval<CONTAINER_CREATOR_PACK>().create_path_container(0zu));
+
+    private:
+        using WEIGHT_CONTAINER = decltype(std::declval<CONTAINER_CREATOR_PACK>().create_weight_container(0zu, std::declval<ED>()));
+        using CODE_CONTAINER = decltype(std::declval<CONTAINER_CREATOR_PACK>().create_code_container(0zu));
+
+        static constexpr CODE C0 { static_cast<CODE>(0zu) };
+
+        // Lane groups. Candidate arrays are laid out group-major (group * lane_cnt + lane).
+        static constexpr std::uint8_t GROUP_OTHER { 0u };
+        static constexpr std::uint8_t GROUP_DOWN { 1u };
+        static constexpr std::uint8_t GROUP_RIGHT { 2u };
+        static constexpr std::uint8_t GROUP_DIAGONAL { 3u };
+        static constexpr std::uint8_t GROUP_CNT { 4u };
+
+        struct batch_walk {
+            std::size_t graph_cnt;
+            std::size_t grid_right_cnt;  // maximum across batch
+            WEIGHT_CONTAINER weights;
+            CODE_CONTAINER codes;
+        };
+
+        /**
+         * Initial edge weight (e.g., 0).
+         */
+        ED zero_weight;
+
+        /**
+         * Container factory.
+         */
+        CONTAINER_CREATOR_PACK container_creator_pack;
+
+    public:
+        /**
+         * Construct an
+         * @ref offbynull::aligner::backtrackers::batch_pairwise_alignment_graph_backtracker::backtracker::backtracker instance.
+         *
+         * @param zero_weight_ Initial weight, equivalent to 0 for numeric weights. Defaults to `ED`'s default constructor, assuming it
+         *     exists.
+         * @param container_creator_pack_ Container factory.
+         */
+        backtracker(
+            ED zero_weight_ = {},
+            CONTAINER_CREATOR_PACK container_creator_pack_ = {}
+        )
+        : zero_weight { zero_weight_ }
+        , container_creator_pack { container_creator_pack_ } {}
+
+        /**
+         * Determine the weight of the maximally-weighted path (path with the highest sum of edge weights) connecting each graph's root
+         * node and leaf node, without producing the paths themselves.
+         *
+         * If `graphs` contains more than `lane_cnt` graphs, or if any graph contains edges with non-finite weights, the behavior of this
+         * function is undefined.
+         *
+         * @param graphs Graphs (at most `lane_cnt`).
+         * @return Maximally weighted path's weight for each graph, where the element at index `i` is for `graphs[i]`. Elements past the
+         *     number of graphs are set to `zero_weight`.
+         */
+        std::array<ED, lane_cnt> find_max_weights(
+            const graph_batch<G> auto& graphs
+        ) {
+            const batch_walk walk { walk_batch(graphs) };
+            std::array<ED, lane_cnt> ret {};
+            ret.fill(zero_weight);
+            for (std::size_t lane { 0zu }; lane < walk.graph_cnt; ++lane) {
+                const G& g { std::ranges::begin(graphs)[lane] };
+                ret[lane] = walk.weights[leaf_offset(g, walk) + lane];
+            }
+            return ret;
+        }
+
+        /**
+         * Determine the maximally-weighted path (path with the highest sum of edge weights) connecting each graph's root node and leaf
+         * node.
+         *
+         * If `graphs` contains more than `lane_cnt` graphs, or if any graph contains edges with non-finite weights, the behavior of this
+         * function is undefined.
+         *
+         * @param graphs Graphs (at most `lane_cnt`).
+         * @return Maximally weighted path from root node to leaf node for each graph, along with that path's weight, where the element at
+         *     index `i` is for `graphs[i]`. Elements past the number of graphs have an empty path and `zero_weight`.
+         */
+        std::array<std::pair<PATH_CONTAINER, ED>, lane_cnt> find_max_paths(
+            const graph_batch<G> auto& graphs
+        ) {
+            const batch_walk walk { walk_batch(graphs) };
+            std::array<std::pair<PATH_CONTAINER, ED>, lane_cnt> ret {};
+            for (auto& [path, weight] : ret) {
+                weight = zero_weight;
+            }
+            for (std::size_t lane { 0zu }; lane < walk.graph_cnt; ++lane) {
+                const G& g { std::ranges::begin(graphs)[lane] };
+                ret[lane] = { backtrack(g, walk, lane), walk.weights[leaf_offset(g, walk) + lane] };
+            }
+            return ret;
+        }
+
+    private:
+        static N node_at(const G& g, std::size_t down, std::size_t right) {
+            if constexpr (grid_addressable_graph<G>) {
+                return N { static_cast<N_INDEX>(down), static_cast<N_INDEX>(right) };
+            }
+            const auto& nodes { g.grid_offset_to_nodes(static_cast<N_INDEX>(down), static_cast<N_INDEX>(right)) };
+            if constexpr (debug_mode) {
+                if (std::ranges::distance(nodes.begin(), nodes.end()) != 1z) {
+                    throw std::runtime_error { "Expected exactly 1 node per grid position" };
+                }
+            }
+            return *nodes.begin();
+        }
+
+        static bool is_resident(const G& g, const N& node) requires grid_addressable_graph<G> {
+            for (const N& resident_node : g.resident_nodes()) {
+                if (resident_node == node) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        static E grid_edge(std::size_t src_down, std::size_t src_right, std::size_t dst_down, std::size_t dst_right)
+        requires grid_addressable_graph<G> {
+            const N src { static_cast<N_INDEX>(src_down), static_cast<N_INDEX>(src_right) };
+            const N dst { static_cast<N_INDEX>(dst_down), static_cast<N_INDEX>(dst_right) };
+            if constexpr (std::same_as<E, edge<N_INDEX>>) {
+                return E { src, dst };
+            } else {
+                return E { decltype(E::type)::NORMAL, { src, dst } };
+            }
+        }
+
+        static std::size_t node_offset(const G& g, const batch_walk& walk, const N& node) {
+            const auto& [down, right, depth] { g.node_to_grid_offset(node) };
+            return (static_cast<std::size_t>(down) * walk.grid_right_cnt + static_cast<std::size_t>(right)) * lane_cnt;
+        }
+
+        static std::size_t leaf_offset(const G& g, const batch_walk& walk) {
+            return node_offset(g, walk, g.get_leaf_node());
+        }
+
+        batch_walk walk_batch(
+            const graph_batch<G> auto& graphs
+        ) {
+            const std::size_t graph_cnt { std::ranges::size(graphs) };
+            if constexpr (debug_mode) {
+                if (graph_cnt > lane_cnt) {
+                    throw std::runtime_error { "Too many graphs for lane count" };
+                }
+            }
+            // Pad every lane out to the largest dimensions in the batch. Lanes without a graph have dimensions of 0, meaning they're
+            // padding across the entire grid.
+            std::array<std::size_t, lane_cnt> lane_down_cnts {};
+            std::array<std::size_t, lane_cnt> lane_right_cnts {};
+            std::size_t grid_down_cnt { 0zu };
+            std::size_t grid_right_cnt { 0zu };
+            for (std::size_t lane { 0zu }; lane < graph_cnt; ++lane) {
+                const G& g { std::ranges::begin(graphs)[lane] };
+                lane_down_cnts[lane] = g.grid_down_cnt;
+                lane_right_cnts[lane] = g.grid_right_cnt;
+                grid_down_cnt = std::max(grid_down_cnt, lane_down_cnts[lane]);
+                grid_right_cnt = std::max(grid_right_cnt, lane_right_cnts[lane]);
+            }
+            batch_walk walk {
+                graph_cnt,
+                grid_right_cnt,
+                container_creator_pack.create_weight_container(grid_down_cnt * grid_right_cnt * lane_cnt, zero_weight),
+                container_creator_pack.create_code_container(grid_down_cnt * grid_right_cnt * lane_cnt)
+            };
+            std::array<ED, GROUP_CNT * lane_cnt> lane_weights {};
+            std::array<CODE, GROUP_CNT * lane_cnt> lane_ranks {};
+            std::array<std::uint8_t, lane_cnt> lane_presences {};
+            for (std::size_t down { 0zu }; down < grid_down_cnt; ++down) {
+                for (std::size_t right { 0zu }; right < grid_right_cnt; ++right) {
+                    const std::size_t base { (down * grid_right_cnt + right) * lane_cnt };
+
+                    // Gather
+                    // ------
+                    // Bucket each lane's incoming edges into lane groups. The first edge from each of the 3 neighbouring nodes goes into
+                    // its own lane group, and anything else (e.g., free-ride edges) gets resolved here to the best "other" candidate. Edge
+                    // ranks (position within get_inputs()) are recorded so that ties are broken exactly like std::ranges::max_element()
+                    // would.
+                    for (std::size_t lane { 0zu }; lane < lane_cnt; ++lane) {
+                        std::uint8_t presence { 0u };
+                        for (std::uint8_t group { GROUP_OTHER }; group < GROUP_CNT; ++group) {
+                            lane_weights[group * lane_cnt + lane] = zero_weight;
+                            lane_ranks[group * lane_cnt + lane] = C0;
+                        }
+                        if (down < lane_down_cnts[lane] && right < lane_right_cnts[lane]) {
+                            const G& g { std::ranges::begin(graphs)[lane] };
+                            const N node { node_at(g, down, right) };
+                            std::size_t rank { 0zu };
+                            const auto take_other {
+                                [&](const E& edge, const std::size_t src_down, const std::size_t src_right) {
+                                    const std::size_t lane_idx { GROUP_OTHER * lane_cnt + lane };
+                                    const ED candidate_weight {
+                                        walk.weights[(src_down * grid_right_cnt + src_right) * lane_cnt + lane] + g.get_edge_data(edge)
+                                    };
+                                    if ((presence & (1u << GROUP_OTHER)) == 0u || candidate_weight > lane_weights[lane_idx]) {
+                                        lane_weights[lane_idx] = candidate_weight;
+                                        lane_ranks[lane_idx] = static_cast<CODE>(rank);
+                                        presence = static_cast<std::uint8_t>(presence | (1u << GROUP_OTHER));
+                                    }
+                                }
+                            };
+                            if constexpr (grid_addressable_graph<G>) {
+                                if (!is_resident(g, node)) {
+                                    // Grid edges are added in the same order as they appear in get_inputs() (from the left, from above,
+                                    // then diagonal), followed by edges from resident nodes, such that ranks match the other gather below.
+                                    const auto take_grid {
+                                        [&](const std::uint8_t group, const std::size_t src_down, const std::size_t src_right) {
+                                            const std::size_t lane_idx { group * lane_cnt + lane };
+                                            lane_weights[lane_idx] = g.get_edge_data(grid_edge(src_down, src_right, down, right));
+                                            lane_ranks[lane_idx] = static_cast<CODE>(rank);
+                                            presence = static_cast<std::uint8_t>(presence | (1u << group));
+                                            ++rank;
+                                        }
+                                    };
+                                    if (right > 0zu) {
+                                        take_grid(GROUP_RIGHT, down, right - 1zu);
+                                    }
+                                    if (down > 0zu) {
+                                        take_grid(GROUP_DOWN, down - 1zu, right);
+                                    }
+                                    if (down > 0zu && right > 0zu) {
+                                        take_grid(GROUP_DIAGONAL, down - 1zu, right - 1zu);
+                                    }
+                                    for (const auto& edge : g.inputs_from_residents(node)) {
+                                        const N src_node { g.get_edge_from(edge) };
+                                        // A resident node neighbouring this node (e.g., root) also feeds in through a grid edge, already
+                                        // taken above.
+                                        if (edge == grid_edge(src_node.down, src_node.right, down, right)) {
+                                            continue;
+                                        }
+                                        if constexpr (debug_mode) {
+                                            if (rank > std::numeric_limits<CODE>::max()) {
+                                                throw std::runtime_error { "Type not wide enough" };
+                                            }
+                                        }
+                                        take_other(edge, src_node.down, src_node.right);
+                                        ++rank;
+                                    }
+                                    if constexpr (debug_mode) {
+                                        if (rank != g.get_in_degree(node)) {
+                                            throw std::runtime_error {
+                                                "Non-resident node has inputs not from grid neighbours or residents"
+                                            };
+                                        }
+                                    }
+                                    lane_presences[lane] = presence;
+                                    continue;
+                                }
+                            }
+                            for (const auto& edge : g.get_inputs(node)) {
+                                if constexpr (debug_mode) {
+                                    if (rank > std::numeric_limits<CODE>::max()) {
+                                        throw std::runtime_error { "Type not wide enough" };
+                                    }
+                                }
+                                const auto& src_node { g.get_edge_from(edge) };
+                                const auto& [src_down_, src_right_, src_depth_] { g.node_to_grid_offset(src_node) };
+                                const std::size_t src_down { src_down_ };
+                                const std::size_t src_right { src_right_ };
+                                std::uint8_t group { GROUP_OTHER };
+                                if (src_down + 1zu == down && src_right == right && (presence & (1u << GROUP_DOWN)) == 0u) {
+                                    group = GROUP_DOWN;
+                                } else if (src_down == down && src_right + 1zu == right && (presence & (1u << GROUP_RIGHT)) == 0u) {
+                                    group = GROUP_RIGHT;
+                                } else if (src_down + 1zu == down && src_right + 1zu == right
+                                        && (presence & (1u << GROUP_DIAGONAL)) == 0u) {
+                                    group = GROUP_DIAGONAL;
+                                }
+                                const std::size_t lane_idx { group * lane_cnt + lane };
+                                if (group != GROUP_OTHER) {
+                                    lane_weights[lane_idx] = g.get_edge_data(edge);
+                                    lane_ranks[lane_idx] = static_cast<CODE>(rank);
+                                    presence = static_cast<std::uint8_t>(presence | (1u << group));
+                                } else {
+                                    if constexpr (debug_mode) {
+                                        if (src_down > down || src_right > right || (src_down == down && src_right == right)) {
+                                            throw std::runtime_error { "Source node not walked" };
+                                        }
+                                    }
+                                    take_other(edge, src_down, src_right);
+                                }
+                                ++rank;
+                            }
+                        }
+                        lane_presences[lane] = presence;
+                    }
+
+                    // Kernel
+                    // ------
+                    // Everything read / written here is contiguous and the loop body has no data-dependent branches, which lets compilers
+                    // vectorize it across lanes for arithmetic edge weights. Neighbours that fall outside of the grid are pointed back at
+                    // the current grid position -- the values read are never selected since the lane's presence bit for them is unset.
+                    const std::size_t down_base { down > 0zu ? base - grid_right_cnt * lane_cnt : base };
+                    const std::size_t right_base { right > 0zu ? base - lane_cnt : base };
+                    const std::size_t diagonal_base { down > 0zu && right > 0zu ? base - (grid_right_cnt + 1zu) * lane_cnt : base };
+                    for (std::size_t lane { 0zu }; lane < lane_cnt; ++lane) {
+                        const std::uint8_t presence { lane_presences[lane] };
+                        bool best_present { (presence & (1u << GROUP_OTHER)) != 0u };
+                        ED best_weight { lane_weights[GROUP_OTHER * lane_cnt + lane] };
+                        CODE best_rank { lane_ranks[GROUP_OTHER * lane_cnt + lane] };
+                        const ED down_weight { walk.weights[down_base + lane] + lane_weights[GROUP_DOWN * lane_cnt + lane] };
+                        const ED right_weight { walk.weights[right_base + lane] + lane_weights[GROUP_RIGHT * lane_cnt + lane] };
+                        const ED diagonal_weight {
+                            walk.weights[diagonal_base + lane] + lane_weights[GROUP_DIAGONAL * lane_cnt + lane]
+                        };
+                        const auto select {
+                            [&](const std::uint8_t group, const ED candidate_weight) {
+                                const bool present { (presence & (1u << group)) != 0u };
+                                const CODE candidate_rank { lane_ranks[group * lane_cnt + lane] };
+                                const bool take {
+                                    present
+                                    && (
+                                        !best_present
+                                        || candidate_weight > best_weight
+                                        || (candidate_weight == best_weight && candidate_rank < best_rank)
+                                    )
+                                };
+                                best_weight = take ? candidate_weight : best_weight;
+                                best_rank = take ? candidate_rank : best_rank;
+                                best_present = best_present || present;
+                            }
+                        };
+                        select(GROUP_DOWN, down_weight);
+                        select(GROUP_RIGHT, right_weight);
+                        select(GROUP_DIAGONAL, diagonal_weight);
+                        walk.weights[base + lane] = best_present ? best_weight : zero_weight;
+                        walk.codes[base + lane] = best_rank;
+                    }
+                }
+            }
+            return walk;
+        }
+
+        PATH_CONTAINER backtrack(
+            const G& g,
+            const batch_walk& walk,
+            const std::size_t lane
+        ) {
+            PATH_CONTAINER path { container_creator_pack.create_path_container(g.path_edge_capacity) };
+            N node { g.get_leaf_node() };
+            while (g.has_inputs(node)) {
+                const std::size_t code { walk.codes[node_offset(g, walk, node) + lane] };
+                auto inputs { g.get_inputs(node) };
+                auto it { inputs.begin() };
+                for (std::size_t i { 0zu }; i < code; ++i) {
+                    ++it;
+                }
+                const E edge { *it };
+                path.push_back(edge);
+                node = g.get_edge_from(edge);
+            }
+            // At this point, path is in reverse order (from last to first). Reverse it to get it into forward order.
+            std::ranges::reverse(path);
+            return path;
+        }
+    };
+
+    /**
+     * Helper function that constructs an
+     * @ref offbynull::aligner::backtrackers::batch_pairwise_alignment_graph_backtracker::backtracker::backtracker instance utilizing the
+     * heap for storage / computations and invokes `find_max_paths(graphs)` on it.
+     *
+     * @tparam debug_mode `true` to enable debugging logic, `false` otherwise.
+     * @tparam CODE Backtracking code type. Must be wide enough to hold the maximum number of incoming edges across all nodes in the
+     *     underlying pairwise alignment graph instances.
+     * @tparam lane_cnt Maximum number of graphs walked at once.
+     * @tparam minimize_allocations `true` to force path containers to reserve `path_edge_capacity` elements, thereby removing/reducing
+     *     the need for adhoc reallocations.
+     * @param graphs Graphs (at most `lane_cnt`).
+     * @return `find_max_paths(graphs)` result.
+     */
+    template<
+        bool debug_mode,
+        widenable_to_size_t CODE,
+        std::size_t lane_cnt,
+        bool minimize_allocations
+    >
+    auto heap_find_max_paths(
+        const std::ranges::random_access_range auto& graphs
+    ) {
+        using G = std::remove_cvref_t<std::ranges::range_reference_t<decltype(graphs)>>;
+        return backtracker<
+            debug_mode,
+            G,
+            CODE,
+            lane_cnt,
+            backtracker_heap_container_creator_pack<
+                debug_mode,
+                typename G::E,
+                typename G::ED,
+                CODE,
+                minimize_allocations
+            >
+        > {}.find_max_paths(graphs);
+    }
+
+    /**
+     * Helper function that constructs an
+     * @ref offbynull::aligner::backtrackers::batch_pairwise_alignment_graph_backtracker::backtracker::backtracker instance utilizing the
+     * stack for storage / computations and invokes `find_max_paths(graphs)` on it.
+     *
+     * @tparam debug_mode `true` to enable debugging logic, `false` otherwise.
+     * @tparam CODE Backtracking code type. Must be wide enough to hold the maximum number of incoming edges across all nodes in the
+     *     underlying pairwise alignment graph instances.
+     * @tparam lane_cnt Maximum number of graphs walked at once.
+     * @tparam grid_down_cnt Maximum down dimension across `graphs`.
+     * @tparam grid_right_cnt Maximum right dimension across `graphs`.
+     * @tparam path_edge_capacity Of all paths between root and leaf within `graphs`, the maximum number of edges.
+     * @param graphs Graphs (at most `lane_cnt`).
+     * @return `find_max_paths(graphs)` result.
+     */
+    template<
+        bool debug_mode,
+        widenable_to_size_t CODE,
+        std::size_t lane_cnt,
+        std::size_t grid_down_cnt,
+        std::size_t grid_right_cnt,
+        std::size_t path_edge_capacity
+    >
+    auto stack_find_max_paths(
+        const std::ranges::random_access_range auto& graphs
+    ) {
+        using G = std::remove_cvref_t<std::ranges::range_reference_t<decltype(graphs)>>;
+        if constexpr (debug_mode) {
+            for (const G& g : graphs) {
+                if (g.grid_down_cnt > grid_down_cnt
+                    || g.grid_right_cnt > grid_right_cnt
+                    || g.path_edge_capacity > path_edge_capacity) {
+                    throw std::runtime_error { "Unexpected graph dimensions" };
+                }
+            }
+        }
+        return backtracker<
+            debug_mode,
+            G,
+            CODE,
+            lane_cnt,
+            backtracker_stack_container_creator_pack<
+                debug_mode,
+                typename G::E,
+                typename G::ED,
+                CODE,
+                lane_cnt,
+                grid_down_cnt,
+                grid_right_cnt,
+                path_edge_capacity
+            >
+        > {}.find_max_paths(graphs);
+    }
+}
+
+#endif //OFFBYNULL_ALIGNER_BACKTRACKERS_BATCH_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_BACKTRACKER_H
@@ -0,0 +1,63 @@
+#ifndef OFFBYNULL_ALIGNER_BACKTRACKERS_BATCH_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_BACKTRACKER_HEAP_CONTAINER_CREATOR_PACK_H
+#define OFFBYNULL_ALIGNER_BACKTRACKERS_BATCH_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_BACKTRACKER_HEAP_CONTAINER_CREATOR_PACK_H
+
+#include <cstddef>
+#include <vector>
+#include "offbynull/aligner/concepts.h"
+#include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/backtrackable_edge.h"
+#include "offbynull/aligner/backtrackers/batch_pairwise_alignment_graph_backtracker/unimplemented_backtracker_container_creator_pack.h"
+#include "offbynull/concepts.h"
+
+namespace offbynull::aligner::backtrackers::batch_pairwise_alignment_graph_backtracker::backtracker_heap_container_creator_pack {
+    using offbynull::aligner::concepts::weight;
+    using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtrackable_edge::backtrackable_edge;
+    using offbynull::concepts::widenable_to_size_t;
+
+    /**
+     * @ref offbynull::aligner::backtrackers::batch_pairwise_alignment_graph_backtracker::backtracker_container_creator_pack::backtracker_container_creator_pack
+     * that allocates its containers on the heap.
+     *
+     * @tparam debug_mode `true` to enable debugging logic, `false` otherwise.
+     * @tparam E Graph edge identifier type.
+     * @tparam ED Graph edge data type (edge weight).
+     * @tparam CODE Backtracking code type. Must be wide enough to hold the maximum number of incoming edges across all nodes in the
+     *     underlying pairwise alignment graph instances.
+     * @tparam minimize_allocations `true` to force `create_path_container()` to reserve `path_edge_capacity` elements, thereby
+     *     removing/reducing the need for adhoc reallocations.
+     */
+    template<
+        bool debug_mode,
+        backtrackable_edge E,
+        weight ED,
+        widenable_to_size_t CODE,
+        bool minimize_allocations
+    >
+    struct backtracker_heap_container_creator_pack {
+        /**
+         * @copydoc offbynull::aligner::backtrackers::batch_pairwise_alignment_graph_backtracker::unimplemented_backtracker_container_creator_pack::unimplemented_backtracker_container_creator_pack::create_weight_container
+         */
+        std::vector<ED> create_weight_container(std::size_t cnt, ED zero_weight) const {
+            return std::vector<ED>(cnt, zero_weight);
+        }
+
+        /**
+         * @copydoc offbynull::aligner::backtrackers::batch_pairwise_alignment_graph_backtracker::unimplemented_backtracker_container_creator_pack::unimplemented_backtracker_container_creator_pack::create_code_container
+         */
+        std::vector<CODE> create_code_container(std::size_t cnt) const {
+            return std::vector<CODE>(cnt);
+        }
+
+        /**
+         * @copydoc offbynull::aligner::backtrackers::batch_pairwise_alignment_graph_backtracker::unimplemented_backtracker_container_creator_pack::unimplemented_backtracker_container_creator_pack::create_path_container
+         */
+        std::vector<E> create_path_container(std::size_t path_edge_capacity) const {
+            std::vector<E> ret {};
+            if constexpr (minimize_allocations) {
+                ret.reserve(path_edge_capacity);
+            }
+            return ret;
+        }
+    };
+}
+
+#endif //OFFBYNULL_ALIGNER_BACKTRACKERS_BATCH_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_BACKTRACKER_HEAP_CONTAINER_CREATOR_PACK_H
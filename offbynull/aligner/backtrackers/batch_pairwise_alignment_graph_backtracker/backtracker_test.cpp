@@ -0,0 +1,185 @@
+#include "offbynull/aligner/graphs/pairwise_global_alignment_graph.h"
+#include "offbynull/aligner/graphs/pairwise_local_alignment_graph.h"
+#include "offbynull/aligner/backtrackers/batch_pairwise_alignment_graph_backtracker/backtracker.h"
+#include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/backtracker.h"
+#include "offbynull/aligner/scorers/simple_scorer.h"
+#include "offbynull/utils.h"
+#include "gtest/gtest.h"
+#include <cstddef>
+#include <cstdint>
+#include <stdfloat>
+#include <string>
+#include <vector>
+#include <random>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+namespace {
+    using offbynull::aligner::backtrackers::batch_pairwise_alignment_graph_backtracker::backtracker::backtracker;
+    using offbynull::aligner::backtrackers::batch_pairwise_alignment_graph_backtracker::backtracker::heap_find_max_paths;
+    using offbynull::aligner::backtrackers::batch_pairwise_alignment_graph_backtracker::backtracker::stack_find_max_paths;
+    using offbynull::aligner::graphs::pairwise_global_alignment_graph::create_pairwise_global_alignment_graph;
+    using offbynull::aligner::graphs::pairwise_local_alignment_graph::create_pairwise_local_alignment_graph;
+    using offbynull::aligner::scorers::simple_scorer::simple_scorer;
+    using offbynull::utils::copy_to_vector;
+    using offbynull::utils::is_debug_mode;
+
+    auto expected_max_path(const auto& g) {
+        using G = std::remove_cvref_t<decltype(g)>;
+        const auto& [path, weight] {
+            offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtracker::backtracker<
+                is_debug_mode(),
+                G,
+                std::size_t,
+                std::size_t
+            > {}.find_max_path(g)
+        };
+        return std::make_pair(copy_to_vector(path), weight);
+    }
+
+    auto random_string(std::mt19937_64& rand, std::size_t max_len) {
+        std::string ret {};
+        for ([[maybe_unused]] auto _ : std::views::iota(0zu, std::uniform_int_distribution<std::size_t>(1zu, max_len)(rand))) {
+            ret += std::uniform_int_distribution<char>('a', 'd')(rand);
+        }
+        return ret;
+    }
+
+    TEST(OABBBacktrackerTest, FindMaxPathsViaHelpers) {
+        auto substitution_scorer {
+            simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_substitution(1.0f64, -1.0f64)
+        };
+        auto gap_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_gap(0.0f64) };
+
+        std::string seq1 { "a" };
+        std::string seq2 { "ac" };
+        std::string seq3 { "c" };
+        std::string seq4 { "c" };
+        std::vector graphs {
+            create_pairwise_global_alignment_graph<is_debug_mode(), std::size_t>(seq1, seq2, substitution_scorer, gap_scorer),
+            create_pairwise_global_alignment_graph<is_debug_mode(), std::size_t>(seq3, seq4, substitution_scorer, gap_scorer)
+        };
+
+        using E = typename decltype(graphs)::value_type::E;
+
+        const auto check {
+            [](const auto& results) {
+                EXPECT_EQ(
+                    copy_to_vector(results[0].first),
+                    (std::vector<E> {
+                        E { { 0zu, 0zu }, { 1zu, 1zu } },
+                        E { { 1zu, 1zu }, { 1zu, 2zu } }
+                    })
+                );
+                EXPECT_EQ(results[0].second, 1.0);
+                EXPECT_EQ(
+                    copy_to_vector(results[1].first),
+                    (std::vector<E> {
+                        E { { 0zu, 0zu }, { 1zu, 1zu } }
+                    })
+                );
+                EXPECT_EQ(results[1].second, 1.0);
+                EXPECT_TRUE(results[2].first.empty());
+                EXPECT_EQ(results[2].second, 0.0);
+            }
+        };
+        check(heap_find_max_paths<is_debug_mode(), std::uint8_t, 4zu, true>(graphs));
+        check(
+            stack_find_max_paths<
+                is_debug_mode(),
+                std::uint8_t,
+                4zu /*lane_cnt*/,
+                2zu /*grid_down_cnt*/,
+                3zu /*grid_right_cnt*/,
+                (2zu - 1zu) + (3zu - 1zu) /*path_edge_capacity*/
+            >(graphs)
+        );
+    }
+
+    TEST(OABBBacktrackerTest, RandomizedGlobalTestingAgainstReadyQueueBacktracker) {
+        std::mt19937_64 rand { 12345 };
+        auto random_integer { [&](auto a, auto b) -> decltype(a) { return std::uniform_int_distribution<decltype(a)>(a,b)(rand); } };
+        for ([[maybe_unused]] auto _ : std::views::iota(0u, 50u)) {
+            // Integer weights from a tiny range to force lots of ties, making sure ties get broken the same way
+            auto substitution_scorer {
+                simple_scorer<is_debug_mode(), std::size_t, char, char, std::int32_t>::create_substitution(
+                    random_integer(-2, 2),
+                    random_integer(-2, 2)
+                )
+            };
+            auto gap_scorer {
+                simple_scorer<is_debug_mode(), std::size_t, char, char, std::int32_t>::create_gap(random_integer(-2, 2))
+            };
+            // Unequal sequence lengths across the batch, such that lanes get padded / masked differently
+            const std::size_t graph_cnt { random_integer(1zu, 16zu) };
+            std::vector<std::pair<std::string, std::string>> seqs {};
+            for ([[maybe_unused]] auto __ : std::views::iota(0zu, graph_cnt)) {
+                seqs.emplace_back(random_string(rand, 12zu), random_string(rand, 12zu));
+            }
+            using G = decltype(
+                create_pairwise_global_alignment_graph<is_debug_mode(), std::size_t>(
+                    seqs[0].first, seqs[0].second, substitution_scorer, gap_scorer
+                )
+            );
+            std::vector<G> graphs {};
+            for (const auto& [seq1, seq2] : seqs) {
+                graphs.push_back(
+                    create_pairwise_global_alignment_graph<is_debug_mode(), std::size_t>(seq1, seq2, substitution_scorer, gap_scorer)
+                );
+            }
+            backtracker<is_debug_mode(), G, std::uint8_t> batch_backtracker {};
+            const auto& paths { batch_backtracker.find_max_paths(graphs) };
+            const auto& weights { batch_backtracker.find_max_weights(graphs) };
+            for (std::size_t i { 0zu }; i < graph_cnt; ++i) {
+                EXPECT_EQ(expected_max_path(graphs[i]), std::make_pair(copy_to_vector(paths[i].first), paths[i].second));
+                EXPECT_EQ(paths[i].second, weights[i]);
+            }
+        }
+    }
+
+    TEST(OABBBacktrackerTest, RandomizedLocalTestingAgainstReadyQueueBacktracker) {
+        std::mt19937_64 rand { 12345 };
+        auto random_integer { [&](auto a, auto b) -> decltype(a) { return std::uniform_int_distribution<decltype(a)>(a,b)(rand); } };
+        for ([[maybe_unused]] auto _ : std::views::iota(0u, 50u)) {
+            auto substitution_scorer {
+                simple_scorer<is_debug_mode(), std::size_t, char, char, std::int32_t>::create_substitution(
+                    random_integer(-2, 2),
+                    random_integer(-2, 2)
+                )
+            };
+            auto gap_scorer {
+                simple_scorer<is_debug_mode(), std::size_t, char, char, std::int32_t>::create_gap(random_integer(-2, 2))
+            };
+            auto freeride_scorer {
+                simple_scorer<is_debug_mode(), std::size_t, char, char, std::int32_t>::create_freeride(random_integer(-2, 2))
+            };
+            const std::size_t graph_cnt { random_integer(1zu, 32zu) };
+            std::vector<std::pair<std::string, std::string>> seqs {};
+            for ([[maybe_unused]] auto __ : std::views::iota(0zu, graph_cnt)) {
+                seqs.emplace_back(random_string(rand, 12zu), random_string(rand, 12zu));
+            }
+            using G = decltype(
+                create_pairwise_local_alignment_graph<is_debug_mode(), std::size_t>(
+                    seqs[0].first, seqs[0].second, substitution_scorer, gap_scorer, freeride_scorer
+                )
+            );
+            std::vector<G> graphs {};
+            for (const auto& [seq1, seq2] : seqs) {
+                graphs.push_back(
+                    create_pairwise_local_alignment_graph<is_debug_mode(), std::size_t>(
+                        seq1, seq2, substitution_scorer, gap_scorer, freeride_scorer
+                    )
+                );
+            }
+            // Free-ride edges mean the leaf node may have more incoming edges than std::uint8_t can count
+            backtracker<is_debug_mode(), G, std::uint16_t, 32zu> batch_backtracker {};
+            const auto& paths { batch_backtracker.find_max_paths(graphs) };
+            const auto& weights { batch_backtracker.find_max_weights(graphs) };
+            for (std::size_t i { 0zu }; i < graph_cnt; ++i) {
+                EXPECT_EQ(expected_max_path(graphs[i]), std::make_pair(copy_to_vector(paths[i].first), paths[i].second));
+                EXPECT_EQ(paths[i].second, weights[i]);
+            }
+        }
+    }
+}
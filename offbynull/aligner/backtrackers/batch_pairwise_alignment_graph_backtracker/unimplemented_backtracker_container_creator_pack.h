@@ -0,0 +1,42 @@
+#ifndef OFFBYNULL_ALIGNER_BACKTRACKERS_BATCH_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_UNIMPLEMENTED_BACKTRACKER_CONTAINER_CREATOR_PACK_H
+#define OFFBYNULL_ALIGNER_BACKTRACKERS_BATCH_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_UNIMPLEMENTED_BACKTRACKER_CONTAINER_CREATOR_PACK_H
+
+#include <cstddef>
+#include "offbynull/aligner/backtrackers/batch_pairwise_alignment_graph_backtracker/backtracker_container_creator_pack.h"
+
+namespace offbynull::aligner::backtrackers::batch_pairwise_alignment_graph_backtracker::unimplemented_backtracker_container_creator_pack {
+    /**
+     * Unimplemented
+     * @ref offbynull::aligner::backtrackers::batch_pairwise_alignment_graph_backtracker::backtracker_container_creator_pack::backtracker_container_creator_pack,
+     * intended for documentation.
+     */
+    struct unimplemented_backtracker_container_creator_pack {
+        /**
+         * Create random access container of accumulated weights, one element per node per lane (indexed by grid offset, then lane).
+         *
+         * @param cnt Number of elements.
+         * @param zero_weight Initial weight, equivalent to 0 for numeric weights.
+         * @return Random access container of `cnt` elements, each initialized to `zero_weight`.
+         */
+        auto create_weight_container(std::size_t cnt, auto zero_weight) const;
+
+        /**
+         * Create random access container of backtracking codes, one element per node per lane (indexed by grid offset, then lane). A
+         * node's code is the position of its backtracking edge within `get_inputs()`.
+         *
+         * @param cnt Number of elements.
+         * @return Random access container of `cnt` zero-initialized elements.
+         */
+        auto create_code_container(std::size_t cnt) const;
+
+        /**
+         * Create random access container used to store path within a graph (sequence of graph edges).
+         *
+         * @param path_edge_capacity Of all paths between root and leaf within the graph, the maximum number of edges.
+         * @return Empty random access container.
+         */
+        auto create_path_container(std::size_t path_edge_capacity) const;
+    };
+}
+
+#endif //OFFBYNULL_ALIGNER_BACKTRACKERS_BATCH_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_UNIMPLEMENTED_BACKTRACKER_CONTAINER_CREATOR_PACK_H
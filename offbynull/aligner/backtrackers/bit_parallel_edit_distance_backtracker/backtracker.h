@@ -0,0 +1,575 @@
+#ifndef OFFBYNULL_ALIGNER_BACKTRACKERS_BIT_PARALLEL_EDIT_DISTANCE_BACKTRACKER_BACKTRACKER_H
+#define OFFBYNULL_ALIGNER_BACKTRACKERS_BIT_PARALLEL_EDIT_DISTANCE_BACKTRACKER_BACKTRACKER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <utility>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include "offbynull/aligner/backtrackers/bit_parallel_edit_distance_backtracker/concepts.h"
+#include "offbynull/aligner/backtrackers/bit_parallel_edit_distance_backtracker/bit_vectors.h"
+#include "offbynull/aligner/backtrackers/bit_parallel_edit_distance_backtracker/backtracker_container_creator_pack.h"
+#include "offbynull/aligner/backtrackers/bit_parallel_edit_distance_backtracker/backtracker_heap_container_creator_pack.h"
+#include "offbynull/aligner/backtrackers/bit_parallel_edit_distance_backtracker/backtracker_stack_container_creator_pack.h"
+#include "offbynull/aligner/sequence/sequence.h"
+#include "offbynull/concepts.h"
+
+namespace offbynull::aligner::backtrackers::bit_parallel_edit_distance_backtracker::backtracker {
+    using offbynull::aligner::backtrackers::bit_parallel_edit_distance_backtracker::concepts::bit_parallel_element;
+    using offbynull::aligner::backtrackers::bit_parallel_edit_distance_backtracker::bit_vectors::word_bit_cnt;
+    using offbynull::aligner::backtrackers::bit_parallel_edit_distance_backtracker::bit_vectors::symbol_cnt;
+    using offbynull::aligner::backtrackers::bit_parallel_edit_distance_backtracker::bit_vectors::block_cnt;
+    using offbynull::aligner::backtrackers::bit_parallel_edit_distance_backtracker::bit_vectors::word_cnt;
+    using offbynull::aligner::backtrackers::bit_parallel_edit_distance_backtracker::backtracker_container_creator_pack
+        ::backtracker_container_creator_pack;
+    using offbynull::aligner::backtrackers::bit_parallel_edit_distance_backtracker::backtracker_heap_container_creator_pack
+        ::backtracker_heap_container_creator_pack;
+    using offbynull::aligner::backtrackers::bit_parallel_edit_distance_backtracker::backtracker_stack_container_creator_pack
+        ::backtracker_stack_container_creator_pack;
+    using offbynull::aligner::sequence::sequence::sequence;
+    using offbynull::concepts::widenable_to_size_t;
+
+    /**
+     * Unit-cost edit distance (Levenshtein) engine for sequences of single byte elements (e.g., DNA / protein strings), producing the
+     * same alignment weights as walking a global or fitting pairwise alignment graph scored by
+     * @ref offbynull::aligner::scorers::levenshtein_scorer::levenshtein_scorer, but without ever materializing the graph.
+     *
+     * The rightward sequence (the pattern) is encoded 1 bit per element, 64 elements per word. Each downward element (the text) then
+     * advances an entire column of the edit distance matrix using Myers' bit-vector algorithm (as reformulated by Hyyrö for multi-word
+     * patterns): rather than costs, a column is held as its vertical deltas (+1 / -1 / 0 between vertically adjacent nodes), which are
+     * updated a word at a time with a handful of bitwise operations and a single addition.
+     *
+     * ```
+     *  column held as vertical deltas
+     *
+     *  cost  delta   positive  negative
+     *   3
+     *   4     +1        1         0
+     *   4      0        0         0
+     *   3     -1        0         1
+     * ```
+     *
+     * Computing the distance alone takes `O(n * ceil(m / 64))` time and `O(ceil(m / 64))` space (`n` / `m` being the downward / rightward
+     * sequence lengths). Tracing back the alignment uses Hirschberg's divide-and-conquer over those same column walks: the downward
+     * sequence is split in half, a forward walk over the top half and a backward walk over the (reversed) bottom half pick the row where
+     * an optimal alignment crosses the split, and each half is recursed into. That roughly doubles the work of computing the distance alone
+     * while keeping space linear.
+     *
+     * The alignment produced is a sequence of element offset pairs, same as what
+     * @ref offbynull::aligner::graphs::pairwise_global_alignment_graph::pairwise_global_alignment_graph::edge_to_element_offsets produces
+     * for each edge of a path (free rides are `std::nullopt`). Costs are edit distances, meaning they're the negated graph weights.
+     *
+     * @tparam debug_mode `true` to enable debugging logic, `false` otherwise.
+     * @tparam N_INDEX Sequence offset type (must be wide enough to hold the length of the longer sequence).
+     * @tparam CONTAINER_CREATOR_PACK Container factory type.
+     */
+    template<
+        bool debug_mode,
+        widenable_to_size_t N_INDEX,
+        backtracker_container_creator_pack<N_INDEX> CONTAINER_CREATOR_PACK = backtracker_heap_container_creator_pack<
+            debug_mode,
+            N_INDEX,
+            true
+        >
+    >
+    class backtracker {
+    public:
+        /** Element offset pair type (a single step of the alignment, `std::nullopt` if the step is a free ride). */
+        using ELEMENT_OFFSETS = std::optional<std::pair<std::optional<N_INDEX>, std::optional<N_INDEX>>>;
+        /** Path container type used by this backtracker implementation. */
+        using PATH_CONTAINER = decltype(std::declval<CONTAINER_CREATOR_PACK>().create_path_container(0zu));
+
+    private:
+        using WORD_CONTAINER = decltype(std::declval<CONTAINER_CREATOR_PACK>().create_word_container(0zu));
+        using COST_CONTAINER = decltype(std::declval<CONTAINER_CREATOR_PACK>().create_cost_container(0zu));
+
+        static constexpr std::uint64_t ONE { 1u };
+        static constexpr std::uint64_t HIGH_BIT { ONE << (word_bit_cnt - 1zu) };
+
+        // Bit-vectors for a pattern of up to some length, laid out as a match mask per symbol followed by the positive and negative
+        // vertical deltas of the column being walked. Each of those is block_stride words long. Patterns shorter than the one the
+        // container was sized for (subproblems during traceback) only use the first few words of each.
+        struct bit_vector_state {
+            WORD_CONTAINER words;
+            std::size_t block_stride;
+        };
+
+        CONTAINER_CREATOR_PACK container_creator_pack;
+
+    public:
+        /**
+         * Construct an @ref offbynull::aligner::backtrackers::bit_parallel_edit_distance_backtracker::backtracker::backtracker instance.
+         *
+         * @param container_creator_pack_ Container factory.
+         */
+        backtracker(
+            CONTAINER_CREATOR_PACK container_creator_pack_ = {}
+        )
+        : container_creator_pack { container_creator_pack_ } {}
+
+        /**
+         * Compute the edit distance of a global alignment (both sequences fully consumed).
+         *
+         * @param down Downward sequence.
+         * @param right Rightward sequence.
+         * @return Edit distance between `down` and `right`.
+         */
+        std::int64_t find_global_cost(
+            const sequence auto& down,
+            const sequence auto& right
+        ) {
+            validate(down, right);
+            const std::size_t right_len { right.size() };
+            bit_vector_state state { create_bit_vector_state(right_len) };
+            const auto right_at { [&](std::size_t r) { return right[r]; } };
+            load_pattern(state, right_len, right_at);
+            std::int64_t cost {};
+            walk_columns(
+                state,
+                right_len,
+                down.size(),
+                [&](std::size_t d) { return down[d]; },
+                1,
+                1,
+                [&](std::size_t, std::int64_t, std::int64_t bottom) { cost = bottom; }
+            );
+            return cost;
+        }
+
+        /**
+         * Compute the edit distance of a fitting alignment (`right` fully consumed, `down` may be entered / exited at any point through a
+         * free ride).
+         *
+         * @param down Downward sequence (sequence to fit against).
+         * @param right Rightward sequence (sequence to fit).
+         * @param freeride_cost Cost of taking a free ride. Must be -1, 0, or 1 (any larger is never taken over indels, and the bit-vector
+         *     recurrence can't represent any smaller).
+         * @return Edit distance of the fitting alignment of `right` within `down`.
+         */
+        std::int64_t find_fitting_cost(
+            const sequence auto& down,
+            const sequence auto& right,
+            const std::int64_t freeride_cost
+        ) {
+            validate(down, right);
+            validate_freeride_cost(freeride_cost);
+            const std::size_t right_len { right.size() };
+            bit_vector_state state { create_bit_vector_state(right_len) };
+            const auto right_at { [&](std::size_t r) { return right[r]; } };
+            load_pattern(state, right_len, right_at);
+            const auto& [cost, end] {
+                find_free_end(state, right_len, down.size(), [&](std::size_t d) { return down[d]; }, freeride_cost, 0, freeride_cost)
+            };
+            return cost;
+        }
+
+        /**
+         * Find a global alignment (both sequences fully consumed) with the minimum edit distance.
+         *
+         * @param down Downward sequence.
+         * @param right Rightward sequence.
+         * @return Alignment of `down` vs `right` along with its edit distance.
+         */
+        std::pair<PATH_CONTAINER, std::int64_t> find_global_path(
+            const sequence auto& down,
+            const sequence auto& right
+        ) {
+            validate(down, right);
+            const std::size_t down_len { down.size() };
+            const std::size_t right_len { right.size() };
+            bit_vector_state state { create_bit_vector_state(right_len) };
+            COST_CONTAINER forward_costs { container_creator_pack.create_cost_container(right_len + 1zu) };
+            COST_CONTAINER backward_costs { container_creator_pack.create_cost_container(right_len + 1zu) };
+            PATH_CONTAINER path { container_creator_pack.create_path_container(down_len + right_len) };
+            split_and_trace(state, forward_costs, backward_costs, down, right, 0zu, down_len, 0zu, right_len, path);
+            const std::int64_t cost { path_cost(down, right, path, 0) };
+            return { std::move(path), cost };
+        }
+
+        /**
+         * Find a fitting alignment (`right` fully consumed, `down` may be entered / exited at any point through a free ride) with the
+         * minimum edit distance.
+         *
+         * @param down Downward sequence (sequence to fit against).
+         * @param right Rightward sequence (sequence to fit).
+         * @param freeride_cost Cost of taking a free ride. Must be -1, 0, or 1 (any larger is never taken over indels, and the bit-vector
+         *     recurrence can't represent any smaller).
+         * @return Fitting alignment of `right` within `down` along with its edit distance.
+         */
+        std::pair<PATH_CONTAINER, std::int64_t> find_fitting_path(
+            const sequence auto& down,
+            const sequence auto& right,
+            const std::int64_t freeride_cost
+        ) {
+            validate(down, right);
+            validate_freeride_cost(freeride_cost);
+            const std::size_t down_len { down.size() };
+            const std::size_t right_len { right.size() };
+            bit_vector_state state { create_bit_vector_state(right_len) };
+            COST_CONTAINER forward_costs { container_creator_pack.create_cost_container(right_len + 1zu) };
+            COST_CONTAINER backward_costs { container_creator_pack.create_cost_container(right_len + 1zu) };
+            PATH_CONTAINER path { container_creator_pack.create_path_container(down_len + right_len + 2zu) };
+
+            // Walk forward to find where the alignment exits down (the end free ride's source, or the very end of down). Beyond the
+            // first column, the top row is entered through a free ride from the root, so its cost stays flat.
+            const auto forward_right_at { [&](std::size_t r) { return right[r]; } };
+            load_pattern(state, right_len, forward_right_at);
+            const auto [cost, end] {
+                find_free_end(state, right_len, down_len, [&](std::size_t d) { return down[d]; }, freeride_cost, 0, freeride_cost)
+            };
+            unload_pattern(state, right_len, forward_right_at);
+
+            // Walk backward from that exit point to find where the alignment enters down (the start free ride's destination, or the very
+            // start of down). Walking in reverse turns the free start into a free end, so the same search applies.
+            const auto backward_right_at { [&](std::size_t r) { return right[right_len - 1zu - r]; } };
+            load_pattern(state, right_len, backward_right_at);
+            const auto [backward_cost, backward_end] {
+                find_free_end(state, right_len, end, [&](std::size_t d) { return down[end - 1zu - d]; }, 1, 1, freeride_cost)
+            };
+            unload_pattern(state, right_len, backward_right_at);
+            const std::size_t start { end - backward_end };
+            if constexpr (debug_mode) {
+                if (backward_cost + (end < down_len ? freeride_cost : 0) != cost) {
+                    throw std::runtime_error { "Forward and backward walks disagree" };
+                }
+            }
+
+            if (start > 0zu) {
+                path.push_back(ELEMENT_OFFSETS { std::nullopt });
+            }
+            split_and_trace(state, forward_costs, backward_costs, down, right, start, end, 0zu, right_len, path);
+            if (end < down_len) {
+                path.push_back(ELEMENT_OFFSETS { std::nullopt });
+            }
+            return { std::move(path), cost };
+        }
+
+    private:
+        static void validate(
+            const sequence auto& down,
+            const sequence auto& right
+        ) {
+            static_assert(bit_parallel_element<std::remove_cvref_t<decltype(down[0zu])>>, "Down elements must be single byte integers");
+            static_assert(bit_parallel_element<std::remove_cvref_t<decltype(right[0zu])>>, "Right elements must be single byte integers");
+            if constexpr (debug_mode) {
+                if (std::numeric_limits<N_INDEX>::max() < down.size() || std::numeric_limits<N_INDEX>::max() < right.size()) {
+                    throw std::runtime_error { "N_INDEX not wide enough to support sequence lengths" };
+                }
+            }
+        }
+
+        static void validate_freeride_cost(const std::int64_t freeride_cost) {
+            if constexpr (debug_mode) {
+                if (freeride_cost < -1 || freeride_cost > 1) {
+                    throw std::runtime_error { "Free ride cost must be -1, 0, or 1" };
+                }
+            }
+        }
+
+        static std::size_t symbol(const auto elem) {
+            return static_cast<std::size_t>(static_cast<std::uint8_t>(elem));
+        }
+
+        bit_vector_state create_bit_vector_state(std::size_t pattern_len) {
+            return { container_creator_pack.create_word_container(word_cnt(pattern_len)), block_cnt(pattern_len) };
+        }
+
+        static void load_pattern(bit_vector_state& state, std::size_t pattern_len, const auto& pattern_at) {
+            for (std::size_t r { 0zu }; r < pattern_len; ++r) {
+                state.words[symbol(pattern_at(r)) * state.block_stride + r / word_bit_cnt] |= ONE << (r % word_bit_cnt);
+            }
+        }
+
+        // Clear only the match mask words the pattern touched, which is much cheaper than clearing every symbol's match mask when the
+        // pattern is short (as is the case deep into the traceback's recursion).
+        static void unload_pattern(bit_vector_state& state, std::size_t pattern_len, const auto& pattern_at) {
+            for (std::size_t r { 0zu }; r < pattern_len; ++r) {
+                state.words[symbol(pattern_at(r)) * state.block_stride + r / word_bit_cnt] = 0u;
+            }
+        }
+
+        // Advance a single word of the column's vertical deltas by 1 text element, given the horizontal delta coming in from above
+        // (hin) and the text element's match mask (eq). Returns the horizontal delta going out from the bit at out_bit.
+        static std::int64_t advance_block(
+            std::uint64_t& positive,
+            std::uint64_t& negative,
+            std::uint64_t eq,
+            const std::int64_t hin,
+            const std::uint64_t out_bit
+        ) {
+            const std::uint64_t hin_negative { hin < 0 ? ONE : 0u };
+            const std::uint64_t hin_positive { hin > 0 ? ONE : 0u };
+            const std::uint64_t xv { eq | negative };
+            eq |= hin_negative;
+            const std::uint64_t xh { (((eq & positive) + positive) ^ positive) | eq };
+            std::uint64_t ph { negative | ~(xh | positive) };
+            std::uint64_t mh { positive & xh };
+            const std::int64_t hout { ((ph & out_bit) != 0u ? 1 : 0) - ((mh & out_bit) != 0u ? 1 : 0) };
+            ph = (ph << 1u) | hin_positive;
+            mh = (mh << 1u) | hin_negative;
+            positive = mh | ~(xv | ph);
+            negative = ph & xv;
+            return hout;
+        }
+
+        // Walk text_len columns over the loaded pattern, starting from a column where each row costs 1 more than the row above (the
+        // leftmost column of any alignment, where only indels are possible). first_top_delta / top_delta are how much the top row's cost
+        // grows when stepping into the first column / any later column. Invokes on_column(d, top_cost, bottom_cost) for each column
+        // d in [0, text_len].
+        static void walk_columns(
+            bit_vector_state& state,
+            const std::size_t pattern_len,
+            const std::size_t text_len,
+            const auto& text_at,
+            const std::int64_t first_top_delta,
+            const std::int64_t top_delta,
+            const auto& on_column
+        ) {
+            const std::size_t blocks { block_cnt(pattern_len) };
+            const std::size_t positive_offset { symbol_cnt * state.block_stride };
+            const std::size_t negative_offset { positive_offset + state.block_stride };
+            for (std::size_t w { 0zu }; w < blocks; ++w) {
+                state.words[positive_offset + w] = ~std::uint64_t { 0u };
+                state.words[negative_offset + w] = 0u;
+            }
+            const std::uint64_t last_bit { pattern_len == 0zu ? 0u : ONE << ((pattern_len - 1zu) % word_bit_cnt) };
+            std::int64_t top { 0 };
+            std::int64_t bottom { static_cast<std::int64_t>(pattern_len) };
+            on_column(0zu, top, bottom);
+            for (std::size_t d { 1zu }; d <= text_len; ++d) {
+                std::int64_t carry { d == 1zu ? first_top_delta : top_delta };
+                top += carry;
+                const std::size_t eq_offset { symbol(text_at(d - 1zu)) * state.block_stride };
+                for (std::size_t w { 0zu }; w < blocks; ++w) {
+                    carry = advance_block(
+                        state.words[positive_offset + w],
+                        state.words[negative_offset + w],
+                        state.words[eq_offset + w],
+                        carry,
+                        w + 1zu == blocks ? last_bit : HIGH_BIT
+                    );
+                }
+                bottom += carry;
+                on_column(d, top, bottom);
+            }
+        }
+
+        // Walk columns, picking the column where the bottom row is exited for the least cost (the last column exits for free, every
+        // other column exits through a free ride). The first such column wins on ties.
+        static std::pair<std::int64_t, std::size_t> find_free_end(
+            bit_vector_state& state,
+            const std::size_t pattern_len,
+            const std::size_t text_len,
+            const auto& text_at,
+            const std::int64_t first_top_delta,
+            const std::int64_t top_delta,
+            const std::int64_t freeride_cost
+        ) {
+            std::optional<std::pair<std::int64_t, std::size_t>> best {};
+            walk_columns(
+                state,
+                pattern_len,
+                text_len,
+                text_at,
+                first_top_delta,
+                top_delta,
+                [&](std::size_t d, std::int64_t, std::int64_t bottom) {
+                    const std::int64_t cost { d == text_len ? bottom : bottom + freeride_cost };
+                    if (!best.has_value() || cost < best->first) {
+                        best = { cost, d };
+                    }
+                }
+            );
+            return *best;
+        }
+
+        // Materialize a column's costs from its vertical deltas.
+        static void extract_column(
+            const bit_vector_state& state,
+            const std::size_t pattern_len,
+            const std::int64_t top,
+            COST_CONTAINER& costs
+        ) {
+            const std::size_t positive_offset { symbol_cnt * state.block_stride };
+            const std::size_t negative_offset { positive_offset + state.block_stride };
+            costs[0zu] = top;
+            for (std::size_t r { 1zu }; r <= pattern_len; ++r) {
+                const std::size_t bit { r - 1zu };
+                const std::size_t w { bit / word_bit_cnt };
+                const std::size_t shift { bit % word_bit_cnt };
+                const std::uint64_t positive { (state.words[positive_offset + w] >> shift) & ONE };
+                const std::uint64_t negative { (state.words[negative_offset + w] >> shift) & ONE };
+                costs[r] = costs[r - 1zu] + static_cast<std::int64_t>(positive) - static_cast<std::int64_t>(negative);
+            }
+        }
+
+        static void push_step(PATH_CONTAINER& path, const std::optional<std::size_t> d, const std::optional<std::size_t> r) {
+            path.push_back(
+                ELEMENT_OFFSETS {
+                    {
+                        d.has_value() ? std::optional<N_INDEX> { static_cast<N_INDEX>(*d) } : std::nullopt,
+                        r.has_value() ? std::optional<N_INDEX> { static_cast<N_INDEX>(*r) } : std::nullopt
+                    }
+                }
+            );
+        }
+
+        // Hirschberg's divide-and-conquer: globally align down[d_from, d_to) vs right[r_from, r_to), appending steps to path in order.
+        void split_and_trace(
+            bit_vector_state& state,
+            COST_CONTAINER& forward_costs,
+            COST_CONTAINER& backward_costs,
+            const sequence auto& down,
+            const sequence auto& right,
+            const std::size_t d_from,
+            const std::size_t d_to,
+            const std::size_t r_from,
+            const std::size_t r_to,
+            PATH_CONTAINER& path
+        ) {
+            // Base cases: either sequence is empty (all indels), or down is a single element. For the latter, aligning that element
+            // against a matching right element (if any) is optimal, otherwise aligning it against the first right element is.
+            if (r_from == r_to) {
+                for (std::size_t d { d_from }; d < d_to; ++d) {
+                    push_step(path, { d }, std::nullopt);
+                }
+                return;
+            }
+            if (d_from == d_to) {
+                for (std::size_t r { r_from }; r < r_to; ++r) {
+                    push_step(path, std::nullopt, { r });
+                }
+                return;
+            }
+            if (d_to - d_from == 1zu) {
+                std::size_t k { r_from };
+                for (std::size_t r { r_from }; r < r_to; ++r) {
+                    if (down[d_from] == right[r]) {
+                        k = r;
+                        break;
+                    }
+                }
+                for (std::size_t r { r_from }; r < k; ++r) {
+                    push_step(path, std::nullopt, { r });
+                }
+                push_step(path, { d_from }, { k });
+                for (std::size_t r { k + 1zu }; r < r_to; ++r) {
+                    push_step(path, std::nullopt, { r });
+                }
+                return;
+            }
+
+            const std::size_t d_mid { d_from + (d_to - d_from) / 2zu };
+            const std::size_t pattern_len { r_to - r_from };
+            const auto ignore_column { [](std::size_t, std::int64_t, std::int64_t) {} };
+
+            // Costs of reaching each row of column d_mid from the top-left.
+            const auto forward_right_at { [&](std::size_t r) { return right[r_from + r]; } };
+            load_pattern(state, pattern_len, forward_right_at);
+            walk_columns(state, pattern_len, d_mid - d_from, [&](std::size_t d) { return down[d_from + d]; }, 1, 1, ignore_column);
+            extract_column(state, pattern_len, static_cast<std::int64_t>(d_mid - d_from), forward_costs);
+            unload_pattern(state, pattern_len, forward_right_at);
+
+            // Costs of reaching the bottom-right from each row of column d_mid (walked in reverse, so row r of the result is row
+            // pattern_len - r of column d_mid).
+            const auto backward_right_at { [&](std::size_t r) { return right[r_to - 1zu - r]; } };
+            load_pattern(state, pattern_len, backward_right_at);
+            walk_columns(state, pattern_len, d_to - d_mid, [&](std::size_t d) { return down[d_to - 1zu - d]; }, 1, 1, ignore_column);
+            extract_column(state, pattern_len, static_cast<std::int64_t>(d_to - d_mid), backward_costs);
+            unload_pattern(state, pattern_len, backward_right_at);
+
+            std::size_t split { 0zu };
+            std::int64_t split_cost { forward_costs[0zu] + backward_costs[pattern_len] };
+            for (std::size_t r { 1zu }; r <= pattern_len; ++r) {
+                const std::int64_t cost { forward_costs[r] + backward_costs[pattern_len - r] };
+                if (cost < split_cost) {
+                    split = r;
+                    split_cost = cost;
+                }
+            }
+            split_and_trace(state, forward_costs, backward_costs, down, right, d_from, d_mid, r_from, r_from + split, path);
+            split_and_trace(state, forward_costs, backward_costs, down, right, d_mid, d_to, r_from + split, r_to, path);
+        }
+
+        static std::int64_t path_cost(
+            const sequence auto& down,
+            const sequence auto& right,
+            const PATH_CONTAINER& path,
+            const std::int64_t freeride_cost
+        ) {
+            std::int64_t cost { 0 };
+            for (const ELEMENT_OFFSETS& step : path) {
+                if (!step.has_value()) {
+                    cost += freeride_cost;
+                } else if (!step->first.has_value() || !step->second.has_value()) {
+                    cost += 1;
+                } else if (!(down[*step->first] == right[*step->second])) {
+                    cost += 1;
+                }
+            }
+            return cost;
+        }
+    };
+
+    /**
+     * Helper function that constructs an
+     * @ref offbynull::aligner::backtrackers::bit_parallel_edit_distance_backtracker::backtracker::backtracker instance utilizing the heap
+     * for storage / computations.
+     *
+     * @tparam debug_mode `true` to enable debugging logic, `false` otherwise.
+     * @tparam N_INDEX Sequence offset type (must be wide enough to hold the length of the longer sequence).
+     * @tparam minimize_allocations `true` to force the path container to reserve its maximum possible size, thereby removing/reducing the
+     *     need for adhoc reallocations.
+     * @return Backtracker instance.
+     */
+    template<
+        bool debug_mode,
+        widenable_to_size_t N_INDEX,
+        bool minimize_allocations
+    >
+    auto create_heap_backtracker() {
+        return backtracker<
+            debug_mode,
+            N_INDEX,
+            backtracker_heap_container_creator_pack<
+                debug_mode,
+                N_INDEX,
+                minimize_allocations
+            >
+        > {};
+    }
+
+    /**
+     * Helper function that constructs an
+     * @ref offbynull::aligner::backtrackers::bit_parallel_edit_distance_backtracker::backtracker::backtracker instance utilizing the stack
+     * for storage / computations.
+     *
+     * @tparam debug_mode `true` to enable debugging logic, `false` otherwise.
+     * @tparam N_INDEX Sequence offset type (must be wide enough to hold `max_down_seq_len` and `max_right_seq_len`).
+     * @tparam max_down_seq_len Maximum length of the downward sequence.
+     * @tparam max_right_seq_len Maximum length of the rightward sequence.
+     * @return Backtracker instance.
+     */
+    template<
+        bool debug_mode,
+        widenable_to_size_t N_INDEX,
+        std::size_t max_down_seq_len,
+        std::size_t max_right_seq_len
+    >
+    auto create_stack_backtracker() {
+        return backtracker<
+            debug_mode,
+            N_INDEX,
+            backtracker_stack_container_creator_pack<
+                debug_mode,
+                N_INDEX,
+                max_down_seq_len,
+                max_right_seq_len
+            >
+        > {};
+    }
+}
+
+#endif //OFFBYNULL_ALIGNER_BACKTRACKERS_BIT_PARALLEL_EDIT_DISTANCE_BACKTRACKER_BACKTRACKER_H
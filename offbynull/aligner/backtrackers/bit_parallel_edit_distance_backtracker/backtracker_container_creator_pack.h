@@ -0,0 +1,38 @@
+#ifndef OFFBYNULL_ALIGNER_BACKTRACKERS_BIT_PARALLEL_EDIT_DISTANCE_BACKTRACKER_BACKTRACKER_CONTAINER_CREATOR_PACK_H
+#define OFFBYNULL_ALIGNER_BACKTRACKERS_BIT_PARALLEL_EDIT_DISTANCE_BACKTRACKER_BACKTRACKER_CONTAINER_CREATOR_PACK_H
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <utility>
+#include "offbynull/concepts.h"
+
+namespace offbynull::aligner::backtrackers::bit_parallel_edit_distance_backtracker::backtracker_container_creator_pack {
+    using offbynull::concepts::widenable_to_size_t;
+    using offbynull::concepts::random_access_sequence_container;
+    using offbynull::concepts::unqualified_object_type;
+
+    /**
+     * Concept that's satisfied if `T` has the traits for creating the containers required by
+     * @ref offbynull::aligner::backtrackers::bit_parallel_edit_distance_backtracker::backtracker::backtracker, referred to as a container
+     * creator pack.
+     *
+     * @tparam T Type to check.
+     * @tparam N_INDEX Sequence offset type.
+     */
+    template<
+        typename T,
+        typename N_INDEX
+    >
+    concept backtracker_container_creator_pack =
+        unqualified_object_type<T>
+        && widenable_to_size_t<N_INDEX>
+        && requires(const T t, std::size_t cnt, std::size_t path_capacity) {
+            { t.create_word_container(cnt) } -> random_access_sequence_container<std::uint64_t>;
+            { t.create_cost_container(cnt) } -> random_access_sequence_container<std::int64_t>;
+            { t.create_path_container(path_capacity) }
+                -> random_access_sequence_container<std::optional<std::pair<std::optional<N_INDEX>, std::optional<N_INDEX>>>>;
+        };
+}
+
+#endif //OFFBYNULL_ALIGNER_BACKTRACKERS_BIT_PARALLEL_EDIT_DISTANCE_BACKTRACKER_BACKTRACKER_CONTAINER_CREATOR_PACK_H
@@ -0,0 +1,98 @@
+#ifndef OFFBYNULL_ALIGNER_BACKTRACKERS_BIT_PARALLEL_EDIT_DISTANCE_BACKTRACKER_BACKTRACKER_STACK_CONTAINER_CREATOR_PACK_H
+#define OFFBYNULL_ALIGNER_BACKTRACKERS_BIT_PARALLEL_EDIT_DISTANCE_BACKTRACKER_BACKTRACKER_STACK_CONTAINER_CREATOR_PACK_H
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <utility>
+#include <stdexcept>
+#include "offbynull/aligner/backtrackers/bit_parallel_edit_distance_backtracker/bit_vectors.h"
+#include "offbynull/aligner/backtrackers/bit_parallel_edit_distance_backtracker/unimplemented_backtracker_container_creator_pack.h"
+#include "offbynull/concepts.h"
+#include "offbynull/utils.h"
+
+namespace offbynull::aligner::backtrackers::bit_parallel_edit_distance_backtracker::backtracker_stack_container_creator_pack {
+    using offbynull::aligner::backtrackers::bit_parallel_edit_distance_backtracker::bit_vectors::word_cnt;
+    using offbynull::concepts::widenable_to_size_t;
+    using offbynull::utils::static_vector_typer;
+
+    /**
+     * @ref offbynull::aligner::backtrackers::bit_parallel_edit_distance_backtracker::backtracker_container_creator_pack::backtracker_container_creator_pack
+     * that allocates its containers on the stack.
+     *
+     * @tparam debug_mode `true` to enable debugging logic, `false` otherwise.
+     * @tparam N_INDEX Sequence offset type.
+     * @tparam max_down_seq_len Maximum length of the downward sequence.
+     * @tparam max_right_seq_len Maximum length of the rightward sequence (the sequence that gets encoded into bit-vectors).
+     */
+    template<
+        bool debug_mode,
+        widenable_to_size_t N_INDEX,
+        std::size_t max_down_seq_len,
+        std::size_t max_right_seq_len
+    >
+    struct backtracker_stack_container_creator_pack {
+        /** Maximum number of elements the word container will need to hold. */
+        static constexpr std::size_t WORD_ELEM_COUNT { word_cnt(max_right_seq_len) };
+
+        /** `create_word_container()` return type. */
+        using WORD_CONTAINER_TYPE = typename static_vector_typer<debug_mode, std::uint64_t, WORD_ELEM_COUNT>::type;
+
+        /**
+         * @copydoc offbynull::aligner::backtrackers::bit_parallel_edit_distance_backtracker::unimplemented_backtracker_container_creator_pack::unimplemented_backtracker_container_creator_pack::create_word_container
+         */
+        WORD_CONTAINER_TYPE create_word_container(std::size_t cnt) const {
+            if constexpr (debug_mode) {
+                if (cnt > WORD_ELEM_COUNT) {
+                    throw std::runtime_error { "Bad element count" };
+                }
+            }
+            return WORD_CONTAINER_TYPE(cnt);
+        }
+
+        /** Maximum number of elements the cost container will need to hold: 1 per rightward sequence element, plus 1 for the top row. */
+        static constexpr std::size_t COST_ELEM_COUNT { max_right_seq_len + 1zu };
+
+        /** `create_cost_container()` return type. */
+        using COST_CONTAINER_TYPE = typename static_vector_typer<debug_mode, std::int64_t, COST_ELEM_COUNT>::type;
+
+        /**
+         * @copydoc offbynull::aligner::backtrackers::bit_parallel_edit_distance_backtracker::unimplemented_backtracker_container_creator_pack::unimplemented_backtracker_container_creator_pack::create_cost_container
+         */
+        COST_CONTAINER_TYPE create_cost_container(std::size_t cnt) const {
+            if constexpr (debug_mode) {
+                if (cnt > COST_ELEM_COUNT) {
+                    throw std::runtime_error { "Bad element count" };
+                }
+            }
+            return COST_CONTAINER_TYPE(cnt);
+        }
+
+        /**
+         * Maximum number of elements the path container will need to hold: 1 per element of either sequence, plus 2 free rides (fitting
+         * alignments only).
+         */
+        static constexpr std::size_t PATH_ELEM_COUNT { max_down_seq_len + max_right_seq_len + 2zu };
+
+        /** `create_path_container()` return type. */
+        using PATH_CONTAINER_TYPE = typename static_vector_typer<
+            debug_mode,
+            std::optional<std::pair<std::optional<N_INDEX>, std::optional<N_INDEX>>>,
+            PATH_ELEM_COUNT
+        >::type;
+
+        /**
+         * @copydoc offbynull::aligner::backtrackers::bit_parallel_edit_distance_backtracker::unimplemented_backtracker_container_creator_pack::unimplemented_backtracker_container_creator_pack::create_path_container
+         */
+        PATH_CONTAINER_TYPE create_path_container(std::size_t path_capacity) const {
+            if constexpr (debug_mode) {
+                if (path_capacity > PATH_ELEM_COUNT) {
+                    throw std::runtime_error { "Path capacity too large" };
+                }
+            }
+            return {};
+        }
+    };
+}
+
+#endif //OFFBYNULL_ALIGNER_BACKTRACKERS_BIT_PARALLEL_EDIT_DISTANCE_BACKTRACKER_BACKTRACKER_STACK_CONTAINER_CREATOR_PACK_H
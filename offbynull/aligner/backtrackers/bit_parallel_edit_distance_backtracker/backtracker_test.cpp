@@ -0,0 +1,200 @@
+#include "offbynull/aligner/graphs/pairwise_global_alignment_graph.h"
+#include "offbynull/aligner/graphs/pairwise_fitting_alignment_graph.h"
+#include "offbynull/aligner/backtrackers/bit_parallel_edit_distance_backtracker/backtracker.h"
+#include "offbynull/aligner/backtrackers/bit_parallel_edit_distance_backtracker/concepts.h"
+#include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/backtracker.h"
+#include "offbynull/aligner/scorers/levenshtein_scorer.h"
+#include "offbynull/aligner/scorers/simple_scorer.h"
+#include "offbynull/utils.h"
+#include "gtest/gtest.h"
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+#include <random>
+#include <type_traits>
+#include <ranges>
+#include <utility>
+
+namespace {
+    using offbynull::aligner::backtrackers::bit_parallel_edit_distance_backtracker::backtracker::create_heap_backtracker;
+    using offbynull::aligner::backtrackers::bit_parallel_edit_distance_backtracker::backtracker::create_stack_backtracker;
+    using offbynull::aligner::backtrackers::bit_parallel_edit_distance_backtracker::concepts::bit_parallel_alignable;
+    using offbynull::aligner::graphs::pairwise_global_alignment_graph::create_pairwise_global_alignment_graph;
+    using offbynull::aligner::graphs::pairwise_fitting_alignment_graph::create_pairwise_fitting_alignment_graph;
+    using offbynull::aligner::scorers::levenshtein_scorer::levenshtein_scorer;
+    using offbynull::aligner::scorers::simple_scorer::simple_scorer;
+    using offbynull::utils::copy_to_vector;
+    using offbynull::utils::is_debug_mode;
+
+    using ELEMENT_OFFSETS = std::optional<std::pair<std::optional<std::size_t>, std::optional<std::size_t>>>;
+
+    auto expected_max_weight(const auto& g) {
+        using G = std::remove_cvref_t<decltype(g)>;
+        const auto& [path, weight] {
+            offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtracker::backtracker<
+                is_debug_mode(),
+                G,
+                std::size_t,
+                std::size_t
+            > {}.find_max_path(g)
+        };
+        return weight;
+    }
+
+    // Replay an alignment, making sure it consumes right fully and down contiguously (fully if global) while summing up its cost.
+    std::int64_t replay(
+        const std::string& down,
+        const std::string& right,
+        const std::vector<ELEMENT_OFFSETS>& path,
+        std::int64_t freeride_cost,
+        bool global
+    ) {
+        std::optional<std::size_t> next_down {};
+        std::size_t next_right { 0zu };
+        std::int64_t cost { 0 };
+        if (global) {
+            next_down = { 0zu };
+        }
+        for (const ELEMENT_OFFSETS& step : path) {
+            if (!step.has_value()) {
+                cost += freeride_cost;
+                continue;
+            }
+            const auto& [d, r] { *step };
+            if (d.has_value()) {
+                if (next_down.has_value()) {
+                    EXPECT_EQ(*d, *next_down);
+                }
+                next_down = { *d + 1zu };
+            }
+            if (r.has_value()) {
+                EXPECT_EQ(*r, next_right);
+                next_right = *r + 1zu;
+            }
+            cost += d.has_value() && r.has_value() && down[*d] == right[*r] ? 0 : 1;
+        }
+        EXPECT_EQ(next_right, right.size());
+        if (global) {
+            EXPECT_EQ(next_down, down.size());
+        }
+        return cost;
+    }
+
+    TEST(OABBBacktrackerTest, ConceptCheck) {
+        using LEVENSHTEIN_SCORER = levenshtein_scorer<is_debug_mode(), std::size_t, char, char, std::int32_t>;
+        using SIMPLE_SCORER = simple_scorer<is_debug_mode(), std::size_t, char, char, std::int32_t>;
+        static_assert(bit_parallel_alignable<char, char, LEVENSHTEIN_SCORER, LEVENSHTEIN_SCORER>);
+        static_assert(!bit_parallel_alignable<char, char, SIMPLE_SCORER, LEVENSHTEIN_SCORER>);  // not unit costs
+        using WIDE_SCORER = levenshtein_scorer<is_debug_mode(), std::size_t, std::int32_t, std::int32_t, std::int32_t>;
+        static_assert(!bit_parallel_alignable<std::int32_t, std::int32_t, WIDE_SCORER, WIDE_SCORER>);  // elements not single byte
+    }
+
+    TEST(OABBBacktrackerTest, FindGlobalPath) {
+        std::string seq1 { "kitten" };
+        std::string seq2 { "sitting" };
+        auto backtracker { create_heap_backtracker<is_debug_mode(), std::size_t, true>() };
+        const auto& [path, cost] { backtracker.find_global_path(seq1, seq2) };
+        EXPECT_EQ(
+            copy_to_vector(path),
+            (std::vector<ELEMENT_OFFSETS> {
+                { { { 0zu }, { 0zu } } },
+                { { { 1zu }, { 1zu } } },
+                { { { 2zu }, { 2zu } } },
+                { { { 3zu }, { 3zu } } },
+                { { { 4zu }, { 4zu } } },
+                { { { 5zu }, { 5zu } } },
+                { { std::nullopt, { 6zu } } }
+            })
+        );
+        EXPECT_EQ(cost, 3);
+        EXPECT_EQ(backtracker.find_global_cost(seq1, seq2), 3);
+    }
+
+    TEST(OABBBacktrackerTest, FindFittingPath) {
+        std::string seq1 { "xxkittenxx" };
+        std::string seq2 { "sitting" };
+        auto backtracker { create_heap_backtracker<is_debug_mode(), std::size_t, true>() };
+        const auto& [path, cost] { backtracker.find_fitting_path(seq1, seq2, 0) };
+        EXPECT_EQ(
+            copy_to_vector(path),
+            (std::vector<ELEMENT_OFFSETS> {
+                { std::nullopt },
+                { { std::nullopt, { 0zu } } },
+                { { { 3zu }, { 1zu } } },
+                { { { 4zu }, { 2zu } } },
+                { { { 5zu }, { 3zu } } },
+                { { { 6zu }, { 4zu } } },
+                { { { 7zu }, { 5zu } } },
+                { { std::nullopt, { 6zu } } },
+                { std::nullopt }
+            })
+        );
+        EXPECT_EQ(cost, 3);
+        EXPECT_EQ(backtracker.find_fitting_cost(seq1, seq2, 0), 3);
+    }
+
+    TEST(OABBBacktrackerTest, FindPathViaStack) {
+        std::string seq1 { "kitten" };
+        std::string seq2 { "sitting" };
+        auto heap_backtracker { create_heap_backtracker<is_debug_mode(), std::size_t, true>() };
+        auto stack_backtracker { create_stack_backtracker<is_debug_mode(), std::size_t, 6zu, 7zu>() };
+        {
+            const auto& [expected_path, expected_cost] { heap_backtracker.find_global_path(seq1, seq2) };
+            const auto& [path, cost] { stack_backtracker.find_global_path(seq1, seq2) };
+            EXPECT_EQ(copy_to_vector(path), copy_to_vector(expected_path));
+            EXPECT_EQ(cost, expected_cost);
+        }
+        {
+            const auto& [expected_path, expected_cost] { heap_backtracker.find_fitting_path(seq1, seq2, -1) };
+            const auto& [path, cost] { stack_backtracker.find_fitting_path(seq1, seq2, -1) };
+            EXPECT_EQ(copy_to_vector(path), copy_to_vector(expected_path));
+            EXPECT_EQ(cost, expected_cost);
+        }
+    }
+
+    TEST(OABBBacktrackerTest, RandomizedTestingAgainstReadyQueueBacktracker) {
+        std::mt19937_64 rand { 12345 };
+        auto random_integer { [&](auto a, auto b) -> decltype(a) { return std::uniform_int_distribution<decltype(a)>(a,b)(rand); } };
+        auto random_string {
+            [&](std::size_t max_len) {
+                std::string ret {};
+                for ([[maybe_unused]] auto _ : std::views::iota(0zu, random_integer(0zu, max_len))) {
+                    ret += random_integer('a', 'd');
+                }
+                return ret;
+            }
+        };
+        levenshtein_scorer<is_debug_mode(), std::size_t, char, char, std::int32_t> scorer {};
+        // Lengths span patterns that fit in a single word as well as ones that span multiple words
+        for (const std::size_t max_len : { 10zu, 150zu }) {
+            for ([[maybe_unused]] auto _ : std::views::iota(0u, 50u)) {
+                std::string seq1 { random_string(max_len) };
+                std::string seq2 { random_string(max_len) };
+                auto backtracker { create_heap_backtracker<is_debug_mode(), std::size_t, true>() };
+                {
+                    auto g { create_pairwise_global_alignment_graph<is_debug_mode(), std::size_t>(seq1, seq2, scorer, scorer) };
+                    const auto& [path, cost] { backtracker.find_global_path(seq1, seq2) };
+                    EXPECT_EQ(-cost, expected_max_weight(g));
+                    EXPECT_EQ(replay(seq1, seq2, copy_to_vector(path), 0, true), cost);
+                    EXPECT_EQ(backtracker.find_global_cost(seq1, seq2), cost);
+                }
+                for (const std::int32_t freeride_weight : { -1, 0, 1 }) {
+                    auto freeride_scorer {
+                        simple_scorer<is_debug_mode(), std::size_t, char, char, std::int32_t>::create_freeride(freeride_weight)
+                    };
+                    auto g {
+                        create_pairwise_fitting_alignment_graph<is_debug_mode(), std::size_t>(
+                            seq1, seq2, scorer, scorer, freeride_scorer
+                        )
+                    };
+                    const auto& [path, cost] { backtracker.find_fitting_path(seq1, seq2, -freeride_weight) };
+                    EXPECT_EQ(-cost, expected_max_weight(g));
+                    EXPECT_EQ(replay(seq1, seq2, copy_to_vector(path), -freeride_weight, false), cost);
+                    EXPECT_EQ(backtracker.find_fitting_cost(seq1, seq2, -freeride_weight), cost);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,35 @@
+#ifndef OFFBYNULL_ALIGNER_BACKTRACKERS_BIT_PARALLEL_EDIT_DISTANCE_BACKTRACKER_BIT_VECTORS_H
+#define OFFBYNULL_ALIGNER_BACKTRACKERS_BIT_PARALLEL_EDIT_DISTANCE_BACKTRACKER_BIT_VECTORS_H
+
+#include <cstddef>
+
+namespace offbynull::aligner::backtrackers::bit_parallel_edit_distance_backtracker::bit_vectors {
+    /** Number of bits (pattern elements) held by each bit-vector word. */
+    constexpr std::size_t word_bit_cnt { 64zu };
+
+    /** Number of distinct single byte symbols, each of which gets its own match mask. */
+    constexpr std::size_t symbol_cnt { 256zu };
+
+    /**
+     * Number of words needed to hold 1 bit per pattern element.
+     *
+     * @param pattern_len Pattern length.
+     * @return `pattern_len` divided by @ref word_bit_cnt, rounded up.
+     */
+    constexpr std::size_t block_cnt(std::size_t pattern_len) {
+        return (pattern_len + word_bit_cnt - 1zu) / word_bit_cnt;
+    }
+
+    /**
+     * Number of words needed by a pattern of up to `pattern_len` elements: a match mask per symbol, plus the positive and negative
+     * vertical delta vectors.
+     *
+     * @param pattern_len Pattern length.
+     * @return Word count.
+     */
+    constexpr std::size_t word_cnt(std::size_t pattern_len) {
+        return (symbol_cnt + 2zu) * block_cnt(pattern_len);
+    }
+}
+
+#endif //OFFBYNULL_ALIGNER_BACKTRACKERS_BIT_PARALLEL_EDIT_DISTANCE_BACKTRACKER_BIT_VECTORS_H
@@ -0,0 +1,63 @@
+#ifndef OFFBYNULL_ALIGNER_BACKTRACKERS_BIT_PARALLEL_EDIT_DISTANCE_BACKTRACKER_CONCEPTS_H
+#define OFFBYNULL_ALIGNER_BACKTRACKERS_BIT_PARALLEL_EDIT_DISTANCE_BACKTRACKER_CONCEPTS_H
+
+#include <concepts>
+#include <type_traits>
+#include "offbynull/aligner/scorers/levenshtein_scorer.h"
+
+namespace offbynull::aligner::backtrackers::bit_parallel_edit_distance_backtracker::concepts {
+    using offbynull::aligner::scorers::levenshtein_scorer::levenshtein_scorer;
+
+    /**
+     * Concept that's satisfied if `T` is a sequence element type that
+     * @ref offbynull::aligner::backtrackers::bit_parallel_edit_distance_backtracker::backtracker::backtracker can index into its
+     * per-symbol match masks. That is, `T` is a (non-`bool`) single byte integral type, such as `char` or `unsigned char`.
+     *
+     * @tparam T Type to check.
+     */
+    template<typename T>
+    concept bit_parallel_element =
+        std::integral<T>
+        && !std::same_as<T, bool>
+        && sizeof(T) == 1zu;
+
+    /**
+     * Concept that's satisfied if `T` is a @ref offbynull::aligner::scorers::levenshtein_scorer::levenshtein_scorer over `ELEM`s (in
+     * either debug mode). Such scorers assign unit costs to mismatches and indels, which is what
+     * @ref offbynull::aligner::backtrackers::bit_parallel_edit_distance_backtracker::backtracker::backtracker encodes into its bit-vectors.
+     *
+     * @tparam T Type to check.
+     * @tparam ELEM Sequence element type.
+     */
+    template<typename T, typename ELEM>
+    concept bit_parallel_scorer =
+        requires {
+            typename T::SEQ_INDEX;
+            typename T::WEIGHT;
+        }
+        && std::is_signed_v<typename T::WEIGHT>
+        && (
+            std::same_as<T, levenshtein_scorer<true, typename T::SEQ_INDEX, ELEM, ELEM, typename T::WEIGHT>>
+            || std::same_as<T, levenshtein_scorer<false, typename T::SEQ_INDEX, ELEM, ELEM, typename T::WEIGHT>>
+        );
+
+    /**
+     * Concept that's satisfied if sequences of `DOWN_ELEM` / `RIGHT_ELEM`s scored by `SUBSTITUTION_SCORER` / `GAP_SCORER` can be aligned
+     * by @ref offbynull::aligner::backtrackers::bit_parallel_edit_distance_backtracker::backtracker::backtracker rather than walking a
+     * pairwise alignment graph. That is, both sequences hold the same single byte element type and both scorers are
+     * @ref offbynull::aligner::scorers::levenshtein_scorer::levenshtein_scorer instances.
+     *
+     * @tparam DOWN_ELEM Downward sequence element type.
+     * @tparam RIGHT_ELEM Rightward sequence element type.
+     * @tparam SUBSTITUTION_SCORER Match/mismatch (substitution) scorer type.
+     * @tparam GAP_SCORER Gap (indel) scorer type.
+     */
+    template<typename DOWN_ELEM, typename RIGHT_ELEM, typename SUBSTITUTION_SCORER, typename GAP_SCORER>
+    concept bit_parallel_alignable =
+        bit_parallel_element<DOWN_ELEM>
+        && std::same_as<DOWN_ELEM, RIGHT_ELEM>
+        && bit_parallel_scorer<SUBSTITUTION_SCORER, DOWN_ELEM>
+        && bit_parallel_scorer<GAP_SCORER, DOWN_ELEM>;
+}
+
+#endif //OFFBYNULL_ALIGNER_BACKTRACKERS_BIT_PARALLEL_EDIT_DISTANCE_BACKTRACKER_CONCEPTS_H
@@ -0,0 +1,43 @@
+#ifndef OFFBYNULL_ALIGNER_BACKTRACKERS_BIT_PARALLEL_EDIT_DISTANCE_BACKTRACKER_UNIMPLEMENTED_BACKTRACKER_CONTAINER_CREATOR_PACK_H
+#define OFFBYNULL_ALIGNER_BACKTRACKERS_BIT_PARALLEL_EDIT_DISTANCE_BACKTRACKER_UNIMPLEMENTED_BACKTRACKER_CONTAINER_CREATOR_PACK_H
+
+#include <cstddef>
+#include <optional>
+#include "offbynull/aligner/backtrackers/bit_parallel_edit_distance_backtracker/backtracker_container_creator_pack.h"
+
+namespace offbynull::aligner::backtrackers::bit_parallel_edit_distance_backtracker::unimplemented_backtracker_container_creator_pack {
+    /**
+     * Unimplemented
+     * @ref offbynull::aligner::backtrackers::bit_parallel_edit_distance_backtracker::backtracker_container_creator_pack::backtracker_container_creator_pack,
+     * intended for documentation.
+     */
+    struct unimplemented_backtracker_container_creator_pack {
+        /**
+         * Create random access container of 64-bit words, used to hold bit-vectors (per-symbol match masks and the vertical deltas of
+         * the column being walked).
+         *
+         * @param cnt Number of elements.
+         * @return Random access container of `cnt` zero-initialized elements.
+         */
+        auto create_word_container(std::size_t cnt) const;
+
+        /**
+         * Create random access container of costs, used to hold a single column of edit distances when splitting the alignment in half.
+         *
+         * @param cnt Number of elements.
+         * @return Random access container of `cnt` zero-initialized elements.
+         */
+        auto create_cost_container(std::size_t cnt) const;
+
+        /**
+         * Create random access container used to store an alignment (sequence of element offset pairs, where free rides are
+         * `std::nullopt`).
+         *
+         * @param path_capacity Maximum number of elements the alignment can have.
+         * @return Empty random access container.
+         */
+        auto create_path_container(std::size_t path_capacity) const;
+    };
+}
+
+#endif //OFFBYNULL_ALIGNER_BACKTRACKERS_BIT_PARALLEL_EDIT_DISTANCE_BACKTRACKER_UNIMPLEMENTED_BACKTRACKER_CONTAINER_CREATOR_PACK_H
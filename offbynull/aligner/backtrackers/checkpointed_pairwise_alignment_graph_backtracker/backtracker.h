@@ -0,0 +1,375 @@
+#ifndef OFFBYNULL_ALIGNER_BACKTRACKERS_CHECKPOINTED_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_BACKTRACKER_H
+#define OFFBYNULL_ALIGNER_BACKTRACKERS_CHECKPOINTED_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_BACKTRACKER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "offbynull/aligner/concepts.h"
+#include "offbynull/aligner/graph/sliceable_pairwise_alignment_graph.h"
+#include "offbynull/aligner/backtrackers/sliceable_pairwise_alignment_graph_backtracker/backtrackable_node.h"
+#include "offbynull/aligner/backtrackers/sliceable_pairwise_alignment_graph_backtracker/backtrackable_edge.h"
+#include "offbynull/aligner/backtrackers/sliceable_pairwise_alignment_graph_backtracker/concepts.h"
+#include "offbynull/aligner/backtrackers/sliceable_pairwise_alignment_graph_backtracker/row_slot_container/slot.h"
+#include "offbynull/aligner/backtrackers/sliceable_pairwise_alignment_graph_backtracker/resident_slot_container/resident_slot.h"
+#include "offbynull/aligner/backtrackers/sliceable_pairwise_alignment_graph_backtracker/resident_slot_container/resident_slot_container.h"
+#include "offbynull/aligner/backtrackers/checkpointed_pairwise_alignment_graph_backtracker/backtracker_container_creator_pack.h"
+#include "offbynull/aligner/backtrackers/checkpointed_pairwise_alignment_graph_backtracker/backtracker_heap_container_creator_pack.h"
+
+namespace offbynull::aligner::backtrackers::checkpointed_pairwise_alignment_graph_backtracker::backtracker {
+    using offbynull::aligner::graph::sliceable_pairwise_alignment_graph::sliceable_pairwise_alignment_graph;
+    using offbynull::aligner::concepts::weight;
+    using offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::backtrackable_node::backtrackable_node;
+    using offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::backtrackable_edge::backtrackable_edge;
+    using offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::concepts::backtracking_result;
+    using offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::concepts
+        ::backtracking_result_without_explicit_weight;
+    using offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::row_slot_container::slot::slot;
+    using offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::resident_slot_container::resident_slot
+        ::resident_slot;
+    using offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::resident_slot_container
+        ::resident_slot_container::resident_slot_container;
+    using offbynull::aligner::backtrackers::checkpointed_pairwise_alignment_graph_backtracker::backtracker_container_creator_pack
+        ::backtracker_container_creator_pack;
+    using offbynull::aligner::backtrackers::checkpointed_pairwise_alignment_graph_backtracker::backtracker_heap_container_creator_pack
+        ::backtracker_heap_container_creator_pack;
+
+    /**
+     * Backtracker for @ref offbynull::aligner::graph::sliceable_pairwise_alignment_graph::sliceable_pairwise_alignment_graph
+     * implementations that sits between
+     * @ref offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtracker::backtracker (holds every node's slot, no
+     * recomputation) and
+     * @ref offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::backtracker::backtracker (holds a couple of
+     * rows, recomputes the graph ~2x). A backtracker's purpose is to find the maximally-weighted path (path with the highest sum of edge
+     * weights) between some directed graph's root node and leaf node, picking an arbitrary one if there are multiple such paths.
+     *
+     * The graph is walked row-by-row from the root node, keeping a copy of every k-th row (checkpoint). Backtracking from the leaf node
+     * then recomputes the rows between two checkpoints one block at a time, starting from the checkpoint at the top of the block. Since
+     * the path only ever moves upward, each block is recomputed at most once, meaning the graph is walked at most ~2x (~1x forward + at
+     * most ~1x while backtracking). The value of k is the smallest one for which the checkpoints plus a single block fit within a memory
+     * budget, where the memory requirement is minimized at k ~ sqrt(grid_down_cnt). If the budget is large enough to hold every row, no
+     * rows are recomputed at all. If the budget is too small to fit even the minimum, the minimum is used regardless.
+     *
+     * Unlike the sliceable backtracker, this backtracker doesn't need a weight comparison tolerance, since it never relies on weights
+     * computed by two different walks being equal.
+     *
+     * @tparam debug_mode `true` to enable debugging logic, `false` otherwise.
+     * @tparam G Graph type.
+     * @tparam CONTAINER_CREATOR_PACK Container factory type.
+     */
+    template<
+        bool debug_mode,
+        sliceable_pairwise_alignment_graph G,
+        backtracker_container_creator_pack<
+            typename G::N,
+            typename G::E,
+            typename G::ED
+        > CONTAINER_CREATOR_PACK = backtracker_heap_container_creator_pack<
+            debug_mode,
+            typename G::N,
+            typename G::E,
+            typename G::ED,
+            true
+        >
+    >
+    requires backtrackable_node<typename G::N> &&
+        backtrackable_edge<typename G::E>
+    class backtracker {
+    public:
+        /** `G`'s node identifier type. */
+        using N = typename G::N;
+        /** `G`'s edge identifier type. */
+        using E = typename G::E;
+        /** `G`'s node data type. */
+        using ND = typename G::ND;
+        /** `G`'s edge data type. */
+        using ED = typename G::ED;
+        /** `G`'s grid coordinate type. For example, `std::uint8_t` will allow up to 255 nodes on both the down and right axis. */
+        using N_INDEX = typename G::N_INDEX;
+
+        /**
+         * Row slot container type used by this backtracker implementation (holds both checkpoint rows and block rows).
+         */
+        using ROW_SLOT_CONTAINER = decltype(
+            std::declval<CONTAINER_CREATOR_PACK>().create_row_slot_container(0zu, 0zu, 0zu, std::declval<ED>())
+        );
+        /**
+         * @ref offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::resident_slot_container::resident_slot_container::resident_slot_container
+         * container factory type used by this backtracker implementation.
+         */
+        using RESIDENT_SLOT_CONTAINER_CONTAINER_CREATOR_PACK =
+            decltype(std::declval<CONTAINER_CREATOR_PACK>().create_resident_slot_container_container_creator_pack());
+        /**
+         * Path container type used by this backtracker implementation.
+         */
+        using PATH_CONTAINER = decltype(std::declval<CONTAINER_CREATOR_PACK>().create_path_container(0zu));
+
+    private:
+        /**
+         * Initial edge weight (e.g., 0).
+         */
+        ED zero_weight;
+
+        /**
+         * Maximum number of bytes to spend on checkpoint rows and block rows.
+         */
+        std::size_t memory_budget;
+
+        /**
+         * Container factory.
+         */
+        CONTAINER_CREATOR_PACK container_creator_pack;
+
+    public:
+        /**
+         * Construct an
+         * @ref offbynull::aligner::backtrackers::checkpointed_pairwise_alignment_graph_backtracker::backtracker::backtracker instance.
+         *
+         * @param zero_weight_ Initial weight, equivalent to 0 for numeric weights. Defaults to `ED`'s default constructor, assuming it
+         *     exists.
+         * @param memory_budget_ Maximum number of bytes to spend on checkpoint rows and block rows (resident nodes and the returned path
+         *     aren't counted). Defaults to unlimited, meaning every row is checkpointed.
+         * @param container_creator_pack_ Container factory.
+         */
+        backtracker(
+            ED zero_weight_ = {},
+            std::size_t memory_budget_ = std::numeric_limits<std::size_t>::max(),
+            CONTAINER_CREATOR_PACK container_creator_pack_ = {}
+        )
+        : zero_weight { zero_weight_ }
+        , memory_budget { memory_budget_ }
+        , container_creator_pack { container_creator_pack_ } {}
+
+        /**
+         * Determine how many rows apart checkpoints are placed (k), such that checkpoints and a single block of rows fit within
+         * `memory_budget_`.
+         *
+         * @param grid_down_cnt Down dimension of the graph.
+         * @param row_byte_cnt Number of bytes needed to hold a single row of slots.
+         * @param memory_budget_ Maximum number of bytes to spend on checkpoint rows and block rows.
+         * @return Smallest interval whose rows fit within `memory_budget_`, or the interval that requires the fewest rows if none fit.
+         */
+        static std::size_t checkpoint_interval(std::size_t grid_down_cnt, std::size_t row_byte_cnt, std::size_t memory_budget_) {
+            const std::size_t row_budget { row_byte_cnt == 0zu ? std::numeric_limits<std::size_t>::max() : memory_budget_ / row_byte_cnt };
+            std::size_t best_interval { 1zu };
+            std::size_t best_row_cnt { std::numeric_limits<std::size_t>::max() };
+            for (std::size_t interval { 1zu }; interval <= std::max(grid_down_cnt, 1zu); ++interval) {
+                const std::size_t row_cnt { stored_row_count(grid_down_cnt, interval) };
+                if (row_cnt <= row_budget) {
+                    return interval;
+                }
+                if (row_cnt < best_row_cnt) {
+                    best_interval = interval;
+                    best_row_cnt = row_cnt;
+                }
+            }
+            return best_interval;
+        }
+
+        /**
+         * Determine the maximally-weighted path (path with the highest sum of edge weights) connecting a sliceable pairwise alignment
+         * graph's root node and leaf node.
+         *
+         * @param g Graph.
+         * @return Maximally weighted path from `g`'s root node to `g`'s leaf node, along with that path's weight.
+         */
+        backtracking_result<ED> auto find_max_path(const G& g) {
+            const std::size_t row_slot_cnt { g.grid_right_cnt * g.grid_depth_cnt };
+            const std::size_t interval {
+                checkpoint_interval(g.grid_down_cnt, row_slot_cnt * sizeof(slot<E, ED>), memory_budget)
+            };
+            const std::size_t block_row_cnt { std::max(interval, 2zu) };  // Walking a row requires the row above it
+            const std::size_t checkpoint_cnt { (g.grid_down_cnt + interval - 1zu) / interval };
+            ROW_SLOT_CONTAINER checkpoints {
+                container_creator_pack.create_row_slot_container(checkpoint_cnt, g.grid_right_cnt, g.grid_depth_cnt, zero_weight)
+            };
+            ROW_SLOT_CONTAINER block {
+                container_creator_pack.create_row_slot_container(block_row_cnt, g.grid_right_cnt, g.grid_depth_cnt, zero_weight)
+            };
+            resident_slot_container<debug_mode, G, RESIDENT_SLOT_CONTAINER_CONTAINER_CREATOR_PACK> resident_slots {
+                g,
+                zero_weight,
+                container_creator_pack.create_resident_slot_container_container_creator_pack()
+            };
+            // Row r of the graph always occupies row r % block_row_cnt of block.
+            auto find_slot {
+                [&](const N& node) -> slot<E, ED>& {
+                    auto found_resident { resident_slots.find(node) };
+                    if (found_resident.has_value()) {
+                        return (*found_resident).get().slot_;
+                    }
+                    const auto& [down_offset, right_offset, depth] { g.node_to_grid_offset(node) };
+                    const std::size_t column { (static_cast<std::size_t>(right_offset) * g.grid_depth_cnt) + depth };
+                    return block[((down_offset % block_row_cnt) * row_slot_cnt) + column];
+                }
+            };
+            auto copy_row {
+                [&](const ROW_SLOT_CONTAINER& src, std::size_t src_row, ROW_SLOT_CONTAINER& dst, std::size_t dst_row) {
+                    std::copy_n(
+                        src.begin() + static_cast<std::ptrdiff_t>(src_row * row_slot_cnt),
+                        row_slot_cnt,
+                        dst.begin() + static_cast<std::ptrdiff_t>(dst_row * row_slot_cnt)
+                    );
+                }
+            };
+
+            // Walk forward, checkpointing every interval-th row.
+            for (std::size_t down { 0zu }; down < g.grid_down_cnt; ++down) {
+                walk_row(g, static_cast<N_INDEX>(down), resident_slots, find_slot, true);
+                if (down % interval == 0zu) {
+                    copy_row(block, down % block_row_cnt, checkpoints, down / interval);
+                }
+            }
+
+            // Walk backward. Block currently holds the rows following the final checkpoint, so that block doesn't need recomputing.
+            std::size_t loaded_checkpoint { ((g.grid_down_cnt - 1zu) / interval) * interval };
+            auto load_slot {
+                [&](const N& node) -> const slot<E, ED>& {
+                    if (!resident_slots.find(node).has_value()) {
+                        const std::size_t down { static_cast<std::size_t>(std::get<0>(g.node_to_grid_offset(node))) };
+                        const std::size_t checkpoint { down - (down % interval) };
+                        if (checkpoint != loaded_checkpoint) {
+                            copy_row(checkpoints, checkpoint / interval, block, checkpoint % block_row_cnt);
+                            const std::size_t block_end { std::min(checkpoint + interval, static_cast<std::size_t>(g.grid_down_cnt)) };
+                            for (std::size_t recompute_down { checkpoint + 1zu }; recompute_down < block_end; ++recompute_down) {
+                                walk_row(g, static_cast<N_INDEX>(recompute_down), resident_slots, find_slot, false);
+                            }
+                            loaded_checkpoint = checkpoint;
+                        }
+                    }
+                    return find_slot(node);
+                }
+            };
+            PATH_CONTAINER path { container_creator_pack.create_path_container(g.path_edge_capacity) };
+            const N root_node { g.get_root_node() };
+            N node { g.get_leaf_node() };
+            const ED final_weight { load_slot(node).backtracking_weight };
+            while (node != root_node) {
+                const slot<E, ED>& slot_ { load_slot(node) };
+                if constexpr (debug_mode) {
+                    if (!slot_.backtracking_edge.has_value()) {
+                        throw std::runtime_error { "Root not reachable" };
+                    }
+                }
+                const E edge { *slot_.backtracking_edge };
+                path.push_back(edge);
+                node = g.get_edge_from(edge);
+            }
+            std::ranges::reverse(path);
+            return std::make_pair(
+                std::move(path),
+                final_weight
+            );  // NOTE: No dangling issues - make_pair() stores values, not refs.
+        }
+
+    private:
+        static std::size_t stored_row_count(std::size_t grid_down_cnt, std::size_t interval) {
+            return ((grid_down_cnt + interval - 1zu) / interval) + std::max(interval, 2zu);
+        }
+
+        void walk_row(
+            const G& g,
+            N_INDEX down,
+            resident_slot_container<debug_mode, G, RESIDENT_SLOT_CONTAINER_CONTAINER_CREATOR_PACK>& resident_slots,
+            auto& find_slot,
+            bool update_residents
+        ) {
+            for (const N& node : g.row_nodes(down)) {
+                // Compute only if node is not a resident. A resident node's backtracking weight + backtracking edge is computed as its
+                // inputs are walked over one-by-one (see block below this one). While recomputing a block, resident nodes are already
+                // final and so are left untouched.
+                const bool is_resident { resident_slots.find(node).has_value() };
+                if (is_resident && !update_residents) {
+                    continue;
+                }
+                slot<E, ED>& slot_ { find_slot(node) };
+                if (!is_resident) {
+                    std::optional<std::pair<E, ED>> found {};
+                    for (const E& edge : g.get_inputs(node)) {
+                        const N& n_from { g.get_edge_from(edge) };
+                        const ED& edge_weight { g.get_edge_data(edge) };
+                        ED weight_ {
+                            static_cast<ED>(find_slot(n_from).backtracking_weight + edge_weight)  // Cast to prevent narrowing warning
+                        };
+                        if (!found.has_value() || (*found).second < weight_) {
+                            found = std::pair<E, ED> { edge, weight_ };
+                        }
+                    }
+                    if (found.has_value()) {
+                        slot_.backtracking_edge = { (*found).first };
+                        slot_.backtracking_weight = (*found).second;
+                    } else {  // if no incoming nodes found, it's a root node
+                        slot_ = slot<E, ED> { std::nullopt, zero_weight };
+                    }
+                }
+                if (!update_residents) {
+                    continue;
+                }
+
+                // Update resident node weights
+                for (const E& edge : g.outputs_to_residents(node)) {
+                    const N& resident_node { g.get_edge_to(edge) };
+                    std::optional<std::reference_wrapper<resident_slot<E, ED>>> resident_slot_maybe {
+                        resident_slots.find(resident_node)
+                    };
+                    if constexpr (debug_mode) {
+                        if (!resident_slot_maybe.has_value()) {
+                            throw std::runtime_error { "This should never happen" };
+                        }
+                    }
+                    resident_slot<E, ED>& resident_slot_ { (*resident_slot_maybe).get() };
+                    const ED& edge_weight { g.get_edge_data(edge) };
+                    ED new_weight {
+                        static_cast<ED>(slot_.backtracking_weight + edge_weight)  // Cast to prevent narrowing warning
+                    };
+                    if (!resident_slot_.initialized || new_weight > resident_slot_.slot_.backtracking_weight) {
+                        resident_slot_.slot_.backtracking_edge = { edge };
+                        resident_slot_.slot_.backtracking_weight = new_weight;
+                        resident_slot_.initialized = true;
+                    }
+                }
+            }
+        }
+    };
+
+    /**
+     * Helper function that constructs an
+     * @ref offbynull::aligner::backtrackers::checkpointed_pairwise_alignment_graph_backtracker::backtracker::backtracker instance
+     * utilizing the heap for storage / computations and invokes `find_max_path(g)` on it.
+     *
+     * @tparam debug_mode `true` to enable debugging logic, `false` otherwise.
+     * @tparam minimize_allocations Primes certain containers with enough capacity such that adhoc reallocations aren't needed.
+     * @param g Graph.
+     * @param memory_budget Maximum number of bytes to spend on checkpoint rows and block rows.
+     * @return `find_max_path(g)` result.
+     */
+    template<
+        bool debug_mode,
+        bool minimize_allocations
+    >
+    backtracking_result_without_explicit_weight auto heap_find_max_path(
+        const sliceable_pairwise_alignment_graph auto& g,
+        std::size_t memory_budget
+    ) {
+        using G = std::remove_cvref_t<decltype(g)>;
+        return backtracker<
+            debug_mode,
+            G,
+            backtracker_heap_container_creator_pack<
+                debug_mode,
+                typename G::N,
+                typename G::E,
+                typename G::ED,
+                minimize_allocations
+            >
+        > { {}, memory_budget }.find_max_path(g);
+    }
+}
+
+#endif //OFFBYNULL_ALIGNER_BACKTRACKERS_CHECKPOINTED_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_BACKTRACKER_H
@@ -0,0 +1,59 @@
+#ifndef OFFBYNULL_ALIGNER_BACKTRACKERS_CHECKPOINTED_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_BACKTRACKER_CONTAINER_CREATOR_PACK_H
+#define OFFBYNULL_ALIGNER_BACKTRACKERS_CHECKPOINTED_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_BACKTRACKER_CONTAINER_CREATOR_PACK_H
+
+#include <cstddef>
+#include "offbynull/aligner/backtrackers/sliceable_pairwise_alignment_graph_backtracker/backtrackable_node.h"
+#include "offbynull/aligner/backtrackers/sliceable_pairwise_alignment_graph_backtracker/backtrackable_edge.h"
+#include "offbynull/aligner/backtrackers/sliceable_pairwise_alignment_graph_backtracker/row_slot_container/slot.h"
+#include "offbynull/aligner/backtrackers/sliceable_pairwise_alignment_graph_backtracker/resident_slot_container/resident_slot_container_container_creator_pack.h"
+#include "offbynull/aligner/concepts.h"
+#include "offbynull/concepts.h"
+
+namespace offbynull::aligner::backtrackers::checkpointed_pairwise_alignment_graph_backtracker::backtracker_container_creator_pack {
+    using offbynull::aligner::concepts::weight;
+    using offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::backtrackable_node::backtrackable_node;
+    using offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::backtrackable_edge::backtrackable_edge;
+    using offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::row_slot_container::slot::slot;
+    using offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::resident_slot_container
+        ::resident_slot_container_container_creator_pack::resident_slot_container_container_creator_pack;
+    using offbynull::concepts::random_access_sequence_container;
+    using offbynull::concepts::unqualified_object_type;
+
+    /**
+     * Concept that's satisfied if `T` has the traits for creating the containers required by
+     * @ref offbynull::aligner::backtrackers::checkpointed_pairwise_alignment_graph_backtracker::backtracker::backtracker,
+     * referred to as a container creator pack.
+     *
+     * @tparam T Type to check.
+     * @tparam N Graph edge node identifier type.
+     * @tparam E Graph edge identifier type.
+     * @tparam ED Graph edge data type (edge weight).
+     */
+    template<
+        typename T,
+        typename N,
+        typename E,
+        typename ED
+    >
+    concept backtracker_container_creator_pack =
+        unqualified_object_type<T>
+        && backtrackable_node<N>
+        && backtrackable_edge<E>
+        && weight<ED>
+        && requires(
+            const T t,
+            std::size_t row_cnt,
+            std::size_t grid_right_cnt,
+            std::size_t grid_depth_cnt,
+            ED zero_weight,
+            std::size_t path_edge_capacity
+        ) {
+            { t.create_resident_slot_container_container_creator_pack() } -> resident_slot_container_container_creator_pack<N, E, ED>;
+            { t.create_row_slot_container(row_cnt, grid_right_cnt, grid_depth_cnt, zero_weight) } -> random_access_sequence_container<
+                slot<E, ED>
+            >;
+            { t.create_path_container(path_edge_capacity) } -> random_access_sequence_container<E>;
+        };
+}
+
+#endif //OFFBYNULL_ALIGNER_BACKTRACKERS_CHECKPOINTED_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_BACKTRACKER_CONTAINER_CREATOR_PACK_H
@@ -0,0 +1,84 @@
+#ifndef OFFBYNULL_ALIGNER_BACKTRACKERS_CHECKPOINTED_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_BACKTRACKER_HEAP_CONTAINER_CREATOR_PACK_H
+#define OFFBYNULL_ALIGNER_BACKTRACKERS_CHECKPOINTED_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_BACKTRACKER_HEAP_CONTAINER_CREATOR_PACK_H
+
+#include <vector>
+#include <cstddef>
+#include <optional>
+#include "offbynull/aligner/backtrackers/sliceable_pairwise_alignment_graph_backtracker/backtrackable_node.h"
+#include "offbynull/aligner/backtrackers/sliceable_pairwise_alignment_graph_backtracker/backtrackable_edge.h"
+#include "offbynull/aligner/backtrackers/sliceable_pairwise_alignment_graph_backtracker/row_slot_container/slot.h"
+#include "offbynull/aligner/backtrackers/sliceable_pairwise_alignment_graph_backtracker/resident_slot_container/resident_slot_container_heap_container_creator_pack.h"
+#include "offbynull/aligner/backtrackers/checkpointed_pairwise_alignment_graph_backtracker/unimplemented_backtracker_container_creator_pack.h"
+#include "offbynull/aligner/concepts.h"
+#include "offbynull/utils.h"
+
+namespace offbynull::aligner::backtrackers::checkpointed_pairwise_alignment_graph_backtracker::backtracker_heap_container_creator_pack {
+    using offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::backtrackable_node::backtrackable_node;
+    using offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::backtrackable_edge::backtrackable_edge;
+    using offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::row_slot_container::slot::slot;
+    using offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::resident_slot_container
+        ::resident_slot_container_heap_container_creator_pack::resident_slot_container_heap_container_creator_pack;
+    using offbynull::aligner::concepts::weight;
+    using offbynull::utils::check_multiplication_nonoverflow_throwable;
+
+    /**
+     * @ref offbynull::aligner::backtrackers::checkpointed_pairwise_alignment_graph_backtracker::backtracker_container_creator_pack::backtracker_container_creator_pack
+     * that allocates its containers on the heap.
+     *
+     * @tparam debug_mode `true` to enable debugging logic, `false` otherwise.
+     * @tparam N Graph node identifier type.
+     * @tparam E Graph edge identifier type.
+     * @tparam ED Graph edge data type (edge weight).
+     * @tparam minimize_allocations Primes certain containers with enough capacity such that adhoc reallocations aren't needed.
+     */
+    template<
+        bool debug_mode,
+        backtrackable_node N,
+        backtrackable_edge E,
+        weight ED,
+        bool minimize_allocations
+    >
+    struct backtracker_heap_container_creator_pack {
+        /**
+         * @copydoc offbynull::aligner::backtrackers::checkpointed_pairwise_alignment_graph_backtracker::unimplemented_backtracker_container_creator_pack::unimplemented_backtracker_container_creator_pack::create_resident_slot_container_container_creator_pack
+         */
+        resident_slot_container_heap_container_creator_pack<
+            debug_mode,
+            N,
+            E,
+            ED,
+            minimize_allocations
+        > create_resident_slot_container_container_creator_pack() const {
+            return {};
+        }
+
+        /**
+         * @copydoc offbynull::aligner::backtrackers::checkpointed_pairwise_alignment_graph_backtracker::unimplemented_backtracker_container_creator_pack::unimplemented_backtracker_container_creator_pack::create_row_slot_container
+         */
+        std::vector<slot<E, ED>> create_row_slot_container(
+            std::size_t row_cnt,
+            std::size_t grid_right_cnt,
+            std::size_t grid_depth_cnt,
+            ED zero_weight
+        ) const {
+            if constexpr (debug_mode) {
+                check_multiplication_nonoverflow_throwable<std::size_t>(row_cnt, grid_right_cnt, grid_depth_cnt);
+            }
+            std::size_t cnt { (row_cnt * grid_right_cnt) * grid_depth_cnt };
+            return std::vector<slot<E, ED>>(cnt, slot<E, ED> { std::nullopt, zero_weight });
+        }
+
+        /**
+         * @copydoc offbynull::aligner::backtrackers::checkpointed_pairwise_alignment_graph_backtracker::unimplemented_backtracker_container_creator_pack::unimplemented_backtracker_container_creator_pack::create_path_container
+         */
+        std::vector<E> create_path_container(std::size_t path_edge_capacity) const {
+            std::vector<E> ret {};
+            if constexpr (minimize_allocations) {
+                ret.reserve(path_edge_capacity);
+            }
+            return ret;
+        }
+    };
+}
+
+#endif //OFFBYNULL_ALIGNER_BACKTRACKERS_CHECKPOINTED_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_BACKTRACKER_HEAP_CONTAINER_CREATOR_PACK_H
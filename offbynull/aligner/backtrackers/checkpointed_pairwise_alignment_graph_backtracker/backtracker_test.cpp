@@ -0,0 +1,244 @@
+#include "offbynull/aligner/graphs/pairwise_global_alignment_graph.h"
+#include "offbynull/aligner/graphs/pairwise_local_alignment_graph.h"
+#include "offbynull/aligner/graphs/pairwise_overlap_alignment_graph.h"
+#include "offbynull/aligner/graphs/pairwise_fitting_alignment_graph.h"
+#include "offbynull/aligner/graphs/pairwise_extended_gap_alignment_graph.h"
+#include "offbynull/aligner/backtrackers/checkpointed_pairwise_alignment_graph_backtracker/backtracker.h"
+#include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/backtracker.h"
+#include "offbynull/aligner/scorers/simple_scorer.h"
+#include "offbynull/utils.h"
+#include "gtest/gtest.h"
+#include <cstddef>
+#include <stdfloat>
+#include <random>
+#include <string>
+#include <vector>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+namespace {
+    using offbynull::aligner::backtrackers::checkpointed_pairwise_alignment_graph_backtracker::backtracker::backtracker;
+    using offbynull::aligner::backtrackers::checkpointed_pairwise_alignment_graph_backtracker::backtracker::heap_find_max_path;
+    using offbynull::aligner::graphs::pairwise_global_alignment_graph::pairwise_global_alignment_graph;
+    using offbynull::aligner::graphs::pairwise_local_alignment_graph::pairwise_local_alignment_graph;
+    using offbynull::aligner::graphs::pairwise_overlap_alignment_graph::pairwise_overlap_alignment_graph;
+    using offbynull::aligner::graphs::pairwise_fitting_alignment_graph::pairwise_fitting_alignment_graph;
+    using offbynull::aligner::graphs::pairwise_extended_gap_alignment_graph::pairwise_extended_gap_alignment_graph;
+    using offbynull::aligner::scorers::simple_scorer::simple_scorer;
+    using offbynull::utils::copy_to_vector;
+    using offbynull::utils::is_debug_mode;
+
+    std::string random_sequence(std::mt19937_64& rand, std::size_t len) {
+        std::string ret {};
+        for (std::size_t i { 0zu }; i < len; ++i) {
+            ret += static_cast<char>('a' + rand() % 4zu);
+        }
+        return ret;
+    }
+
+    // Run with a range of budgets (every row checkpointed, minimum memory, and something in between) and make sure that the path found
+    // is a valid root-to-leaf path whose weight matches the one found by the full-matrix backtracker.
+    void check_against_full_matrix(const auto& g) {
+        using G = std::remove_cvref_t<decltype(g)>;
+        using E = typename G::E;
+        using ED = typename G::ED;
+        const auto& [expected_path, expected_weight] {
+            offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtracker::backtracker<
+                is_debug_mode(),
+                G,
+                std::size_t,
+                std::size_t
+            > {}.find_max_path(g)
+        };
+        for (std::size_t memory_budget : { std::numeric_limits<std::size_t>::max(), 0zu, 4096zu }) {
+            const auto& [path, weight] { backtracker<is_debug_mode(), G> { {}, memory_budget }.find_max_path(g) };
+            EXPECT_NEAR(weight, expected_weight, 0.000001f64);
+            const std::vector<E> path_vec { copy_to_vector(path) };
+            ASSERT_FALSE(path_vec.empty());
+            EXPECT_EQ(g.get_edge_from(path_vec.front()), g.get_root_node());
+            EXPECT_EQ(g.get_edge_to(path_vec.back()), g.get_leaf_node());
+            ED path_weight {};
+            for (std::size_t i { 0zu }; i < path_vec.size(); ++i) {
+                if (i > 0zu) {
+                    EXPECT_EQ(g.get_edge_to(path_vec[i - 1zu]), g.get_edge_from(path_vec[i]));
+                }
+                path_weight += g.get_edge_data(path_vec[i]);
+            }
+            EXPECT_NEAR(path_weight, weight, 0.000001f64);
+        }
+    }
+
+    TEST(OABCBacktrackerTest, CheckpointIntervalTest) {
+        using G = pairwise_global_alignment_graph<
+            is_debug_mode(),
+            std::size_t,
+            std::float64_t,
+            std::string,
+            std::string,
+            decltype(simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_substitution(1.0f64, -1.0f64)),
+            decltype(simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_gap(-1.0f64))
+        >;
+        using B = backtracker<is_debug_mode(), G>;
+        // Enough for every row (+1 extra row for the block) means checkpointing every row
+        EXPECT_EQ(B::checkpoint_interval(100zu, 1zu, 102zu), 1zu);
+        EXPECT_EQ(B::checkpoint_interval(100zu, 1zu, std::numeric_limits<std::size_t>::max()), 1zu);
+        // Minimum is 10 checkpoints + 10 block rows
+        EXPECT_EQ(B::checkpoint_interval(100zu, 1zu, 20zu), 10zu);
+        EXPECT_EQ(B::checkpoint_interval(100zu, 1zu, 0zu), 10zu);
+        // In between picks the smallest interval that fits
+        EXPECT_EQ(B::checkpoint_interval(100zu, 10zu, 270zu), 5zu);
+        EXPECT_EQ(B::checkpoint_interval(1zu, 1zu, 0zu), 1zu);
+    }
+
+    TEST(OABCBacktrackerTest, GlobalTest) {
+        auto substitution_scorer {
+            simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_substitution(1.0f64, -1.0f64)
+        };
+        auto gap_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_gap(-1.0f64) };
+        std::mt19937_64 rand { 12345 };
+        for (const auto& [len1, len2] : { std::pair { 1zu, 1zu }, std::pair { 0zu, 5zu }, std::pair { 70zu, 55zu } }) {
+            std::string seq1 { random_sequence(rand, len1) };
+            std::string seq2 { random_sequence(rand, len2) };
+            pairwise_global_alignment_graph<
+                is_debug_mode(),
+                std::size_t,
+                std::float64_t,
+                decltype(seq1),
+                decltype(seq2),
+                decltype(substitution_scorer),
+                decltype(gap_scorer)
+            > g {
+                seq1,
+                seq2,
+                substitution_scorer,
+                gap_scorer
+            };
+            check_against_full_matrix(g);
+        }
+    }
+
+    TEST(OABCBacktrackerTest, LocalTest) {
+        auto substitution_scorer {
+            simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_substitution(1.0f64, -1.0f64)
+        };
+        auto gap_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_gap(-1.0f64) };
+        auto freeride_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_freeride(0.0f64) };
+        std::string seq1 { "aaaaalmnaaaaa" };
+        std::string seq2 { "zzzzzlmnzzzzz" };
+        pairwise_local_alignment_graph<
+            is_debug_mode(),
+            std::size_t,
+            std::float64_t,
+            decltype(seq1),
+            decltype(seq2),
+            decltype(substitution_scorer),
+            decltype(gap_scorer),
+            decltype(freeride_scorer)
+        > g {
+            seq1,
+            seq2,
+            substitution_scorer,
+            gap_scorer,
+            freeride_scorer
+        };
+        using N = typename decltype(g)::N;
+        using E = typename decltype(g)::E;
+
+        const auto& [path, weight] { heap_find_max_path<is_debug_mode(), true>(g, 0zu) };
+        using offbynull::aligner::graphs::pairwise_local_alignment_graph::edge_type;
+        std::vector<E> expected_path {
+            E { edge_type::FREE_RIDE, { N { 0zu, 0zu }, N { 5zu, 5zu } } },
+            E { edge_type::NORMAL, { N { 5zu, 5zu }, N { 6zu, 6zu } } },
+            E { edge_type::NORMAL, { N { 6zu, 6zu }, N { 7zu, 7zu } } },
+            E { edge_type::NORMAL, { N { 7zu, 7zu }, N { 8zu, 8zu } } },
+            E { edge_type::FREE_RIDE, { N { 8zu, 8zu }, N { 13zu, 13zu } } }
+        };
+        EXPECT_EQ(expected_path, copy_to_vector(path));
+        EXPECT_EQ(weight, 3.0f64);
+
+        check_against_full_matrix(g);
+    }
+
+    TEST(OABCBacktrackerTest, OverlapAndFittingTest) {
+        auto substitution_scorer {
+            simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_substitution(1.0f64, -1.0f64)
+        };
+        auto gap_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_gap(-1.0f64) };
+        auto freeride_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_freeride(0.0f64) };
+        std::mt19937_64 rand { 54321 };
+        std::string seq1 { random_sequence(rand, 60zu) };
+        std::string seq2 { random_sequence(rand, 45zu) };
+        pairwise_overlap_alignment_graph<
+            is_debug_mode(),
+            std::size_t,
+            std::float64_t,
+            decltype(seq1),
+            decltype(seq2),
+            decltype(substitution_scorer),
+            decltype(gap_scorer),
+            decltype(freeride_scorer)
+        > overlap_g {
+            seq1,
+            seq2,
+            substitution_scorer,
+            gap_scorer,
+            freeride_scorer
+        };
+        check_against_full_matrix(overlap_g);
+        pairwise_fitting_alignment_graph<
+            is_debug_mode(),
+            std::size_t,
+            std::float64_t,
+            decltype(seq1),
+            decltype(seq2),
+            decltype(substitution_scorer),
+            decltype(gap_scorer),
+            decltype(freeride_scorer)
+        > fitting_g {
+            seq1,
+            seq2,
+            substitution_scorer,
+            gap_scorer,
+            freeride_scorer
+        };
+        check_against_full_matrix(fitting_g);
+    }
+
+    TEST(OABCBacktrackerTest, ExtendedGapTest) {
+        auto substitution_scorer {
+            simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_substitution(1.0f64, -1.0f64)
+        };
+        auto initial_gap_scorer {
+            simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_gap(-1.0f64)
+        };
+        auto extended_gap_scorer {
+            simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_gap(-0.1f64)
+        };
+        auto freeride_scorer {
+            simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_freeride(0.0f64)
+        };
+        std::mt19937_64 rand { 999 };
+        std::string seq1 { random_sequence(rand, 40zu) };
+        std::string seq2 { random_sequence(rand, 30zu) };
+        pairwise_extended_gap_alignment_graph<
+            is_debug_mode(),
+            std::size_t,
+            std::float64_t,
+            decltype(seq1),
+            decltype(seq2),
+            decltype(substitution_scorer),
+            decltype(initial_gap_scorer),
+            decltype(extended_gap_scorer),
+            decltype(freeride_scorer)
+        > g {
+            seq1,
+            seq2,
+            substitution_scorer,
+            initial_gap_scorer,
+            extended_gap_scorer,
+            freeride_scorer
+        };
+        check_against_full_matrix(g);
+    }
+}
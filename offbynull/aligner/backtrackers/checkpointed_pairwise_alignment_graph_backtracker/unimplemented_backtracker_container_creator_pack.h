@@ -0,0 +1,55 @@
+#ifndef OFFBYNULL_ALIGNER_BACKTRACKERS_CHECKPOINTED_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_UNIMPLEMENTED_BACKTRACKER_CONTAINER_CREATOR_PACK_H
+#define OFFBYNULL_ALIGNER_BACKTRACKERS_CHECKPOINTED_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_UNIMPLEMENTED_BACKTRACKER_CONTAINER_CREATOR_PACK_H
+
+#include <cstddef>
+
+namespace offbynull::aligner::backtrackers::checkpointed_pairwise_alignment_graph_backtracker
+        ::unimplemented_backtracker_container_creator_pack {
+
+    /**
+     * Unimplemented
+     * @ref offbynull::aligner::backtrackers::checkpointed_pairwise_alignment_graph_backtracker::backtracker_container_creator_pack::backtracker_container_creator_pack,
+     * intended for documentation.
+     */
+    struct unimplemented_backtracker_container_creator_pack {
+        /**
+         * Create
+         * @ref offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::resident_slot_container::resident_slot_container_container_creator_pack::resident_slot_container_container_creator_pack
+         * container creator pack.
+         *
+         * @return
+         *     @ref offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::resident_slot_container::resident_slot_container_container_creator_pack::resident_slot_container_container_creator_pack
+         *     container creator pack.
+         */
+        auto create_resident_slot_container_container_creator_pack() const;
+
+        /**
+         * Create container of
+         * @ref offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::row_slot_container::slot::slot "slots"
+         * for some number of rows, where each row holds a slot for every node within a row of the underlying graph (laid out one row after
+         * another).
+         *
+         * @param row_cnt Number of rows.
+         * @param grid_right_cnt Right dimension of underlying pairwise alignment graph instance.
+         * @param grid_depth_cnt Depth dimension of underlying pairwise alignment graph instance.
+         * @param zero_weight Initial weight, equivalent to 0 for numeric weights.
+         * @return Container sized to `row_cnt * grid_right_cnt * grid_depth_cnt` slots.
+         */
+        auto create_row_slot_container(
+            std::size_t row_cnt,
+            std::size_t grid_right_cnt,
+            std::size_t grid_depth_cnt,
+            auto zero_weight
+        ) const;
+
+        /**
+         * Create container that holds the edges of a path.
+         *
+         * @param path_edge_capacity Maximum number of edges the container can hold.
+         * @return Empty container.
+         */
+        auto create_path_container(std::size_t path_edge_capacity) const;
+    };
+}
+
+#endif //OFFBYNULL_ALIGNER_BACKTRACKERS_CHECKPOINTED_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_UNIMPLEMENTED_BACKTRACKER_CONTAINER_CREATOR_PACK_H
@@ -0,0 +1,323 @@
+#ifndef OFFBYNULL_ALIGNER_BACKTRACKERS_COMPACT_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_BACKTRACKER_H
+#define OFFBYNULL_ALIGNER_BACKTRACKERS_COMPACT_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_BACKTRACKER_H
+
+#include <cstddef>
+#include <ranges>
+#include <utility>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include "offbynull/aligner/backtrackers/compact_pairwise_alignment_graph_backtracker/concepts.h"
+#include "offbynull/aligner/backtrackers/compact_pairwise_alignment_graph_backtracker/backtracker_container_creator_pack.h"
+#include "offbynull/aligner/backtrackers/compact_pairwise_alignment_graph_backtracker/backtracker_heap_container_creator_pack.h"
+#include "offbynull/aligner/backtrackers/compact_pairwise_alignment_graph_backtracker/backtracker_stack_container_creator_pack.h"
+#include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/concepts.h"
+#include "offbynull/concepts.h"
+#include "offbynull/utils.h"
+
+namespace offbynull::aligner::backtrackers::compact_pairwise_alignment_graph_backtracker::backtracker {
+    using offbynull::aligner::backtrackers::compact_pairwise_alignment_graph_backtracker::concepts::compact_backtrackable_graph;
+    using offbynull::aligner::backtrackers::compact_pairwise_alignment_graph_backtracker::backtracker_container_creator_pack
+        ::backtracker_container_creator_pack;
+    using offbynull::aligner::backtrackers::compact_pairwise_alignment_graph_backtracker::backtracker_heap_container_creator_pack
+        ::backtracker_heap_container_creator_pack;
+    using offbynull::aligner::backtrackers::compact_pairwise_alignment_graph_backtracker::backtracker_stack_container_creator_pack
+        ::backtracker_stack_container_creator_pack;
+    using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::concepts::backtracking_result;
+    using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::concepts::backtracking_result_without_explicit_weight;
+    using offbynull::concepts::widenable_to_size_t;
+    using offbynull::utils::check_multiplication_nonoverflow_throwable;
+
+    /**
+     * Backtracker for @ref offbynull::aligner::graph::pairwise_alignment_graph::row_major_sweepable_pairwise_alignment_graph
+     * implementations that keeps its dynamic programming matrix in a compact structure-of-arrays layout. Results are identical to
+     * @ref offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtracker::backtracker (including which path is
+     * picked when multiple maximally-weighted paths exist).
+     *
+     * Rather than a slot per node holding the node, its backtracking edge, its accumulated weight, and its parent count, this backtracker
+     * holds 2 containers indexed by grid offset ...
+     *
+     *  * weights: each node's accumulated weight.
+     *  * codes: each node's backtracking code, which is the position of its backtracking edge within `get_inputs()`.
+     *
+     * Nodes aren't stored because they're implied by the index, and backtracking edges are re-derived from codes only for the nodes on
+     * the returned path. For a global alignment graph with `double` weights, each node takes up 9 bytes when `CODE` is `std::uint8_t`,
+     * compared to several times that for a slot. Consecutive nodes in a row are adjacent within both containers, such that sweeping the
+     * grid row-by-row reads and writes memory sequentially.
+     *
+     * The behavior of this class is undefined if `get_inputs()` doesn't return a node's incoming edges in the same order each time it's
+     * invoked.
+     *
+     * @tparam debug_mode `true` to enable debugging logic, `false` otherwise.
+     * @tparam G Graph type.
+     * @tparam CODE Backtracking code type. Must be wide enough to hold the maximum number of incoming edges across all nodes in the
+     *     underlying pairwise alignment graph instance (e.g., `std::uint8_t` is wide enough for global and extended gap alignment graphs,
+     *     but local, overlap, and fitting alignment graphs have free-ride edges that may require something wider).
+     * @tparam CONTAINER_CREATOR_PACK Container factory type.
+     */
+    template<
+        bool debug_mode,
+        compact_backtrackable_graph G,
+        widenable_to_size_t CODE,
+        backtracker_container_creator_pack<
+            typename G::E,
+            typename G::ED,
+            CODE
+        > CONTAINER_CREATOR_PACK = backtracker_heap_container_creator_pack<
+            debug_mode,
+            typename G::E,
+            typename G::ED,
+            CODE,
+            true
+        >
+    >
+    class backtracker {
+    public:
+        /** `G`'s node identifier type. */
+        using N = typename G::N;
+        /** `G`'s edge identifier type. */
+        using E = typename G::E;
+        /** `G`'s edge data type. */
+        using ED = typename G::ED;
+        /** `G`'s grid coordinate type. For example, `std::uint8_t` will allow up to 255 nodes on both the down and right axis. */
+        using N_INDEX = typename G::N_INDEX;
+
+        /**
+         * Path container type used by this backtracker implementation.
+         */
+        using PATH_CONTAINER = decltype(std::declval<CONTAINER_CREATOR_PACK>().create_path_container(0zu));
+
+    private:
+        using WEIGHT_CONTAINER = decltype(std::declval<CONTAINER_CREATOR_PACK>().create_weight_container(0zu, std::declval<ED>()));
+        using CODE_CONTAINER = decltype(std::declval<CONTAINER_CREATOR_PACK>().create_code_container(0zu));
+
+        static constexpr N_INDEX I0 { static_cast<N_INDEX>(0zu) };
+
+        /**
+         * Initial edge weight (e.g., 0).
+         */
+        ED zero_weight;
+
+        /**
+         * Container factory.
+         */
+        CONTAINER_CREATOR_PACK container_creator_pack;
+
+    public:
+        /**
+         * Construct an @ref offbynull::aligner::backtrackers::compact_pairwise_alignment_graph_backtracker::backtracker::backtracker
+         * instance.
+         *
+         * @param zero_weight_ Initial weight, equivalent to 0 for numeric weights. Defaults to `ED`'s default constructor, assuming it
+         *     exists.
+         * @param container_creator_pack_ Container factory.
+         */
+        backtracker(
+            ED zero_weight_ = {},
+            CONTAINER_CREATOR_PACK container_creator_pack_ = {}
+        )
+        : zero_weight { zero_weight_ }
+        , container_creator_pack { container_creator_pack_ } {}
+
+        /**
+         * Determine the maximally-weighted path (path with the highest sum of edge weights) connecting a pairwise alignment graph's root
+         * node and leaf node.
+         *
+         * If `g` contains edges with non-finite weights, the behavior of this function is undefined.
+         *
+         * @param g Graph.
+         * @return Maximally weighted path from `g`'s root node to `g`'s leaf node, along with that path's weight.
+         * @throws std::runtime_error If `CODE` isn't wide enough for `g.node_incoming_edge_capacity`, or if debug mode is enabled and the
+         *     number of nodes in `g` overflows `std::size_t`.
+         */
+        backtracking_result<ED> auto find_max_path(
+            const G& g
+        ) {
+            // node_incoming_edge_capacity is only known at runtime (e.g., it depends on sequence length for local / fitting / overlap
+            // graphs), so it can't be static_assert'd. Codes that are too narrow silently corrupt the backtrack, so always check it.
+            if (g.node_incoming_edge_capacity > 0zu
+                    && std::numeric_limits<CODE>::max() < g.node_incoming_edge_capacity - 1zu) {
+                throw std::runtime_error { "CODE not wide enough to support node_incoming_edge_capacity" };
+            }
+            if constexpr (debug_mode) {
+                check_multiplication_nonoverflow_throwable<std::size_t>(g.grid_down_cnt, g.grid_right_cnt, g.grid_depth_cnt);
+            }
+            const std::size_t cnt { to_size_t(g.grid_down_cnt) * to_size_t(g.grid_right_cnt) * to_size_t(g.grid_depth_cnt) };
+            WEIGHT_CONTAINER weights { container_creator_pack.create_weight_container(cnt, zero_weight) };
+            CODE_CONTAINER codes { container_creator_pack.create_code_container(cnt) };
+            populate_weights_and_codes(g, weights, codes);
+            auto path { backtrack(g, codes) };  // NOTE: Don't use const auto& or auto&& - can't end up as const due to std::move() below
+            const ED weight { weights[to_idx(g, g.get_leaf_node())] };
+            return std::make_pair(
+                std::move(path),
+                weight
+            );  // NOTE: No dangling issues - make_pair() stores values, not refs.
+        }
+
+    private:
+        static std::size_t to_size_t(const N_INDEX idx) {
+            return static_cast<std::size_t>(idx);
+        }
+
+        static std::size_t to_idx(const G& g, const N& node) {
+            const auto& [down, right, depth] { g.node_to_grid_offset(node) };
+            return ((to_size_t(down) * to_size_t(g.grid_right_cnt)) + to_size_t(right)) * to_size_t(g.grid_depth_cnt) + to_size_t(depth);
+        }
+
+        void populate_weights_and_codes(
+            const G& g,
+            WEIGHT_CONTAINER& weights,
+            CODE_CONTAINER& codes
+        ) {
+            // Sweep the grid row-by-row. Row-major order is a topological order of the graph, so a node's parents are always walked before
+            // the node itself. The root node sits at the first grid position, and since it has no parents, it keeps its initial weight.
+            for (N_INDEX grid_down { I0 }; grid_down < g.grid_down_cnt; ++grid_down) {
+                for (N_INDEX grid_right { I0 }; grid_right < g.grid_right_cnt; ++grid_right) {
+                    for (const N& node : g.grid_offset_to_nodes(grid_down, grid_right)) {
+                        // Pick the first incoming edge with the highest accumulated weight, which is how
+                        // pairwise_alignment_graph_backtracker's std::ranges::max_element() breaks ties.
+                        std::optional<std::pair<std::size_t, ED>> found {};
+                        std::size_t code { 0zu };
+                        for (const auto& edge : g.get_inputs(node)) {
+                            const ED& src_weight { weights[to_idx(g, g.get_edge_from(edge))] };
+                            ED weight { static_cast<ED>(src_weight + g.get_edge_data(edge)) };  // Cast to prevent narrowing warning
+                            if (!found.has_value() || (*found).second < weight) {
+                                found = { code, weight };
+                            }
+                            ++code;
+                        }
+                        if (found.has_value()) {  // if no incoming nodes found, it's a root node
+                            const std::size_t idx { to_idx(g, node) };
+                            codes[idx] = static_cast<CODE>((*found).first);
+                            weights[idx] = (*found).second;
+                        }
+                    }
+                }
+            }
+        }
+
+        auto backtrack(
+            const G& g,
+            const CODE_CONTAINER& codes
+        ) {
+            auto next_node { g.get_leaf_node() };
+            PATH_CONTAINER path {
+                container_creator_pack.create_path_container(
+                    g.path_edge_capacity
+                )
+            };
+            while (true) {
+                auto node { next_node };
+                if (!g.has_inputs(node)) {
+                    break;
+                }
+                // Reconstruct backtracking edge from code
+                auto inputs { g.get_inputs(node) };
+                auto it { inputs.begin() };
+                for (std::size_t i { 0zu }; i < static_cast<std::size_t>(codes[to_idx(g, node)]); ++i) {
+                    ++it;
+                }
+                if constexpr (debug_mode) {
+                    if (it == inputs.end()) {
+                        throw std::runtime_error { "Backtracking code out of bounds" };
+                    }
+                }
+                const E edge { *it };
+                path.push_back(edge);
+                next_node = g.get_edge_from(edge);
+            }
+            // At this point, path is in reverse order (from last to first). Reverse it (view) to get it into forward order.
+            return std::move(path) | std::views::reverse;
+        }
+    };
+
+    /**
+     * Helper function that constructs an
+     * @ref offbynull::aligner::backtrackers::compact_pairwise_alignment_graph_backtracker::backtracker::backtracker instance utilizing the
+     * heap for storage / computations and invokes `find_max_path(g)` on it.
+     *
+     * @tparam debug_mode `true` to enable debugging logic, `false` otherwise.
+     * @tparam CODE Backtracking code type. Must be wide enough to hold the maximum number of incoming edges across all nodes in `g`.
+     * @tparam minimize_allocations `true` to force the path container to reserve `g.path_edge_capacity` elements, thereby
+     *     removing/reducing the need for adhoc reallocations.
+     * @param g Graph.
+     * @return `find_max_path(g)` result.
+     */
+    template<
+        bool debug_mode,
+        widenable_to_size_t CODE,
+        bool minimize_allocations
+    >
+    backtracking_result_without_explicit_weight auto heap_find_max_path(
+        const compact_backtrackable_graph auto& g
+    ) {
+        using G = std::remove_cvref_t<decltype(g)>;
+        return backtracker<
+            debug_mode,
+            G,
+            CODE,
+            backtracker_heap_container_creator_pack<
+                debug_mode,
+                typename G::E,
+                typename G::ED,
+                CODE,
+                minimize_allocations
+            >
+        > {}.find_max_path(g);
+    }
+
+    /**
+     * Helper function that constructs an
+     * @ref offbynull::aligner::backtrackers::compact_pairwise_alignment_graph_backtracker::backtracker::backtracker instance utilizing the
+     * stack for storage / computations and invokes `find_max_path(g)` on it.
+     *
+     * @tparam debug_mode `true` to enable debugging logic, `false` otherwise.
+     * @tparam CODE Backtracking code type. Must be wide enough to hold the maximum number of incoming edges across all nodes in `g`.
+     * @tparam grid_down_cnt `g`'s down dimension of the underlying pairwise alignment graph instance.
+     * @tparam grid_right_cnt `g`'s right dimension of the underlying pairwise alignment graph instance.
+     * @tparam grid_depth_cnt `g'`s depth dimension of the underlying pairwise alignment graph instance.
+     * @tparam path_edge_capacity Of all paths between root and leaf within `g`, the maximum number of edges.
+     * @param g Graph.
+     * @return `find_max_path(g)` result.
+     */
+    template<
+        bool debug_mode,
+        widenable_to_size_t CODE,
+        std::size_t grid_down_cnt,
+        std::size_t grid_right_cnt,
+        std::size_t grid_depth_cnt,
+        std::size_t path_edge_capacity
+    >
+    backtracking_result_without_explicit_weight auto stack_find_max_path(
+        const compact_backtrackable_graph auto& g
+    ) {
+        using G = std::remove_cvref_t<decltype(g)>;
+        if constexpr (debug_mode) {
+            if (g.grid_down_cnt != grid_down_cnt
+                || g.grid_right_cnt != grid_right_cnt
+                || g.grid_depth_cnt != grid_depth_cnt
+                || g.path_edge_capacity != path_edge_capacity) {
+                throw std::runtime_error { "Unexpected graph dimensions" };
+            }
+        }
+        return backtracker<
+            debug_mode,
+            G,
+            CODE,
+            backtracker_stack_container_creator_pack<
+                debug_mode,
+                typename G::E,
+                typename G::ED,
+                CODE,
+                grid_down_cnt,
+                grid_right_cnt,
+                grid_depth_cnt,
+                path_edge_capacity
+            >
+        > {}.find_max_path(g);
+    }
+}
+
+#endif //OFFBYNULL_ALIGNER_BACKTRACKERS_COMPACT_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_BACKTRACKER_H
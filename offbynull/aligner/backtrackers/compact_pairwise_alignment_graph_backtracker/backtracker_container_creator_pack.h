@@ -0,0 +1,45 @@
+#ifndef OFFBYNULL_ALIGNER_BACKTRACKERS_COMPACT_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_BACKTRACKER_CONTAINER_CREATOR_PACK_H
+#define OFFBYNULL_ALIGNER_BACKTRACKERS_COMPACT_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_BACKTRACKER_CONTAINER_CREATOR_PACK_H
+
+#include <cstddef>
+#include "offbynull/aligner/concepts.h"
+#include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/backtrackable_edge.h"
+#include "offbynull/concepts.h"
+
+namespace offbynull::aligner::backtrackers::compact_pairwise_alignment_graph_backtracker::backtracker_container_creator_pack {
+    using offbynull::aligner::concepts::weight;
+    using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtrackable_edge::backtrackable_edge;
+    using offbynull::concepts::widenable_to_size_t;
+    using offbynull::concepts::random_access_sequence_container;
+    using offbynull::concepts::unqualified_object_type;
+
+    /**
+     * Concept that's satisfied if `T` has the traits for creating the containers required by
+     * @ref offbynull::aligner::backtrackers::compact_pairwise_alignment_graph_backtracker::backtracker::backtracker, referred to as a
+     * container creator pack.
+     *
+     * @tparam T Type to check.
+     * @tparam E Graph edge identifier type.
+     * @tparam ED Graph edge data type (edge weight).
+     * @tparam CODE Backtracking code type. Must be wide enough to hold the maximum number of incoming edges across all nodes in the
+     *     underlying pairwise alignment graph instance.
+     */
+    template<
+        typename T,
+        typename E,
+        typename ED,
+        typename CODE
+    >
+    concept backtracker_container_creator_pack =
+        unqualified_object_type<T>
+        && backtrackable_edge<E>
+        && weight<ED>
+        && widenable_to_size_t<CODE>
+        && requires(const T t, std::size_t cnt, ED zero_weight, std::size_t path_edge_capacity) {
+            { t.create_weight_container(cnt, zero_weight) } -> random_access_sequence_container<ED>;
+            { t.create_code_container(cnt) } -> random_access_sequence_container<CODE>;
+            { t.create_path_container(path_edge_capacity) } -> random_access_sequence_container<E>;
+        };
+}
+
+#endif //OFFBYNULL_ALIGNER_BACKTRACKERS_COMPACT_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_BACKTRACKER_CONTAINER_CREATOR_PACK_H
@@ -0,0 +1,94 @@
+#ifndef OFFBYNULL_ALIGNER_BACKTRACKERS_COMPACT_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_BACKTRACKER_STACK_CONTAINER_CREATOR_PACK_H
+#define OFFBYNULL_ALIGNER_BACKTRACKERS_COMPACT_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_BACKTRACKER_STACK_CONTAINER_CREATOR_PACK_H
+
+#include <cstddef>
+#include <stdexcept>
+#include "offbynull/aligner/concepts.h"
+#include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/backtrackable_edge.h"
+#include "offbynull/aligner/backtrackers/compact_pairwise_alignment_graph_backtracker/unimplemented_backtracker_container_creator_pack.h"
+#include "offbynull/concepts.h"
+#include "offbynull/utils.h"
+
+namespace offbynull::aligner::backtrackers::compact_pairwise_alignment_graph_backtracker::backtracker_stack_container_creator_pack {
+    using offbynull::aligner::concepts::weight;
+    using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtrackable_edge::backtrackable_edge;
+    using offbynull::concepts::widenable_to_size_t;
+    using offbynull::utils::static_vector_typer;
+
+    /**
+     * @ref offbynull::aligner::backtrackers::compact_pairwise_alignment_graph_backtracker::backtracker_container_creator_pack::backtracker_container_creator_pack
+     * that allocates its containers on the stack.
+     *
+     * @tparam debug_mode `true` to enable debugging logic, `false` otherwise.
+     * @tparam E Graph edge identifier type.
+     * @tparam ED Graph edge data type (edge weight).
+     * @tparam CODE Backtracking code type. Must be wide enough to hold the maximum number of incoming edges across all nodes in the
+     *     underlying pairwise alignment graph instance.
+     * @tparam grid_down_cnt Expected down dimension of the underlying pairwise alignment graph instance.
+     * @tparam grid_right_cnt Expected right dimension of the underlying pairwise alignment graph instance.
+     * @tparam grid_depth_cnt Expected depth dimension of the underlying pairwise alignment graph instance.
+     * @tparam path_edge_capacity Of all paths between root and leaf within the underlying pairwise alignment graph, the maximum number of
+     *     edges.
+     */
+    template<
+        bool debug_mode,
+        backtrackable_edge E,
+        weight ED,
+        widenable_to_size_t CODE,
+        std::size_t grid_down_cnt,
+        std::size_t grid_right_cnt,
+        std::size_t grid_depth_cnt,
+        std::size_t path_edge_capacity
+    >
+    struct backtracker_stack_container_creator_pack {
+        /** Number of nodes in the underlying pairwise alignment graph (one weight and one code per node). */
+        static constexpr std::size_t ELEM_COUNT { grid_down_cnt * grid_right_cnt * grid_depth_cnt };
+
+        /** `create_weight_container()` return type. */
+        using WEIGHT_CONTAINER_TYPE = typename static_vector_typer<debug_mode, ED, ELEM_COUNT>::type;
+
+        /**
+         * @copydoc offbynull::aligner::backtrackers::compact_pairwise_alignment_graph_backtracker::unimplemented_backtracker_container_creator_pack::unimplemented_backtracker_container_creator_pack::create_weight_container
+         */
+        WEIGHT_CONTAINER_TYPE create_weight_container(std::size_t cnt, ED zero_weight) const {
+            if constexpr (debug_mode) {
+                if (cnt > ELEM_COUNT) {
+                    throw std::runtime_error { "Bad element count" };
+                }
+            }
+            return WEIGHT_CONTAINER_TYPE(cnt, zero_weight);
+        }
+
+        /** `create_code_container()` return type. */
+        using CODE_CONTAINER_TYPE = typename static_vector_typer<debug_mode, CODE, ELEM_COUNT>::type;
+
+        /**
+         * @copydoc offbynull::aligner::backtrackers::compact_pairwise_alignment_graph_backtracker::unimplemented_backtracker_container_creator_pack::unimplemented_backtracker_container_creator_pack::create_code_container
+         */
+        CODE_CONTAINER_TYPE create_code_container(std::size_t cnt) const {
+            if constexpr (debug_mode) {
+                if (cnt > ELEM_COUNT) {
+                    throw std::runtime_error { "Bad element count" };
+                }
+            }
+            return CODE_CONTAINER_TYPE(cnt);
+        }
+
+        /** `create_path_container()` return type. */
+        using PATH_CONTAINER_TYPE = typename static_vector_typer<debug_mode, E, path_edge_capacity>::type;
+
+        /**
+         * @copydoc offbynull::aligner::backtrackers::compact_pairwise_alignment_graph_backtracker::unimplemented_backtracker_container_creator_pack::unimplemented_backtracker_container_creator_pack::create_path_container
+         */
+        PATH_CONTAINER_TYPE create_path_container(std::size_t path_edge_capacity_) const {
+            if constexpr (debug_mode) {
+                if (path_edge_capacity_ > path_edge_capacity) {
+                    throw std::runtime_error { "Path edge capacity too large" };
+                }
+            }
+            return {};
+        }
+    };
+}
+
+#endif //OFFBYNULL_ALIGNER_BACKTRACKERS_COMPACT_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_BACKTRACKER_STACK_CONTAINER_CREATOR_PACK_H
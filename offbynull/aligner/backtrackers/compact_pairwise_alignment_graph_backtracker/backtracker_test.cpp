@@ -0,0 +1,279 @@
+#include "offbynull/aligner/graphs/pairwise_global_alignment_graph.h"
+#include "offbynull/aligner/graphs/pairwise_local_alignment_graph.h"
+#include "offbynull/aligner/graphs/pairwise_overlap_alignment_graph.h"
+#include "offbynull/aligner/graphs/pairwise_fitting_alignment_graph.h"
+#include "offbynull/aligner/graphs/pairwise_extended_gap_alignment_graph.h"
+#include "offbynull/aligner/backtrackers/compact_pairwise_alignment_graph_backtracker/backtracker.h"
+#include "offbynull/aligner/backtrackers/compact_pairwise_alignment_graph_backtracker/concepts.h"
+#include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/backtracker.h"
+#include "offbynull/aligner/scorers/simple_scorer.h"
+#include "offbynull/utils.h"
+#include "gtest/gtest.h"
+#include <cstddef>
+#include <cstdint>
+#include <stdfloat>
+#include <string>
+#include <vector>
+#include <random>
+#include <stdexcept>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+namespace {
+    using offbynull::aligner::backtrackers::compact_pairwise_alignment_graph_backtracker::backtracker::backtracker;
+    using offbynull::aligner::backtrackers::compact_pairwise_alignment_graph_backtracker::backtracker::heap_find_max_path;
+    using offbynull::aligner::backtrackers::compact_pairwise_alignment_graph_backtracker::backtracker::stack_find_max_path;
+    using offbynull::aligner::backtrackers::compact_pairwise_alignment_graph_backtracker::concepts::compact_backtrackable_graph;
+    using offbynull::aligner::graphs::pairwise_global_alignment_graph::pairwise_global_alignment_graph;
+    using offbynull::aligner::graphs::pairwise_global_alignment_graph::create_pairwise_global_alignment_graph;
+    using offbynull::aligner::graphs::pairwise_local_alignment_graph::pairwise_local_alignment_graph;
+    using offbynull::aligner::graphs::pairwise_local_alignment_graph::create_pairwise_local_alignment_graph;
+    using offbynull::aligner::graphs::pairwise_overlap_alignment_graph::create_pairwise_overlap_alignment_graph;
+    using offbynull::aligner::graphs::pairwise_fitting_alignment_graph::create_pairwise_fitting_alignment_graph;
+    using offbynull::aligner::graphs::pairwise_extended_gap_alignment_graph::pairwise_extended_gap_alignment_graph;
+    using offbynull::aligner::graphs::pairwise_extended_gap_alignment_graph::create_pairwise_extended_gap_alignment_graph;
+    using offbynull::aligner::scorers::simple_scorer::simple_scorer;
+    using offbynull::utils::copy_to_vector;
+    using offbynull::utils::is_debug_mode;
+
+    auto expected_max_path(const auto& g) {
+        using G = std::remove_cvref_t<decltype(g)>;
+        const auto& [path, weight] {
+            offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtracker::backtracker<
+                is_debug_mode(),
+                G,
+                std::size_t,
+                std::size_t
+            > {}.find_max_path(g)
+        };
+        return std::make_pair(copy_to_vector(path), weight);
+    }
+
+    template<typename CODE>
+    auto actual_max_path(const auto& g) {
+        using G = std::remove_cvref_t<decltype(g)>;
+        const auto& [path, weight] {
+            backtracker<
+                is_debug_mode(),
+                G,
+                CODE
+            > {}.find_max_path(g)
+        };
+        return std::make_pair(copy_to_vector(path), weight);
+    }
+
+    TEST(OABCBacktrackerTest, ConceptCheck) {
+        auto substitution_scorer {
+            simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_substitution(1.0f64, -1.0f64)
+        };
+        auto gap_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_gap(0.0f64) };
+        auto freeride_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_freeride() };
+        using G1 = pairwise_global_alignment_graph<
+            is_debug_mode(),
+            std::size_t,
+            std::float64_t,
+            std::string,
+            std::string,
+            decltype(substitution_scorer),
+            decltype(gap_scorer)
+        >;
+        static_assert(compact_backtrackable_graph<G1>);
+        using G2 = pairwise_extended_gap_alignment_graph<
+            is_debug_mode(),
+            std::size_t,
+            std::float64_t,
+            std::string,
+            std::string,
+            decltype(substitution_scorer),
+            decltype(gap_scorer),
+            decltype(gap_scorer),
+            decltype(freeride_scorer)
+        >;
+        static_assert(compact_backtrackable_graph<G2>);
+    }
+
+    TEST(OABCBacktrackerTest, FindMaxPathViaHelpers) {
+        auto substitution_scorer {
+            simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_substitution(1.0f64, -1.0f64)
+        };
+        auto gap_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_gap(0.0f64) };
+
+        std::string seq1 { "a" };
+        std::string seq2 { "ac" };
+        pairwise_global_alignment_graph<
+            is_debug_mode(),
+            std::size_t,
+            std::float64_t,
+            decltype(seq1),
+            decltype(seq2),
+            decltype(substitution_scorer),
+            decltype(gap_scorer)
+        > g {
+            seq1,
+            seq2,
+            substitution_scorer,
+            gap_scorer
+        };
+
+        using E = decltype(g)::E;
+
+        {
+            const auto& [path, weight] { heap_find_max_path<is_debug_mode(), std::uint8_t, true>(g) };
+            EXPECT_EQ(
+                copy_to_vector(path),
+                (std::vector<E> {
+                    E { { 0zu, 0zu }, { 1zu, 1zu } },
+                    E { { 1zu, 1zu }, { 1zu, 2zu } }
+                })
+            );
+            EXPECT_EQ(weight, 1.0);
+        }
+        {
+            const auto& [path, weight] {
+                stack_find_max_path<
+                    is_debug_mode(),
+                    std::uint8_t,
+                    2zu /*grid_down_cnt*/,
+                    3zu /*grid_right_cnt*/,
+                    1zu /*grid_depth_cnt*/,
+                    (2zu - 1zu) + (3zu - 1zu) /*path_edge_capacity*/
+                >(g)
+            };
+            EXPECT_EQ(
+                copy_to_vector(path),
+                (std::vector<E> {
+                    E { { 0zu, 0zu }, { 1zu, 1zu } },
+                    E { { 1zu, 1zu }, { 1zu, 2zu } }
+                })
+            );
+            EXPECT_EQ(weight, 1.0);
+        }
+    }
+
+    TEST(OABCBacktrackerTest, RandomizedTestingAgainstReadyQueueBacktracker) {
+        std::mt19937_64 rand { 12345 };
+        auto random_integer { [&](auto a, auto b) -> decltype(a) { return std::uniform_int_distribution<decltype(a)>(a,b)(rand); } };
+        auto random_string {
+            [&](std::size_t max_len) {
+                std::string ret {};
+                for ([[maybe_unused]] auto _ : std::views::iota(0zu, random_integer(1zu, max_len))) {
+                    ret += random_integer('a', 'd');
+                }
+                return ret;
+            }
+        };
+        for ([[maybe_unused]] auto _ : std::views::iota(0u, 250u)) {
+            // Integer weights from a tiny range to force lots of ties, making sure ties get broken the same way
+            auto substitution_scorer {
+                simple_scorer<is_debug_mode(), std::size_t, char, char, std::int32_t>::create_substitution(
+                    random_integer(-2, 2),
+                    random_integer(-2, 2)
+                )
+            };
+            auto gap_scorer {
+                simple_scorer<is_debug_mode(), std::size_t, char, char, std::int32_t>::create_gap(random_integer(-2, 2))
+            };
+            auto freeride_scorer {
+                simple_scorer<is_debug_mode(), std::size_t, char, char, std::int32_t>::create_freeride(random_integer(-2, 2))
+            };
+            std::string seq1 { random_string(12zu) };
+            std::string seq2 { random_string(12zu) };
+            {
+                auto g {
+                    create_pairwise_global_alignment_graph<is_debug_mode(), std::size_t>(seq1, seq2, substitution_scorer, gap_scorer)
+                };
+                EXPECT_EQ(expected_max_path(g), actual_max_path<std::uint8_t>(g));
+            }
+            // Free-ride edges mean the leaf node (or root node's children) may have more incoming edges than std::uint8_t can count
+            {
+                auto g {
+                    create_pairwise_local_alignment_graph<is_debug_mode(), std::size_t>(
+                        seq1, seq2, substitution_scorer, gap_scorer, freeride_scorer
+                    )
+                };
+                EXPECT_EQ(expected_max_path(g), actual_max_path<std::uint16_t>(g));
+            }
+            {
+                auto g {
+                    create_pairwise_overlap_alignment_graph<is_debug_mode(), std::size_t>(
+                        seq1, seq2, substitution_scorer, gap_scorer, freeride_scorer
+                    )
+                };
+                EXPECT_EQ(expected_max_path(g), actual_max_path<std::uint16_t>(g));
+            }
+            {
+                auto g {
+                    create_pairwise_fitting_alignment_graph<is_debug_mode(), std::size_t>(
+                        seq1, seq2, substitution_scorer, gap_scorer, freeride_scorer
+                    )
+                };
+                EXPECT_EQ(expected_max_path(g), actual_max_path<std::uint16_t>(g));
+            }
+        }
+    }
+
+    TEST(OABCBacktrackerTest, RandomizedExtendedGapTestingAgainstReadyQueueBacktracker) {
+        std::mt19937_64 rand { 12345 };
+        auto random_integer { [&](auto a, auto b) -> decltype(a) { return std::uniform_int_distribution<decltype(a)>(a,b)(rand); } };
+        auto random_string {
+            [&](std::size_t max_len) {
+                std::string ret {};
+                for ([[maybe_unused]] auto _ : std::views::iota(0zu, random_integer(1zu, max_len))) {
+                    ret += random_integer('a', 'd');
+                }
+                return ret;
+            }
+        };
+        for ([[maybe_unused]] auto _ : std::views::iota(0u, 250u)) {
+            auto substitution_scorer {
+                simple_scorer<is_debug_mode(), std::size_t, char, char, std::int32_t>::create_substitution(
+                    random_integer(-2, 2),
+                    random_integer(-2, 2)
+                )
+            };
+            auto initial_gap_scorer {
+                simple_scorer<is_debug_mode(), std::size_t, char, char, std::int32_t>::create_gap(random_integer(-2, 2))
+            };
+            auto extended_gap_scorer {
+                simple_scorer<is_debug_mode(), std::size_t, char, char, std::int32_t>::create_gap(random_integer(-2, 2))
+            };
+            auto freeride_scorer {
+                simple_scorer<is_debug_mode(), std::size_t, char, char, std::int32_t>::create_freeride(random_integer(-2, 2))
+            };
+            std::string seq1 { random_string(12zu) };
+            std::string seq2 { random_string(12zu) };
+            auto g {
+                create_pairwise_extended_gap_alignment_graph<is_debug_mode(), std::size_t>(
+                    seq1, seq2, substitution_scorer, initial_gap_scorer, extended_gap_scorer, freeride_scorer
+                )
+            };
+            EXPECT_EQ(expected_max_path(g), actual_max_path<std::uint8_t>(g));
+        }
+    }
+
+    TEST(OABCBacktrackerTest, NarrowCodeThrowsRegardlessOfDebugMode) {
+        auto substitution_scorer {
+            simple_scorer<is_debug_mode(), std::size_t, char, char, std::int32_t>::create_substitution(1, -1)
+        };
+        auto gap_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, std::int32_t>::create_gap(0) };
+        auto freeride_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, std::int32_t>::create_freeride(0) };
+        std::string seq1 { std::string(20zu, 'a') };
+        std::string seq2 { std::string(20zu, 'c') };
+        // Leaf node takes in a free-ride edge from every other node, which is more than std::uint8_t can count
+        using G = pairwise_local_alignment_graph<
+            is_debug_mode(),
+            std::size_t,
+            std::int32_t,
+            decltype(seq1),
+            decltype(seq2),
+            decltype(substitution_scorer),
+            decltype(gap_scorer),
+            decltype(freeride_scorer)
+        >;
+        G g { seq1, seq2, substitution_scorer, gap_scorer, freeride_scorer };
+        EXPECT_THROW((backtracker<false, G, std::uint8_t> {}.find_max_path(g)), std::runtime_error);
+        EXPECT_THROW((backtracker<true, G, std::uint8_t> {}.find_max_path(g)), std::runtime_error);
+        EXPECT_NO_THROW((backtracker<false, G, std::uint16_t> {}.find_max_path(g)));
+    }
+}
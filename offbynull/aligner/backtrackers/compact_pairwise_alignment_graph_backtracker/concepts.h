@@ -0,0 +1,29 @@
+#ifndef OFFBYNULL_ALIGNER_BACKTRACKERS_COMPACT_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_CONCEPTS_H
+#define OFFBYNULL_ALIGNER_BACKTRACKERS_COMPACT_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_CONCEPTS_H
+
+#include "offbynull/aligner/graph/pairwise_alignment_graph.h"
+#include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/backtrackable_node.h"
+#include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/backtrackable_edge.h"
+
+namespace offbynull::aligner::backtrackers::compact_pairwise_alignment_graph_backtracker::concepts {
+    using offbynull::aligner::graph::pairwise_alignment_graph::row_major_sweepable_pairwise_alignment_graph;
+    using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtrackable_node::backtrackable_node;
+    using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtrackable_edge::backtrackable_edge;
+
+    /**
+     * Concept that's satisfied if `G` can be walked by
+     * @ref offbynull::aligner::backtrackers::compact_pairwise_alignment_graph_backtracker::backtracker::backtracker. That is, `G` is a
+     * @ref offbynull::aligner::graph::pairwise_alignment_graph::row_major_sweepable_pairwise_alignment_graph (e.g., global, local,
+     * overlap, fitting, and extended gap alignment graphs), such that each node's slot can be found from its grid offset and the walk
+     * order is known without tracking each node's parents.
+     *
+     * @tparam G Type to check.
+     */
+    template<typename G>
+    concept compact_backtrackable_graph =
+        row_major_sweepable_pairwise_alignment_graph<G>
+        && backtrackable_node<typename G::N>
+        && backtrackable_edge<typename G::E>;
+}
+
+#endif //OFFBYNULL_ALIGNER_BACKTRACKERS_COMPACT_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_CONCEPTS_H
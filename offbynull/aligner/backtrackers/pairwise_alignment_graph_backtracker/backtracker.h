@@ -7,8 +7,13 @@
 #include <utility>
 #include <functional>
 #include <limits>
+#include <optional>
 #include <stdexcept>
+#include <tuple>
 #include <type_traits>
+#include <atomic>
+#include <future>
+#include <exception>
 #include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/backtrackable_node.h"
 #include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/backtrackable_edge.h"
 #include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/backtracker_container_creator_pack.h"
@@ -16,13 +21,18 @@
 #include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/backtracker_stack_container_creator_pack.h"
 #include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/ready_queue/ready_queue.h"
 #include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/slot_container/slot.h"
+#include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/slot_container/sweep_slot.h"
 #include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/slot_container/slot_container.h"
 #include "offbynull/aligner/graph/pairwise_alignment_graph.h"
+#include "offbynull/aligner/graph/sliceable_pairwise_alignment_graph.h"
 #include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/concepts.h"
 #include "offbynull/concepts.h"
+#include "offbynull/helpers/forkable_thread_pool.h"
 
 namespace offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtracker {
     using offbynull::aligner::graph::pairwise_alignment_graph::pairwise_alignment_graph;
+    using offbynull::aligner::graph::pairwise_alignment_graph::row_major_sweepable_pairwise_alignment_graph;
+    using offbynull::aligner::graph::sliceable_pairwise_alignment_graph::sliceable_pairwise_alignment_graph;
     using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtrackable_node::backtrackable_node;
     using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtrackable_edge::backtrackable_edge;
     using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtracker_container_creator_pack
@@ -32,11 +42,13 @@ namespace offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker
     using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtracker_stack_container_creator_pack
         ::backtracker_stack_container_creator_pack;
     using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::slot_container::slot::slot;
+    using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::slot_container::sweep_slot::sweep_slot;
     using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::slot_container::slot_container::slot_container;
     using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::ready_queue::ready_queue::ready_queue;
     using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::concepts::backtracking_result;
     using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::concepts::backtracking_result_without_explicit_weight;
     using offbynull::concepts::widenable_to_size_t;
+    using offbynull::helpers::forkable_thread_pool::forkable_thread_pool;
 
     /**
      * Backtracker for @ref offbynull::aligner::graph::pairwise_alignment_graph::pairwise_alignment_graph implementations. A
@@ -45,11 +57,18 @@ namespace offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker
      * backtracking algorithm, see
      * https://offbynull.com/docs/data/learn/Bioinformatics/output/output.html#H_Backtrack%20Algorithm.
      *
+     * If `G` satisfies @ref offbynull::aligner::graph::pairwise_alignment_graph::row_major_sweepable_pairwise_alignment_graph, nodes are
+     * walked by sweeping the grid in square tiles of `tile_size` x `tile_size` grid positions (tiles row-by-row, and within each tile,
+     * positions row-by-row). Tiling keeps the slots a node reads from (the tile's previous row and the neighbouring tiles' boundaries)
+     * within a small working set, rather than the entire previous row of the grid, so large grids don't thrash the CPU cache. Otherwise,
+     * nodes are walked as they become ready, which requires first counting each node's parents (`PARENT_COUNT`) and then queueing nodes
+     * whose parents have all been walked.
+     *
      * @tparam debug_mode `true` to enable debugging logic, `false` otherwise.
      * @tparam G Graph type.
      * @tparam PARENT_COUNT Graph node incoming edge counter type. Must be wide enough to hold the maximum number of incoming edges across
      *      all nodes in the underlying pairwise alignment graph instance (e.g., across all nodes in any global pairwise alignment graph, a
-     *      node can have at most 3 incoming edges).
+     *      node can have at most 3 incoming edges). Unused if `G` is row-major sweepable (slots don't hold a parent count in that case).
      * @tparam SLOT_INDEX Slot indexer type. Must be wide enough to hold the value `grid_down_cnt * grid_right_cnt * grid_depth_cnt`
      *     (variables being multiplied are the dimensions of the `G` instance).
      * @tparam CONTAINER_CREATOR_PACK Container factory type.
@@ -94,11 +113,22 @@ namespace offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker
          */
         using SLOT_CONTAINER_CONTAINER_CREATOR_PACK =
             decltype(std::declval<CONTAINER_CREATOR_PACK>().create_slot_container_container_creator_pack());
+        /**
+         * Slot type used by this backtracker implementation:
+         * @ref offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::slot_container::sweep_slot::sweep_slot if `G` is
+         * row-major sweepable (nodes are walked in a known order, so parent counts aren't needed),
+         * @ref offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::slot_container::slot::slot otherwise.
+         */
+        using SLOT = std::conditional_t<
+            row_major_sweepable_pairwise_alignment_graph<G>,
+            sweep_slot<N, E, ED>,
+            slot<N, E, ED, PARENT_COUNT>
+        >;
         /**
          * @ref offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::slot_container::slot_container::slot_container type
          * used by this backtracker implementation.
          */
-        using SLOT_CONTAINER = slot_container<debug_mode, G, PARENT_COUNT, SLOT_INDEX, SLOT_CONTAINER_CONTAINER_CREATOR_PACK>;
+        using SLOT_CONTAINER = slot_container<debug_mode, G, PARENT_COUNT, SLOT_INDEX, SLOT_CONTAINER_CONTAINER_CREATOR_PACK, SLOT>;
         /**
          * @ref offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::ready_queue::ready_queue::ready_queue container
          * factory type used by this backtracker implementation.
@@ -114,6 +144,18 @@ namespace offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker
          * Path container type used by this backtracker implementation.
          */
         using PATH_CONTAINER = decltype(std::declval<CONTAINER_CREATOR_PACK>().create_path_container(0zu));
+        /**
+         * Container type used by this backtracker implementation to count the unwalked dependencies of each tile when walking in
+         * parallel.
+         */
+        using TILE_DEPENDENCY_COUNT_CONTAINER =
+            decltype(std::declval<CONTAINER_CREATOR_PACK>().create_tile_dependency_count_container(0zu));
+        /**
+         * Container type used by this backtracker implementation to hold tiles that a thread has to walk itself when walking in
+         * parallel.
+         */
+        using PENDING_TILE_INDEX_CONTAINER =
+            decltype(std::declval<CONTAINER_CREATOR_PACK>().create_pending_tile_index_container(0zu, 0zu));
 
     private:
         static constexpr PARENT_COUNT PC0 { static_cast<PARENT_COUNT>(0zu) };
@@ -129,20 +171,41 @@ namespace offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker
          */
         CONTAINER_CREATOR_PACK container_creator_pack;
 
+        /**
+         * Width and height (in grid positions) of the tiles that row-major sweepable graphs are walked in.
+         */
+        std::size_t tile_size;
+
     public:
+        /**
+         * Default tile width and height. Slots for a tile's row fit comfortably within the L1 / L2 caches of most CPUs.
+         */
+        static constexpr std::size_t default_tile_size { 128zu };
+
         /**
          * Construct an @ref offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtracker::backtracker instance.
          *
          * @param zero_weight_ Initial weight, equivalent to 0 for numeric weights. Defaults to `ED`'s default constructor, assuming it
          *     exists.
          * @param container_creator_pack_ Container factory.
+         * @param tile_size_ Width and height (in grid positions) of the tiles that row-major sweepable graphs are walked in. Tiling never
+         *     changes the result. Passing `std::numeric_limits<std::size_t>::max()` walks the entire grid as a single tile (row-by-row).
+         * @throws std::runtime_error If debug mode is enabled and `tile_size_` is 0.
          */
         backtracker(
             ED zero_weight_ = {},
-            CONTAINER_CREATOR_PACK container_creator_pack_ = {}
+            CONTAINER_CREATOR_PACK container_creator_pack_ = {},
+            std::size_t tile_size_ = default_tile_size
         )
         : zero_weight { zero_weight_ }
-        , container_creator_pack { container_creator_pack_ } {}
+        , container_creator_pack { container_creator_pack_ }
+        , tile_size { tile_size_ } {
+            if constexpr (debug_mode) {
+                if (tile_size == 0zu) {
+                    throw std::runtime_error { "Tile size must be at least 1" };
+                }
+            }
+        }
 
         /**
          * Determine the maximally-weighted path (path with the highest sum of edge weights) connecting a pairwise alignment graph's root
@@ -156,7 +219,90 @@ namespace offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker
         backtracking_result<ED> auto find_max_path(
             const G& g
         ) {
-            auto slots { populate_weights_and_backtrack_pointers(g) };
+            auto slots { populate_weights_and_backtrack_pointers(g, std::nullopt) };
+            auto path { backtrack(g, slots) };  // NOTE: Don't use const auto& or auto&& - can't end up as const due to std::move() below
+            const auto& leaf_node { g.get_leaf_node() };
+            const auto& weight { slots.find_ref(leaf_node).backtracking_weight };
+            return std::make_pair(
+                std::move(path),  // For some reason this range can't be copied, but it can be moved?
+                weight
+            );  // NOTE: No dangling issues - make_pair() stores values, not refs.
+        }
+
+        /**
+         * Determine a high-weighted path connecting a pairwise alignment graph's root node and leaf node using X-drop pruning. While
+         * walking, any node whose accumulated weight falls more than `xdrop` below the highest accumulated weight seen so far is pruned,
+         * meaning that it's no longer extended into its children (edge weights leading out of it are never evaluated). A node whose parents
+         * have all been pruned is itself pruned.
+         *
+         * X-drop is a heuristic intended for extension-style alignments (e.g., local or fitting alignments seeded at the root node), where
+         * regions trailing far behind the best score seen are unlikely to ever rejoin the maximally-weighted path. As such, the returned
+         * path may not be the maximally-weighted path if `xdrop` is too small.
+         *
+         * If `G` satisfies both
+         * @ref offbynull::aligner::graph::pairwise_alignment_graph::row_major_sweepable_pairwise_alignment_graph and
+         * @ref offbynull::aligner::graph::sliceable_pairwise_alignment_graph::sliceable_pairwise_alignment_graph (e.g., local and fitting
+         * alignment graphs), pruned nodes aren't walked at all. Each row is only walked across the band of columns that may still hold
+         * unpruned nodes: starting from the first column holding an unpruned node in the row above, and ending once the nodes walked can't
+         * be extended any further right. Once a row holds no unpruned nodes and no resident node can feed the rows below, the remaining
+         * rows are skipped entirely. Resident nodes (e.g., a local alignment graph's leaf) collect their weights from the unpruned nodes
+         * feeding into them rather than querying all of their parents.
+         *
+         * The behavior of this function is undefined if ...
+         *
+         *  * `g` contains edges with non-finite weights.
+         *  * `xdrop` is negative or non-finite.
+         *  * every path reaching the leaf node gets pruned.
+         *
+         * @param g Graph.
+         * @param xdrop Maximum amount a node's accumulated weight may trail the highest accumulated weight seen so far before that node is
+         *     pruned.
+         * @return Path from `g`'s root node to `g`'s leaf node, along with that path's weight.
+         */
+        backtracking_result<ED> auto find_max_path(
+            const G& g,
+            const ED xdrop
+        ) {
+            auto slots { populate_weights_and_backtrack_pointers(g, { xdrop }) };
+            auto path { backtrack(g, slots) };  // NOTE: Don't use const auto& or auto&& - can't end up as const due to std::move() below
+            const auto& leaf_node { g.get_leaf_node() };
+            const auto& weight { slots.find_ref(leaf_node).backtracking_weight };
+            return std::make_pair(
+                std::move(path),  // For some reason this range can't be copied, but it can be moved?
+                weight
+            );  // NOTE: No dangling issues - make_pair() stores values, not refs.
+        }
+
+        /**
+         * Determine the maximally-weighted path (path with the highest sum of edge weights) connecting a pairwise alignment graph's root
+         * node and leaf node, walking tiles in parallel on a thread pool.
+         *
+         * The grid is divided into the same `tile_size` x `tile_size` tiles as the single-threaded sweep. A tile depends only on the tile
+         * above it and the tile to its left, so tiles get queued onto `thread_pool` as their dependencies finish, forming anti-diagonal
+         * wavefronts that sweep from the grid's top-left corner to its bottom-right corner. Results are written into the same slots the
+         * single-threaded sweep writes into, so the returned path and weight are identical to those returned by `find_max_path(g)`.
+         *
+         * The behavior of this function is undefined if ...
+         *
+         *  * `g` contains edges with non-finite weights.
+         *  * `g` isn't safe to query from multiple threads at once (e.g.,
+         *    @ref offbynull::aligner::graphs::memoizing_sliceable_pairwise_alignment_graph::memoizing_sliceable_pairwise_alignment_graph
+         *    mutates its cache on every query).
+         *  * `thread_pool` is closed before this function returns.
+         *
+         * This function may be invoked from one of `thread_pool`'s threads (e.g., from within a task queued onto `thread_pool`). While
+         * waiting for tiles to be walked, the invoking thread runs tasks queued on `thread_pool` (see
+         * @ref offbynull::helpers::forkable_thread_pool::forkable_thread_pool::join), so it never ties up a thread that tiles need.
+         *
+         * @param g Graph.
+         * @param thread_pool Thread pool to walk tiles on.
+         * @return Maximally weighted path from `g`'s root node to `g`'s leaf node, along with that path's weight.
+         */
+        backtracking_result<ED> auto find_max_path(
+            const G& g,
+            forkable_thread_pool<debug_mode, void>& thread_pool
+        ) requires row_major_sweepable_pairwise_alignment_graph<G> {
+            auto slots { parallel_sweep_weights_and_backtrack_pointers(g, thread_pool) };
             auto path { backtrack(g, slots) };  // NOTE: Don't use const auto& or auto&& - can't end up as const due to std::move() below
             const auto& leaf_node { g.get_leaf_node() };
             const auto& weight { slots.find_ref(leaf_node).backtracking_weight };
@@ -168,7 +314,444 @@ namespace offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker
 
     private:
         SLOT_CONTAINER populate_weights_and_backtrack_pointers(
-            const G& g
+            const G& g,
+            const std::optional<ED> xdrop
+        ) {
+            if constexpr (row_major_sweepable_pairwise_alignment_graph<G>) {
+                return sweep_weights_and_backtrack_pointers(g, xdrop);
+            } else {
+                return queue_weights_and_backtrack_pointers(g, xdrop);
+            }
+        }
+
+        SLOT_CONTAINER sweep_weights_and_backtrack_pointers(
+            const G& g,
+            const std::optional<ED> xdrop
+        ) {
+            if constexpr (sliceable_pairwise_alignment_graph<G>) {
+                if (xdrop.has_value()) {
+                    return xdrop_sweep_weights_and_backtrack_pointers(g, *xdrop);
+                }
+            }
+            // Create "slots" list
+            // -------------------
+            // Walking the grid in tiles is a topological order of the graph, so a node's parents are always walked before the node itself.
+            // There's no need to count each node's unwalked parents up front, meaning slots are left as the container creator pack created
+            // them (assigned a node only once the sweep reaches them).
+            auto no_slots { std::views::empty<SLOT> };
+            SLOT_CONTAINER slots {
+                g,
+                no_slots.begin(),
+                no_slots.end(),
+                zero_weight,
+                container_creator_pack.create_slot_container_container_creator_pack()
+            };
+            // Highest accumulated weight seen so far, only used when X-drop pruning is enabled (and G isn't sliceable, see
+            // xdrop_sweep_weights_and_backtrack_pointers()). Since pruning depends on the order nodes are walked in, X-drop sweeps the grid
+            // as a single tile (row-by-row) regardless of tile_size.
+            ED best_weight { zero_weight };
+            const std::size_t walk_tile_size { xdrop.has_value() ? std::numeric_limits<std::size_t>::max() : tile_size };
+            // Find max path within graph
+            // --------------------------
+            // Sweep the grid tile-by-tile, walking each node the same way as the ready queue based walk does (see
+            // queue_weights_and_backtrack_pointers()). A tile only reads from slots within itself and along the bottom / right boundaries
+            // of the tiles above and to its left. The root node sits at the first grid position, and since it has no parents, it keeps
+            // its initial weight.
+            const std::size_t down_cnt { g.grid_down_cnt };
+            const std::size_t right_cnt { g.grid_right_cnt };
+            for (std::size_t tile_down { 0zu }; tile_down < down_cnt; ) {
+                const std::size_t tile_down_end { down_cnt - tile_down <= walk_tile_size ? down_cnt : tile_down + walk_tile_size };
+                for (std::size_t tile_right { 0zu }; tile_right < right_cnt; ) {
+                    const std::size_t tile_right_end { right_cnt - tile_right <= walk_tile_size ? right_cnt : tile_right + walk_tile_size };
+                    walk_tile(g, slots, tile_down, tile_down_end, tile_right, tile_right_end, xdrop, best_weight);
+                    tile_right = tile_right_end;
+                }
+                tile_down = tile_down_end;
+            }
+            // Return slots container, which can go on to be used for backtracking
+            return slots;
+        }
+
+        SLOT_CONTAINER xdrop_sweep_weights_and_backtrack_pointers(
+            const G& g,
+            const ED xdrop
+        ) requires sliceable_pairwise_alignment_graph<G> {
+            // Create "slots" list
+            // -------------------
+            // Same as sweep_weights_and_backtrack_pointers(), except that resident nodes with parents get their slots marked as untouched.
+            // Rather than querying its parents, a resident node has its weight pushed into it by each unpruned parent as that parent gets
+            // walked (for a local alignment graph's leaf, querying parents would mean querying every node in the graph). An untouched
+            // slot points to the root node, which can never be a resident node with parents.
+            auto no_slots { std::views::empty<SLOT> };
+            SLOT_CONTAINER slots {
+                g,
+                no_slots.begin(),
+                no_slots.end(),
+                zero_weight,
+                container_creator_pack.create_slot_container_container_creator_pack()
+            };
+            const N& root_node { g.get_root_node() };
+            for (const N& resident_node : g.resident_nodes()) {
+                if (g.has_inputs(resident_node)) {
+                    slots.find_ref(resident_node).node = root_node;
+                }
+            }
+            ED best_weight { zero_weight };
+            // Weight of some pruned node, assigned to any node that's pruned because its parents were never walked.
+            std::optional<ED> pruned_weight {};
+            // Find max path within graph
+            // --------------------------
+            // Sweep the grid row-by-row. A non-resident node's parents are either resident nodes or sit within the same row / the row
+            // above at a column that's no further right (see sliceable_pairwise_alignment_graph and
+            // row_major_sweepable_pairwise_alignment_graph). Unless a resident node may feed into a row, a node in that row can only be
+            // unpruned if it's fed by an unpruned node in the row above, or by the unpruned node to its left. Each row is therefore walked
+            // starting from the first column holding an unpruned node in the row above, and stopping once a column is neither fed from the
+            // row above nor by an unpruned column to its left. Nodes outside of the columns walked are never touched, and read as pruned
+            // to any node walked after them.
+            const std::size_t down_cnt { g.grid_down_cnt };
+            const std::size_t right_cnt { g.grid_right_cnt };
+            std::size_t prev_walk_begin { 0zu };
+            std::size_t prev_walk_end { 0zu };
+            std::size_t prev_live_begin { 0zu };
+            std::size_t prev_live_end { 0zu };
+            bool leaf_walked { false };  // Only tracked in debug mode
+            for (std::size_t grid_down { 0zu }; grid_down < down_cnt; ++grid_down) {
+                const bool fed { grid_down == 0zu || has_feeding_resident(g, slots, grid_down, xdrop, best_weight) };
+                if (!fed && prev_live_begin == prev_live_end) {
+                    break;  // Every node in every remaining row is pruned
+                }
+                const std::size_t walk_begin { fed ? 0zu : prev_live_begin };
+                const auto is_walked {
+                    [&](const N& src_node) {
+                        const auto& [src_down, src_right, src_depth] { g.node_to_grid_offset(src_node) };
+                        const std::size_t src_down_ { src_down };
+                        const std::size_t src_right_ { src_right };
+                        if (src_down_ == grid_down) {
+                            return src_right_ >= walk_begin;
+                        } else if (src_down_ + 1zu == grid_down) {
+                            return src_right_ >= prev_walk_begin && src_right_ < prev_walk_end;
+                        }
+                        return true;  // Resident node, always walked in full rows
+                    }
+                };
+                std::size_t live_begin { right_cnt };
+                std::size_t live_end { right_cnt };
+                std::size_t grid_right { walk_begin };
+                for (; grid_right < right_cnt; ++grid_right) {
+                    if (!fed && grid_right > prev_live_end && live_end != grid_right) {
+                        break;
+                    }
+                    bool column_live { false };
+                    const auto& nodes {
+                        g.grid_offset_to_nodes(
+                            static_cast<N_INDEX>(grid_down),  // Cast to prevent narrowing warning
+                            static_cast<N_INDEX>(grid_right)  // Cast to prevent narrowing warning
+                        )
+                    };
+                    for (const N& node : nodes) {
+                        if constexpr (debug_mode) {
+                            leaf_walked = leaf_walked || node == g.get_leaf_node();
+                        }
+                        auto& current_slot { slots.find_ref(node) };
+                        bool live;
+                        if (is_resident(g, node)) {
+                            live = settle_resident(g, current_slot, node, xdrop, best_weight, pruned_weight);
+                        } else {
+                            current_slot.node = node;
+                            live = walk_with_xdrop(g, slots, current_slot, xdrop, best_weight, pruned_weight, is_walked);
+                        }
+                        if (live) {
+                            push_to_residents(g, slots, current_slot);
+                            column_live = true;
+                        } else {
+                            pruned_weight = { current_slot.backtracking_weight };
+                        }
+                    }
+                    if (column_live) {
+                        if (live_begin == right_cnt) {
+                            live_begin = grid_right;
+                        }
+                        live_end = grid_right + 1zu;
+                    }
+                }
+                prev_walk_begin = walk_begin;
+                prev_walk_end = grid_right;
+                prev_live_begin = live_begin == right_cnt ? 0zu : live_begin;
+                prev_live_end = live_begin == right_cnt ? 0zu : live_end;
+            }
+            // Resident nodes that the sweep never reached, and that no unpruned parent fed into, are pruned
+            for (const N& resident_node : g.resident_nodes()) {
+                auto& resident_slot { slots.find_ref(resident_node) };
+                if (g.has_inputs(resident_node) && resident_slot.node != resident_node) {
+                    settle_resident(g, resident_slot, resident_node, xdrop, best_weight, pruned_weight);
+                }
+            }
+            if constexpr (debug_mode) {
+                const N& leaf_node { g.get_leaf_node() };
+                if (!leaf_walked && !is_resident(g, leaf_node)) {
+                    throw std::runtime_error { "X-drop pruned every path to leaf node" };
+                }
+            }
+            // Return slots container, which can go on to be used for backtracking
+            return slots;
+        }
+
+        static bool is_resident(const G& g, const N& node) requires sliceable_pairwise_alignment_graph<G> {
+            for (const N& resident_node : g.resident_nodes()) {
+                if (resident_node == node) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        bool has_feeding_resident(
+            const G& g,
+            const SLOT_CONTAINER& slots,
+            const std::size_t grid_down,
+            const ED xdrop,
+            const ED& best_weight
+        ) requires sliceable_pairwise_alignment_graph<G> {
+            // A resident node may feed into any row below it (e.g., a local alignment graph's root node has a freeride edge to every
+            // node). If it hasn't been walked yet, assume it may end up unpruned.
+            for (const N& resident_node : g.resident_nodes()) {
+                if (!g.has_outputs(resident_node)) {
+                    continue;
+                }
+                const std::size_t resident_down { std::get<0zu>(g.node_to_grid_offset(resident_node)) };
+                if (resident_down >= grid_down || !(slots.find_ref(resident_node).backtracking_weight + xdrop < best_weight)) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        bool settle_resident(
+            const G& g,
+            SLOT& resident_slot,
+            const N& resident_node,
+            const ED xdrop,
+            ED& best_weight,
+            const std::optional<ED>& pruned_weight
+        ) requires sliceable_pairwise_alignment_graph<G> {
+            if (!g.has_inputs(resident_node)) {  // Root node
+                resident_slot.node = resident_node;
+                return true;
+            }
+            if (resident_slot.node != resident_node) {  // Untouched, meaning no unpruned parent fed into it
+                if constexpr (debug_mode) {
+                    if (!g.has_outputs(resident_node)) {
+                        throw std::runtime_error { "X-drop pruned every path to leaf node" };
+                    }
+                }
+                resident_slot.node = resident_node;
+                if (pruned_weight.has_value()) {
+                    resident_slot.backtracking_weight = *pruned_weight;
+                }
+                return false;
+            }
+            if (resident_slot.backtracking_weight + xdrop < best_weight) {
+                return false;
+            }
+            if (best_weight < resident_slot.backtracking_weight) {
+                best_weight = resident_slot.backtracking_weight;
+            }
+            return true;
+        }
+
+        void push_to_residents(
+            const G& g,
+            SLOT_CONTAINER& slots,
+            const SLOT& current_slot
+        ) requires sliceable_pairwise_alignment_graph<G> {
+            for (const E& edge : g.outputs_to_residents(current_slot.node)) {
+                const N& resident_node { g.get_edge_to(edge) };
+                auto& resident_slot { slots.find_ref(resident_node) };
+                const ED& edge_weight { g.get_edge_data(edge) };
+                ED weight { static_cast<ED>(current_slot.backtracking_weight + edge_weight) };  // Cast to prevent narrowing warning
+                if (resident_slot.node != resident_node || resident_slot.backtracking_weight < weight) {
+                    resident_slot.node = resident_node;
+                    resident_slot.backtracking_edge = edge;
+                    resident_slot.backtracking_weight = weight;
+                }
+            }
+        }
+
+        // Tiling state shared between the tasks of parallel_sweep_weights_and_backtrack_pointers(). Tiles are indexed row-major.
+        struct parallel_sweep_state {
+            const G& g;
+            SLOT_CONTAINER& slots;
+            std::size_t tile_down_cnt;
+            std::size_t tile_right_cnt;
+            TILE_DEPENDENCY_COUNT_CONTAINER unwalked_dependency_cnts;  // Only ever accessed through std::atomic_ref
+            std::atomic<std::size_t> unreleased_tile_cnt;
+            std::promise<void> all_tiles_released;
+            std::atomic_flag failed;
+            std::exception_ptr failure;
+        };
+
+        SLOT_CONTAINER parallel_sweep_weights_and_backtrack_pointers(
+            const G& g,
+            forkable_thread_pool<debug_mode, void>& thread_pool
+        ) {
+            // Create "slots" list
+            // -------------------
+            // Same as sweep_weights_and_backtrack_pointers(): slots are left as the container creator pack created them, since walking
+            // tiles in dependency order is a topological order of the graph.
+            auto no_slots { std::views::empty<SLOT> };
+            SLOT_CONTAINER slots {
+                g,
+                no_slots.begin(),
+                no_slots.end(),
+                zero_weight,
+                container_creator_pack.create_slot_container_container_creator_pack()
+            };
+            // Count dependencies of each tile
+            // -------------------------------
+            // A tile depends on the tile directly above it and the tile directly to its left. Any other tile it reads from (e.g., the one
+            // diagonally above-left) is a dependency of one of those two, so it's guaranteed to have been walked already.
+            const std::size_t down_cnt { g.grid_down_cnt };
+            const std::size_t right_cnt { g.grid_right_cnt };
+            const std::size_t tile_down_cnt { down_cnt / tile_size + (down_cnt % tile_size == 0zu ? 0zu : 1zu) };
+            const std::size_t tile_right_cnt { right_cnt / tile_size + (right_cnt % tile_size == 0zu ? 0zu : 1zu) };
+            const std::size_t tile_cnt { tile_down_cnt * tile_right_cnt };
+            parallel_sweep_state state {
+                g,
+                slots,
+                tile_down_cnt,
+                tile_right_cnt,
+                container_creator_pack.create_tile_dependency_count_container(tile_cnt),
+                tile_cnt,
+                {},
+                {},
+                {}
+            };
+            for (std::size_t tile_down { 0zu }; tile_down < tile_down_cnt; ++tile_down) {
+                for (std::size_t tile_right { 0zu }; tile_right < tile_right_cnt; ++tile_right) {
+                    state.unwalked_dependency_cnts[tile_down * tile_right_cnt + tile_right] =
+                        static_cast<std::uint8_t>((tile_down == 0zu ? 0u : 1u) + (tile_right == 0zu ? 0u : 1u));
+                }
+            }
+            // Find max path within graph
+            // --------------------------
+            // Kick off the top-left tile (the only tile without dependencies). Each tile, once walked, queues whichever of its dependents
+            // it was the last unwalked dependency of. The release counter gets counted down once per tile, and the tile that brings it
+            // to zero fulfills the promise, so waiting on the promise guarantees that no task still references the state above once this
+            // function moves on. The wait goes through join() rather than blocking outright, meaning that the current thread runs queued
+            // tiles while it waits. Otherwise, if the current thread were one of the pool's threads, it'd be taken away from the tiles it's
+            // waiting on (deadlocking outright if it's the pool's only thread).
+            if (tile_cnt > 0zu) {
+                std::future<void> all_tiles_released { state.all_tiles_released.get_future() };
+                walk_tile_and_release(state, 0zu, thread_pool);
+                thread_pool.join(all_tiles_released);
+            }
+            if (state.failed.test(std::memory_order_acquire)) {
+                std::rethrow_exception(state.failure);
+            }
+            // Return slots container, which can go on to be used for backtracking
+            return slots;
+        }
+
+        void walk_tile_and_release(
+            parallel_sweep_state& state,
+            const std::size_t tile_idx,
+            forkable_thread_pool<debug_mode, void>& thread_pool
+        ) {
+            // Tiles that became ready but couldn't be queued (thread pool refused them) are walked on the current thread instead.
+            PENDING_TILE_INDEX_CONTAINER pending_tile_idxes {
+                container_creator_pack.create_pending_tile_index_container(state.tile_down_cnt, state.tile_right_cnt)
+            };
+            pending_tile_idxes.push_back(tile_idx);
+            while (!pending_tile_idxes.empty()) {
+                const std::size_t idx { pending_tile_idxes.back() };
+                pending_tile_idxes.pop_back();
+                const std::size_t tile_down { idx / state.tile_right_cnt };
+                const std::size_t tile_right { idx % state.tile_right_cnt };
+                // Once any tile fails, remaining tiles are skipped but still released, so that the release counter still hits zero.
+                if (!state.failed.test(std::memory_order_acquire)) {
+                    try {
+                        const std::size_t down_cnt { state.g.grid_down_cnt };
+                        const std::size_t right_cnt { state.g.grid_right_cnt };
+                        const std::size_t down_begin { tile_down * tile_size };
+                        const std::size_t right_begin { tile_right * tile_size };
+                        const std::size_t down_end { down_cnt - down_begin <= tile_size ? down_cnt : down_begin + tile_size };
+                        const std::size_t right_end { right_cnt - right_begin <= tile_size ? right_cnt : right_begin + tile_size };
+                        ED best_weight { zero_weight };  // Unused (X-drop isn't supported when walking in parallel)
+                        walk_tile(state.g, state.slots, down_begin, down_end, right_begin, right_end, std::nullopt, best_weight);
+                    } catch (...) {
+                        if (!state.failed.test_and_set(std::memory_order_acq_rel)) {
+                            state.failure = std::current_exception();
+                        }
+                    }
+                }
+                const auto release {
+                    [&](const std::size_t dependent_idx) {
+                        std::atomic_ref<std::uint8_t> unwalked_dependency_cnt { state.unwalked_dependency_cnts[dependent_idx] };
+                        if (unwalked_dependency_cnt.fetch_sub(1u, std::memory_order_acq_rel) != 1u) {
+                            return;
+                        }
+                        auto queued {
+                            thread_pool.queue(
+                                [this, &state, dependent_idx](forkable_thread_pool<debug_mode, void>& owner) {
+                                    walk_tile_and_release(state, dependent_idx, owner);
+                                }
+                            )
+                        };
+                        if (!queued.has_value()) {
+                            pending_tile_idxes.push_back(dependent_idx);
+                        }
+                    }
+                };
+                if (tile_down + 1zu < state.tile_down_cnt) {
+                    release(idx + state.tile_right_cnt);
+                }
+                if (tile_right + 1zu < state.tile_right_cnt) {
+                    release(idx + 1zu);
+                }
+                if (state.unreleased_tile_cnt.fetch_sub(1zu, std::memory_order_acq_rel) == 1zu) {
+                    state.all_tiles_released.set_value();
+                }
+            }
+        }
+
+        void walk_tile(
+            const G& g,
+            SLOT_CONTAINER& slots,
+            const std::size_t down_begin,
+            const std::size_t down_end,
+            const std::size_t right_begin,
+            const std::size_t right_end,
+            const std::optional<ED> xdrop,
+            ED& best_weight
+        ) {
+            for (std::size_t grid_down { down_begin }; grid_down < down_end; ++grid_down) {
+                for (std::size_t grid_right { right_begin }; grid_right < right_end; ++grid_right) {
+                    const auto& nodes {
+                        g.grid_offset_to_nodes(
+                            static_cast<N_INDEX>(grid_down),  // Cast to prevent narrowing warning
+                            static_cast<N_INDEX>(grid_right)  // Cast to prevent narrowing warning
+                        )
+                    };
+                    for (const N& node : nodes) {
+                        auto& current_slot { slots.find_ref(node) };
+                        current_slot.node = node;
+                        if constexpr (debug_mode) {
+                            for (const auto& edge : g.get_inputs(node)) {
+                                const auto& [src_down, src_right, src_depth] { g.node_to_grid_offset(g.get_edge_from(edge)) };
+                                if (src_down > grid_down || src_right > grid_right) {
+                                    throw std::runtime_error { "Source nodes not fully walked" };
+                                }
+                            }
+                        }
+                        walk(g, slots, current_slot, xdrop, best_weight);
+                    }
+                }
+            }
+        }
+
+        SLOT_CONTAINER queue_weights_and_backtrack_pointers(
+            const G& g,
+            const std::optional<ED> xdrop
         ) {
             // Create "slots" list
             // -------------------
@@ -193,7 +776,8 @@ namespace offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker
                 g,
                 slots_lazy.begin(),
                 slots_lazy.end(),
-                zero_weight
+                zero_weight,
+                container_creator_pack.create_slot_container_container_creator_pack()
             };
             // Create "ready_idxes" queue
             // --------------------------
@@ -201,12 +785,14 @@ namespace offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker
             // parents processed, and so it can be processed). Since root nodes have no parents, they are ready-to-process from
             // the get-go. As such, the "ready_idxes" queue is primed with the "slots" indices for root nodes (of which there
             // should be only one).
-            READY_QUEUE ready_idxes { g };
+            READY_QUEUE ready_idxes { g, container_creator_pack.create_ready_queue_container_creator_pack() };
             const N& root_node { g.get_root_node() };
             const auto& [root_slot_idx, root_slot] { slots.find(root_node) };
             ready_idxes.push(root_slot_idx);
             // static_assert(std::numeric_limits<float>::is_iec559, "IEEE 754 required"); // Require for inf and nan?
             root_slot.backtracking_weight = zero_weight;
+            // Highest accumulated weight seen so far, only used when X-drop pruning is enabled.
+            ED best_weight { zero_weight };
             // Find max path within graph
             // --------------------------
             // Using the backtracking algorithm, find the path within graph that has the maximum weight. If more than one such
@@ -227,13 +813,43 @@ namespace offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker
                         }
                     }
                 }
+                walk(g, slots, current_slot, xdrop, best_weight);
+                // For outgoing nodes this node points to, decrement its number of unprocessed parents (this node was one of its
+                // parents, and it was processed in this iteration of the loop) then add it to "ready_idxes" if it has no more
+                // unprocessed parents.
+                for (const auto& edge : g.get_outputs(current_slot.node)) {
+                    const auto& dst_node { g.get_edge_to(edge) };
+                    const auto& [dst_slot_idx, dst_slot] { slots.find(dst_node) };
+                    if constexpr (debug_mode) {
+                        if (dst_slot.unwalked_parent_cnt == PC0) {
+                            throw std::runtime_error { "Invalid number of unprocessed parents" };
+                        }
+                    }
+                    dst_slot.unwalked_parent_cnt = static_cast<PARENT_COUNT>(dst_slot.unwalked_parent_cnt - PC1);
+                    if (dst_slot.unwalked_parent_cnt == PC0) {
+                        ready_idxes.push(dst_slot_idx);
+                    }
+                }
+            }
+            // Return slots container, which can go on to be used for backtracking
+            return slots;
+        }
+
+        void walk(
+            const G& g,
+            const SLOT_CONTAINER& slots,
+            SLOT& current_slot,
+            const std::optional<ED> xdrop,
+            ED& best_weight
+        ) {
+            if (!xdrop.has_value()) {
                 auto incoming_accumulated {
                     std::views::common(
                         g.get_inputs(current_slot.node)
                         | std::views::transform(
                             [&](const auto& edge) -> std::pair<E, ED> {
                                 const auto& src_node { g.get_edge_from(edge) };
-                                const slot<N, E, ED, PARENT_COUNT>& src_node_slot { slots.find_ref(src_node) };
+                                const SLOT& src_node_slot { slots.find_ref(src_node) };
                                 const auto& edge_weight { g.get_edge_data(edge) };
                                 return { edge, src_node_slot.backtracking_weight + edge_weight };
                             }
@@ -254,25 +870,75 @@ namespace offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker
                     current_slot.backtracking_edge = (*found).first;
                     current_slot.backtracking_weight = (*found).second;
                 }
-                // For outgoing nodes this node points to, decrement its number of unprocessed parents (this node was one of its
-                // parents, and it was processed in this iteration of the loop) then add it to "ready_idxes" if it has no more
-                // unprocessed parents.
-                for (const auto& edge : g.get_outputs(current_slot.node)) {
-                    const auto& dst_node { g.get_edge_to(edge) };
-                    const auto& [dst_slot_idx, dst_slot] { slots.find(dst_node) };
-                    if constexpr (debug_mode) {
-                        if (dst_slot.unwalked_parent_cnt == PC0) {
-                            throw std::runtime_error { "Invalid number of unprocessed parents" };
-                        }
+            } else {
+                walk_with_xdrop(g, slots, current_slot, *xdrop, best_weight, std::nullopt, [](const N&) { return true; });
+            }
+        }
+
+        bool walk_with_xdrop(
+            const G& g,
+            const SLOT_CONTAINER& slots,
+            SLOT& current_slot,
+            const ED xdrop,
+            ED& best_weight,
+            const std::optional<ED>& pruned_weight,
+            const auto& is_walked
+        ) {
+            // A parent is pruned if its accumulated weight trails best_weight by more than xdrop. Since best_weight never decreases, a
+            // parent that was pruned at some point remains pruned for the rest of the walk. A parent that was never walked is pruned
+            // as well (only possible when whole regions are skipped, in which case pruned_weight holds the weight of some pruned node).
+            std::optional<std::pair<E, ED>> found {};
+            std::optional<std::pair<E, ED>> pruned {};
+            std::optional<E> unwalked {};
+            for (const auto& edge : g.get_inputs(current_slot.node)) {
+                const auto& src_node { g.get_edge_from(edge) };
+                if (!is_walked(src_node)) {
+                    if (!unwalked.has_value()) {
+                        unwalked = { edge };
                     }
-                    dst_slot.unwalked_parent_cnt = static_cast<PARENT_COUNT>(dst_slot.unwalked_parent_cnt - PC1);
-                    if (dst_slot.unwalked_parent_cnt == PC0) {
-                        ready_idxes.push(dst_slot_idx);
+                    continue;
+                }
+                const ED& src_weight { slots.find_ref(src_node).backtracking_weight };
+                if (src_weight + xdrop < best_weight) {
+                    if (!pruned.has_value()) {
+                        pruned = { edge, src_weight };
                     }
+                    continue;
+                }
+                const auto& edge_weight { g.get_edge_data(edge) };
+                ED weight { static_cast<ED>(src_weight + edge_weight) };  // Cast to prevent narrowing warning
+                if (!found.has_value() || (*found).second < weight) {
+                    found = { edge, weight };
                 }
             }
-            // Return slots container, which can go on to be used for backtracking
-            return slots;
+            if (found.has_value()) {
+                current_slot.backtracking_edge = (*found).first;
+                current_slot.backtracking_weight = (*found).second;
+                if (best_weight < (*found).second) {
+                    best_weight = (*found).second;
+                }
+                return !((*found).second + xdrop < best_weight);
+            } else if (pruned.has_value() || unwalked.has_value()) {  // if no incoming nodes found, it's a root node
+                if constexpr (debug_mode) {
+                    if (!g.has_outputs(current_slot.node)) {
+                        throw std::runtime_error { "X-drop pruned every path to leaf node" };
+                    }
+                    if (!pruned.has_value() && !pruned_weight.has_value()) {
+                        throw std::runtime_error { "This should never happen" };
+                    }
+                }
+                // Every parent was pruned, so this node is pruned as well. Taking on a pruned weight guarantees that this node also reads
+                // as pruned to its own children.
+                if (pruned.has_value()) {
+                    current_slot.backtracking_edge = (*pruned).first;
+                    current_slot.backtracking_weight = (*pruned).second;
+                } else {
+                    current_slot.backtracking_edge = *unwalked;
+                    current_slot.backtracking_weight = *pruned_weight;
+                }
+                return false;
+            }
+            return true;
         }
 
         auto backtrack(
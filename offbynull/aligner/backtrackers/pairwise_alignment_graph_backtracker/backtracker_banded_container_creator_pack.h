@@ -0,0 +1,120 @@
+#ifndef OFFBYNULL_ALIGNER_BACKTRACKERS_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_BACKTRACKER_BANDED_CONTAINER_CREATOR_PACK_H
+#define OFFBYNULL_ALIGNER_BACKTRACKERS_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_BACKTRACKER_BANDED_CONTAINER_CREATOR_PACK_H
+
+#include <cstddef>
+#include <utility>
+#include "offbynull/aligner/concepts.h"
+#include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/backtrackable_node.h"
+#include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/backtrackable_edge.h"
+#include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/backtracker_container_creator_pack.h"
+#include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/backtracker_heap_container_creator_pack.h"
+#include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/unimplemented_backtracker_container_creator_pack.h"
+#include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/slot_container/slot_container_banded_container_creator_pack.h"
+#include "offbynull/concepts.h"
+
+namespace offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtracker_banded_container_creator_pack {
+    using offbynull::aligner::concepts::weight;
+    using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtrackable_node::backtrackable_node;
+    using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtrackable_edge::backtrackable_edge;
+    using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtracker_container_creator_pack
+        ::backtracker_container_creator_pack;
+    using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtracker_heap_container_creator_pack
+        ::backtracker_heap_container_creator_pack;
+    using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::slot_container
+        ::slot_container_banded_container_creator_pack::slot_container_banded_container_creator_pack;
+    using offbynull::concepts::widenable_to_size_t;
+
+    /**
+     * @ref offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtracker_container_creator_pack::backtracker_container_creator_pack
+     * that limits slot storage to `band_width` columns per row, intended for graphs where only a diagonal band of each row exists (e.g.,
+     * @ref offbynull::aligner::graphs::banded_sliceable_pairwise_alignment_graph::banded_sliceable_pairwise_alignment_graph). The
+     * containers themselves are created by a backing container creator pack.
+     *
+     * @tparam debug_mode `true` to enable debugging logic, `false` otherwise.
+     * @tparam N Graph node identifier type.
+     * @tparam E Graph edge identifier type.
+     * @tparam ED Graph edge data type (edge weight).
+     * @tparam PARENT_COUNT Graph node incoming edge counter type. Must be wide enough to hold the maximum number of incoming edges across
+     *     all nodes in the underlying pairwise alignment graph instance (e.g., across all nodes in any global pairwise alignment graph, a
+     *     node can have at most 3 incoming edges).
+     * @tparam SLOT_INDEX Slot indexer type. Must be wide enough to hold the value `grid_down_cnt * band_width * grid_depth_cnt`
+     *     (variables being multiplied are the dimensions of the underlying graph).
+     * @tparam BACKING_CONTAINER_CREATOR_PACK Container factory type that containers are created with. The default doesn't prime
+     *     @ref offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::ready_queue::ready_queue::ready_queue with reserved
+     *     elements, since doing so would reserve for the entire grid rather than just the band.
+     */
+    template<
+        bool debug_mode,
+        backtrackable_node N,
+        backtrackable_edge E,
+        weight ED,
+        widenable_to_size_t PARENT_COUNT,
+        widenable_to_size_t SLOT_INDEX,
+        backtracker_container_creator_pack<
+            N,
+            E,
+            ED,
+            PARENT_COUNT,
+            SLOT_INDEX
+        > BACKING_CONTAINER_CREATOR_PACK = backtracker_heap_container_creator_pack<
+            debug_mode,
+            N,
+            E,
+            ED,
+            PARENT_COUNT,
+            SLOT_INDEX,
+            false
+        >
+    >
+    struct backtracker_banded_container_creator_pack {
+        /** Maximum number of columns held per row. */
+        std::size_t band_width;
+        /** Container factory that containers are created with. */
+        BACKING_CONTAINER_CREATOR_PACK backing_container_creator_pack {};
+
+        /**
+         * @copydoc offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::unimplemented_backtracker_container_creator_pack::unimplemented_backtracker_container_creator_pack::create_slot_container_container_creator_pack
+         */
+        slot_container_banded_container_creator_pack<
+            debug_mode,
+            N,
+            E,
+            ED,
+            PARENT_COUNT,
+            SLOT_INDEX,
+            decltype(std::declval<BACKING_CONTAINER_CREATOR_PACK>().create_slot_container_container_creator_pack())
+        > create_slot_container_container_creator_pack() const {
+            return { band_width, backing_container_creator_pack.create_slot_container_container_creator_pack() };
+        }
+
+        /**
+         * @copydoc offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::unimplemented_backtracker_container_creator_pack::unimplemented_backtracker_container_creator_pack::create_ready_queue_container_creator_pack
+         */
+        auto create_ready_queue_container_creator_pack() const {
+            return backing_container_creator_pack.create_ready_queue_container_creator_pack();
+        }
+
+        /**
+         * @copydoc offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::unimplemented_backtracker_container_creator_pack::unimplemented_backtracker_container_creator_pack::create_path_container
+         */
+        auto create_path_container(std::size_t path_edge_capacity) const {
+            return backing_container_creator_pack.create_path_container(path_edge_capacity);
+        }
+
+        /**
+         * @copydoc offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::unimplemented_backtracker_container_creator_pack::unimplemented_backtracker_container_creator_pack::create_tile_dependency_count_container
+         */
+        auto create_tile_dependency_count_container(std::size_t tile_cnt) const {
+            return backing_container_creator_pack.create_tile_dependency_count_container(tile_cnt);
+        }
+
+        /**
+         * @copydoc offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::unimplemented_backtracker_container_creator_pack::unimplemented_backtracker_container_creator_pack::create_pending_tile_index_container
+         */
+        auto create_pending_tile_index_container(std::size_t tile_down_cnt, std::size_t tile_right_cnt) const {
+            return backing_container_creator_pack.create_pending_tile_index_container(tile_down_cnt, tile_right_cnt);
+        }
+    };
+}
+
+#endif //OFFBYNULL_ALIGNER_BACKTRACKERS_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_BACKTRACKER_BANDED_CONTAINER_CREATOR_PACK_H
@@ -2,6 +2,7 @@
 #define OFFBYNULL_ALIGNER_BACKTRACKERS_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_BACKTRACKER_CONTAINER_CREATOR_PACK_H
 
 #include <cstddef>
+#include <cstdint>
 #include "offbynull/aligner/concepts.h"
 #include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/backtrackable_node.h"
 #include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/backtrackable_edge.h"
@@ -51,11 +52,19 @@ namespace offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker
         && weight<ED>
         && widenable_to_size_t<PARENT_COUNT>
         && widenable_to_size_t<SLOT_INDEX>
-        && requires(const T t, std::size_t path_edge_capacity) {
+        && requires(
+            const T t,
+            std::size_t path_edge_capacity,
+            std::size_t tile_cnt,
+            std::size_t tile_down_cnt,
+            std::size_t tile_right_cnt
+        ) {
             { t.create_slot_container_container_creator_pack() }
                 -> slot_container_container_creator_pack<N, E, ED, PARENT_COUNT, SLOT_INDEX>;
             { t.create_ready_queue_container_creator_pack() } -> ready_queue_container_creator_pack<SLOT_INDEX>;
             { t.create_path_container(path_edge_capacity) } -> random_access_sequence_container<E>;
+            { t.create_tile_dependency_count_container(tile_cnt) } -> random_access_sequence_container<std::uint8_t>;
+            { t.create_pending_tile_index_container(tile_down_cnt, tile_right_cnt) } -> random_access_sequence_container<std::size_t>;
         };
 }
 
@@ -2,6 +2,8 @@
 #define OFFBYNULL_ALIGNER_BACKTRACKERS_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_BACKTRACKER_HEAP_CONTAINER_CREATOR_PACK_H
 
 #include <cstddef>
+#include <cstdint>
+#include <algorithm>
 #include <vector>
 #include "offbynull/aligner/concepts.h"
 #include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/backtrackable_node.h"
@@ -84,6 +86,24 @@ namespace offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker
             }
             return ret;
         }
+
+        /**
+         * @copydoc offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::unimplemented_backtracker_container_creator_pack::unimplemented_backtracker_container_creator_pack::create_tile_dependency_count_container
+         */
+        std::vector<std::uint8_t> create_tile_dependency_count_container(std::size_t tile_cnt) const {
+            return std::vector<std::uint8_t>(tile_cnt);
+        }
+
+        /**
+         * @copydoc offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::unimplemented_backtracker_container_creator_pack::unimplemented_backtracker_container_creator_pack::create_pending_tile_index_container
+         */
+        std::vector<std::size_t> create_pending_tile_index_container(std::size_t tile_down_cnt, std::size_t tile_right_cnt) const {
+            std::vector<std::size_t> ret {};
+            if constexpr (minimize_allocations) {
+                ret.reserve(std::min(tile_down_cnt, tile_right_cnt));
+            }
+            return ret;
+        }
     };
 }
 
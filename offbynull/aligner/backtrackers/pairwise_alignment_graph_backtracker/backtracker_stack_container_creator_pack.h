@@ -2,6 +2,8 @@
 #define OFFBYNULL_ALIGNER_BACKTRACKERS_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_BACKTRACKER_STACK_CONTAINER_CREATOR_PACK_H
 
 #include <cstddef>
+#include <cstdint>
+#include <algorithm>
 #include <stdexcept>
 #include "offbynull/aligner/concepts.h"
 #include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/backtrackable_node.h"
@@ -98,6 +100,47 @@ namespace offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker
             }
             return {};
         }
+
+        /** `create_tile_dependency_count_container()` return type. */
+        using TILE_DEPENDENCY_COUNT_CONTAINER_TYPE = typename static_vector_typer<
+            debug_mode,
+            std::uint8_t,
+            grid_down_cnt * grid_right_cnt  // Tiles are at least 1x1, so there can't be more tiles than positions on the grid
+        >::type;
+
+        /**
+         * @copydoc offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::unimplemented_backtracker_container_creator_pack::unimplemented_backtracker_container_creator_pack::create_tile_dependency_count_container
+         */
+        TILE_DEPENDENCY_COUNT_CONTAINER_TYPE create_tile_dependency_count_container(std::size_t tile_cnt) const {
+            if constexpr (debug_mode) {
+                if (tile_cnt > grid_down_cnt * grid_right_cnt) {
+                    throw std::runtime_error { "Tile count too large" };
+                }
+            }
+            return TILE_DEPENDENCY_COUNT_CONTAINER_TYPE(tile_cnt);
+        }
+
+        /** `create_pending_tile_index_container()` return type. */
+        using PENDING_TILE_INDEX_CONTAINER_TYPE = typename static_vector_typer<
+            debug_mode,
+            std::size_t,
+            std::min(grid_down_cnt, grid_right_cnt)  // Tiles are at least 1x1, so there can't be more tiles along an axis than positions
+        >::type;
+
+        /**
+         * @copydoc offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::unimplemented_backtracker_container_creator_pack::unimplemented_backtracker_container_creator_pack::create_pending_tile_index_container
+         */
+        PENDING_TILE_INDEX_CONTAINER_TYPE create_pending_tile_index_container(
+            std::size_t tile_down_cnt,
+            std::size_t tile_right_cnt
+        ) const {
+            if constexpr (debug_mode) {
+                if (std::min(tile_down_cnt, tile_right_cnt) > std::min(grid_down_cnt, grid_right_cnt)) {
+                    throw std::runtime_error { "Tile count too large" };
+                }
+            }
+            return {};
+        }
     };
 }
 
@@ -1,8 +1,20 @@
 #include "offbynull/aligner/graph/graph.h"
+#include "offbynull/aligner/graph/pairwise_alignment_graph.h"
 #include "offbynull/aligner/graphs/pairwise_global_alignment_graph.h"
+#include "offbynull/aligner/graphs/pairwise_local_alignment_graph.h"
 #include "offbynull/aligner/graphs/directed_graph.h"
+#include "offbynull/aligner/graphs/banded_sliceable_pairwise_alignment_graph.h"
 #include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/backtracker.h"
+#include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/backtracker_banded_container_creator_pack.h"
+#include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/backtracker_stack_container_creator_pack.h"
+#include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/backtracker_huge_page_container_creator_pack.h"
+#include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/backtracker_file_backed_container_creator_pack.h"
+#include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/backtracker_workspace.h"
+#include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/backtracker_workspace_container_creator_pack.h"
+#include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/slot_container/slot.h"
+#include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/slot_container/sweep_slot.h"
 #include "offbynull/aligner/scorers/simple_scorer.h"
+#include "offbynull/helpers/forkable_thread_pool.h"
 #include "offbynull/utils.h"
 #include "gtest/gtest.h"
 #include <cstddef>
@@ -11,16 +23,58 @@
 #include <ostream>
 #include <iostream>
 #include <vector>
+#include <limits>
+#include <random>
+#include <ranges>
+#include <chrono>
+#include <future>
+#include <type_traits>
 
 namespace {
     using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtracker::backtracker;
     using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtracker::heap_find_max_path;
     using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtracker::stack_find_max_path;
+    using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtracker_banded_container_creator_pack
+        ::backtracker_banded_container_creator_pack;
+    using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtracker_stack_container_creator_pack
+        ::backtracker_stack_container_creator_pack;
+    using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtracker_huge_page_container_creator_pack
+        ::backtracker_huge_page_container_creator_pack;
+    using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtracker_file_backed_container_creator_pack
+        ::backtracker_file_backed_container_creator_pack;
+    using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtracker_workspace::backtracker_workspace;
+    using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtracker_workspace_container_creator_pack
+        ::backtracker_workspace_container_creator_pack;
+    using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::slot_container::slot::slot;
+    using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::slot_container::sweep_slot::sweep_slot;
+    using offbynull::aligner::graph::pairwise_alignment_graph::row_major_sweepable_pairwise_alignment_graph;
     using offbynull::aligner::graphs::pairwise_global_alignment_graph::pairwise_global_alignment_graph;
+    using offbynull::aligner::graphs::pairwise_local_alignment_graph::pairwise_local_alignment_graph;
+    using offbynull::aligner::graphs::banded_sliceable_pairwise_alignment_graph::banded_sliceable_pairwise_alignment_graph;
     using offbynull::aligner::scorers::simple_scorer::simple_scorer;
+    using offbynull::helpers::forkable_thread_pool::forkable_thread_pool;
     using offbynull::utils::copy_to_vector;
     using offbynull::utils::is_debug_mode;
 
+    // Opts a graph out of being row-major sweepable, forcing the backtracker to walk it via its ready queue.
+    template<typename G>
+    struct unsweepable_graph : G {
+        using G::G;
+        static constexpr bool row_major_sweepable { false };
+    };
+
+    // Counts how many nodes have their parents queried, i.e. how many nodes a backtracker walks.
+    template<typename G>
+    struct input_counting_graph : G {
+        using G::G;
+        mutable std::size_t input_query_cnt { 0zu };
+
+        auto get_inputs(const typename G::N& node) const {
+            ++input_query_cnt;
+            return G::get_inputs(node);
+        }
+    };
+
     TEST(OABPBacktrackerTest, FindMaxPathOnGridGraph) {
         auto substitution_scorer {
             simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_substitution(1.0f64, -1.0f64)
@@ -204,4 +258,658 @@ namespace {
         );
         EXPECT_EQ(weight, 1.0);
     }
+
+    TEST(OABPBacktrackerTest, FindMaxPathOnBandedGridGraph) {
+        auto substitution_scorer {
+            simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_substitution(1.0f64, -1.0f64)
+        };
+        auto gap_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_gap(-1.0f64) };
+
+        std::string seq1 { "abcdefgh" };
+        std::string seq2 { "abcxefgh" };
+        pairwise_global_alignment_graph<
+            is_debug_mode(),
+            std::size_t,
+            std::float64_t,
+            decltype(seq1),
+            decltype(seq2),
+            decltype(substitution_scorer),
+            decltype(gap_scorer)
+        > g {
+            seq1,
+            seq2,
+            substitution_scorer,
+            gap_scorer
+        };
+        banded_sliceable_pairwise_alignment_graph<is_debug_mode(), decltype(g)> banded_g { g, 1zu, 1zu };
+
+        using N = decltype(g)::N;
+        using E = decltype(g)::E;
+        using ED = decltype(g)::ED;
+
+        backtracker<
+            is_debug_mode(),
+            decltype(banded_g),
+            std::size_t,
+            std::size_t,
+            backtracker_banded_container_creator_pack<is_debug_mode(), N, E, ED, std::size_t, std::size_t>
+        > backtracker_ { 0.0f64, { banded_g.band_width } };
+        const auto& [path, weight] {
+            backtracker_.find_max_path(banded_g)
+        };
+        const auto& [unbanded_path, unbanded_weight] {
+            heap_find_max_path<is_debug_mode(), std::size_t, std::size_t, false>(g)
+        };
+
+        for (const E& e : path) {
+            std::cout << e << ' ';
+        }
+        std::cout << std::endl;
+        std::cout << weight << std::endl;
+        EXPECT_EQ(copy_to_vector(path), copy_to_vector(unbanded_path));
+        EXPECT_EQ(weight, unbanded_weight);
+        EXPECT_EQ(weight, 6.0);
+    }
+
+    TEST(OABPBacktrackerTest, FindMaxPathWithXDropOnGridGraph) {
+        auto substitution_scorer {
+            simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_substitution(1.0f64, -1.0f64)
+        };
+        auto gap_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_gap(-1.0f64) };
+
+        std::string seq1 { "abcdefgh" };
+        std::string seq2 { "abcxefgh" };
+        pairwise_global_alignment_graph<
+            is_debug_mode(),
+            std::size_t,
+            std::float64_t,
+            decltype(seq1),
+            decltype(seq2),
+            decltype(substitution_scorer),
+            decltype(gap_scorer)
+        > g {
+            seq1,
+            seq2,
+            substitution_scorer,
+            gap_scorer
+        };
+
+        using E = decltype(g)::E;
+
+        const auto& [unpruned_path, unpruned_weight] {
+            heap_find_max_path<is_debug_mode(), std::size_t, std::size_t, false>(g)
+        };
+
+        // X-drop large enough to never prune anything
+        {
+            backtracker<is_debug_mode(), decltype(g), std::size_t, std::size_t> backtracker_ {};
+            const auto& [path, weight] {
+                backtracker_.find_max_path(g, 1000.0f64)
+            };
+            EXPECT_EQ(copy_to_vector(path), copy_to_vector(unpruned_path));
+            EXPECT_EQ(weight, unpruned_weight);
+        }
+
+        // X-drop that prunes everything off the main diagonal, but the single mismatch on the main diagonal is still tolerated
+        {
+            backtracker<is_debug_mode(), decltype(g), std::size_t, std::size_t> backtracker_ {};
+            const auto& [path, weight] {
+                backtracker_.find_max_path(g, 1.0f64)
+            };
+            for (const E& e : path) {
+                std::cout << e << ' ';
+            }
+            std::cout << std::endl;
+            std::cout << weight << std::endl;
+            EXPECT_EQ(copy_to_vector(path), copy_to_vector(unpruned_path));
+            EXPECT_EQ(weight, 6.0);
+        }
+    }
+
+    TEST(OABPBacktrackerTest, FindMaxPathWithXDropSkipsPrunedNodes) {
+        auto substitution_scorer {
+            simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_substitution(1.0f64, -1.0f64)
+        };
+        auto gap_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_gap(-1.0f64) };
+        auto freeride_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_freeride(0.0f64) };
+
+        // Only the leading "abcd" matches, after which everything is pruned within a few rows / columns
+        std::string seq1 { "abcd" + std::string(100zu, 'w') };
+        std::string seq2 { "abcd" + std::string(100zu, 'z') };
+        using G = pairwise_local_alignment_graph<
+            is_debug_mode(),
+            std::size_t,
+            std::float64_t,
+            decltype(seq1),
+            decltype(seq2),
+            decltype(substitution_scorer),
+            decltype(gap_scorer),
+            decltype(freeride_scorer)
+        >;
+        input_counting_graph<G> g { seq1, seq2, substitution_scorer, gap_scorer, freeride_scorer };
+        input_counting_graph<unsweepable_graph<G>> unsweepable_g { seq1, seq2, substitution_scorer, gap_scorer, freeride_scorer };
+        const std::size_t node_cnt { g.grid_down_cnt * g.grid_right_cnt };
+
+        const auto& [path, weight] {
+            backtracker<is_debug_mode(), input_counting_graph<G>, std::size_t, std::size_t> {}.find_max_path(g, 2.0f64)
+        };
+        const auto& [queued_path, queued_weight] {
+            backtracker<is_debug_mode(), input_counting_graph<unsweepable_graph<G>>, std::size_t, std::size_t> {}.find_max_path(
+                unsweepable_g,
+                2.0f64
+            )
+        };
+        EXPECT_EQ(weight, 4.0);
+        EXPECT_EQ(weight, queued_weight);
+        EXPECT_EQ(copy_to_vector(path), copy_to_vector(queued_path));
+        // The ready queue walks every node, while the sweep only walks the first few rows (until the root node gets pruned) plus a narrow
+        // band below them
+        EXPECT_GE(unsweepable_g.input_query_cnt, node_cnt);
+        EXPECT_LT(g.input_query_cnt, node_cnt / 10zu);
+        std::cout << g.input_query_cnt << " of " << node_cnt << " nodes walked" << std::endl;
+    }
+
+    TEST(OABPBacktrackerTest, FindMaxPathSweepMatchesReadyQueue) {
+        auto substitution_scorer {
+            simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_substitution(1.0f64, -1.0f64)
+        };
+        auto gap_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_gap(-1.0f64) };
+        auto freeride_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_freeride(0.0f64) };
+
+        std::string seq1 { "xxabcdefghxx" };
+        std::string seq2 { "yabcxefgy" };
+
+        {
+            using G = pairwise_global_alignment_graph<
+                is_debug_mode(),
+                std::size_t,
+                std::float64_t,
+                decltype(seq1),
+                decltype(seq2),
+                decltype(substitution_scorer),
+                decltype(gap_scorer)
+            >;
+            static_assert(row_major_sweepable_pairwise_alignment_graph<G>);
+            static_assert(!row_major_sweepable_pairwise_alignment_graph<unsweepable_graph<G>>);
+            // Sweeping doesn't track parent counts, so its slots don't hold one
+            static_assert(
+                std::is_same_v<
+                    backtracker<is_debug_mode(), G, std::size_t, std::size_t>::SLOT,
+                    sweep_slot<typename G::N, typename G::E, typename G::ED>
+                >
+            );
+            static_assert(
+                std::is_same_v<
+                    backtracker<is_debug_mode(), unsweepable_graph<G>, std::size_t, std::size_t>::SLOT,
+                    slot<typename G::N, typename G::E, typename G::ED, std::size_t>
+                >
+            );
+            G g { seq1, seq2, substitution_scorer, gap_scorer };
+            unsweepable_graph<G> unsweepable_g { seq1, seq2, substitution_scorer, gap_scorer };
+            const auto& [path, weight] {
+                backtracker<is_debug_mode(), G, std::size_t, std::size_t> {}.find_max_path(g)
+            };
+            const auto& [queued_path, queued_weight] {
+                backtracker<is_debug_mode(), unsweepable_graph<G>, std::size_t, std::size_t> {}.find_max_path(unsweepable_g)
+            };
+            EXPECT_EQ(copy_to_vector(path), copy_to_vector(queued_path));
+            EXPECT_EQ(weight, queued_weight);
+        }
+
+        {
+            using G = pairwise_local_alignment_graph<
+                is_debug_mode(),
+                std::size_t,
+                std::float64_t,
+                decltype(seq1),
+                decltype(seq2),
+                decltype(substitution_scorer),
+                decltype(gap_scorer),
+                decltype(freeride_scorer)
+            >;
+            static_assert(row_major_sweepable_pairwise_alignment_graph<G>);
+            G g { seq1, seq2, substitution_scorer, gap_scorer, freeride_scorer };
+            unsweepable_graph<G> unsweepable_g { seq1, seq2, substitution_scorer, gap_scorer, freeride_scorer };
+            const auto& [path, weight] {
+                backtracker<is_debug_mode(), G, std::size_t, std::size_t> {}.find_max_path(g)
+            };
+            const auto& [queued_path, queued_weight] {
+                backtracker<is_debug_mode(), unsweepable_graph<G>, std::size_t, std::size_t> {}.find_max_path(unsweepable_g)
+            };
+            EXPECT_EQ(copy_to_vector(path), copy_to_vector(queued_path));
+            EXPECT_EQ(weight, queued_weight);
+            EXPECT_EQ(weight, 5.0);
+        }
+    }
+
+    TEST(OABPBacktrackerTest, FindMaxPathTiledMatchesUntiled) {
+        auto substitution_scorer {
+            simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_substitution(1.0f64, -1.0f64)
+        };
+        auto gap_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_gap(-1.0f64) };
+        auto freeride_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_freeride(0.0f64) };
+
+        std::string seq1 { "xxabcdefghxx" };
+        std::string seq2 { "yabcxefgy" };
+
+        {
+            using G = pairwise_global_alignment_graph<
+                is_debug_mode(),
+                std::size_t,
+                std::float64_t,
+                decltype(seq1),
+                decltype(seq2),
+                decltype(substitution_scorer),
+                decltype(gap_scorer)
+            >;
+            G g { seq1, seq2, substitution_scorer, gap_scorer };
+            const auto& [untiled_path, untiled_weight] {
+                backtracker<is_debug_mode(), G, std::size_t, std::size_t> {
+                    0.0f64,
+                    {},
+                    std::numeric_limits<std::size_t>::max()
+                }.find_max_path(g)
+            };
+            for (std::size_t tile_size : { 1zu, 2zu, 3zu, 5zu, 128zu }) {
+                const auto& [path, weight] {
+                    backtracker<is_debug_mode(), G, std::size_t, std::size_t> { 0.0f64, {}, tile_size }.find_max_path(g)
+                };
+                EXPECT_EQ(copy_to_vector(path), copy_to_vector(untiled_path));
+                EXPECT_EQ(weight, untiled_weight);
+            }
+        }
+
+        {
+            using G = pairwise_local_alignment_graph<
+                is_debug_mode(),
+                std::size_t,
+                std::float64_t,
+                decltype(seq1),
+                decltype(seq2),
+                decltype(substitution_scorer),
+                decltype(gap_scorer),
+                decltype(freeride_scorer)
+            >;
+            G g { seq1, seq2, substitution_scorer, gap_scorer, freeride_scorer };
+            const auto& [untiled_path, untiled_weight] {
+                backtracker<is_debug_mode(), G, std::size_t, std::size_t> {
+                    0.0f64,
+                    {},
+                    std::numeric_limits<std::size_t>::max()
+                }.find_max_path(g)
+            };
+            for (std::size_t tile_size : { 1zu, 2zu, 3zu, 5zu, 128zu }) {
+                const auto& [path, weight] {
+                    backtracker<is_debug_mode(), G, std::size_t, std::size_t> { 0.0f64, {}, tile_size }.find_max_path(g)
+                };
+                EXPECT_EQ(copy_to_vector(path), copy_to_vector(untiled_path));
+                EXPECT_EQ(weight, untiled_weight);
+            }
+            EXPECT_EQ(untiled_weight, 5.0);
+        }
+    }
+
+    TEST(OABPBacktrackerTest, FindMaxPathParallelMatchesSequential) {
+        std::mt19937_64 rand { 12345 };
+        auto random_string {
+            [&](std::size_t len) {
+                std::string ret {};
+                for ([[maybe_unused]] auto _ : std::views::iota(0zu, len)) {
+                    ret += std::uniform_int_distribution<char>('a', 'd')(rand);
+                }
+                return ret;
+            }
+        };
+        auto substitution_scorer {
+            simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_substitution(1.0f64, -1.0f64)
+        };
+        auto gap_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_gap(-1.0f64) };
+        auto freeride_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_freeride(0.0f64) };
+
+        std::string seq1 { random_string(61zu) };
+        std::string seq2 { random_string(47zu) };
+
+        forkable_thread_pool<is_debug_mode(), void> thread_pool { 4zu };
+
+        {
+            using G = pairwise_global_alignment_graph<
+                is_debug_mode(),
+                std::size_t,
+                std::float64_t,
+                decltype(seq1),
+                decltype(seq2),
+                decltype(substitution_scorer),
+                decltype(gap_scorer)
+            >;
+            G g { seq1, seq2, substitution_scorer, gap_scorer };
+            const auto& [sequential_path, sequential_weight] {
+                backtracker<is_debug_mode(), G, std::size_t, std::size_t> {}.find_max_path(g)
+            };
+            for (std::size_t tile_size : { 1zu, 7zu, 16zu, 128zu }) {
+                const auto& [path, weight] {
+                    backtracker<is_debug_mode(), G, std::size_t, std::size_t> { 0.0f64, {}, tile_size }.find_max_path(g, thread_pool)
+                };
+                EXPECT_EQ(copy_to_vector(path), copy_to_vector(sequential_path));
+                EXPECT_EQ(weight, sequential_weight);
+            }
+        }
+
+        {
+            using G = pairwise_local_alignment_graph<
+                is_debug_mode(),
+                std::size_t,
+                std::float64_t,
+                decltype(seq1),
+                decltype(seq2),
+                decltype(substitution_scorer),
+                decltype(gap_scorer),
+                decltype(freeride_scorer)
+            >;
+            G g { seq1, seq2, substitution_scorer, gap_scorer, freeride_scorer };
+            const auto& [sequential_path, sequential_weight] {
+                backtracker<is_debug_mode(), G, std::size_t, std::size_t> {}.find_max_path(g)
+            };
+            for (std::size_t tile_size : { 1zu, 7zu, 16zu, 128zu }) {
+                const auto& [path, weight] {
+                    backtracker<is_debug_mode(), G, std::size_t, std::size_t> { 0.0f64, {}, tile_size }.find_max_path(g, thread_pool)
+                };
+                EXPECT_EQ(copy_to_vector(path), copy_to_vector(sequential_path));
+                EXPECT_EQ(weight, sequential_weight);
+            }
+        }
+    }
+
+    TEST(OABPBacktrackerTest, FindMaxPathParallelFromWithinThreadPool) {
+        auto substitution_scorer {
+            simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_substitution(1.0f64, -1.0f64)
+        };
+        auto gap_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_gap(-1.0f64) };
+        std::string seq1 { "thequickbrownfoxjumpsoverthelazydog" };
+        std::string seq2 { "aquickbrowndogjumpedoverthelazyfoxes" };
+        using G = pairwise_global_alignment_graph<
+            is_debug_mode(),
+            std::size_t,
+            std::float64_t,
+            decltype(seq1),
+            decltype(seq2),
+            decltype(substitution_scorer),
+            decltype(gap_scorer)
+        >;
+        G g { seq1, seq2, substitution_scorer, gap_scorer };
+        using E = typename G::E;
+        const auto& [sequential_path, sequential_weight] {
+            backtracker<is_debug_mode(), G, std::size_t, std::size_t> {}.find_max_path(g)
+        };
+
+        // A single-threaded pool is the worst case: the task invoking find_max_path() occupies the pool's only thread, so tiles only get
+        // walked if that task walks them itself while it waits.
+        forkable_thread_pool<is_debug_mode(), void> thread_pool { 1zu };
+        std::vector<E> path {};
+        std::float64_t weight {};
+        auto future {
+            thread_pool.queue(
+                [&](forkable_thread_pool<is_debug_mode(), void>& owner) {
+                    const auto& [path_, weight_] {
+                        backtracker<is_debug_mode(), G, std::size_t, std::size_t> { 0.0f64, {}, 4zu }.find_max_path(g, owner)
+                    };
+                    path = copy_to_vector(path_);
+                    weight = weight_;
+                }
+            )
+        };
+        ASSERT_TRUE(future.has_value());
+        using namespace std::chrono_literals;
+        ASSERT_EQ(future->wait_for(60s), std::future_status::ready);
+        future->get();
+        EXPECT_EQ(path, copy_to_vector(sequential_path));
+        EXPECT_EQ(weight, sequential_weight);
+    }
+
+    TEST(OABPBacktrackerTest, FindMaxPathParallelWithContainerCreatorPacks) {
+        auto substitution_scorer {
+            simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_substitution(1.0f64, -1.0f64)
+        };
+        auto gap_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_gap(-1.0f64) };
+        std::string seq1 { "thequickbrownfox" };
+        std::string seq2 { "aquickbrowndog" };
+        using G = pairwise_global_alignment_graph<
+            is_debug_mode(),
+            std::size_t,
+            std::float64_t,
+            decltype(seq1),
+            decltype(seq2),
+            decltype(substitution_scorer),
+            decltype(gap_scorer)
+        >;
+        using N = typename G::N;
+        using E = typename G::E;
+        using ED = typename G::ED;
+        G g { seq1, seq2, substitution_scorer, gap_scorer };
+        const auto& [sequential_path, sequential_weight] {
+            backtracker<is_debug_mode(), G, std::size_t, std::size_t> {}.find_max_path(g)
+        };
+
+        // Tile counters and pending tile lists come from the container creator pack, so every pack has to hand out containers that
+        // hold up when walking in parallel (1x1 tiles being the worst case for how many are needed).
+        forkable_thread_pool<is_debug_mode(), void> thread_pool { 2zu };
+        backtracker_workspace workspace {};
+        for (std::size_t tile_size : { 1zu, 3zu }) {
+            using STACK_CONTAINER_CREATOR_PACK = backtracker_stack_container_creator_pack<
+                is_debug_mode(),
+                N,
+                E,
+                ED,
+                std::size_t,
+                std::size_t,
+                17zu /*grid_down_cnt*/,
+                15zu /*grid_right_cnt*/,
+                1zu /*grid_depth_cnt*/,
+                (17zu - 1zu) + (15zu - 1zu) /*path_edge_capacity*/
+            >;
+            const auto& [stack_path, stack_weight] {
+                backtracker<is_debug_mode(), G, std::size_t, std::size_t, STACK_CONTAINER_CREATOR_PACK> {
+                    0.0f64,
+                    {},
+                    tile_size
+                }.find_max_path(g, thread_pool)
+            };
+            EXPECT_EQ(copy_to_vector(stack_path), copy_to_vector(sequential_path));
+            EXPECT_EQ(stack_weight, sequential_weight);
+
+            using WORKSPACE_CONTAINER_CREATOR_PACK = backtracker_workspace_container_creator_pack<
+                is_debug_mode(),
+                N,
+                E,
+                ED,
+                std::size_t,
+                std::size_t,
+                true
+            >;
+            const auto& [workspace_path, workspace_weight] {
+                backtracker<is_debug_mode(), G, std::size_t, std::size_t, WORKSPACE_CONTAINER_CREATOR_PACK> {
+                    0.0f64,
+                    { &workspace },
+                    tile_size
+                }.find_max_path(g, thread_pool)
+            };
+            EXPECT_EQ(copy_to_vector(workspace_path), copy_to_vector(sequential_path));
+            EXPECT_EQ(workspace_weight, sequential_weight);
+
+            using BANDED_CONTAINER_CREATOR_PACK = backtracker_banded_container_creator_pack<
+                is_debug_mode(),
+                N,
+                E,
+                ED,
+                std::size_t,
+                std::size_t
+            >;
+            const auto& [banded_path, banded_weight] {
+                backtracker<is_debug_mode(), G, std::size_t, std::size_t, BANDED_CONTAINER_CREATOR_PACK> {
+                    0.0f64,
+                    { g.grid_right_cnt },
+                    tile_size
+                }.find_max_path(g, thread_pool)
+            };
+            EXPECT_EQ(copy_to_vector(banded_path), copy_to_vector(sequential_path));
+            EXPECT_EQ(banded_weight, sequential_weight);
+        }
+    }
+
+    TEST(OABPBacktrackerTest, FindMaxPathReusingWorkspace) {
+        auto substitution_scorer {
+            simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_substitution(1.0f64, -1.0f64)
+        };
+        auto gap_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_gap(-1.0f64) };
+        using G = pairwise_global_alignment_graph<
+            is_debug_mode(),
+            std::size_t,
+            std::float64_t,
+            std::string,
+            std::string,
+            decltype(substitution_scorer),
+            decltype(gap_scorer)
+        >;
+        using CONTAINER_CREATOR_PACK = backtracker_workspace_container_creator_pack<
+            is_debug_mode(),
+            typename G::N,
+            typename G::E,
+            typename G::ED,
+            std::size_t,
+            std::size_t,
+            true
+        >;
+        using UNSWEEPABLE_CONTAINER_CREATOR_PACK = backtracker_workspace_container_creator_pack<
+            is_debug_mode(),
+            typename unsweepable_graph<G>::N,
+            typename unsweepable_graph<G>::E,
+            typename unsweepable_graph<G>::ED,
+            std::size_t,
+            std::size_t,
+            true
+        >;
+
+        // Graphs grow and shrink, and the swept / ready queue walks lease from the same workspace, so leased buffers are both reused
+        // and regrown.
+        backtracker_workspace workspace {};
+        std::mt19937_64 rand { 12345 };
+        for (std::size_t len : { 3zu, 20zu, 1zu, 35zu, 7zu, 35zu, 0zu, 12zu }) {
+            std::string seq1 {};
+            std::string seq2 {};
+            for (std::size_t i { 0zu }; i < len; ++i) {
+                seq1 += static_cast<char>('a' + rand() % 4zu);
+                seq2 += static_cast<char>('a' + rand() % 4zu);
+            }
+            seq2 += "xy";
+            G g { seq1, seq2, substitution_scorer, gap_scorer };
+            unsweepable_graph<G> unsweepable_g { seq1, seq2, substitution_scorer, gap_scorer };
+            const auto& [expected_path, expected_weight] {
+                backtracker<is_debug_mode(), G, std::size_t, std::size_t> {}.find_max_path(g)
+            };
+            const auto& [path, weight] {
+                backtracker<is_debug_mode(), G, std::size_t, std::size_t, CONTAINER_CREATOR_PACK> { {}, { &workspace } }.find_max_path(g)
+            };
+            const auto& [queued_path, queued_weight] {
+                backtracker<is_debug_mode(), unsweepable_graph<G>, std::size_t, std::size_t, UNSWEEPABLE_CONTAINER_CREATOR_PACK> {
+                    {},
+                    { &workspace }
+                }.find_max_path(unsweepable_g)
+            };
+            EXPECT_EQ(copy_to_vector(path), copy_to_vector(expected_path));
+            EXPECT_EQ(weight, expected_weight);
+            EXPECT_EQ(copy_to_vector(queued_path), copy_to_vector(expected_path));
+            EXPECT_EQ(queued_weight, expected_weight);
+            if (len == 35zu) {
+                workspace.shrink();
+            }
+        }
+    }
+
+    TEST(OABPBacktrackerTest, FindMaxPathWithHugePages) {
+        auto substitution_scorer {
+            simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_substitution(1.0f64, -1.0f64)
+        };
+        auto gap_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_gap(-1.0f64) };
+        using G = pairwise_global_alignment_graph<
+            is_debug_mode(),
+            std::size_t,
+            std::float64_t,
+            std::string,
+            std::string,
+            decltype(substitution_scorer),
+            decltype(gap_scorer)
+        >;
+        using CONTAINER_CREATOR_PACK = backtracker_huge_page_container_creator_pack<
+            is_debug_mode(),
+            typename G::N,
+            typename G::E,
+            typename G::ED,
+            std::size_t,
+            std::size_t,
+            false
+        >;
+
+        // The larger graph's slots span several huge pages, while the smaller graph's slots are a regular mapping.
+        std::mt19937_64 rand { 12345 };
+        for (std::size_t len : { 250zu, 10zu }) {
+            std::string seq1 {};
+            std::string seq2 {};
+            for (std::size_t i { 0zu }; i < len; ++i) {
+                seq1 += static_cast<char>('a' + rand() % 4zu);
+                seq2 += static_cast<char>('a' + rand() % 4zu);
+            }
+            G g { seq1, seq2, substitution_scorer, gap_scorer };
+            const auto& [expected_path, expected_weight] {
+                backtracker<is_debug_mode(), G, std::size_t, std::size_t> {}.find_max_path(g)
+            };
+            const auto& [path, weight] {
+                backtracker<is_debug_mode(), G, std::size_t, std::size_t, CONTAINER_CREATOR_PACK> {}.find_max_path(g)
+            };
+            EXPECT_EQ(copy_to_vector(path), copy_to_vector(expected_path));
+            EXPECT_EQ(weight, expected_weight);
+        }
+    }
+
+    TEST(OABPBacktrackerTest, FindMaxPathWithFileBackedSlots) {
+        auto substitution_scorer {
+            simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_substitution(1.0f64, -1.0f64)
+        };
+        auto gap_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_gap(-1.0f64) };
+        using G = pairwise_global_alignment_graph<
+            is_debug_mode(),
+            std::size_t,
+            std::float64_t,
+            std::string,
+            std::string,
+            decltype(substitution_scorer),
+            decltype(gap_scorer)
+        >;
+        using CONTAINER_CREATOR_PACK = backtracker_file_backed_container_creator_pack<
+            is_debug_mode(),
+            typename G::N,
+            typename G::E,
+            typename G::ED,
+            std::size_t,
+            std::size_t,
+            false
+        >;
+
+        std::mt19937_64 rand { 12345 };
+        for (std::size_t len : { 250zu, 10zu }) {
+            std::string seq1 {};
+            std::string seq2 {};
+            for (std::size_t i { 0zu }; i < len; ++i) {
+                seq1 += static_cast<char>('a' + rand() % 4zu);
+                seq2 += static_cast<char>('a' + rand() % 4zu);
+            }
+            G g { seq1, seq2, substitution_scorer, gap_scorer };
+            const auto& [expected_path, expected_weight] {
+                backtracker<is_debug_mode(), G, std::size_t, std::size_t> {}.find_max_path(g)
+            };
+            const auto& [path, weight] {
+                backtracker<is_debug_mode(), G, std::size_t, std::size_t, CONTAINER_CREATOR_PACK> {}.find_max_path(g)
+            };
+            EXPECT_EQ(copy_to_vector(path), copy_to_vector(expected_path));
+            EXPECT_EQ(weight, expected_weight);
+        }
+    }
 }
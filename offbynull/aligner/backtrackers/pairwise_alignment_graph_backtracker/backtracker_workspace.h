@@ -0,0 +1,184 @@
+#ifndef OFFBYNULL_ALIGNER_BACKTRACKERS_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_BACKTRACKER_WORKSPACE_H
+#define OFFBYNULL_ALIGNER_BACKTRACKERS_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_BACKTRACKER_WORKSPACE_H
+
+#include <any>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtracker_workspace {
+    class backtracker_workspace;
+
+    /**
+     * Vector leased out by a
+     * @ref offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtracker_workspace::backtracker_workspace.
+     * On destruction, the underlying storage (including any capacity gained while leased) is handed back to the workspace it was leased
+     * from rather than being freed, such that it can be leased out again by a subsequent backtracker invocation.
+     *
+     * A default constructed instance isn't leased from any workspace, meaning that it behaves like a plain `std::vector`.
+     *
+     * The behavior of this class is undefined if it outlives the workspace it was leased from.
+     *
+     * @tparam T Element type.
+     */
+    template<typename T>
+    class workspace_buffer {
+    private:
+        std::vector<T> buffer;
+        backtracker_workspace* workspace;
+        std::size_t entry_idx;
+
+        friend class backtracker_workspace;
+
+        workspace_buffer(std::vector<T>&& buffer_, backtracker_workspace* workspace_, std::size_t entry_idx_)
+        : buffer { std::move(buffer_) }
+        , workspace { workspace_ }
+        , entry_idx { entry_idx_ } {}
+
+        void give_back();
+
+    public:
+        /**
+         * Construct an empty
+         * @ref offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtracker_workspace::workspace_buffer that isn't
+         * leased from a workspace.
+         */
+        workspace_buffer()
+        : buffer {}
+        , workspace { nullptr }
+        , entry_idx { 0zu } {}
+
+        workspace_buffer(const workspace_buffer&) = delete;
+        workspace_buffer& operator=(const workspace_buffer&) = delete;
+
+        workspace_buffer(workspace_buffer&& other) noexcept
+        : buffer { std::move(other.buffer) }
+        , workspace { std::exchange(other.workspace, nullptr) }
+        , entry_idx { other.entry_idx } {}
+
+        workspace_buffer& operator=(workspace_buffer&& other) noexcept {
+            if (this != &other) {
+                give_back();
+                buffer = std::move(other.buffer);
+                workspace = std::exchange(other.workspace, nullptr);
+                entry_idx = other.entry_idx;
+            }
+            return *this;
+        }
+
+        ~workspace_buffer() {
+            give_back();
+        }
+
+        auto begin() { return buffer.begin(); }
+        auto begin() const { return buffer.begin(); }
+        auto end() { return buffer.end(); }
+        auto end() const { return buffer.end(); }
+        std::size_t size() const { return buffer.size(); }
+        bool empty() const { return buffer.empty(); }
+        T& operator[](std::size_t idx) { return buffer[idx]; }
+        const T& operator[](std::size_t idx) const { return buffer[idx]; }
+        T& back() { return buffer.back(); }
+        const T& back() const { return buffer.back(); }
+        void push_back(const T& value) { buffer.push_back(value); }
+        void push_back(T&& value) { buffer.push_back(std::move(value)); }
+        void pop_back() { buffer.pop_back(); }
+        void clear() { buffer.clear(); }
+        void reserve(std::size_t cnt) { buffer.reserve(cnt); }
+        void assign(std::size_t cnt, const T& value) { buffer.assign(cnt, value); }
+    };
+
+    /**
+     * Pool of reusable buffers for backtrackers, such that repeatedly aligning sequences doesn't repeatedly allocate (and free) the large
+     * containers each alignment requires (e.g., the slots for every node in the alignment graph). Buffers are leased out as
+     * @ref offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtracker_workspace::workspace_buffer instances, and
+     * return to the workspace once they're destroyed. A buffer's capacity is kept across leases, meaning that it only ever reallocates when
+     * a larger alignment graph than any seen before comes along.
+     *
+     * Buffers are pooled by element type, so a single workspace can be shared by backtrackers for different graph types (e.g., aligning
+     * with different weight types). The first idle buffer of the requested element type gets leased out, meaning that a backtracker which
+     * leases buffers in the same order on every invocation gets back the same buffers on every invocation.
+     *
+     * Workspaces aren't thread-safe. Each thread should have its own workspace.
+     */
+    class backtracker_workspace {
+    private:
+        struct entry {
+            std::any buffer;
+            bool leased;
+        };
+
+        std::vector<entry> entries;
+
+        template<typename T>
+        friend class workspace_buffer;
+
+        template<typename T>
+        void give_back(std::size_t entry_idx, std::vector<T>&& buffer) {
+            entry& e { entries[entry_idx] };
+            // Move into the std::vector already held by the std::any, so that std::any doesn't have to allocate new holder storage.
+            *std::any_cast<std::vector<T>>(&e.buffer) = std::move(buffer);
+            e.leased = false;
+        }
+
+    public:
+        /**
+         * Construct an empty
+         * @ref offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtracker_workspace::backtracker_workspace instance.
+         */
+        backtracker_workspace()
+        : entries {} {}
+
+        backtracker_workspace(const backtracker_workspace&) = delete;
+        backtracker_workspace& operator=(const backtracker_workspace&) = delete;
+
+        /**
+         * Lease out an idle buffer of element type `T`, creating one if no such buffer is idle. The buffer's contents are unspecified
+         * (e.g., elements left over from a previous lease), meaning that it should be cleared or assigned before use.
+         *
+         * @tparam T Element type.
+         * @return Leased buffer.
+         */
+        template<typename T>
+        workspace_buffer<T> lease() {
+            for (std::size_t i { 0zu }; i < entries.size(); ++i) {
+                entry& e { entries[i] };
+                if (e.leased) {
+                    continue;
+                }
+                if (!e.buffer.has_value()) {  // Freed by shrink()
+                    e.buffer.emplace<std::vector<T>>();
+                }
+                std::vector<T>* buffer { std::any_cast<std::vector<T>>(&e.buffer) };
+                if (buffer == nullptr) {
+                    continue;
+                }
+                e.leased = true;
+                return { std::exchange(*buffer, {}), this, i };
+            }
+            entries.push_back({ std::vector<T> {}, true });
+            return { std::vector<T> {}, this, entries.size() - 1zu };
+        }
+
+        /**
+         * Free all idle buffers (e.g., after aligning an unusually large pair of sequences). Buffers currently leased out are unaffected.
+         */
+        void shrink() {
+            for (entry& e : entries) {
+                if (!e.leased) {
+                    e.buffer.reset();
+                }
+            }
+        }
+    };
+
+    template<typename T>
+    void workspace_buffer<T>::give_back() {
+        if (workspace != nullptr) {
+            workspace->give_back(entry_idx, std::move(buffer));
+            workspace = nullptr;
+        }
+    }
+}
+
+#endif //OFFBYNULL_ALIGNER_BACKTRACKERS_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_BACKTRACKER_WORKSPACE_H
@@ -0,0 +1,63 @@
+#ifndef OFFBYNULL_ALIGNER_BACKTRACKERS_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_READY_QUEUE_READY_QUEUE_WORKSPACE_CONTAINER_CREATOR_PACK_H
+#define OFFBYNULL_ALIGNER_BACKTRACKERS_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_READY_QUEUE_READY_QUEUE_WORKSPACE_CONTAINER_CREATOR_PACK_H
+
+#include <cstddef>
+#include "offbynull/concepts.h"
+#include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/backtracker_workspace.h"
+#include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/ready_queue/unimplemented_ready_queue_container_creator_pack.h"
+#include "offbynull/utils.h"
+
+namespace offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::ready_queue
+        ::ready_queue_workspace_container_creator_pack {
+    using offbynull::concepts::widenable_to_size_t;
+    using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtracker_workspace::backtracker_workspace;
+    using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtracker_workspace::workspace_buffer;
+    using offbynull::utils::check_multiplication_nonoverflow_throwable;
+
+    /**
+     * @ref offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::ready_queue::ready_queue_container_creator_pack::ready_queue_container_creator_pack
+     * that leases its containers from a
+     * @ref offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtracker_workspace::backtracker_workspace, falling
+     * back to the heap if no workspace is set.
+     *
+     * @tparam debug_mode `true` to enable debugging logic, `false` otherwise.
+     * @tparam SLOT_INDEX Slot indexer type. Must be wide enough to hold the value `grid_down_cnt * grid_right_cnt * grid_depth_cnt`
+     *     (variables being multiplied are the dimensions of the underlying pairwise alignment graph instance).
+     * @tparam minimize_allocations `true` to force `create_queue_container()` to reserve `grid_down_cnt * grid_right_cnt * grid_depth_cnt`
+     *     elements, thereby removing/reducing the need for adhoc reallocations, `false` otherwise.
+     */
+    template<
+        bool debug_mode,
+        widenable_to_size_t SLOT_INDEX,
+        bool minimize_allocations
+    >
+    struct ready_queue_workspace_container_creator_pack {
+        /**
+         * Workspace to lease containers from, or `nullptr` to allocate containers on the heap.
+         */
+        backtracker_workspace* workspace { nullptr };
+
+        /**
+         * @copydoc offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::ready_queue::unimplemented_ready_queue_container_creator_pack::unimplemented_ready_queue_container_creator_pack::create_queue_container
+         */
+        workspace_buffer<SLOT_INDEX> create_queue_container(
+            std::size_t grid_down_cnt,
+            std::size_t grid_right_cnt,
+            std::size_t grid_depth_cnt
+        ) const {
+            if constexpr (debug_mode) {
+                check_multiplication_nonoverflow_throwable<std::size_t>(grid_down_cnt, grid_right_cnt, grid_depth_cnt);
+            }
+            workspace_buffer<SLOT_INDEX> ret {};
+            if (workspace != nullptr) {
+                ret = workspace->lease<SLOT_INDEX>();
+                ret.clear();
+            }
+            if constexpr (minimize_allocations) {
+                ret.reserve(grid_down_cnt * grid_right_cnt * grid_depth_cnt);
+            }
+            return ret;
+        }
+    };
+}
+#endif //OFFBYNULL_ALIGNER_BACKTRACKERS_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_READY_QUEUE_READY_QUEUE_WORKSPACE_CONTAINER_CREATOR_PACK_H
@@ -26,6 +26,12 @@ namespace offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker
      * or the backtracking algorithm has processed all parent nodes and this node as well (holding on to the incoming edge with the highest
      * accumulated weight).
      *
+     * Only used when nodes are walked as they become ready. Backtracking algorithms that walk nodes in a known topological order (e.g.,
+     * sweeping a
+     * @ref offbynull::aligner::graph::pairwise_alignment_graph::row_major_sweepable_pairwise_alignment_graph) use
+     * @ref offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::slot_container::sweep_slot::sweep_slot instead, which
+     * doesn't hold `unwalked_parent_cnt`.
+     *
      * Struct is packed when `OBN_PACK_STRUCTS` macro is defined (and platform supports struct packing).
      *
      * @tparam N Graph node identifier type.
@@ -46,9 +52,9 @@ namespace offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker
         N node;
         /** Number of `node` parents that have yet to be walked. */
         PARENT_COUNT unwalked_parent_cnt;
-        /** Backtracking edge (value is valid only if `unwalked_parent_cnt == 0`). */
+        /** Backtracking edge (value is valid only once `node` has been walked). */
         E backtracking_edge;
-        /** Backtracking weight (value is valid only if `unwalked_parent_cnt == 0`). */
+        /** Backtracking weight (value is valid only once `node` has been walked). */
         ED backtracking_weight;
 
         /**
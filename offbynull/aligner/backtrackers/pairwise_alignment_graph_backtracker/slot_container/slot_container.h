@@ -7,8 +7,11 @@
 #include <limits>
 #include <stdexcept>
 #include <ranges>
+#include <concepts>
 #include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/slot_container/slot.h"
+#include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/slot_container/sweep_slot.h"
 #include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/slot_container/slot_container_container_creator_pack.h"
+#include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/slot_container/sweep_slot_container_container_creator_pack.h"
 #include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/slot_container/slot_container_heap_container_creator_pack.h"
 #include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/backtrackable_node.h"
 #include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/backtrackable_edge.h"
@@ -23,8 +26,11 @@ namespace offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker
     using offbynull::concepts::widenable_to_size_t;
     using offbynull::aligner::graph::pairwise_alignment_graph::pairwise_alignment_graph;
     using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::slot_container::slot::slot;
+    using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::slot_container::sweep_slot::sweep_slot;
     using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::slot_container::slot_container_container_creator_pack
         ::slot_container_container_creator_pack;
+    using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::slot_container
+        ::sweep_slot_container_container_creator_pack::sweep_slot_container_container_creator_pack;
     using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::slot_container::slot_container_heap_container_creator_pack
         ::slot_container_heap_container_creator_pack;
     using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtrackable_node::backtrackable_node;
@@ -45,6 +51,12 @@ namespace offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker
      * @tparam SLOT_INDEX Slot indexer type. Must be wide enough to hold the value `grid_down_cnt * grid_right_cnt * grid_depth_cnt`
      *     (variables being multiplied are the dimensions of the `G` instance).
      * @tparam CONTAINER_CREATOR_PACK Container factory type.
+     * @tparam SLOT Slot type, either
+     *     @ref offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::slot_container::slot::slot or (if the owning
+     *     backtracker walks nodes in a known topological order, meaning that parent counts aren't needed)
+     *     @ref offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::slot_container::sweep_slot::sweep_slot. If the
+     *     latter, `PARENT_COUNT` is unused and `CONTAINER_CREATOR_PACK` must also satisfy
+     *     @ref offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::slot_container::sweep_slot_container_container_creator_pack::sweep_slot_container_container_creator_pack.
      */
     template<
         bool debug_mode,
@@ -64,8 +76,20 @@ namespace offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker
             typename G::ED,
             PARENT_COUNT,
             SLOT_INDEX
-        >
+        >,
+        typename SLOT = slot<typename G::N, typename G::E, typename G::ED, PARENT_COUNT>
     >
+    requires std::same_as<SLOT, slot<typename G::N, typename G::E, typename G::ED, PARENT_COUNT>>
+        || (
+            std::same_as<SLOT, sweep_slot<typename G::N, typename G::E, typename G::ED>>
+            && sweep_slot_container_container_creator_pack<
+                CONTAINER_CREATOR_PACK,
+                typename G::N,
+                typename G::E,
+                typename G::ED,
+                SLOT_INDEX
+            >
+        )
     class slot_container {
     private:
         using N = typename G::N;
@@ -74,10 +98,27 @@ namespace offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker
         using ED = typename G::ED;
         using N_INDEX = typename G::N_INDEX;
 
-        using SLOT_CONTAINER = decltype(std::declval<CONTAINER_CREATOR_PACK>().create_slot_container(0zu, 0zu, 0zu, std::declval<ED>()));
+        static constexpr bool parent_counted { std::same_as<SLOT, slot<N, E, ED, PARENT_COUNT>> };
+
+        static auto create_slots(const CONTAINER_CREATOR_PACK& container_creator_pack, const G& g, ED zero_weight) {
+            if constexpr (parent_counted) {
+                return container_creator_pack.create_slot_container(g.grid_down_cnt, g.grid_right_cnt, g.grid_depth_cnt, zero_weight);
+            } else {
+                return container_creator_pack.create_sweep_slot_container(g.grid_down_cnt, g.grid_right_cnt, g.grid_depth_cnt, zero_weight);
+            }
+        }
+
+        using SLOT_CONTAINER = decltype(create_slots(std::declval<CONTAINER_CREATOR_PACK>(), std::declval<G>(), std::declval<ED>()));
 
         const G& g;
         SLOT_CONTAINER slots;
+        std::size_t slots_right_cnt;
+
+        std::size_t to_idx(std::size_t down_offset, std::size_t right_offset, std::size_t depth) const {
+            // Containers narrower than the graph (e.g., banded) wrap columns around.
+            const std::size_t column { right_offset < slots_right_cnt ? right_offset : right_offset % slots_right_cnt };
+            return (g.grid_depth_cnt * ((down_offset * slots_right_cnt) + column)) + depth;
+        }
 
     public:
         // Concepts for params have been commented out because THEY FAIL when you pass in a std::views::common(...)'s
@@ -108,34 +149,30 @@ namespace offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker
          */
         slot_container(
             const G& g_,
-            input_iterator_of_non_cvref<slot<N, E, ED, PARENT_COUNT>> auto begin,
+            input_iterator_of_non_cvref<SLOT> auto begin,
             std::sentinel_for<decltype(begin)> auto end,
             ED zero_weight,
             CONTAINER_CREATOR_PACK container_creator_pack = {}
         )
         : g { g_ }
-        , slots {
-            container_creator_pack.create_slot_container(
-                g.grid_down_cnt,
-                g.grid_right_cnt,
-                g.grid_depth_cnt,
-                zero_weight
-            )
-        } {
+        , slots { create_slots(container_creator_pack, g, zero_weight) }
+        , slots_right_cnt { slots.size() / (g.grid_down_cnt * g.grid_depth_cnt) } {
             if constexpr (debug_mode) {
                 check_multiplication_nonoverflow_throwable<SLOT_INDEX>(g.grid_down_cnt, g.grid_right_cnt, g.grid_depth_cnt);
                 if (std::numeric_limits<SLOT_INDEX>::max() < g.grid_down_cnt * g.grid_right_cnt * g.grid_depth_cnt) {
                     throw std::runtime_error { "SLOT_INDEX not wide enough to support grid_down_cnt * grid_right_cnt * grid_depth_cnt" };
                 }
-                if (std::numeric_limits<PARENT_COUNT>::max() < g.node_incoming_edge_capacity) {
-                    throw std::runtime_error { "PARENT_COUNT not wide enough to support node_incoming_edge_capacity" };
+                if constexpr (parent_counted) {
+                    if (std::numeric_limits<PARENT_COUNT>::max() < g.node_incoming_edge_capacity) {
+                        throw std::runtime_error { "PARENT_COUNT not wide enough to support node_incoming_edge_capacity" };
+                    }
                 }
             }
             auto it { begin };
             while (it != end) {
                 const auto& slot { *it };
                 const auto& [down_offset, right_offset, depth] { g.node_to_grid_offset(slot.node) };
-                std::size_t idx { (g.grid_depth_cnt * ((down_offset * g.grid_right_cnt) + right_offset)) + depth };
+                std::size_t idx { to_idx(down_offset, right_offset, depth) };
                 slots[idx] = slot;
                 ++it;
             }
@@ -152,9 +189,7 @@ namespace offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker
         SLOT_INDEX find_idx(const N& node) const {
             const auto& [down_offset, right_offset, depth] { g.node_to_grid_offset(node) };
             SLOT_INDEX ret {
-                static_cast<SLOT_INDEX>(
-                    (g.grid_depth_cnt * ((down_offset * g.grid_right_cnt) + right_offset)) + depth
-                )  // Cast to prevent narrowing warning
+                static_cast<SLOT_INDEX>(to_idx(down_offset, right_offset, depth))  // Cast to prevent narrowing warning
             };
             if constexpr (debug_mode) {
                 if (ret >= slots.size()) {
@@ -173,9 +208,9 @@ namespace offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker
          * @param node Identifier of node to find.
          * @return Reference to slot assigned to `node`.
          */
-        slot<N, E, ED, PARENT_COUNT>& find_ref(const N& node) {
+        SLOT& find_ref(const N& node) {
             std::size_t idx { find_idx(node) };
-            slot<N, E, ED, PARENT_COUNT>& slot { slots[idx] };
+            SLOT& slot { slots[idx] };
             return slot;
         }
 
@@ -188,9 +223,9 @@ namespace offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker
          * @param node Identifier of node to find.
          * @return Reference to slot assigned to `node`.
          */
-        const slot<N, E, ED, PARENT_COUNT>& find_ref(const N& node) const {
+        const SLOT& find_ref(const N& node) const {
             std::size_t idx { find_idx(node) };
-            const slot<N, E, ED, PARENT_COUNT>& slot { slots[idx] };
+            const SLOT& slot { slots[idx] };
             return slot;
         }
 
@@ -202,7 +237,7 @@ namespace offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker
          * @param idx Index of slot
          * @return Reference to slot at `idx`.
          */
-        slot<N, E, ED, PARENT_COUNT>& at_idx(const SLOT_INDEX idx) {
+        SLOT& at_idx(const SLOT_INDEX idx) {
             if constexpr (debug_mode) {
                 if (idx >= slots.size()) {
                     throw std::runtime_error { "Out of bounds" };
@@ -219,7 +254,7 @@ namespace offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker
          * @param idx Index of slot
          * @return Reference to slot at `idx`.
          */
-        const slot<N, E, ED, PARENT_COUNT>& at_idx(const SLOT_INDEX idx) const {
+        const SLOT& at_idx(const SLOT_INDEX idx) const {
             if constexpr (debug_mode) {
                 if (idx >= slots.size()) {
                     throw std::runtime_error { "Out of bounds" };
@@ -237,9 +272,9 @@ namespace offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker
          * @param node Identifier of node to find.
          * @return Index of and reference to slot assigned to `node`.
          */
-        std::pair<SLOT_INDEX, slot<N, E, ED, PARENT_COUNT>&> find(const N& node) {
+        std::pair<SLOT_INDEX, SLOT&> find(const N& node) {
             SLOT_INDEX idx { find_idx(node) };
-            slot<N, E, ED, PARENT_COUNT>& slot { slots[idx] };
+            SLOT& slot { slots[idx] };
             return { idx, slot };
         }
 
@@ -252,9 +287,9 @@ namespace offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker
          * @param node Identifier of node to find.
          * @return Index of and reference to slot assigned to `node`.
          */
-        std::pair<SLOT_INDEX, const slot<N, E, ED, PARENT_COUNT>&> find(const N& node) const {
+        std::pair<SLOT_INDEX, const SLOT&> find(const N& node) const {
             SLOT_INDEX idx { find_idx(node) };
-            const slot<N, E, ED, PARENT_COUNT>& slot { slots[idx] };
+            const SLOT& slot { slots[idx] };
             return { idx, slot };
         }
     };
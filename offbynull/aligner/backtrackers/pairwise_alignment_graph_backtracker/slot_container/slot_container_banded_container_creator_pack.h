@@ -0,0 +1,111 @@
+#ifndef OFFBYNULL_ALIGNER_BACKTRACKERS_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_SLOT_CONTAINER_SLOT_CONTAINER_BANDED_CONTAINER_CREATOR_PACK_H
+#define OFFBYNULL_ALIGNER_BACKTRACKERS_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_SLOT_CONTAINER_SLOT_CONTAINER_BANDED_CONTAINER_CREATOR_PACK_H
+
+#include <cstddef>
+#include <algorithm>
+#include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/backtrackable_node.h"
+#include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/backtrackable_edge.h"
+#include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/slot_container/slot_container_container_creator_pack.h"
+#include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/slot_container/slot_container_heap_container_creator_pack.h"
+#include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/slot_container/unimplemented_slot_container_container_creator_pack.h"
+#include "offbynull/aligner/concepts.h"
+#include "offbynull/concepts.h"
+
+namespace offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::slot_container
+        ::slot_container_banded_container_creator_pack {
+    using offbynull::aligner::concepts::weight;
+    using offbynull::concepts::widenable_to_size_t;
+    using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtrackable_node::backtrackable_node;
+    using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtrackable_edge::backtrackable_edge;
+    using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::slot_container::slot_container_container_creator_pack
+        ::slot_container_container_creator_pack;
+    using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::slot_container::slot_container_heap_container_creator_pack
+        ::slot_container_heap_container_creator_pack;
+
+    /**
+     * @ref offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::slot_container::slot_container_container_creator_pack::slot_container_container_creator_pack
+     * that creates containers holding at most `band_width` columns per row, intended for graphs where only a diagonal band of each row
+     * exists (e.g.,
+     * @ref offbynull::aligner::graphs::banded_sliceable_pairwise_alignment_graph::banded_sliceable_pairwise_alignment_graph). The
+     * containers themselves are created by a backing container creator pack.
+     *
+     * @ref offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::slot_container::slot_container::slot_container wraps
+     * columns around when its container holds fewer columns than the graph's rows, so the behavior is undefined if any row of the graph
+     * has nodes spanning more than `band_width` columns.
+     *
+     * @tparam debug_mode `true` to enable debugging logic, `false` otherwise.
+     * @tparam N Graph node identifier type.
+     * @tparam E Graph edge identifier type.
+     * @tparam ED Graph edge data type (edge weight).
+     * @tparam PARENT_COUNT Graph node incoming edge counter type. Must be wide enough to hold the maximum number of incoming edges across
+     *      all nodes in the underlying pairwise alignment graph instance (e.g., across all nodes in any global pairwise alignment graph, a
+     *      node can have at most 3 incoming edges).
+     * @tparam SLOT_INDEX Slot indexer type. Must be wide enough to hold the value `grid_down_cnt * band_width * grid_depth_cnt`
+     *     (variables being multiplied are the dimensions of the underlying graph).
+     * @tparam BACKING_CONTAINER_CREATOR_PACK Container factory type that containers are created with.
+     */
+    template<
+        bool debug_mode,
+        backtrackable_node N,
+        backtrackable_edge E,
+        weight ED,
+        widenable_to_size_t PARENT_COUNT,
+        widenable_to_size_t SLOT_INDEX,
+        slot_container_container_creator_pack<
+            N,
+            E,
+            ED,
+            PARENT_COUNT,
+            SLOT_INDEX
+        > BACKING_CONTAINER_CREATOR_PACK = slot_container_heap_container_creator_pack<
+            debug_mode,
+            N,
+            E,
+            ED,
+            PARENT_COUNT,
+            SLOT_INDEX
+        >
+    >
+    struct slot_container_banded_container_creator_pack {
+        /** Maximum number of columns held per row. */
+        std::size_t band_width;
+        /** Container factory that containers are created with. */
+        BACKING_CONTAINER_CREATOR_PACK backing_container_creator_pack {};
+
+        /**
+         * @copydoc offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::slot_container::unimplemented_slot_container_container_creator_pack::unimplemented_slot_container_container_creator_pack::create_slot_container
+         */
+        auto create_slot_container(
+            std::size_t grid_down_cnt,
+            std::size_t grid_right_cnt,
+            std::size_t grid_depth_cnt,
+            ED zero_weight
+        ) const {
+            return backing_container_creator_pack.create_slot_container(
+                grid_down_cnt,
+                std::min(grid_right_cnt, band_width),
+                grid_depth_cnt,
+                zero_weight
+            );
+        }
+
+        /**
+         * @copydoc offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::slot_container::unimplemented_slot_container_container_creator_pack::unimplemented_slot_container_container_creator_pack::create_sweep_slot_container
+         */
+        auto create_sweep_slot_container(
+            std::size_t grid_down_cnt,
+            std::size_t grid_right_cnt,
+            std::size_t grid_depth_cnt,
+            ED zero_weight
+        ) const {
+            return backing_container_creator_pack.create_sweep_slot_container(
+                grid_down_cnt,
+                std::min(grid_right_cnt, band_width),
+                grid_depth_cnt,
+                zero_weight
+            );
+        }
+    };
+}
+
+#endif //OFFBYNULL_ALIGNER_BACKTRACKERS_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_SLOT_CONTAINER_SLOT_CONTAINER_BANDED_CONTAINER_CREATOR_PACK_H
@@ -0,0 +1,112 @@
+#ifndef OFFBYNULL_ALIGNER_BACKTRACKERS_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_SLOT_CONTAINER_SLOT_CONTAINER_FILE_BACKED_CONTAINER_CREATOR_PACK_H
+#define OFFBYNULL_ALIGNER_BACKTRACKERS_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_SLOT_CONTAINER_SLOT_CONTAINER_FILE_BACKED_CONTAINER_CREATOR_PACK_H
+
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <boost/filesystem.hpp>
+#include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/backtrackable_node.h"
+#include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/backtrackable_edge.h"
+#include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/slot_container/slot.h"
+#include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/slot_container/sweep_slot.h"
+#include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/slot_container/unimplemented_slot_container_container_creator_pack.h"
+#include "offbynull/aligner/concepts.h"
+#include "offbynull/concepts.h"
+#include "offbynull/helpers/file_backed_array.h"
+#include "offbynull/utils.h"
+
+namespace offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::slot_container
+        ::slot_container_file_backed_container_creator_pack {
+    using offbynull::aligner::concepts::weight;
+    using offbynull::concepts::widenable_to_size_t;
+    using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtrackable_node::backtrackable_node;
+    using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtrackable_edge::backtrackable_edge;
+    using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::slot_container::slot::slot;
+    using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::slot_container::sweep_slot::sweep_slot;
+    using offbynull::helpers::file_backed_array::file_backed_array;
+    using offbynull::utils::check_multiplication_nonoverflow_throwable;
+
+    /**
+     * @ref offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::slot_container::slot_container_container_creator_pack::slot_container_container_creator_pack
+     * that allocates its containers as memory-mapped scratch files within some directory (see
+     * @ref offbynull::helpers::file_backed_array::file_backed_array). Intended for graphs whose slot container doesn't fit in RAM but
+     * does fit on local disk (e.g., NVMe), where a single pass of dynamic programming over disk is cheaper than the ~2x recomputation
+     * that sliced subdivision incurs.
+     *
+     * This pack is only available on POSIX systems.
+     *
+     * @tparam debug_mode `true` to enable debugging logic, `false` otherwise.
+     * @tparam N Graph node identifier type.
+     * @tparam E Graph edge identifier type.
+     * @tparam ED Graph edge data type (edge weight).
+     * @tparam PARENT_COUNT Graph node incoming edge counter type. Must be wide enough to hold the maximum number of incoming edges across
+     *      all nodes in the underlying pairwise alignment graph instance (e.g., across all nodes in any global pairwise alignment graph, a
+     *      node can have at most 3 incoming edges).
+     * @tparam SLOT_INDEX Slot indexer type. Must be wide enough to hold the value `grid_down_cnt * grid_right_cnt * grid_depth_cnt`
+     *     (variables being multiplied are the dimensions of the underlying graph).
+     */
+    template<
+        bool debug_mode,
+        backtrackable_node N,
+        backtrackable_edge E,
+        weight ED,
+        widenable_to_size_t PARENT_COUNT,
+        widenable_to_size_t SLOT_INDEX
+    >
+    struct slot_container_file_backed_container_creator_pack {
+        /** Directory to create scratch files in. */
+        boost::filesystem::path directory { boost::filesystem::temp_directory_path() };
+
+        /**
+         * @copydoc offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::slot_container::unimplemented_slot_container_container_creator_pack::unimplemented_slot_container_container_creator_pack::create_slot_container
+         */
+        file_backed_array<slot<N, E, ED, PARENT_COUNT>> create_slot_container(
+            std::size_t grid_down_cnt,
+            std::size_t grid_right_cnt,
+            std::size_t grid_depth_cnt,
+            ED zero_weight
+        ) const {
+            if constexpr (debug_mode) {
+                check_multiplication_nonoverflow_throwable<std::size_t>(grid_down_cnt, grid_right_cnt, grid_depth_cnt);
+            }
+            std::size_t cnt { (grid_down_cnt * grid_right_cnt) * grid_depth_cnt };
+            if constexpr (debug_mode) {
+                if (std::numeric_limits<SLOT_INDEX>::max() < cnt) {
+                    throw std::runtime_error { "SLOT_INDEX not wide enough to support grid_down_cnt * grid_right_cnt * grid_depth_cnt" };
+                }
+            }
+            return file_backed_array<slot<N, E, ED, PARENT_COUNT>>(
+                cnt,
+                slot<N, E, ED, PARENT_COUNT> { {}, {}, zero_weight },
+                directory
+            );
+        }
+
+        /**
+         * @copydoc offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::slot_container::unimplemented_slot_container_container_creator_pack::unimplemented_slot_container_container_creator_pack::create_sweep_slot_container
+         */
+        file_backed_array<sweep_slot<N, E, ED>> create_sweep_slot_container(
+            std::size_t grid_down_cnt,
+            std::size_t grid_right_cnt,
+            std::size_t grid_depth_cnt,
+            ED zero_weight
+        ) const {
+            if constexpr (debug_mode) {
+                check_multiplication_nonoverflow_throwable<std::size_t>(grid_down_cnt, grid_right_cnt, grid_depth_cnt);
+            }
+            std::size_t cnt { (grid_down_cnt * grid_right_cnt) * grid_depth_cnt };
+            if constexpr (debug_mode) {
+                if (std::numeric_limits<SLOT_INDEX>::max() < cnt) {
+                    throw std::runtime_error { "SLOT_INDEX not wide enough to support grid_down_cnt * grid_right_cnt * grid_depth_cnt" };
+                }
+            }
+            return file_backed_array<sweep_slot<N, E, ED>>(
+                cnt,
+                sweep_slot<N, E, ED> { {}, zero_weight },
+                directory
+            );
+        }
+    };
+}
+
+#endif //OFFBYNULL_ALIGNER_BACKTRACKERS_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_SLOT_CONTAINER_SLOT_CONTAINER_FILE_BACKED_CONTAINER_CREATOR_PACK_H
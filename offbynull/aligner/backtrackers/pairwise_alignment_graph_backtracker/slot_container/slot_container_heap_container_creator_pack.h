@@ -9,6 +9,7 @@
 #include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/backtrackable_node.h"
 #include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/backtrackable_edge.h"
 #include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/slot_container/slot.h"
+#include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/slot_container/sweep_slot.h"
 #include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/slot_container/unimplemented_slot_container_container_creator_pack.h"
 #include "offbynull/aligner/concepts.h"
 #include "offbynull/concepts.h"
@@ -21,6 +22,7 @@ namespace offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker
     using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtrackable_node::backtrackable_node;
     using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtrackable_edge::backtrackable_edge;
     using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::slot_container::slot::slot;
+    using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::slot_container::sweep_slot::sweep_slot;
     using offbynull::utils::check_multiplication_nonoverflow_throwable;
     using offbynull::utils::copy_to_vector;
 
@@ -70,6 +72,30 @@ namespace offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker
                 | std::views::transform([=](const auto&) { return slot<N, E, ED, PARENT_COUNT> { {}, {}, zero_weight }; })
             );
         }
+
+        /**
+         * @copydoc offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::slot_container::unimplemented_slot_container_container_creator_pack::unimplemented_slot_container_container_creator_pack::create_sweep_slot_container
+         */
+        std::vector<sweep_slot<N, E, ED>> create_sweep_slot_container(
+            std::size_t grid_down_cnt,
+            std::size_t grid_right_cnt,
+            std::size_t grid_depth_cnt,
+            ED zero_weight
+        ) const {
+            if constexpr (debug_mode) {
+                check_multiplication_nonoverflow_throwable<std::size_t>(grid_down_cnt, grid_right_cnt, grid_depth_cnt);
+            }
+            std::size_t cnt { (grid_down_cnt * grid_right_cnt) * grid_depth_cnt };
+            if constexpr (debug_mode) {
+                if (std::numeric_limits<SLOT_INDEX>::max() < cnt) {
+                    throw std::runtime_error { "SLOT_INDEX not wide enough to support grid_down_cnt * grid_right_cnt * grid_depth_cnt" };
+                }
+            }
+            return copy_to_vector(
+                std::views::iota(0zu, cnt)
+                | std::views::transform([=](const auto&) { return sweep_slot<N, E, ED> { {}, zero_weight }; })
+            );
+        }
     };
 }
 
@@ -8,6 +8,7 @@
 #include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/backtrackable_node.h"
 #include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/backtrackable_edge.h"
 #include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/slot_container/slot.h"
+#include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/slot_container/sweep_slot.h"
 #include "offbynull/aligner/concepts.h"
 #include "offbynull/concepts.h"
 #include "offbynull/utils.h"
@@ -19,6 +20,7 @@ namespace offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker
     using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtrackable_node::backtrackable_node;
     using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtrackable_edge::backtrackable_edge;
     using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::slot_container::slot::slot;
+    using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::slot_container::sweep_slot::sweep_slot;
     using offbynull::utils::check_multiplication_nonoverflow;
     using offbynull::utils::check_multiplication_nonoverflow_throwable;
     using offbynull::utils::static_vector_typer;
@@ -55,7 +57,7 @@ namespace offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker
         // Line below errors out if ELEM_COUNT will result in an overflow
         static_assert(check_multiplication_nonoverflow<std::size_t>(max_grid_down_cnt, max_grid_right_cnt, max_grid_depth_cnt));
 
-        /** Maximum number of element allowed in returned `create_slot_container()` container. */
+        /** Maximum number of element allowed in returned `create_slot_container()` / `create_sweep_slot_container()` container. */
         static constexpr std::size_t ELEM_COUNT { max_grid_down_cnt * max_grid_right_cnt * max_grid_depth_cnt };
 
         /** `create_slot_container()` return type. */
@@ -65,6 +67,13 @@ namespace offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker
             ELEM_COUNT
         >::type;
 
+        /** `create_sweep_slot_container()` return type. */
+        using SWEEP_CONTAINER_TYPE = typename static_vector_typer<
+            debug_mode,
+            sweep_slot<N, E, ED>,
+            ELEM_COUNT
+        >::type;
+
         /**
          * @copydoc offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::slot_container::unimplemented_slot_container_container_creator_pack::unimplemented_slot_container_container_creator_pack::create_slot_container
          */
@@ -92,6 +101,34 @@ namespace offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker
             };
             return CONTAINER_TYPE(r.begin(), r.end());
         }
+
+        /**
+         * @copydoc offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::slot_container::unimplemented_slot_container_container_creator_pack::unimplemented_slot_container_container_creator_pack::create_sweep_slot_container
+         */
+        SWEEP_CONTAINER_TYPE create_sweep_slot_container(
+            std::size_t grid_down_cnt,
+            std::size_t grid_right_cnt,
+            std::size_t grid_depth_cnt,
+            ED zero_weight
+        ) const {
+            if constexpr (debug_mode) {
+                check_multiplication_nonoverflow_throwable<std::size_t>(grid_down_cnt, grid_right_cnt, grid_depth_cnt);
+            }
+            std::size_t cnt { (grid_down_cnt * grid_right_cnt) * grid_depth_cnt };
+            if constexpr (debug_mode) {
+                if (std::numeric_limits<SLOT_INDEX>::max() < cnt) {
+                    throw std::runtime_error { "SLOT_INDEX not wide enough to support grid_down_cnt * grid_right_cnt * grid_depth_cnt" };
+                }
+                if (cnt > ELEM_COUNT) {
+                    throw std::runtime_error { "Bad element count" };
+                }
+            }
+            auto r {
+                std::views::iota(0zu, cnt)
+                | std::views::transform([=](const auto&) { return sweep_slot<N, E, ED> { {}, zero_weight }; })
+            };
+            return SWEEP_CONTAINER_TYPE(r.begin(), r.end());
+        }
     };
 }
 
@@ -0,0 +1,63 @@
+#ifndef OFFBYNULL_ALIGNER_BACKTRACKERS_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_SLOT_CONTAINER_SWEEP_SLOT_H
+#define OFFBYNULL_ALIGNER_BACKTRACKERS_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_SLOT_CONTAINER_SWEEP_SLOT_H
+
+#include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/backtrackable_node.h"
+#include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/backtrackable_edge.h"
+#include "offbynull/aligner/graph/pairwise_alignment_graph.h"
+#include "offbynull/utils.h"
+#include "offbynull/concepts.h"
+
+namespace offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::slot_container::sweep_slot {
+    using offbynull::aligner::concepts::weight;
+    using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtrackable_node::backtrackable_node;
+    using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtrackable_edge::backtrackable_edge;
+
+    PACK_STRUCT_START
+    /**
+     * Element within
+     * @ref offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::slot_container::slot_container::slot_container, used
+     * in place of @ref offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::slot_container::slot::slot when the
+     * @ref offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtracker::backtracker "backtracking algorithm"
+     * sweeps a
+     * @ref offbynull::aligner::graph::pairwise_alignment_graph::row_major_sweepable_pairwise_alignment_graph. A sweep walks nodes in
+     * a known topological order, so there's no count of unwalked parents to track: Each slot only holds on to the incoming edge with the
+     * highest accumulated weight once its node has been walked.
+     *
+     * Struct is packed when `OBN_PACK_STRUCTS` macro is defined (and platform supports struct packing).
+     *
+     * @tparam N Graph node identifier type.
+     * @tparam E Graph edge identifier type.
+     * @tparam ED Graph edge data type (edge weight).
+     */
+    template<
+        backtrackable_node N,
+        backtrackable_edge E,
+        weight ED
+    >
+    struct sweep_slot {
+        /** Node identifier this `sweep_slot` is assigned to. */
+        N node;
+        /** Backtracking edge (value is valid only once `node` has been walked). */
+        E backtracking_edge;
+        /** Backtracking weight (value is valid only once `node` has been walked). */
+        ED backtracking_weight;
+
+        /**
+         * Construct an
+         * @ref offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::slot_container::sweep_slot::sweep_slot instance.
+         *
+         * @param node_ Identifier of node to be assigned to this slot.
+         * @param backtracking_weight_ Initial backtracking weight, equivalent to 0 for numeric weights.
+         */
+        sweep_slot(
+            N node_,
+            ED backtracking_weight_
+        )
+        : node { node_ }
+        , backtracking_edge {}
+        , backtracking_weight { backtracking_weight_ } {}
+    }
+    PACK_STRUCT_STOP;
+}
+
+#endif //OFFBYNULL_ALIGNER_BACKTRACKERS_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_SLOT_CONTAINER_SWEEP_SLOT_H
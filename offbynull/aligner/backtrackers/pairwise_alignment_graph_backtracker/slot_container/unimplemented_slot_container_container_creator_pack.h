@@ -11,7 +11,9 @@ namespace offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker
 
     /**
      * Unimplemented
-     * @ref offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::slot_container::slot_container_container_creator_pack::slot_container_container_creator_pack,
+     * @ref offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::slot_container::slot_container_container_creator_pack::slot_container_container_creator_pack
+     * and
+     * @ref offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::slot_container::sweep_slot_container_container_creator_pack::sweep_slot_container_container_creator_pack,
      * intended for documentation.
      */
     struct unimplemented_slot_container_container_creator_pack {
@@ -30,6 +32,23 @@ namespace offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker
             std::size_t grid_depth_cnt,
             weight auto zero_weight
         ) const;
+
+        /**
+         * Create random access container used to store
+         * @ref offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::slot_container::sweep_slot::sweep_slot "sweep slots".
+         *
+         * @param grid_down_cnt Down dimension of the underlying pairwise alignment graph instance.
+         * @param grid_right_cnt Right dimension of the underlying pairwise alignment graph instance.
+         * @param grid_depth_cnt Depth dimension of the underlying pairwise alignment graph instance.
+         * @param zero_weight Initial weight, equivalent to 0 for numeric weights.
+         * @return Empty random access container which can hold at least `grid_down_cnt * grid_right_cnt * grid_depth_cnt` elements.
+         */
+        auto create_sweep_slot_container(
+            std::size_t grid_down_cnt,
+            std::size_t grid_right_cnt,
+            std::size_t grid_depth_cnt,
+            weight auto zero_weight
+        ) const;
     };
 }
 
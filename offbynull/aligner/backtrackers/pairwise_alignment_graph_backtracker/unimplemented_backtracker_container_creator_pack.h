@@ -1,6 +1,7 @@
 #ifndef OFFBYNULL_ALIGNER_BACKTRACKERS_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_UNIMPLEMENTED_BACKTRACKER_CONTAINER_CREATOR_PACK_H
 #define OFFBYNULL_ALIGNER_BACKTRACKERS_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_UNIMPLEMENTED_BACKTRACKER_CONTAINER_CREATOR_PACK_H
 
+#include <cstddef>
 #include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/backtracker_container_creator_pack.h"
 
 namespace offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::unimplemented_backtracker_container_creator_pack {
@@ -35,6 +36,27 @@ namespace offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker
          * @return Empty random access container.
          */
         auto create_path_container() const;
+
+        /**
+         * Create random access container used to count, for each tile of a parallel sweep, how many of the tiles it depends on have yet
+         * to be walked. Counts are only ever accessed atomically.
+         *
+         * @param tile_cnt Number of tiles.
+         * @return Random access container of `tile_cnt` zeroed elements.
+         */
+        auto create_tile_dependency_count_container(std::size_t tile_cnt) const;
+
+        /**
+         * Create random access container used to hold the tiles of a parallel sweep that became ready but that the thread pool refused to
+         * queue, such that the current thread has to walk them itself. These containers get created from within thread pool tasks,
+         * possibly on many threads at once. Since tiles only ever become ready once all tiles above and to the left of them have been
+         * walked, the number of tiles held at once never exceeds the lesser of `tile_down_cnt` and `tile_right_cnt`.
+         *
+         * @param tile_down_cnt Number of tiles along the down axis.
+         * @param tile_right_cnt Number of tiles along the right axis.
+         * @return Empty random access container.
+         */
+        auto create_pending_tile_index_container(std::size_t tile_down_cnt, std::size_t tile_right_cnt) const;
     };
 }
 
@@ -23,6 +23,7 @@
 #include "offbynull/aligner/graphs/middle_sliceable_pairwise_alignment_graph.h"
 #include "offbynull/aligner/graphs/reversed_sliceable_pairwise_alignment_graph.h"
 #include "offbynull/concepts.h"
+#include "offbynull/helpers/forkable_thread_pool.h"
 
 namespace offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::backtracker {
     using offbynull::aligner::graph::sliceable_pairwise_alignment_graph::sliceable_pairwise_alignment_graph;
@@ -33,6 +34,7 @@ namespace offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_b
         ::resident_segmenter;
     using offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::sliced_subdivider
         ::sliced_subdivider::sliced_subdivider;
+    using offbynull::helpers::forkable_thread_pool::forkable_thread_pool;
     using offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::backtrackable_node::backtrackable_node;
     using offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::backtrackable_edge::backtrackable_edge;
     using offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::backtracker_container_creator_pack
@@ -123,6 +125,11 @@ namespace offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_b
          */
         CONTAINER_CREATOR_PACK container_creator_pack;
 
+        /**
+         * Node count at or below which a segment is solved in a single walk rather than subdivided further.
+         */
+        std::size_t full_dp_node_cnt;
+
     public:
         /**
          * Construct an @ref offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::backtracker::backtracker
@@ -131,13 +138,17 @@ namespace offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_b
          * @param zero_weight_ Initial weight, equivalent to 0 for numeric weights. Defaults to `ED`'s default constructor, assuming it
          *     exists.
          * @param container_creator_pack_ Container factory.
+         * @param full_dp_node_cnt_ Node count at or below which a segment is solved in a single walk rather than subdivided further (see
+         *     @ref offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::sliced_subdivider::sliced_subdivider::sliced_subdivider).
          */
         backtracker(
             ED zero_weight_ = {},
-            CONTAINER_CREATOR_PACK container_creator_pack_ = {}
+            CONTAINER_CREATOR_PACK container_creator_pack_ = {},
+            std::size_t full_dp_node_cnt_ = 0zu
         )
         : zero_weight { zero_weight_ }
-        , container_creator_pack { container_creator_pack_ } {}
+        , container_creator_pack { container_creator_pack_ }
+        , full_dp_node_cnt { full_dp_node_cnt_ } {}
 
         /**
          * Determine the maximally-weighted path (path with the highest sum of edge weights) connecting a sliceable pairwise alignment
@@ -156,6 +167,45 @@ namespace offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_b
         backtracking_result<ED> auto find_max_path(
             const G& g,
             const ED max_path_weight_comparison_tolerance
+        ) {
+            return find_max_path(g, max_path_weight_comparison_tolerance, nullptr, 0zu);
+        }
+
+        /**
+         * Determine the maximally-weighted path (path with the highest sum of edge weights) connecting a sliceable pairwise alignment
+         * graph's root node and leaf node, subdividing each segment in parallel on a thread pool (see the thread pool overload of
+         * @ref offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::sliced_subdivider::sliced_subdivider::sliced_subdivider::subdivide).
+         * The path returned is identical to the one returned by `find_max_path(g, max_path_weight_comparison_tolerance)`.
+         *
+         * The behavior of this function is undefined if ...
+         *
+         *  * `max_path_weight_comparison_tolerance` is not a finite value (e.g., NaN or inf).
+         *  * `g` or the container factory isn't safe to use from multiple threads at once.
+         *  * `thread_pool` is closed before this function returns.
+         *  * this function is invoked from one of `thread_pool`'s threads.
+         *
+         * @param g Graph.
+         * @param thread_pool Thread pool to subdivide on.
+         * @param max_path_weight_comparison_tolerance Tolerance used when testing for weight for equality (see
+         *     `find_max_path(g, max_path_weight_comparison_tolerance)`).
+         * @param serial_node_cnt Node count below which a segment is subdivided on the current thread.
+         * @return Maximally weighted path from `g`'s root node to `g`'s leaf node, along with that path's weight.
+         */
+        backtracking_result<ED> auto find_max_path(
+            const G& g,
+            forkable_thread_pool<debug_mode, void>& thread_pool,
+            const ED max_path_weight_comparison_tolerance,
+            const std::size_t serial_node_cnt = 65536zu
+        ) {
+            return find_max_path(g, max_path_weight_comparison_tolerance, &thread_pool, serial_node_cnt);
+        }
+
+    private:
+        backtracking_result<ED> auto find_max_path(
+            const G& g,
+            const ED max_path_weight_comparison_tolerance,
+            forkable_thread_pool<debug_mode, void>* const thread_pool,
+            const std::size_t serial_node_cnt
         ) {
             if constexpr (debug_mode) {
                 if constexpr (numeric<ED>) {
@@ -198,9 +248,12 @@ namespace offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_b
                     > subdivider {
                         g_segment,
                         zero_weight,
-                        container_creator_pack.create_sliced_subdivider_container_creator_pack()
+                        container_creator_pack.create_sliced_subdivider_container_creator_pack(),
+                        full_dp_node_cnt
+                    };
+                    auto path_container {
+                        thread_pool == nullptr ? subdivider.subdivide() : subdivider.subdivide(*thread_pool, serial_node_cnt)
                     };
-                    auto path_container { subdivider.subdivide() };
                     for (const E& edge : path_container.walk_path_forward()) {
                         path.push_back(edge);
                     }
@@ -0,0 +1,87 @@
+#ifndef OFFBYNULL_ALIGNER_BACKTRACKERS_SLICEABLE_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_BACKTRACKER_ARENA_CONTAINER_CREATOR_PACK_H
+#define OFFBYNULL_ALIGNER_BACKTRACKERS_SLICEABLE_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_BACKTRACKER_ARENA_CONTAINER_CREATOR_PACK_H
+
+#include <vector>
+#include <cstddef>
+#include <memory_resource>
+#include "offbynull/aligner/backtrackers/sliceable_pairwise_alignment_graph_backtracker/backtrackable_node.h"
+#include "offbynull/aligner/backtrackers/sliceable_pairwise_alignment_graph_backtracker/backtrackable_edge.h"
+#include "offbynull/aligner/backtrackers/sliceable_pairwise_alignment_graph_backtracker/resident_segmenter/resident_segmenter_arena_container_creator_pack.h"
+#include "offbynull/aligner/backtrackers/sliceable_pairwise_alignment_graph_backtracker/sliced_subdivider/sliced_subdivider_arena_container_creator_pack.h"
+#include "offbynull/aligner/backtrackers/sliceable_pairwise_alignment_graph_backtracker/unimplemented_backtracker_container_creator_pack.h"
+#include "offbynull/aligner/concepts.h"
+
+namespace offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::backtracker_arena_container_creator_pack {
+    using offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::backtrackable_node::backtrackable_node;
+    using offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::backtrackable_edge::backtrackable_edge;
+    using offbynull::aligner::concepts::weight;
+    using offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::resident_segmenter
+        ::resident_segmenter_arena_container_creator_pack::resident_segmenter_arena_container_creator_pack;
+    using offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::sliced_subdivider
+        ::sliced_subdivider_arena_container_creator_pack::sliced_subdivider_arena_container_creator_pack;
+
+    /**
+     * @ref offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::backtracker_container_creator_pack::backtracker_container_creator_pack
+     * that allocates its containers from a caller-provided `std::pmr::memory_resource`, such as an arena shared across many alignments.
+     *
+     * All containers besides the returned path are scratch space that's gone by the time `find_max_path()` returns, meaning the resource
+     * can be reset between alignments. With a `std::pmr::monotonic_buffer_resource`, allocations are pointer bumps and `release()` frees
+     * everything in one go, but nothing is reused within an alignment. With a `std::pmr::unsynchronized_pool_resource`, containers freed
+     * partway through an alignment get recycled by the ones created after them. Either way, the returned path is allocated on the heap
+     * rather than from the resource, so it remains valid after the resource is reset.
+     *
+     * @tparam debug_mode `true` to enable debugging logic, `false` otherwise.
+     * @tparam N Graph node identifier type.
+     * @tparam E Graph edge identifier type.
+     * @tparam ED Graph edge data type (edge weight).
+     * @tparam minimize_allocations Primes certain containers with enough capacity such that adhoc reallocations aren't needed.
+     */
+    template<
+        bool debug_mode,
+        backtrackable_node N,
+        backtrackable_edge E,
+        weight ED,
+        bool minimize_allocations
+    >
+    struct backtracker_arena_container_creator_pack {
+        /** Memory resource that containers are allocated from (must outlive the backtracker invocation). */
+        std::pmr::memory_resource* resource { std::pmr::get_default_resource() };
+
+        /**
+         * @copydoc offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::unimplemented_backtracker_container_creator_pack::unimplemented_backtracker_container_creator_pack::create_resident_segmenter_container_creator_pack
+         */
+        resident_segmenter_arena_container_creator_pack<
+            debug_mode,
+            N,
+            E,
+            ED,
+            minimize_allocations
+        > create_resident_segmenter_container_creator_pack() const {
+            return { resource };
+        }
+
+        /**
+         * @copydoc offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::unimplemented_backtracker_container_creator_pack::unimplemented_backtracker_container_creator_pack::create_sliced_subdivider_container_creator_pack
+         */
+        sliced_subdivider_arena_container_creator_pack<
+            debug_mode,
+            E,
+            ED
+        > create_sliced_subdivider_container_creator_pack() const {
+            return { resource };
+        }
+
+        /**
+         * @copydoc offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::unimplemented_backtracker_container_creator_pack::unimplemented_backtracker_container_creator_pack::create_path_container
+         */
+        std::vector<E> create_path_container(std::size_t path_edge_capacity) const {
+            std::vector<E> ret {};
+            if constexpr (minimize_allocations) {
+                ret.reserve(path_edge_capacity);
+            }
+            return ret;
+        }
+    };
+}
+
+#endif //OFFBYNULL_ALIGNER_BACKTRACKERS_SLICEABLE_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_BACKTRACKER_ARENA_CONTAINER_CREATOR_PACK_H
@@ -4,7 +4,9 @@
 #include "offbynull/aligner/graphs/pairwise_local_alignment_graph.h"
 #include "offbynull/aligner/graphs/pairwise_global_alignment_graph.h"
 #include "offbynull/aligner/graphs/pairwise_extended_gap_alignment_graph.h"
+#include "offbynull/aligner/graphs/banded_sliceable_pairwise_alignment_graph.h"
 #include "offbynull/aligner/backtrackers/sliceable_pairwise_alignment_graph_backtracker/backtracker.h"
+#include "offbynull/aligner/backtrackers/sliceable_pairwise_alignment_graph_backtracker/backtracker_banded_container_creator_pack.h"
 #include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/backtracker.h"
 #include "offbynull/aligner/scorers/simple_scorer.h"
 #include "offbynull/utils.h"
@@ -25,12 +27,15 @@ namespace {
     using offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::backtracker::backtracker;
     using offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::backtracker::heap_find_max_path;
     using offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::backtracker::stack_find_max_path;
+    using offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::backtracker_banded_container_creator_pack
+        ::backtracker_banded_container_creator_pack;
     using offbynull::aligner::graphs::pairwise_global_alignment_graph::pairwise_global_alignment_graph;
     using offbynull::aligner::graphs::pairwise_local_alignment_graph::pairwise_local_alignment_graph;
     using offbynull::aligner::graphs::pairwise_overlap_alignment_graph::pairwise_overlap_alignment_graph;
     using offbynull::aligner::graphs::pairwise_fitting_alignment_graph::pairwise_fitting_alignment_graph;
     using offbynull::aligner::graphs::pairwise_extended_gap_alignment_graph::pairwise_extended_gap_alignment_graph;
     using offbynull::aligner::graphs::middle_sliceable_pairwise_alignment_graph::middle_sliceable_pairwise_alignment_graph;
+    using offbynull::aligner::graphs::banded_sliceable_pairwise_alignment_graph::banded_sliceable_pairwise_alignment_graph;
     using offbynull::aligner::scorers::simple_scorer::simple_scorer;
     using offbynull::utils::copy_to_vector;
     using offbynull::utils::is_debug_mode;
@@ -758,4 +763,54 @@ namespace {
         );
         EXPECT_EQ(weight, 1.0);
     }
+
+    TEST(OABSBacktrackerTest, BandedTest) {
+        auto substitution_scorer {
+            simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_substitution(1.0f64, -1.0f64)
+        };
+        auto gap_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_gap(-1.0f64) };
+        std::string seq1 { "abcdefghijklmnop" };
+        std::string seq2 { "abcdefxhijklnop" };
+        pairwise_global_alignment_graph<
+            is_debug_mode(),
+            std::size_t,
+            std::float64_t,
+            decltype(seq1),
+            decltype(seq2),
+            decltype(substitution_scorer),
+            decltype(gap_scorer)
+        > g {
+            seq1,
+            seq2,
+            substitution_scorer,
+            gap_scorer
+        };
+        banded_sliceable_pairwise_alignment_graph<is_debug_mode(), decltype(g)> banded_g { g, 2zu, 2zu };
+
+        using N = typename decltype(g)::N;
+        using E = typename decltype(g)::E;
+        using ED = typename decltype(g)::ED;
+
+        // walk
+        backtracker<
+            is_debug_mode(),
+            decltype(banded_g),
+            backtracker_banded_container_creator_pack<is_debug_mode(), N, E, ED>
+        > backtracker_ { 0.0f64, { banded_g.band_width } };
+        const auto& [path, weight] { backtracker_.find_max_path(banded_g, 0.000001f64) };
+        for (const E& e : path) {
+            std::cout << e << ' ';
+        }
+        std::cout << std::endl;
+        std::cout << weight << std::endl;
+
+        const auto& [unbanded_path, unbanded_weight] { heap_find_max_path<is_debug_mode(), false>(g, 0.000001f64) };
+        std::float64_t path_weight {};
+        for (const E& e : path) {
+            EXPECT_TRUE(banded_g.has_edge(e));
+            path_weight += g.get_edge_data(e);
+        }
+        EXPECT_NEAR(weight, unbanded_weight, 0.001);
+        EXPECT_NEAR(path_weight, unbanded_weight, 0.001);
+    }
 }
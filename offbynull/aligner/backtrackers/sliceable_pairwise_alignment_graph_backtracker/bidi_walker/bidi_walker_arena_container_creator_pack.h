@@ -0,0 +1,70 @@
+#ifndef OFFBYNULL_ALIGNER_BACKTRACKERS_SLICEABLE_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_BIDI_WALKER_BIDI_WALKER_ARENA_CONTAINER_CREATOR_PACK_H
+#define OFFBYNULL_ALIGNER_BACKTRACKERS_SLICEABLE_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_BIDI_WALKER_BIDI_WALKER_ARENA_CONTAINER_CREATOR_PACK_H
+
+#include <memory_resource>
+#include "offbynull/aligner/concepts.h"
+#include "offbynull/aligner/backtrackers/sliceable_pairwise_alignment_graph_backtracker/backtrackable_node.h"
+#include "offbynull/aligner/backtrackers/sliceable_pairwise_alignment_graph_backtracker/backtrackable_edge.h"
+#include "offbynull/aligner/backtrackers/sliceable_pairwise_alignment_graph_backtracker/forward_walker/forward_walker_arena_container_creator_pack.h"
+#include "offbynull/aligner/backtrackers/sliceable_pairwise_alignment_graph_backtracker/bidi_walker/unimplemented_bidi_walker_container_creator_pack.h"
+
+namespace offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::bidi_walker::
+        bidi_walker_arena_container_creator_pack {
+    using offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::backtrackable_node::backtrackable_node;
+    using offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::backtrackable_edge::backtrackable_edge;
+    using offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::forward_walker
+        ::forward_walker_arena_container_creator_pack::forward_walker_arena_container_creator_pack;
+    using offbynull::aligner::concepts::weight;
+
+    /**
+     * @ref offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::bidi_walker::bidi_walker_container_creator_pack::bidi_walker_container_creator_pack
+     * that allocates its containers from a `std::pmr::memory_resource`.
+     *
+     * @tparam debug_mode `true` to enable debugging logic, `false` otherwise.
+     * @tparam N Graph node identifier type.
+     * @tparam E Graph edge identifier type.
+     * @tparam ED Graph edge data type (edge weight).
+     * @tparam minimize_allocations Passed to container creator packs generated by `create_forward_walker_container_creator_pack()` and
+     *     `create_backward_walker_container_creator_pack()`, which prime certain containers with enough capacity such that adhoc
+     *     reallocations aren't needed.
+     */
+    template<
+        bool debug_mode,
+        backtrackable_node N,
+        backtrackable_edge E,
+        weight ED,
+        bool minimize_allocations
+    >
+    struct bidi_walker_arena_container_creator_pack {
+        /** Memory resource that containers are allocated from (must outlive the containers). */
+        std::pmr::memory_resource* resource { std::pmr::get_default_resource() };
+
+        /**
+         * @copydoc offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::bidi_walker::unimplemented_bidi_walker_container_creator_pack::unimplemented_bidi_walker_container_creator_pack::create_forward_walker_container_creator_pack.
+         */
+        forward_walker_arena_container_creator_pack<
+            debug_mode,
+            N,
+            E,
+            ED,
+            minimize_allocations
+        > create_forward_walker_container_creator_pack() const {
+            return { resource };
+        }
+
+        /**
+         * @copydoc offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::bidi_walker::unimplemented_bidi_walker_container_creator_pack::unimplemented_bidi_walker_container_creator_pack::create_backward_walker_container_creator_pack.
+         */
+        forward_walker_arena_container_creator_pack<
+            debug_mode,
+            N,
+            E,
+            ED,
+            minimize_allocations
+        > create_backward_walker_container_creator_pack() const {
+            return { resource };
+        }
+    };
+}
+
+#endif //OFFBYNULL_ALIGNER_BACKTRACKERS_SLICEABLE_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_BIDI_WALKER_BIDI_WALKER_ARENA_CONTAINER_CREATOR_PACK_H
@@ -0,0 +1,89 @@
+#ifndef OFFBYNULL_ALIGNER_BACKTRACKERS_SLICEABLE_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_BIDI_WALKER_BIDI_WALKER_BANDED_CONTAINER_CREATOR_PACK_H
+#define OFFBYNULL_ALIGNER_BACKTRACKERS_SLICEABLE_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_BIDI_WALKER_BIDI_WALKER_BANDED_CONTAINER_CREATOR_PACK_H
+
+#include <cstddef>
+#include <utility>
+#include "offbynull/aligner/concepts.h"
+#include "offbynull/aligner/backtrackers/sliceable_pairwise_alignment_graph_backtracker/backtrackable_node.h"
+#include "offbynull/aligner/backtrackers/sliceable_pairwise_alignment_graph_backtracker/backtrackable_edge.h"
+#include "offbynull/aligner/backtrackers/sliceable_pairwise_alignment_graph_backtracker/forward_walker/forward_walker_banded_container_creator_pack.h"
+#include "offbynull/aligner/backtrackers/sliceable_pairwise_alignment_graph_backtracker/bidi_walker/bidi_walker_container_creator_pack.h"
+#include "offbynull/aligner/backtrackers/sliceable_pairwise_alignment_graph_backtracker/bidi_walker/bidi_walker_heap_container_creator_pack.h"
+#include "offbynull/aligner/backtrackers/sliceable_pairwise_alignment_graph_backtracker/bidi_walker/unimplemented_bidi_walker_container_creator_pack.h"
+
+namespace offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::bidi_walker
+        ::bidi_walker_banded_container_creator_pack {
+    using offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::backtrackable_node::backtrackable_node;
+    using offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::backtrackable_edge::backtrackable_edge;
+    using offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::forward_walker
+        ::forward_walker_banded_container_creator_pack::forward_walker_banded_container_creator_pack;
+    using offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::bidi_walker
+        ::bidi_walker_container_creator_pack::bidi_walker_container_creator_pack;
+    using offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::bidi_walker
+        ::bidi_walker_heap_container_creator_pack::bidi_walker_heap_container_creator_pack;
+    using offbynull::aligner::concepts::weight;
+
+    /**
+     * @ref offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::bidi_walker::bidi_walker_container_creator_pack::bidi_walker_container_creator_pack
+     * that limits row storage to `band_width` columns, intended for graphs where only a diagonal band of each row exists (e.g.,
+     * @ref offbynull::aligner::graphs::banded_sliceable_pairwise_alignment_graph::banded_sliceable_pairwise_alignment_graph). The
+     * containers themselves are created by a backing container creator pack.
+     *
+     * @tparam debug_mode `true` to enable debugging logic, `false` otherwise.
+     * @tparam N Graph node identifier type.
+     * @tparam E Graph edge identifier type.
+     * @tparam ED Graph edge data type (edge weight).
+     * @tparam BACKING_CONTAINER_CREATOR_PACK Container factory type that containers are created with.
+     */
+    template<
+        bool debug_mode,
+        backtrackable_node N,
+        backtrackable_edge E,
+        weight ED,
+        bidi_walker_container_creator_pack<
+            N,
+            E,
+            ED
+        > BACKING_CONTAINER_CREATOR_PACK = bidi_walker_heap_container_creator_pack<
+            debug_mode,
+            N,
+            E,
+            ED,
+            false
+        >
+    >
+    struct bidi_walker_banded_container_creator_pack {
+        /** Maximum number of columns held per row. */
+        std::size_t band_width;
+        /** Container factory that containers are created with. */
+        BACKING_CONTAINER_CREATOR_PACK backing_container_creator_pack {};
+
+        /**
+         * @copydoc offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::bidi_walker::unimplemented_bidi_walker_container_creator_pack::unimplemented_bidi_walker_container_creator_pack::create_forward_walker_container_creator_pack.
+         */
+        forward_walker_banded_container_creator_pack<
+            debug_mode,
+            N,
+            E,
+            ED,
+            decltype(std::declval<BACKING_CONTAINER_CREATOR_PACK>().create_forward_walker_container_creator_pack())
+        > create_forward_walker_container_creator_pack() const {
+            return { band_width, backing_container_creator_pack.create_forward_walker_container_creator_pack() };
+        }
+
+        /**
+         * @copydoc offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::bidi_walker::unimplemented_bidi_walker_container_creator_pack::unimplemented_bidi_walker_container_creator_pack::create_backward_walker_container_creator_pack.
+         */
+        forward_walker_banded_container_creator_pack<
+            debug_mode,
+            N,
+            E,
+            ED,
+            decltype(std::declval<BACKING_CONTAINER_CREATOR_PACK>().create_backward_walker_container_creator_pack())
+        > create_backward_walker_container_creator_pack() const {
+            return { band_width, backing_container_creator_pack.create_backward_walker_container_creator_pack() };
+        }
+    };
+}
+
+#endif //OFFBYNULL_ALIGNER_BACKTRACKERS_SLICEABLE_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_BIDI_WALKER_BIDI_WALKER_BANDED_CONTAINER_CREATOR_PACK_H
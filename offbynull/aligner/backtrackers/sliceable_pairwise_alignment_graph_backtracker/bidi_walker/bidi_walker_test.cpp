@@ -5,6 +5,7 @@
 #include "offbynull/aligner/graphs/pairwise_global_alignment_graph.h"
 #include "offbynull/aligner/backtrackers/sliceable_pairwise_alignment_graph_backtracker/bidi_walker/bidi_walker.h"
 #include "offbynull/aligner/scorers/simple_scorer.h"
+#include "offbynull/helpers/forkable_thread_pool.h"
 #include "offbynull/utils.h"
 #include "gtest/gtest.h"
 #include <cstddef>
@@ -23,6 +24,7 @@ namespace {
     using offbynull::aligner::graphs::pairwise_fitting_alignment_graph::pairwise_fitting_alignment_graph;
     using offbynull::aligner::graphs::pairwise_overlap_alignment_graph::pairwise_overlap_alignment_graph;
     using offbynull::aligner::scorers::simple_scorer::simple_scorer;
+    using offbynull::helpers::forkable_thread_pool::forkable_thread_pool;
     using offbynull::utils::packable_optional;
     using offbynull::utils::random_printable_ascii;
     using offbynull::utils::is_debug_mode;
@@ -67,6 +69,64 @@ namespace {
         std::cout << weight << std::endl;
     }
 
+    TEST(OABSBBidiWalkerTest, ConcurrentWalk) {
+        auto substitution_scorer {
+            simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_substitution(1.0f64, -1.0f64)
+        };
+        auto gap_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_gap(-1.0f64) };
+        std::mt19937_64 rand { 54321 };
+        std::string seq1 { random_printable_ascii(rand, 60zu) };
+        std::string seq2 { random_printable_ascii(rand, 45zu) };
+        using G = pairwise_global_alignment_graph<
+            is_debug_mode(),
+            std::size_t,
+            std::float64_t,
+            decltype(seq1),
+            decltype(seq2),
+            decltype(substitution_scorer),
+            decltype(gap_scorer)
+        >;
+        G g { seq1, seq2, substitution_scorer, gap_scorer };
+        using N = typename G::N;
+
+        forkable_thread_pool<is_debug_mode(), void> thread_pool { 2zu };
+        for (std::size_t down_offset { 0zu }; down_offset < g.grid_down_cnt; down_offset += 7zu) {
+            auto serial_walker { bidi_walker<is_debug_mode(), G>::create_and_initialize(g, down_offset, 0.0f64) };
+            auto thread_walker { bidi_walker<is_debug_mode(), G>::create_and_initialize_concurrently(g, down_offset, 0.0f64) };
+            // Thread pool walk invoked from a task running within the thread pool
+            auto thread_pool_walker_future {
+                thread_pool.queue(
+                    [&](forkable_thread_pool<is_debug_mode(), void>& owner) {
+                        auto thread_pool_walker { bidi_walker<is_debug_mode(), G>::create_and_initialize(g, down_offset, 0.0f64, owner) };
+                        for (std::size_t right_offset { 0zu }; right_offset < g.grid_right_cnt; ++right_offset) {
+                            EXPECT_EQ(
+                                walk_to_node(serial_walker, N { down_offset, right_offset }),
+                                walk_to_node(thread_pool_walker, N { down_offset, right_offset })
+                            );
+                        }
+                    }
+                )
+            };
+            thread_pool_walker_future->get();
+            // Thread pool walk invoked directly from this thread, which is outside of the thread pool
+            auto outside_thread_pool_walker {
+                bidi_walker<is_debug_mode(), G>::create_and_initialize(g, down_offset, 0.0f64, thread_pool)
+            };
+            for (std::size_t right_offset { 0zu }; right_offset < g.grid_right_cnt; ++right_offset) {
+                EXPECT_EQ(
+                    walk_to_node(serial_walker, N { down_offset, right_offset }),
+                    walk_to_node(outside_thread_pool_walker, N { down_offset, right_offset })
+                );
+            }
+            for (std::size_t right_offset { 0zu }; right_offset < g.grid_right_cnt; ++right_offset) {
+                EXPECT_EQ(
+                    walk_to_node(serial_walker, N { down_offset, right_offset }),
+                    walk_to_node(thread_walker, N { down_offset, right_offset })
+                );
+            }
+        }
+    }
+
     TEST(OABSBBidiWalkerTest, WalkGlobal) {
         auto substitution_scorer {
             simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_substitution(1.0f64, -1.0f64)
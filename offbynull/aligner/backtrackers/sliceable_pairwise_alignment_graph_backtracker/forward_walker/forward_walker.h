@@ -5,6 +5,7 @@
 #include <ranges>
 #include <optional>
 #include <utility>
+#include <tuple>
 #include <stdexcept>
 #include "offbynull/aligner/concepts.h"
 #include "offbynull/aligner/graph/sliceable_pairwise_alignment_graph.h"
@@ -107,6 +108,11 @@ namespace offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_b
         decltype(g.row_nodes(0zu)) row;
         decltype(row.begin()) row_it;
         row_entry<N, E, ED> row_entry_;
+        std::optional<ED> xdrop;
+        ED best_weight;
+        std::optional<ED> pruned_weight;
+        bool row_live;
+        bool pruned_out;
 
     public:
         /**
@@ -137,6 +143,7 @@ namespace offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_b
             forward_walker ret {
                 g_,
                 zero_weight,
+                std::nullopt,
                 container_creator_pack_
             };
             while (ret.row_slots.down_offset() != target_row || ret.row_it != ret.row.end()) {
@@ -145,6 +152,58 @@ namespace offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_b
             return ret;
         }
 
+        /**
+         * Create an @ref offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::forward_walker::forward_walker
+         * instance targeted at nodes within a specific row of the graph, using X-drop pruning while walking. Any node whose weight falls
+         * more than `xdrop` below the highest weight seen so far is pruned, meaning that it's no longer extended into its children (edge
+         * weights leading out of it are never evaluated). A node whose parents have all been pruned is itself pruned. Once every node in a
+         * row has been pruned (and no resident node that could feed later rows remains unpruned), all rows up to `target_row` are skipped
+         * without being walked, and every non-resident node in `target_row` is reported as pruned.
+         *
+         * The weight reported for a pruned node is the weight of some other pruned node, and as such is meaningless beyond the fact that it
+         * trails the highest weight seen by more than `xdrop`.
+         *
+         * The behavior of this function is undefined if ...
+         *
+         *  * `target_row` is past the final row within `g`.
+         *  * `xdrop` is negative or non-finite.
+         *
+         * @param g_ Graph.
+         * @param target_row Row within `g`.
+         * @param zero_weight Initial weight, equivalent to 0 for numeric weights.
+         * @param xdrop Maximum amount a node's weight may trail the highest weight seen so far before that node is pruned.
+         * @param container_creator_pack_ Container factory.
+         * @return @ref offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::forward_walker::forward_walker
+         *     instance primed to `g`'s `target_row` row.
+         */
+        static forward_walker create_and_initialize_with_xdrop(
+            const G& g_,
+            N_INDEX target_row,
+            ED zero_weight,
+            ED xdrop,
+            CONTAINER_CREATOR_PACK container_creator_pack_ = {}
+        ) {
+            if constexpr (debug_mode) {
+                if (target_row >= g_.grid_down_cnt) {
+                    throw std::runtime_error { "Slice too far down" };
+                }
+            }
+            forward_walker ret {
+                g_,
+                zero_weight,
+                { xdrop },
+                container_creator_pack_
+            };
+            while (ret.row_slots.down_offset() != target_row || ret.row_it != ret.row.end()) {
+                if (ret.pruned_out) {
+                    ret.skip_to_row(target_row);
+                    break;
+                }
+                ret.step_forward();
+            }
+            return ret;
+        }
+
         /**
          * For the maximally-weighted path from the root node to `node` (path with the highest sum of edge weights), get the final edge of
          * that path (last edge before reaching `node`) as well as the weight of that path.
@@ -178,6 +237,7 @@ namespace offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_b
         forward_walker(
             const G& g_,
             ED zero_weight,
+            std::optional<ED> xdrop_,
             CONTAINER_CREATOR_PACK container_creator_pack_ = {}
         )
         : g { g_ }
@@ -185,7 +245,12 @@ namespace offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_b
         , row_slots { g, zero_weight, container_creator_pack_.create_row_slot_container_container_creator_pack() }
         , row { g.row_nodes(I0) }
         , row_it { row.begin() }
-        , row_entry_ {} {
+        , row_entry_ {}
+        , xdrop { xdrop_ }
+        , best_weight { zero_weight }
+        , pruned_weight { std::nullopt }
+        , row_live { false }
+        , pruned_out { false } {
             row_entry_.node = *row_it;
             row_entry_.slot_ptr = &find(row_entry_.node); // should be equivalent to g.get_root_node()
         }
@@ -198,6 +263,13 @@ namespace offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_b
                 if (row_slots.down_offset() == g.grid_down_cnt - I1) {
                     return;
                 }
+                if (xdrop.has_value()) {
+                    if (!row_live && !has_unpruned_feeding_resident()) {
+                        pruned_out = true;
+                        return;
+                    }
+                    row_live = false;
+                }
                 row_slots.move_down();
                 row = g.row_nodes(row_slots.down_offset());
                 row_it = row.begin();
@@ -206,7 +278,18 @@ namespace offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_b
             }
             // Compute only if node is not a resident. A resident node's backtracking weight + backtracking edge should
             // be computed as its inputs are walked over one-by-one by this function (see block below this one).
-            if (!resident_slots.find(row_entry_.node).has_value()) {
+            const bool is_resident { resident_slots.find(row_entry_.node).has_value() };
+            if (xdrop.has_value()) {
+                if (!is_resident) {
+                    walk_with_xdrop();
+                }
+                if (is_pruned(row_entry_.slot_ptr->backtracking_weight)) {
+                    pruned_weight = { row_entry_.slot_ptr->backtracking_weight };
+                    ++row_it;
+                    return;  // Pruned nodes don't feed into resident nodes
+                }
+                row_live = true;
+            } else if (!is_resident) {
                 auto incoming_accumulated {
                     std::views::common(
                         g.get_inputs(row_entry_.node)
@@ -251,24 +334,91 @@ namespace offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_b
                 }
                 resident_slot<E, ED>& resident_slot_ { (*resident_slot_maybe).get() };
                 const ED& edge_weight { g.get_edge_data(edge) };
+                ED new_weight {
+                    static_cast<ED>(row_entry_.slot_ptr->backtracking_weight + edge_weight)  // Cast to prevent narrowing warning
+                };
                 if (!resident_slot_.initialized) {
                     resident_slot_.slot_.backtracking_edge = { edge };
-                    resident_slot_.slot_.backtracking_weight = edge_weight;
+                    resident_slot_.slot_.backtracking_weight = new_weight;
                     resident_slot_.initialized = true;
-                } else {
-                    ED new_weight {
-                        static_cast<ED>(row_entry_.slot_ptr->backtracking_weight + edge_weight)  // Cast to prevent narrowing warning
-                    };
-                    if (new_weight > resident_slot_.slot_.backtracking_weight) {
-                        resident_slot_.slot_.backtracking_edge = { edge };
-                        resident_slot_.slot_.backtracking_weight = new_weight;
-                    }
+                } else if (new_weight > resident_slot_.slot_.backtracking_weight) {
+                    resident_slot_.slot_.backtracking_edge = { edge };
+                    resident_slot_.slot_.backtracking_weight = new_weight;
                 }
             }
 
             // Move to next node
             ++row_it;
         }
+
+        bool is_pruned(const ED& weight) const {
+            return weight + *xdrop < best_weight;
+        }
+
+        void walk_with_xdrop() {
+            // Since best_weight never decreases, a node that was pruned at some point remains pruned for the rest of the walk.
+            std::optional<std::pair<E, ED>> found {};
+            std::optional<std::pair<E, ED>> pruned {};
+            for (const auto& edge : g.get_inputs(row_entry_.node)) {
+                const N& n_from { g.get_edge_from(edge) };
+                const ED& n_from_weight { find(n_from).backtracking_weight };
+                if (is_pruned(n_from_weight)) {
+                    if (!pruned.has_value()) {
+                        pruned = { edge, n_from_weight };
+                    }
+                    continue;
+                }
+                const ED& edge_weight { g.get_edge_data(edge) };
+                ED weight { static_cast<ED>(n_from_weight + edge_weight) };  // Cast to prevent narrowing warning
+                if (!found.has_value() || (*found).second < weight) {
+                    found = { edge, weight };
+                }
+            }
+            if (found.has_value()) {
+                row_entry_.slot_ptr->backtracking_edge = { (*found).first };
+                row_entry_.slot_ptr->backtracking_weight = (*found).second;
+                if (best_weight < (*found).second) {
+                    best_weight = (*found).second;
+                }
+            } else if (pruned.has_value()) {  // if no incoming nodes found, it's a root node
+                // Every parent was pruned, so this node is pruned as well. Taking on a pruned parent's weight guarantees that this node
+                // also reads as pruned to its own children.
+                row_entry_.slot_ptr->backtracking_edge = { (*pruned).first };
+                row_entry_.slot_ptr->backtracking_weight = (*pruned).second;
+            }
+        }
+
+        bool has_unpruned_feeding_resident() {
+            // A resident node at or above the current row that has outputs may still feed into rows below (e.g., the root node's freeride
+            // edges within a local alignment graph).
+            for (const N& resident_node : g.resident_nodes()) {
+                const N_INDEX down { std::get<0zu>(g.node_to_grid_offset(resident_node)) };
+                if (down > row_slots.down_offset() || !g.has_outputs(resident_node)) {
+                    continue;
+                }
+                if (!is_pruned((*resident_slots.find(resident_node)).get().slot_.backtracking_weight)) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        void skip_to_row(N_INDEX target_row) {
+            // Every node in the rows being skipped is pruned, so there's no need to walk them. Only the target row's slots need to be
+            // overwritten (they may hold stale values from a previous row).
+            while (row_slots.down_offset() != target_row) {
+                row_slots.move_down();
+            }
+            row = g.row_nodes(target_row);
+            for (const N& node : row) {
+                if (!resident_slots.find(node).has_value()) {
+                    slot<E, ED>& slot_ { find(node) };
+                    slot_.backtracking_edge = { std::nullopt };
+                    slot_.backtracking_weight = *pruned_weight;
+                }
+            }
+            row_it = row.end();
+        }
     };
 }
 
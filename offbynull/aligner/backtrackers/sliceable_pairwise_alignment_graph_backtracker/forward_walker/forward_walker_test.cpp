@@ -265,4 +265,56 @@ namespace {
             EXPECT_EQ(walker.find(N { 3zu, 3zu }).backtracking_weight, 1.0);
         }
     }
+
+    TEST(OABSFForwardWalkerTest, ForwardWalkWithXDrop) {
+        auto substitution_scorer {
+            simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_substitution(1.0f64, -1.0f64)
+        };
+        auto gap_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_gap(-1.0f64) };
+        auto freeride_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_freeride(0.0f64) };
+        std::string seq1 { "aaaabbbbbbbb" };
+        std::string seq2 { "aaaacccccccc" };
+        pairwise_local_alignment_graph<
+            is_debug_mode(),
+            std::size_t,
+            std::float64_t,
+            decltype(seq1),
+            decltype(seq2),
+            decltype(substitution_scorer),
+            decltype(gap_scorer),
+            decltype(freeride_scorer)
+        > g {
+            seq1,
+            seq2,
+            substitution_scorer,
+            gap_scorer,
+            freeride_scorer
+        };
+
+        using N = typename decltype(g)::N;
+
+        // X-drop large enough to never prune anything
+        for (std::size_t row { 0zu }; row <= seq1.size(); ++row) {
+            forward_walker<is_debug_mode(), decltype(g)> walker {
+                forward_walker<is_debug_mode(), decltype(g)>::create_and_initialize(g, row, 0.0)
+            };
+            forward_walker<is_debug_mode(), decltype(g)> xdrop_walker {
+                forward_walker<is_debug_mode(), decltype(g)>::create_and_initialize_with_xdrop(g, row, 0.0, 1000.0)
+            };
+            for (std::size_t col { 0zu }; col <= seq2.size(); ++col) {
+                EXPECT_EQ(xdrop_walker.find(N { row, col }), walker.find(N { row, col }));
+            }
+        }
+
+        // X-drop small enough that every node past the matching prefix gets pruned
+        {
+            forward_walker<is_debug_mode(), decltype(g)> xdrop_walker {
+                forward_walker<is_debug_mode(), decltype(g)>::create_and_initialize_with_xdrop(g, 12u, 0.0, 1.0)
+            };
+            for (std::size_t col { 0zu }; col < seq2.size(); ++col) {
+                EXPECT_LT(xdrop_walker.find(N { 12zu, col }).backtracking_weight + 1.0, 4.0);
+            }
+            EXPECT_EQ(xdrop_walker.find(N { 12zu, 12zu }).backtracking_weight, 4.0);  // leaf
+        }
+    }
 }
@@ -0,0 +1,40 @@
+#ifndef OFFBYNULL_ALIGNER_BACKTRACKERS_SLICEABLE_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_PATH_CONTAINER_PATH_CONTAINER_ARENA_CONTAINER_CREATOR_PACK_H
+#define OFFBYNULL_ALIGNER_BACKTRACKERS_SLICEABLE_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_PATH_CONTAINER_PATH_CONTAINER_ARENA_CONTAINER_CREATOR_PACK_H
+
+#include "offbynull/aligner/backtrackers/sliceable_pairwise_alignment_graph_backtracker/backtrackable_edge.h"
+#include "offbynull/aligner/backtrackers/sliceable_pairwise_alignment_graph_backtracker/path_container/element.h"
+#include "offbynull/aligner/backtrackers/sliceable_pairwise_alignment_graph_backtracker/path_container/unimplemented_path_container_container_creator_pack.h"
+#include <cstddef>
+#include <memory_resource>
+#include <vector>
+
+namespace offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::path_container
+        ::path_container_arena_container_creator_pack {
+    using offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::path_container::element::element;
+    using offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::backtrackable_edge::backtrackable_edge;
+
+    /**
+     * @ref offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::path_container::path_container_container_creator_pack::path_container_container_creator_pack
+     * that allocates its containers from a `std::pmr::memory_resource`.
+     *
+     * @tparam debug_mode `true` to enable debugging logic, `false` otherwise.
+     * @tparam E Graph edge identifier type.
+     */
+    template<
+        bool debug_mode,
+        backtrackable_edge E
+    >
+    struct path_container_arena_container_creator_pack {
+        /** Memory resource that containers are allocated from (must outlive the containers). */
+        std::pmr::memory_resource* resource { std::pmr::get_default_resource() };
+
+        /**
+         * @copydoc offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::path_container::unimplemented_path_container_container_creator_pack::unimplemented_path_container_container_creator_pack::create_element_container
+         */
+        std::pmr::vector<element<E>> create_element_container(std::size_t path_edge_capacity) const {
+            return std::pmr::vector<element<E>>(path_edge_capacity, resource);
+        }
+    };
+}
+
+#endif //OFFBYNULL_ALIGNER_BACKTRACKERS_SLICEABLE_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_PATH_CONTAINER_PATH_CONTAINER_ARENA_CONTAINER_CREATOR_PACK_H
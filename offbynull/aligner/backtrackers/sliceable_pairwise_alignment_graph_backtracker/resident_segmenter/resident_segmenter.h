@@ -5,6 +5,7 @@
 #include <algorithm>
 #include <utility>
 #include <variant>
+#include <optional>
 #include <cmath>
 #include <stdexcept>
 #include "offbynull/aligner/backtrackers/sliceable_pairwise_alignment_graph_backtracker/backtrackable_node.h"
@@ -13,7 +14,7 @@
 #include "offbynull/aligner/backtrackers/sliceable_pairwise_alignment_graph_backtracker/resident_segmenter/segment.h"
 #include "offbynull/aligner/backtrackers/sliceable_pairwise_alignment_graph_backtracker/resident_segmenter/resident_segmenter_container_creator_pack.h"
 #include "offbynull/aligner/backtrackers/sliceable_pairwise_alignment_graph_backtracker/resident_segmenter/resident_segmenter_heap_container_creator_pack.h"
-#include "offbynull/aligner/backtrackers/sliceable_pairwise_alignment_graph_backtracker/bidi_walker/bidi_walker.h"
+#include "offbynull/aligner/backtrackers/sliceable_pairwise_alignment_graph_backtracker/forward_walker/forward_walker.h"
 #include "offbynull/aligner/backtrackers/sliceable_pairwise_alignment_graph_backtracker/bidi_walker/bidi_walker_container_creator_pack.h"
 #include "offbynull/aligner/backtrackers/sliceable_pairwise_alignment_graph_backtracker/bidi_walker/bidi_walker_heap_container_creator_pack.h"
 #include "offbynull/aligner/backtrackers/sliceable_pairwise_alignment_graph_backtracker/bidi_walker/bidi_walker_stack_container_creator_pack.h"
@@ -23,7 +24,6 @@
 #include "offbynull/aligner/graphs/prefix_sliceable_pairwise_alignment_graph.h"
 #include "offbynull/aligner/graphs/suffix_sliceable_pairwise_alignment_graph.h"
 #include "offbynull/aligner/graphs/reversed_sliceable_pairwise_alignment_graph.h"
-#include "offbynull/aligner/graphs/middle_sliceable_pairwise_alignment_graph.h"
 #include "offbynull/aligner/concepts.h"
 #include "offbynull/concepts.h"
 #include "offbynull/utils.h"
@@ -38,7 +38,7 @@ namespace offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_b
         ::resident_segmenter_heap_container_creator_pack::resident_segmenter_heap_container_creator_pack;
     using offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::backtrackable_node::backtrackable_node;
     using offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::backtrackable_edge::backtrackable_edge;
-    using offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::bidi_walker::bidi_walker::bidi_walker;
+    using offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::forward_walker::forward_walker::forward_walker;
     using offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::bidi_walker::bidi_walker_container_creator_pack
         ::bidi_walker_container_creator_pack;
     using offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::bidi_walker
@@ -51,7 +51,6 @@ namespace offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_b
     using offbynull::aligner::graphs::prefix_sliceable_pairwise_alignment_graph::prefix_sliceable_pairwise_alignment_graph;
     using offbynull::aligner::graphs::suffix_sliceable_pairwise_alignment_graph::suffix_sliceable_pairwise_alignment_graph;
     using offbynull::aligner::graphs::reversed_sliceable_pairwise_alignment_graph::reversed_sliceable_pairwise_alignment_graph;
-    using offbynull::aligner::graphs::middle_sliceable_pairwise_alignment_graph::middle_sliceable_pairwise_alignment_graph;
     using offbynull::aligner::concepts::weight;
     using offbynull::concepts::unqualified_object_type;
     using offbynull::concepts::numeric;
@@ -139,8 +138,14 @@ namespace offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_b
         using ND = typename G::ND;
         using N_INDEX = typename G::N_INDEX;
 
+        static constexpr N_INDEX I1 { static_cast<N_INDEX>(1zu) };
+
         using BIDI_WALKER_CONTAINER_CREATOR_PACK =
             decltype(std::declval<CONTAINER_CREATOR_PACK>().create_bidi_walker_container_creator_pack());
+        using FORWARD_WALKER_CONTAINER_CREATOR_PACK =
+            decltype(std::declval<BIDI_WALKER_CONTAINER_CREATOR_PACK>().create_forward_walker_container_creator_pack());
+        using BACKWARD_WALKER_CONTAINER_CREATOR_PACK =
+            decltype(std::declval<BIDI_WALKER_CONTAINER_CREATOR_PACK>().create_backward_walker_container_creator_pack());
         using RESIDENT_NODE_CONTAINER =
             decltype(std::declval<CONTAINER_CREATOR_PACK>().create_resident_node_container(std::declval<std::vector<N>>()));
         using RESIDENT_EDGE_CONTAINER = decltype(std::declval<CONTAINER_CREATOR_PACK>().create_resident_edge_container(0zu));
@@ -197,17 +202,21 @@ namespace offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_b
                 }
             }
 
-            ED max_path_weight {
-                bidi_walker<
-                    debug_mode,
-                    G,
-                    BIDI_WALKER_CONTAINER_CREATOR_PACK
-                >::converge_weight(
+            // Walk forward over the entire graph. Resident nodes are held onto for the entire walk, so once the walk reaches the final row,
+            // the weight and final edge of the maximally-weighted path from the root node to every resident node is available (as well as
+            // to the leaf node).
+            BIDI_WALKER_CONTAINER_CREATOR_PACK bidi_walker_container_creator_pack {
+                container_creator_pack.create_bidi_walker_container_creator_pack()
+            };
+            auto forward_walker_ {
+                forward_walker<debug_mode, G, FORWARD_WALKER_CONTAINER_CREATOR_PACK>::create_and_initialize(
                     g,
-                    g.get_leaf_node(),
-                    zero_weight
+                    static_cast<N_INDEX>(g.grid_down_cnt - I1),  // Cast to prevent narrowing warning
+                    zero_weight,
+                    bidi_walker_container_creator_pack.create_forward_walker_container_creator_pack()
                 )
             };
+            const ED max_path_weight { forward_walker_.find(g.get_leaf_node()).backtracking_weight };
 
             const auto& resident_nodes { g.resident_nodes() };
             RESIDENT_NODE_CONTAINER resident_nodes_sorted {
@@ -216,84 +225,67 @@ namespace offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_b
                 )
             };
             std::ranges::sort(resident_nodes_sorted);
-            auto resident_nodes_sorted_it { resident_nodes_sorted.begin() };
 
+            // Backtrack from the leaf node to the root node, collecting the resident node edges of a single maximally-weighted path. For
+            // each node reached ...
+            //
+            //  * if it's a resident node, its final edge is known from the forward walk above.
+            //  * if it isn't, walk backward from it to find the last resident node on a maximally-weighted path leading up to it (the
+            //    forward walk doesn't hold onto non-resident nodes).
+            //
+            // Resident nodes are only ever connected to a handful of other resident nodes (e.g., the root node and leaf node in a local
+            // alignment graph), so the walk backward is only needed a handful of times. Each resident node included gets exactly one edge:
+            // its final edge, or if it has no inputs (e.g., root node), the edge leaving it.
             RESIDENT_EDGE_CONTAINER resident_edges {
                 container_creator_pack.create_resident_edge_container(
                     resident_nodes_sorted.size()
                 )
             };
             {
-                N last_to_node { g.get_root_node() };
-                while (resident_nodes_sorted_it != resident_nodes_sorted.end()) {
-                    resident_nodes_sorted_it = std::lower_bound(resident_nodes_sorted_it, resident_nodes_sorted.end(), last_to_node);
-                    const N& resident_node { *resident_nodes_sorted_it };
-                    // Does an optimal path through this resident node? If it doesn't, skip. IS THIS STEP ACTUALLY
-                    // NECESSARY?
-                    // TODO: Optimize this so that if multiple resident nodes are on the same slice, you don't have to walk the entire graph
-                    //       for each one
-                    // TODO: If a resident node is on the path, ignore the ones before it? Start from the resident node >=, if it goes
-                    //       through subdivide and do again?
-                    // TODO: More testing need
-                    //
-                    // TODO: Is there a better way to do this? Find first resident, then instead of looping and walking again, you can shift
-                    //       up/down the existing bidiwalker?
-                    // TODO: Is this class even necessary? If you start subdividing from the whole graph, every subdivision should be for a
-                    //       region that the path travels through? IT IS NECESSARY -- THE MIDDLE SLICE OF THE GRAPH MAY BE HOPPED OVER?
-                    bool on_max_path {
-                        bidi_walker<
-                            debug_mode,
-                            G,
-                            BIDI_WALKER_CONTAINER_CREATOR_PACK
-                        >::is_node_on_max_path(
-                            g,
-                            resident_node,
-                            max_path_weight,
-                            max_path_weight_comparison_tolerance,
-                            zero_weight
-                        )
-                    };
-                    if (!on_max_path) {
-                        ++resident_nodes_sorted_it;
-                        continue;
+                N node { g.get_leaf_node() };
+                ED node_weight { max_path_weight };
+                while (true) {
+                    if (std::ranges::binary_search(resident_nodes_sorted, node)) {
+                        if (!g.has_inputs(node)) {  // is root node
+                            break;
+                        }
+                        const auto& node_slot { forward_walker_.find(node) };
+                        if constexpr (debug_mode) {
+                            if (!node_slot.backtracking_edge.has_value()) {
+                                throw std::runtime_error { "Resident node unreachable" };
+                            }
+                        }
+                        const E& resident_edge { *node_slot.backtracking_edge };
+                        resident_edges.push_back(resident_edge);
+                        node = g.get_edge_from(resident_edge);
+                        node_weight = static_cast<ED>(
+                            node_slot.backtracking_weight - g.get_edge_data(resident_edge)
+                        );  // Cast to prevent narrowing warning
+                    } else {
+                        const auto& found {
+                            find_last_resident_node(
+                                g,
+                                node,
+                                node_weight,
+                                resident_nodes_sorted,
+                                forward_walker_,
+                                max_path_weight_comparison_tolerance,
+                                zero_weight,
+                                bidi_walker_container_creator_pack
+                            )
+                        };
+                        if (!found.has_value()) {
+                            break;
+                        }
+                        const auto& [resident_node, resident_edge] { *found };
+                        if (!g.has_inputs(resident_node)) {  // is root node
+                            resident_edges.push_back(resident_edge);
+                        }
+                        node = resident_node;
+                        node_weight = forward_walker_.find(resident_node).backtracking_weight;
                     }
-                    // Isolate graph such that root is last_to_node and walk it instead of full graph. This is required
-                    // because, when walking using the whole graph (not isolated), sometimes the edge's "from node" will
-                    // be BEFORE last_to_node. Having a "from node" BEFORE last_to_node is a known issue because there
-                    // may be more than 1 optimal path and the prior edge vs this edge are targeting different optimal
-                    // paths. The problem is that we can't accept that because we're targeting exactly one optimal path,
-                    // and so we want to reject anything BEFORE last_to_node because if it goes BEFORE last_to_node then
-                    // we know it's targeting a different optimal path vs the one that goes through last_to_node.
-                    middle_sliceable_pairwise_alignment_graph<debug_mode, G> sub_graph {
-                        g,
-                        last_to_node,
-                        g.get_leaf_node()
-                    };
-                    const auto& converged_edges_at_resident_node {
-                        bidi_walker<
-                            debug_mode,
-                            decltype(sub_graph),
-                            BIDI_WALKER_CONTAINER_CREATOR_PACK
-                        >::converge(
-                            sub_graph,
-                            resident_node,
-                            zero_weight
-                        )
-                    };
-                    if (!sub_graph.has_node(resident_node)) { // if node isn't visible, skip
-                        ++resident_nodes_sorted_it;
-                        continue;
-                    }
-                    E resident_edge;
-                    if (!g.has_inputs(resident_node)) {  // is root node
-                        resident_edge = *(converged_edges_at_resident_node.backward_slot).backtracking_edge;
-                    } else { // is NOT root node (leaf node or any node that isn't root node)
-                        resident_edge = *(converged_edges_at_resident_node.forward_slot).backtracking_edge;
-                    }
-                    resident_edges.push_back(resident_edge);
-                    last_to_node = g.get_edge_to(resident_edge);
-                    ++resident_nodes_sorted_it;
                 }
+                std::ranges::reverse(resident_edges);
             }
 
             SEGMENT_HOP_CHAIN_CONTAINER parts {
@@ -327,6 +319,69 @@ namespace offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_b
 
             return std::make_pair(parts, max_path_weight);
         }
+
+    private:
+        // Find the last resident node on any of the maximally-weighted paths between the root node and `node`, along with the edge leaving
+        // that resident node on that path. `node_weight` is the weight of the maximally-weighted path between the root node and `node`.
+        std::optional<std::pair<N, E>> find_last_resident_node(
+            const G& g,
+            const N& node,
+            const ED node_weight,
+            const RESIDENT_NODE_CONTAINER& resident_nodes_sorted,
+            auto& forward_walker_,
+            const ED max_path_weight_comparison_tolerance,
+            const ED zero_weight,
+            const BIDI_WALKER_CONTAINER_CREATOR_PACK& bidi_walker_container_creator_pack
+        ) {
+            const auto resident_nodes_before_node_end { std::ranges::lower_bound(resident_nodes_sorted, node) };
+            if (resident_nodes_before_node_end == resident_nodes_sorted.begin()) {
+                return std::nullopt;
+            }
+            prefix_sliceable_pairwise_alignment_graph<debug_mode, G> prefix_g { g, node };
+            reversed_sliceable_pairwise_alignment_graph<debug_mode, decltype(prefix_g)> reversed_prefix_g { prefix_g };
+            auto backward_walker {
+                forward_walker<debug_mode, decltype(reversed_prefix_g), BACKWARD_WALKER_CONTAINER_CREATOR_PACK>::create_and_initialize(
+                    reversed_prefix_g,
+                    static_cast<N_INDEX>(reversed_prefix_g.grid_down_cnt - I1),  // Cast to prevent narrowing warning
+                    zero_weight,
+                    bidi_walker_container_creator_pack.create_backward_walker_container_creator_pack()
+                )
+            };
+            // Why not use std::abs()? If ED is unsigned, std::abs() doesn't have overloads for unsigned types.
+            auto diff {
+                [](ED a, ED b) {
+                    if (a < b) {
+                        return static_cast<ED>(b - a);  // Cast to prevent narrowing warning
+                    } else {
+                        return static_cast<ED>(a - b);  // Cast to prevent narrowing warning
+                    }
+                }
+            };
+            for (auto it { resident_nodes_before_node_end }; it != resident_nodes_sorted.begin(); ) {
+                --it;
+                const N& resident_node { *it };
+                if (!prefix_g.has_node(resident_node)) {  // if node isn't visible, skip
+                    continue;
+                }
+                const auto& forward_slot { forward_walker_.find(resident_node) };
+                const auto& backward_slot { backward_walker.find(resident_node) };
+                if (!forward_slot.backtracking_edge.has_value() && g.has_inputs(resident_node)) {  // if node isn't reachable, skip
+                    continue;
+                }
+                if (!backward_slot.backtracking_edge.has_value()) {  // if node can't reach node, skip
+                    continue;
+                }
+                const ED converged_weight {
+                    static_cast<ED>(
+                        forward_slot.backtracking_weight + backward_slot.backtracking_weight
+                    )  // Cast to prevent narrowing warning
+                };
+                if (diff(converged_weight, node_weight) <= max_path_weight_comparison_tolerance) {
+                    return { { resident_node, *backward_slot.backtracking_edge } };
+                }
+            }
+            return std::nullopt;
+        }
     };
 }
 
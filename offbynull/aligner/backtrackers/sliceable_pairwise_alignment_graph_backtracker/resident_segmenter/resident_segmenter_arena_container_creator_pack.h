@@ -0,0 +1,110 @@
+#ifndef OFFBYNULL_ALIGNER_BACKTRACKERS_SLICEABLE_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_RESIDENT_SEGMENTER_RESIDENT_SEGMENTER_ARENA_CONTAINER_CREATOR_PACK_H
+#define OFFBYNULL_ALIGNER_BACKTRACKERS_SLICEABLE_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_RESIDENT_SEGMENTER_RESIDENT_SEGMENTER_ARENA_CONTAINER_CREATOR_PACK_H
+
+#include <cstddef>
+#include <memory_resource>
+#include <vector>
+#include <variant>
+#include <ranges>
+#include <type_traits>
+#include "offbynull/aligner/backtrackers/sliceable_pairwise_alignment_graph_backtracker/backtrackable_node.h"
+#include "offbynull/aligner/backtrackers/sliceable_pairwise_alignment_graph_backtracker/backtrackable_edge.h"
+#include "offbynull/aligner/backtrackers/sliceable_pairwise_alignment_graph_backtracker/resident_segmenter/hop.h"
+#include "offbynull/aligner/backtrackers/sliceable_pairwise_alignment_graph_backtracker/resident_segmenter/segment.h"
+#include "offbynull/aligner/backtrackers/sliceable_pairwise_alignment_graph_backtracker/resident_segmenter/unimplemented_resident_segmenter_container_creator_pack.h"
+#include "offbynull/aligner/backtrackers/sliceable_pairwise_alignment_graph_backtracker/bidi_walker/bidi_walker_arena_container_creator_pack.h"
+#include "offbynull/aligner/concepts.h"
+#include "offbynull/concepts.h"
+
+namespace offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::resident_segmenter
+        ::resident_segmenter_arena_container_creator_pack {
+    using offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::backtrackable_node::backtrackable_node;
+    using offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::backtrackable_edge::backtrackable_edge;
+    using offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::resident_segmenter::hop::hop;
+    using offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::resident_segmenter::segment::segment;
+    using offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::bidi_walker
+        ::bidi_walker_arena_container_creator_pack::bidi_walker_arena_container_creator_pack;
+    using offbynull::aligner::concepts::weight;
+    using offbynull::concepts::forward_range_of_non_cvref;
+
+    /**
+     * @ref offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::resident_segmenter::resident_segmenter_container_creator_pack::resident_segmenter_container_creator_pack
+     * that allocates its containers from a `std::pmr::memory_resource`.
+     *
+     * @tparam debug_mode `true` to enable debugging logic, `false` otherwise.
+     * @tparam N Graph node identifier type.
+     * @tparam E Graph edge identifier type.
+     * @tparam ED Graph edge data type (edge weight).
+     * @tparam minimize_allocations `true` to force created containers to prime with the exact number of elements needed, thereby
+     *     removing/reducing the need for adhoc reallocations.
+     */
+    template<
+        bool debug_mode,
+        backtrackable_node N,
+        backtrackable_edge E,
+        weight ED,
+        bool minimize_allocations
+    >
+    struct resident_segmenter_arena_container_creator_pack {
+        /** Memory resource that containers are allocated from (must outlive the containers). */
+        std::pmr::memory_resource* resource { std::pmr::get_default_resource() };
+
+        /**
+         * @copydoc offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::resident_segmenter::unimplemented_resident_segmenter_container_creator_pack::unimplemented_resident_segmenter_container_creator_pack::create_bidi_walker_container_creator_pack
+         */
+        bidi_walker_arena_container_creator_pack<
+            debug_mode,
+            N,
+            E,
+            ED,
+            minimize_allocations
+        > create_bidi_walker_container_creator_pack() const {
+            return { resource };
+        }
+
+        /**
+         * @copydoc offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::resident_segmenter::unimplemented_resident_segmenter_container_creator_pack::unimplemented_resident_segmenter_container_creator_pack::create_resident_node_container
+         */
+        std::pmr::vector<N> create_resident_node_container(forward_range_of_non_cvref<N> auto&& resident_nodes) const {
+            std::pmr::vector<N> ret(resource);
+            if constexpr (std::ranges::sized_range<std::remove_cvref_t<decltype(resident_nodes)>>) {
+                ret.reserve(std::ranges::size(resident_nodes));
+            } else if constexpr (minimize_allocations) {
+                ret.reserve(std::ranges::distance(resident_nodes.begin(), resident_nodes.end()));
+            }
+            for (const auto& n : resident_nodes) {
+                ret.push_back(n);
+            }
+            return ret;
+        }
+
+        /**
+         * @copydoc offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::resident_segmenter::unimplemented_resident_segmenter_container_creator_pack::unimplemented_resident_segmenter_container_creator_pack::create_resident_edge_container
+         */
+        std::pmr::vector<E> create_resident_edge_container(std::size_t resident_nodes_capacity) const {
+            std::pmr::vector<E> ret(resource);
+            if constexpr (minimize_allocations) {
+                ret.reserve(resident_nodes_capacity);
+            }
+            return ret;
+        }
+
+        /**
+         * @copydoc offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::resident_segmenter::unimplemented_resident_segmenter_container_creator_pack::unimplemented_resident_segmenter_container_creator_pack::create_segment_hop_chain_container
+         */
+        std::pmr::vector<
+            std::variant<
+                hop<E>,
+                segment<N>
+            >
+        > create_segment_hop_chain_container(std::size_t resident_nodes_capacity) const {
+            std::pmr::vector<std::variant<hop<E>, segment<N>>> ret(resource);
+            if constexpr (minimize_allocations) {
+                ret.reserve(resident_nodes_capacity * 2zu + 1zu);
+            }
+            return ret;
+        }
+    };
+}
+
+#endif //OFFBYNULL_ALIGNER_BACKTRACKERS_SLICEABLE_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_RESIDENT_SEGMENTER_RESIDENT_SEGMENTER_ARENA_CONTAINER_CREATOR_PACK_H
@@ -0,0 +1,99 @@
+#ifndef OFFBYNULL_ALIGNER_BACKTRACKERS_SLICEABLE_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_RESIDENT_SEGMENTER_RESIDENT_SEGMENTER_BANDED_CONTAINER_CREATOR_PACK_H
+#define OFFBYNULL_ALIGNER_BACKTRACKERS_SLICEABLE_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_RESIDENT_SEGMENTER_RESIDENT_SEGMENTER_BANDED_CONTAINER_CREATOR_PACK_H
+
+#include <cstddef>
+#include <utility>
+#include "offbynull/aligner/backtrackers/sliceable_pairwise_alignment_graph_backtracker/backtrackable_node.h"
+#include "offbynull/aligner/backtrackers/sliceable_pairwise_alignment_graph_backtracker/backtrackable_edge.h"
+#include "offbynull/aligner/backtrackers/sliceable_pairwise_alignment_graph_backtracker/resident_segmenter/resident_segmenter_container_creator_pack.h"
+#include "offbynull/aligner/backtrackers/sliceable_pairwise_alignment_graph_backtracker/resident_segmenter/resident_segmenter_heap_container_creator_pack.h"
+#include "offbynull/aligner/backtrackers/sliceable_pairwise_alignment_graph_backtracker/resident_segmenter/unimplemented_resident_segmenter_container_creator_pack.h"
+#include "offbynull/aligner/backtrackers/sliceable_pairwise_alignment_graph_backtracker/bidi_walker/bidi_walker_banded_container_creator_pack.h"
+#include "offbynull/aligner/concepts.h"
+#include "offbynull/concepts.h"
+
+namespace offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::resident_segmenter
+        ::resident_segmenter_banded_container_creator_pack {
+    using offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::backtrackable_node::backtrackable_node;
+    using offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::backtrackable_edge::backtrackable_edge;
+    using offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::resident_segmenter
+        ::resident_segmenter_container_creator_pack::resident_segmenter_container_creator_pack;
+    using offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::resident_segmenter
+        ::resident_segmenter_heap_container_creator_pack::resident_segmenter_heap_container_creator_pack;
+    using offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::bidi_walker
+        ::bidi_walker_banded_container_creator_pack::bidi_walker_banded_container_creator_pack;
+    using offbynull::aligner::concepts::weight;
+    using offbynull::concepts::forward_range_of_non_cvref;
+
+    /**
+     * @ref offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::resident_segmenter::resident_segmenter_container_creator_pack::resident_segmenter_container_creator_pack
+     * that limits row storage to `band_width` columns, intended for graphs where only a diagonal band of each row exists (e.g.,
+     * @ref offbynull::aligner::graphs::banded_sliceable_pairwise_alignment_graph::banded_sliceable_pairwise_alignment_graph). The
+     * containers themselves are created by a backing container creator pack.
+     *
+     * @tparam debug_mode `true` to enable debugging logic, `false` otherwise.
+     * @tparam N Graph node identifier type.
+     * @tparam E Graph edge identifier type.
+     * @tparam ED Graph edge data type (edge weight).
+     * @tparam BACKING_CONTAINER_CREATOR_PACK Container factory type that containers are created with.
+     */
+    template<
+        bool debug_mode,
+        backtrackable_node N,
+        backtrackable_edge E,
+        weight ED,
+        resident_segmenter_container_creator_pack<
+            N,
+            E,
+            ED
+        > BACKING_CONTAINER_CREATOR_PACK = resident_segmenter_heap_container_creator_pack<
+            debug_mode,
+            N,
+            E,
+            ED,
+            false
+        >
+    >
+    struct resident_segmenter_banded_container_creator_pack {
+        /** Maximum number of columns held per row. */
+        std::size_t band_width;
+        /** Container factory that containers are created with. */
+        BACKING_CONTAINER_CREATOR_PACK backing_container_creator_pack {};
+
+        /**
+         * @copydoc offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::resident_segmenter::unimplemented_resident_segmenter_container_creator_pack::unimplemented_resident_segmenter_container_creator_pack::create_bidi_walker_container_creator_pack
+         */
+        bidi_walker_banded_container_creator_pack<
+            debug_mode,
+            N,
+            E,
+            ED,
+            decltype(std::declval<BACKING_CONTAINER_CREATOR_PACK>().create_bidi_walker_container_creator_pack())
+        > create_bidi_walker_container_creator_pack() const {
+            return { band_width, backing_container_creator_pack.create_bidi_walker_container_creator_pack() };
+        }
+
+        /**
+         * @copydoc offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::resident_segmenter::unimplemented_resident_segmenter_container_creator_pack::unimplemented_resident_segmenter_container_creator_pack::create_resident_node_container
+         */
+        auto create_resident_node_container(forward_range_of_non_cvref<N> auto&& resident_nodes) const {
+            return backing_container_creator_pack.create_resident_node_container(std::forward<decltype(resident_nodes)>(resident_nodes));
+        }
+
+        /**
+         * @copydoc offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::resident_segmenter::unimplemented_resident_segmenter_container_creator_pack::unimplemented_resident_segmenter_container_creator_pack::create_resident_edge_container
+         */
+        auto create_resident_edge_container(std::size_t resident_nodes_capacity) const {
+            return backing_container_creator_pack.create_resident_edge_container(resident_nodes_capacity);
+        }
+
+        /**
+         * @copydoc offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::resident_segmenter::unimplemented_resident_segmenter_container_creator_pack::unimplemented_resident_segmenter_container_creator_pack::create_segment_hop_chain_container
+         */
+        auto create_segment_hop_chain_container(std::size_t resident_nodes_capacity) const {
+            return backing_container_creator_pack.create_segment_hop_chain_container(resident_nodes_capacity);
+        }
+    };
+}
+
+#endif //OFFBYNULL_ALIGNER_BACKTRACKERS_SLICEABLE_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_RESIDENT_SEGMENTER_RESIDENT_SEGMENTER_BANDED_CONTAINER_CREATOR_PACK_H
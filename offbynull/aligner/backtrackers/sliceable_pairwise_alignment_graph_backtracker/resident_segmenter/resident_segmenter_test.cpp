@@ -3,6 +3,7 @@
 #include "offbynull/aligner/graphs/pairwise_fitting_alignment_graph.h"
 #include "offbynull/aligner/graphs/pairwise_overlap_alignment_graph.h"
 #include "offbynull/aligner/graphs/pairwise_global_alignment_graph.h"
+#include "offbynull/aligner/graphs/middle_sliceable_pairwise_alignment_graph.h"
 #include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/backtracker.h"
 #include "offbynull/aligner/backtrackers/sliceable_pairwise_alignment_graph_backtracker/resident_segmenter/hop.h"
 #include "offbynull/aligner/backtrackers/sliceable_pairwise_alignment_graph_backtracker/resident_segmenter/segment.h"
@@ -19,6 +20,8 @@
 #include <cstdint>
 #include <cstddef>
 #include <stdexcept>
+#include <random>
+#include <type_traits>
 
 namespace {
     using offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::resident_segmenter::hop::hop;
@@ -29,6 +32,8 @@ namespace {
     using offbynull::aligner::graphs::pairwise_local_alignment_graph::pairwise_local_alignment_graph;
     using offbynull::aligner::graphs::pairwise_fitting_alignment_graph::pairwise_fitting_alignment_graph;
     using offbynull::aligner::graphs::pairwise_overlap_alignment_graph::pairwise_overlap_alignment_graph;
+    using offbynull::aligner::graphs::middle_sliceable_pairwise_alignment_graph::middle_sliceable_pairwise_alignment_graph;
+    using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtracker::heap_find_max_path;
     using offbynull::aligner::scorers::simple_scorer::simple_scorer;
     using offbynull::utils::is_debug_mode;
 
@@ -160,4 +165,103 @@ namespace {
             }
         }
     }
+
+    std::string random_sequence(std::mt19937_64& rand, std::size_t len) {
+        std::string ret {};
+        for (std::size_t i { 0zu }; i < len; ++i) {
+            ret += static_cast<char>('a' + rand() % 4zu);
+        }
+        return ret;
+    }
+
+    // The segment-hop chain must run from the root node to the leaf node and, with each segment's own maximally-weighted path filled in,
+    // must add up to the maximally-weighted path's weight (meaning that all hops sit on the same maximally-weighted path).
+    void check_segmentation_points(const auto& g) {
+        using G = std::remove_cvref_t<decltype(g)>;
+        using N = typename G::N;
+        using E = typename G::E;
+        const auto& [expected_path, expected_weight] { heap_find_max_path<is_debug_mode(), std::size_t, std::size_t, true>(g) };
+        resident_segmenter<is_debug_mode(), G> segmenter {};
+        const auto& [parts, final_weight] { segmenter.backtrack_segmentation_points(g, 0.000001f64, 0.0f64) };
+        EXPECT_NEAR(final_weight, expected_weight, 0.000001f64);
+        N last_to_node { g.get_root_node() };
+        std::float64_t chain_weight { 0.0f64 };
+        for (const auto& part : parts) {
+            if (const hop<E>* hop_ptr = std::get_if<hop<E>>(&part)) {
+                EXPECT_EQ(g.get_edge_from(hop_ptr->edge), last_to_node);
+                chain_weight += g.get_edge_data(hop_ptr->edge);
+                last_to_node = g.get_edge_to(hop_ptr->edge);
+            } else if (const segment<N>* segment_ptr = std::get_if<segment<N>>(&part)) {
+                EXPECT_EQ(segment_ptr->from_node, last_to_node);
+                middle_sliceable_pairwise_alignment_graph<is_debug_mode(), G> segment_g {
+                    g,
+                    segment_ptr->from_node,
+                    segment_ptr->to_node
+                };
+                const auto& [segment_path, segment_weight] {
+                    heap_find_max_path<is_debug_mode(), std::size_t, std::size_t, true>(segment_g)
+                };
+                chain_weight += segment_weight;
+                last_to_node = segment_ptr->to_node;
+            }
+        }
+        EXPECT_EQ(last_to_node, g.get_leaf_node());
+        EXPECT_NEAR(chain_weight, expected_weight, 0.000001f64);
+    }
+
+    TEST(OABSRResidentSegmenterTest, SegmentationPointsOnMaxPath) {
+        auto substitution_scorer {
+            simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_substitution(1.0f64, -1.0f64)
+        };
+        auto gap_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_gap(-1.0f64) };
+        auto freeride_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_freeride(0.0f64) };
+        std::mt19937_64 rand { 24680 };
+        for (std::size_t i { 0zu }; i < 10zu; ++i) {
+            std::string seq1 { random_sequence(rand, 1zu + rand() % 30zu) };
+            std::string seq2 { random_sequence(rand, 1zu + rand() % 30zu) };
+            pairwise_global_alignment_graph<
+                is_debug_mode(),
+                std::size_t,
+                std::float64_t,
+                decltype(seq1),
+                decltype(seq2),
+                decltype(substitution_scorer),
+                decltype(gap_scorer)
+            > global_g { seq1, seq2, substitution_scorer, gap_scorer };
+            check_segmentation_points(global_g);
+            pairwise_local_alignment_graph<
+                is_debug_mode(),
+                std::size_t,
+                std::float64_t,
+                decltype(seq1),
+                decltype(seq2),
+                decltype(substitution_scorer),
+                decltype(gap_scorer),
+                decltype(freeride_scorer)
+            > local_g { seq1, seq2, substitution_scorer, gap_scorer, freeride_scorer };
+            check_segmentation_points(local_g);
+            pairwise_overlap_alignment_graph<
+                is_debug_mode(),
+                std::size_t,
+                std::float64_t,
+                decltype(seq1),
+                decltype(seq2),
+                decltype(substitution_scorer),
+                decltype(gap_scorer),
+                decltype(freeride_scorer)
+            > overlap_g { seq1, seq2, substitution_scorer, gap_scorer, freeride_scorer };
+            check_segmentation_points(overlap_g);
+            pairwise_fitting_alignment_graph<
+                is_debug_mode(),
+                std::size_t,
+                std::float64_t,
+                decltype(seq1),
+                decltype(seq2),
+                decltype(substitution_scorer),
+                decltype(gap_scorer),
+                decltype(freeride_scorer)
+            > fitting_g { seq1, seq2, substitution_scorer, gap_scorer, freeride_scorer };
+            check_segmentation_points(fitting_g);
+        }
+    }
 }
@@ -61,6 +61,7 @@ namespace offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_b
 
         const G& g;
         SLOT_CONTAINER slots;
+        std::size_t slots_right_cnt;
         N_INDEX grid_down;
 
     public:
@@ -88,6 +89,7 @@ namespace offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_b
                 zero_weight
             )
         }
+        , slots_right_cnt { slots.size() / g.grid_depth_cnt }
         , grid_down {} {}
 
         // TODO: Is it safe to assume this'll always return something valid? So we can skip the check and std::optional wrapper (or make the
@@ -104,7 +106,9 @@ namespace offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_b
             if (grid_down != down_offset) {
                 return { std::nullopt };
             }
-            std::size_t idx { (right_offset * g.grid_depth_cnt) + depth };
+            // Containers narrower than the graph (e.g., banded) wrap columns around.
+            const std::size_t column { right_offset < slots_right_cnt ? right_offset : right_offset % slots_right_cnt };
+            std::size_t idx { (column * g.grid_depth_cnt) + depth };
             return { { slots[idx] } };
         }
 
@@ -1,6 +1,8 @@
 #ifndef OFFBYNULL_ALIGNER_BACKTRACKERS_SLICEABLE_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_SLICED_SUBDIVIDER_SLICED_SUBDIVIDER_H
 #define OFFBYNULL_ALIGNER_BACKTRACKERS_SLICEABLE_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_SLICED_SUBDIVIDER_SLICED_SUBDIVIDER_H
 
+#include <cstddef>
+#include <mutex>
 #include <string>
 #include <iostream>
 #include <ostream>
@@ -14,6 +16,7 @@
 #include "offbynull/aligner/backtrackers/sliceable_pairwise_alignment_graph_backtracker/sliced_subdivider/sliced_subdivider_heap_container_creator_pack.h"
 #include "offbynull/aligner/backtrackers/sliceable_pairwise_alignment_graph_backtracker/resident_slot_container/resident_slot_container_stack_container_creator_pack.h"
 #include "offbynull/aligner/backtrackers/sliceable_pairwise_alignment_graph_backtracker/bidi_walker/bidi_walker.h"
+#include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/backtracker.h"
 #include "offbynull/aligner/graph/sliceable_pairwise_alignment_graph.h"
 #include "offbynull/aligner/graphs/prefix_sliceable_pairwise_alignment_graph.h"
 #include "offbynull/aligner/graphs/suffix_sliceable_pairwise_alignment_graph.h"
@@ -21,6 +24,7 @@
 #include "offbynull/aligner/graphs/reversed_sliceable_pairwise_alignment_graph.h"
 #include "offbynull/aligner/concepts.h"
 #include "offbynull/concepts.h"
+#include "offbynull/helpers/forkable_thread_pool.h"
 
 namespace offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::sliced_subdivider::sliced_subdivider {
     using offbynull::aligner::graph::sliceable_pairwise_alignment_graph::sliceable_pairwise_alignment_graph;
@@ -31,6 +35,7 @@ namespace offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_b
     using offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::sliced_subdivider
         ::sliced_subdivider_heap_container_creator_pack::sliced_subdivider_heap_container_creator_pack;
     using offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::bidi_walker::bidi_walker::bidi_walker;
+    using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtracker::heap_find_max_path;
     using offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::path_container::path_container::element;
     using offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::path_container::path_container::path_container;
     using offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::resident_slot_container
@@ -42,6 +47,7 @@ namespace offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_b
     using offbynull::aligner::concepts::weight;
     using offbynull::concepts::widenable_to_size_t;
     using offbynull::concepts::unqualified_object_type;
+    using offbynull::helpers::forkable_thread_pool::forkable_thread_pool;
 
     /**
      * Sliced subdivider finds a maximally-weighted path through a
@@ -76,6 +82,11 @@ namespace offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_b
      *
      * The converging / bisecting edges form a maximally-weighted path through the segment.
      *
+     * Each level of recursion re-walks the segments it creates, so small segments are disproportionately expensive to subdivide. Once a
+     * segment has at most `full_dp_node_cnt` nodes, its maximally-weighted path is instead found in a single walk via
+     * @ref offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtracker::backtracker (on the heap), which holds
+     * onto a slot for every node in that segment.
+     *
      *```
      *    maximally-weighted path
      * *---->*
@@ -139,12 +150,20 @@ namespace offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_b
 
         CONTAINER_CREATOR_PACK container_creator_pack;
 
+        const std::size_t full_dp_node_cnt;
+
         enum class walk_direction {
             PREFIX,
             SUFFIX,
             INITIALIZE
         };
 
+        struct parallel_context {
+            forkable_thread_pool<debug_mode, void>& thread_pool;
+            const std::size_t serial_node_cnt;
+            std::mutex path_mutex;
+        };
+
     public:
         /**
          * Construct an
@@ -163,15 +182,19 @@ namespace offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_b
          * @param g Graph (view of a segment).
          * @param zero_weight_ Initial weight, equivalent to 0 for numeric weights.
          * @param container_creator_pack_ Container factory.
+         * @param full_dp_node_cnt_ Node count at or below which a segment is solved in a single walk rather than subdivided further (0
+         *     to always subdivide, meaning that nothing gets allocated outside of `container_creator_pack_`).
          */
         sliced_subdivider(
             const G& g,
             const ED zero_weight_,
-            CONTAINER_CREATOR_PACK container_creator_pack_ = {}
+            CONTAINER_CREATOR_PACK container_creator_pack_ = {},
+            const std::size_t full_dp_node_cnt_ = 0zu
         )
         : whole_graph { g }
         , zero_weight { zero_weight_ }
-        , container_creator_pack { container_creator_pack_ } {
+        , container_creator_pack { container_creator_pack_ }
+        , full_dp_node_cnt { full_dp_node_cnt_ } {
             if constexpr (debug_mode) {
                 for (const auto& resident_node : whole_graph.resident_nodes()) {
                     if (resident_node != whole_graph.get_root_node() && resident_node != whole_graph.get_leaf_node()) {
@@ -199,12 +222,81 @@ namespace offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_b
                 whole_graph.get_root_node(),
                 whole_graph.get_leaf_node(),
                 zero_weight,
-                zero_weight
+                zero_weight,
+                nullptr
             );
 
             return path_container_;
         }
 
+        /**
+         * Find maximally-weighted path throughout the graph segment assigned to this object, subdividing in parallel on a thread pool.
+         *
+         * The walks used to find a segment's bisecting edge (from the segment's root and from the segment's leaf) are independent of each
+         * other, so the walk from the leaf is queued onto `thread_pool` while the walk from the root runs on the current thread. Likewise,
+         * once a segment's bisecting edge is found, the segments before and after that edge are independent of each other, so the segment
+         * before is queued onto `thread_pool` while the segment after is subdivided on the current thread. Segments with fewer than
+         * `serial_node_cnt` nodes are subdivided entirely on the current thread, since at that size the overhead of queueing outweighs
+         * the work being queued. Bisecting edges are stitched into the returned path in order, so the returned path is identical to the
+         * one returned by `subdivide()`.
+         *
+         * The behavior of this function is undefined if ...
+         *
+         *  * the graph isn't safe to query from multiple threads at once (e.g.,
+         *    @ref offbynull::aligner::graphs::memoizing_sliceable_pairwise_alignment_graph::memoizing_sliceable_pairwise_alignment_graph
+         *    mutates its cache on every query).
+         *  * the container creator pack isn't safe to use from multiple threads at once (e.g.,
+         *    @ref offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::sliced_subdivider::sliced_subdivider_arena_container_creator_pack::sliced_subdivider_arena_container_creator_pack
+         *    backed by an unsynchronized pool resource).
+         *  * `thread_pool` is closed before this function returns.
+         *  * this function is invoked from one of `thread_pool`'s threads.
+         *
+         * @param thread_pool Thread pool to subdivide on.
+         * @param serial_node_cnt Node count below which a segment is subdivided on the current thread.
+         * @return Maximally-weighted path through graph segment.
+         */
+        path_container<debug_mode, G, PATH_CONTAINER_CONTAINER_CREATOR_PACK> subdivide(
+            forkable_thread_pool<debug_mode, void>& thread_pool,
+            const std::size_t serial_node_cnt = 65536zu
+        ) {
+            path_container<debug_mode, G, PATH_CONTAINER_CONTAINER_CREATOR_PACK> path_container_ {
+                whole_graph,
+                container_creator_pack.create_path_container_container_creator_pack()
+            };
+
+            parallel_context parallel { thread_pool, serial_node_cnt, {} };
+            const auto subdivide_whole_graph {
+                [&](parallel_context* const parallel_) {
+                    subdivide(
+                        path_container_,
+                        nullptr,
+                        walk_direction::INITIALIZE,
+                        whole_graph.get_root_node(),
+                        whole_graph.get_leaf_node(),
+                        zero_weight,
+                        zero_weight,
+                        parallel_
+                    );
+                }
+            };
+            // Subdivision itself is queued onto the thread pool, so that the current thread only waits on the result rather than running
+            // (and joining) forked work itself.
+            auto future {
+                thread_pool.queue(
+                    [&](forkable_thread_pool<debug_mode, void>&) {
+                        subdivide_whole_graph(&parallel);
+                    }
+                )
+            };
+            if (future.has_value()) {
+                future->get();
+            } else {  // Thread pool refused the task, so subdivide on the current thread instead
+                subdivide_whole_graph(nullptr);
+            }
+
+            return path_container_;
+        }
+
     private:
         ED subdivide(
             path_container<debug_mode, G, PATH_CONTAINER_CONTAINER_CREATOR_PACK>& path_container_,
@@ -213,7 +305,8 @@ namespace offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_b
             const N& root_node,
             const N& leaf_node,
             const ED existing_weight_at_root,
-            const ED existing_weight_at_leaf
+            const ED existing_weight_at_leaf,
+            parallel_context* const parallel
         ) {
             // std::string indent_str {};
             // static int indent { 0 };
@@ -242,6 +335,17 @@ namespace offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_b
             if (root_node == leaf_node) {
                 return zero_weight;
             }
+            const std::size_t node_cnt {
+                (static_cast<std::size_t>(sub_graph.grid_down_cnt) * sub_graph.grid_right_cnt) * sub_graph.grid_depth_cnt
+            };
+            const bool fork { parallel != nullptr && node_cnt >= parallel->serial_node_cnt };
+            if (node_cnt <= full_dp_node_cnt) {
+                return static_cast<ED>(
+                    existing_weight_at_root
+                    + splice_full_dp_path(path_container_, parent_element, dir, sub_graph, parallel)
+                    + existing_weight_at_leaf
+                );  // Cast to prevent narrowing warning
+            }
             ED max_path_weight { zero_weight };
             E max_edge {};
             ED max_edge_weight { zero_weight };
@@ -279,16 +383,25 @@ namespace offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_b
                     decltype(sub_graph),
                     override_bidi_walker_container_creator_pack
                 >;
+                override_bidi_walker_container_creator_pack bidi_walker_container_creator_pack {
+                    container_creator_pack
+                        .create_row_slot_container_container_creator_pack()
+                };
                 BIDI_WALKER_TYPE bidi_walker_ {
-                    BIDI_WALKER_TYPE::create_and_initialize(
-                        sub_graph,
-                        mid_down_offset,
-                        zero_weight,
-                        override_bidi_walker_container_creator_pack {
-                            container_creator_pack
-                                .create_row_slot_container_container_creator_pack()
-                        }
-                    )
+                    fork
+                        ? BIDI_WALKER_TYPE::create_and_initialize(
+                            sub_graph,
+                            mid_down_offset,
+                            zero_weight,
+                            parallel->thread_pool,
+                            bidi_walker_container_creator_pack
+                        )
+                        : BIDI_WALKER_TYPE::create_and_initialize(
+                            sub_graph,
+                            mid_down_offset,
+                            zero_weight,
+                            bidi_walker_container_creator_pack
+                        )
                 };
                 // walk middle, pulling out node/edge with max weight
                 auto mid_row { sub_graph.row_nodes(mid_down_offset) };
@@ -344,8 +457,12 @@ namespace offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_b
             //         << " edge_weight: " << max_edge_weight
             //         << " post_weight: " << after_max_edge_weight << std::endl;
 
-            // Add
+            // Add (concurrent subdivisions only ever insert into separate gaps of the path, but they still share the container)
             element<E>* current_element { nullptr };
+            std::unique_lock<std::mutex> path_lock {};
+            if (parallel != nullptr) {
+                path_lock = std::unique_lock { parallel->path_mutex };
+            }
             switch (dir) {
                 case walk_direction::PREFIX:
                     current_element = path_container_.push_prefix(parent_element, max_edge);
@@ -362,33 +479,113 @@ namespace offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_b
                     }
                     break;
             }
+            if (path_lock.owns_lock()) {
+                path_lock.unlock();
+            }
 
             // Recurse
             // indent++;
-            // std::cout << indent_str << " topleft" << std::endl;
-            subdivide(
-                path_container_,
-                current_element,
-                walk_direction::PREFIX,
-                sub_graph.get_root_node(),
-                sub_graph.get_edge_from(max_edge),
-                existing_weight_at_root,
-                static_cast<ED>(existing_weight_at_leaf + after_max_edge_weight + max_edge_weight)  // Cast to prevent narrowing warning
-            );
-            // std::cout << indent_str << " bottomright" << std::endl;
-            subdivide(
-                path_container_,
-                current_element,
-                walk_direction::SUFFIX,
-                sub_graph.get_edge_to(max_edge),
-                sub_graph.get_leaf_node(),
-                static_cast<ED>(existing_weight_at_root + before_max_edge_weight + max_edge_weight),  // Cast to prevent narrowing warning
-                existing_weight_at_leaf
-            );
+            const auto recurse_prefix {
+                [&]() {
+                    // std::cout << indent_str << " topleft" << std::endl;
+                    subdivide(
+                        path_container_,
+                        current_element,
+                        walk_direction::PREFIX,
+                        sub_graph.get_root_node(),
+                        sub_graph.get_edge_from(max_edge),
+                        existing_weight_at_root,
+                        static_cast<ED>(existing_weight_at_leaf + after_max_edge_weight + max_edge_weight),  // Cast to prevent narrowing
+                        parallel
+                    );
+                }
+            };
+            const auto recurse_suffix {
+                [&]() {
+                    // std::cout << indent_str << " bottomright" << std::endl;
+                    subdivide(
+                        path_container_,
+                        current_element,
+                        walk_direction::SUFFIX,
+                        sub_graph.get_edge_to(max_edge),
+                        sub_graph.get_leaf_node(),
+                        static_cast<ED>(existing_weight_at_root + before_max_edge_weight + max_edge_weight),  // Cast to prevent narrowing
+                        existing_weight_at_leaf,
+                        parallel
+                    );
+                }
+            };
+            if (fork) {
+                auto prefix_future {
+                    parallel->thread_pool.queue(
+                        [&](forkable_thread_pool<debug_mode, void>&) {
+                            recurse_prefix();
+                        }
+                    )
+                };
+                if (prefix_future.has_value()) {
+                    // The queued task references this stack frame, so it must finish before this function exits (even on failure).
+                    try {
+                        recurse_suffix();
+                    } catch (...) {
+                        parallel->thread_pool.join(*prefix_future);
+                        throw;
+                    }
+                    parallel->thread_pool.join(*prefix_future).get();
+                } else {  // Thread pool refused the task, so subdivide on the current thread instead
+                    recurse_prefix();
+                    recurse_suffix();
+                }
+            } else {
+                recurse_prefix();
+                recurse_suffix();
+            }
             // indent--;
 
             return max_path_weight;
         }
+
+        ED splice_full_dp_path(
+            path_container<debug_mode, G, PATH_CONTAINER_CONTAINER_CREATOR_PACK>& path_container_,
+            element<E>* const parent_element,
+            const walk_direction dir,
+            const middle_sliceable_pairwise_alignment_graph<debug_mode, G>& sub_graph,
+            parallel_context* const parallel
+        ) {
+            // The incoming edge capacity of a node isn't known at compile-time (e.g., local alignment graph's leaf node has an incoming
+            // free ride edge from every other node), so PARENT_COUNT must be as wide as possible.
+            const auto& [path, weight] { heap_find_max_path<debug_mode, std::size_t, std::size_t, true>(sub_graph) };
+            std::unique_lock<std::mutex> path_lock {};
+            if (parallel != nullptr) {
+                path_lock = std::unique_lock { parallel->path_mutex };
+            }
+            // Edges get spliced in order. When splicing before parent_element, each edge gets pushed directly in front of parent_element
+            // (after the previously spliced edge). Otherwise, each edge gets pushed directly after the previously spliced edge.
+            element<E>* current_element { parent_element };
+            for (const E& edge : path) {
+                switch (dir) {
+                    case walk_direction::PREFIX:
+                        path_container_.push_prefix(parent_element, edge);
+                        break;
+                    case walk_direction::SUFFIX:
+                        current_element = path_container_.push_suffix(current_element, edge);
+                        break;
+                    case walk_direction::INITIALIZE:
+                        if (current_element == nullptr) {
+                            current_element = path_container_.initialize(edge);
+                        } else {
+                            current_element = path_container_.push_suffix(current_element, edge);
+                        }
+                        break;
+                    [[unlikely]] default:
+                        if constexpr (debug_mode) {
+                            throw std::runtime_error { "This should never happen" };
+                        }
+                        break;
+                }
+            }
+            return weight;
+        }
     };
 }
 
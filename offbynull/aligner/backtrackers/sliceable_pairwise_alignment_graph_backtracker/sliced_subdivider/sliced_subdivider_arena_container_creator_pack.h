@@ -0,0 +1,63 @@
+#ifndef OFFBYNULL_ALIGNER_BACKTRACKERS_SLICEABLE_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_SLICED_SUBDIVIDER_SLICED_SUBDIVIDER_ARENA_CONTAINER_CREATOR_PACK_H
+#define OFFBYNULL_ALIGNER_BACKTRACKERS_SLICEABLE_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_SLICED_SUBDIVIDER_SLICED_SUBDIVIDER_ARENA_CONTAINER_CREATOR_PACK_H
+
+#include <memory_resource>
+#include "offbynull/aligner/backtrackers/sliceable_pairwise_alignment_graph_backtracker/backtrackable_edge.h"
+#include "offbynull/aligner/backtrackers/sliceable_pairwise_alignment_graph_backtracker/path_container/path_container_arena_container_creator_pack.h"
+#include "offbynull/aligner/backtrackers/sliceable_pairwise_alignment_graph_backtracker/row_slot_container/row_slot_container_arena_container_creator_pack.h"
+#include "offbynull/aligner/concepts.h"
+
+namespace offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::sliced_subdivider
+        ::sliced_subdivider_arena_container_creator_pack {
+    using offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::backtrackable_edge::backtrackable_edge;
+    using offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::path_container
+        ::path_container_arena_container_creator_pack::path_container_arena_container_creator_pack;
+    using offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::row_slot_container
+        ::row_slot_container_arena_container_creator_pack::row_slot_container_arena_container_creator_pack;
+    using offbynull::aligner::concepts::weight;
+
+    /**
+     * @ref offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::sliced_subdivider::sliced_subdivider_container_creator_pack::sliced_subdivider_container_creator_pack
+     * that allocates its containers from a `std::pmr::memory_resource`.
+     *
+     * The sliced subdivider creates (and destroys) a pair of row containers at every level of its recursion. Backing this pack with a
+     * pooling resource (e.g., `std::pmr::unsynchronized_pool_resource`) has those row containers recycle each other's memory rather than
+     * going through the global allocator each time.
+     *
+     * @tparam debug_mode `true` to enable debugging logic, `false` otherwise.
+     * @tparam E Graph edge identifier type.
+     * @tparam ED Graph edge data type (edge weight).
+     */
+    template<
+        bool debug_mode,
+        backtrackable_edge E,
+        weight ED
+    >
+    struct sliced_subdivider_arena_container_creator_pack {
+        /** Memory resource that containers are allocated from (must outlive the containers). */
+        std::pmr::memory_resource* resource { std::pmr::get_default_resource() };
+
+        /**
+         * @copydoc offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::sliced_subdivider::unimplemented_sliced_subdivider_container_creator_pack::unimplemented_sliced_subdivider_container_creator_pack::create_row_slot_container_container_creator_pack
+         */
+        row_slot_container_arena_container_creator_pack<
+            debug_mode,
+            E,
+            ED
+        > create_row_slot_container_container_creator_pack() const {
+            return { resource };
+        }
+
+        /**
+         * @copydoc offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::sliced_subdivider::unimplemented_sliced_subdivider_container_creator_pack::unimplemented_sliced_subdivider_container_creator_pack::create_path_container_container_creator_pack
+         */
+        path_container_arena_container_creator_pack<
+            debug_mode,
+            E
+        > create_path_container_container_creator_pack() const {
+            return { resource };
+        }
+    };
+}
+
+#endif //OFFBYNULL_ALIGNER_BACKTRACKERS_SLICEABLE_PAIRWISE_ALIGNMENT_GRAPH_BACKTRACKER_SLICED_SUBDIVIDER_SLICED_SUBDIVIDER_ARENA_CONTAINER_CREATOR_PACK_H
@@ -2,7 +2,9 @@
 #include "offbynull/aligner/graphs/pairwise_local_alignment_graph.h"
 #include "offbynull/aligner/graphs/pairwise_global_alignment_graph.h"
 #include "offbynull/aligner/backtrackers/sliceable_pairwise_alignment_graph_backtracker/sliced_subdivider/sliced_subdivider.h"
+#include "offbynull/aligner/backtrackers/sliceable_pairwise_alignment_graph_backtracker/sliced_subdivider/sliced_subdivider_arena_container_creator_pack.h"
 #include "offbynull/aligner/scorers/simple_scorer.h"
+#include "offbynull/helpers/forkable_thread_pool.h"
 #include "offbynull/utils.h"
 #include "gtest/gtest.h"
 #include <cstddef>
@@ -13,15 +15,22 @@
 #include <stdexcept>
 #include <ostream>
 #include <iostream>
+#include <memory_resource>
+#include <utility>
+#include <limits>
+#include <type_traits>
 
 namespace {
     using offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::sliced_subdivider::sliced_subdivider
         ::sliced_subdivider;
+    using offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::sliced_subdivider
+        ::sliced_subdivider_arena_container_creator_pack::sliced_subdivider_arena_container_creator_pack;
     using offbynull::aligner::graphs::pairwise_global_alignment_graph::pairwise_global_alignment_graph;
     using offbynull::aligner::graphs::pairwise_local_alignment_graph::pairwise_local_alignment_graph;
     using offbynull::aligner::graphs::pairwise_local_alignment_graph::edge_type;
     using offbynull::aligner::graphs::middle_sliceable_pairwise_alignment_graph::middle_sliceable_pairwise_alignment_graph;
     using offbynull::aligner::scorers::simple_scorer::simple_scorer;
+    using offbynull::helpers::forkable_thread_pool::forkable_thread_pool;
     using offbynull::utils::is_debug_mode;
 
     TEST(OABSSSlicedSubdividerTest, GlobalTest) {
@@ -165,4 +174,172 @@ namespace {
         // THIS WILL NOT THROW, because subdivider accepts it if root and leaf are both resident nodes (segmenter will
         // segment graph based on resident node edges that get passed through)
     }
+
+    TEST(OABSSSlicedSubdividerTest, ArenaTest) {
+        auto substitution_scorer {
+            simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_substitution(1.0f64, -1.0f64)
+        };
+        auto gap_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_gap(-1.0f64) };
+        std::pmr::unsynchronized_pool_resource pool_resource {};
+        std::pmr::monotonic_buffer_resource monotonic_resource {};
+        for (const auto& [seq1, seq2] : {
+            std::pair<std::string, std::string> { "abc", "azc" },
+            std::pair<std::string, std::string> { "panamacanal", "bananaramacanal" },
+            std::pair<std::string, std::string> { "a", "" },
+            std::pair<std::string, std::string> { "aaaaalmnaaaaa", "zzzzzlVnzzzzz" }
+        }) {
+            using G = pairwise_global_alignment_graph<
+                is_debug_mode(),
+                std::size_t,
+                std::float64_t,
+                std::string,
+                std::string,
+                decltype(substitution_scorer),
+                decltype(gap_scorer)
+            >;
+            G g { seq1, seq2, substitution_scorer, gap_scorer };
+            using E = typename G::E;
+            using CONTAINER_CREATOR_PACK = sliced_subdivider_arena_container_creator_pack<is_debug_mode(), E, std::float64_t>;
+
+            auto walk {
+                [&](auto&& subdivider) {
+                    auto path { subdivider.subdivide() };
+                    auto backward_path_view { path.walk_path_backward() };
+                    return std::vector<E>(backward_path_view.begin(), backward_path_view.end());
+                }
+            };
+            std::vector<E> expected_path { walk(sliced_subdivider<is_debug_mode(), G> { g, 0.0f64 }) };
+            std::vector<E> pool_path {
+                walk(sliced_subdivider<is_debug_mode(), G, CONTAINER_CREATOR_PACK> { g, 0.0f64, { &pool_resource } })
+            };
+            std::vector<E> monotonic_path {
+                walk(sliced_subdivider<is_debug_mode(), G, CONTAINER_CREATOR_PACK> { g, 0.0f64, { &monotonic_resource } })
+            };
+            monotonic_resource.release();  // Everything allocated for the walk is freed at once
+            EXPECT_EQ(expected_path, pool_path);
+            EXPECT_EQ(expected_path, monotonic_path);
+        }
+    }
+
+    TEST(OABSSSlicedSubdividerTest, ThreadPoolTest) {
+        auto substitution_scorer {
+            simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_substitution(1.0f64, -1.0f64)
+        };
+        auto gap_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_gap(-1.0f64) };
+        forkable_thread_pool<is_debug_mode(), void> thread_pool { 4zu };
+        for (const auto& [seq1, seq2] : {
+            std::pair<std::string, std::string> { "abc", "azc" },
+            std::pair<std::string, std::string> { "panamacanal", "bananaramacanal" },
+            std::pair<std::string, std::string> { "a", "" },
+            std::pair<std::string, std::string> {
+                "thequickbrownfoxjumpsoverthelazydogthequickbrownfoxjumpsoverthelazydog",
+                "aquickbrowndogjumpedoverthelazyfoxesthequickbrowncatjumpsoverthedog"
+            }
+        }) {
+            using G = pairwise_global_alignment_graph<
+                is_debug_mode(),
+                std::size_t,
+                std::float64_t,
+                std::string,
+                std::string,
+                decltype(substitution_scorer),
+                decltype(gap_scorer)
+            >;
+            G g { seq1, seq2, substitution_scorer, gap_scorer };
+            using E = typename G::E;
+
+            auto to_vector {
+                [](auto&& path) {
+                    auto backward_path_view { path.walk_path_backward() };
+                    return std::vector<E>(backward_path_view.begin(), backward_path_view.end());
+                }
+            };
+            std::vector<E> expected_path { to_vector(sliced_subdivider<is_debug_mode(), G> { g, 0.0f64 }.subdivide()) };
+            for (std::size_t serial_node_cnt : { 0zu, 16zu, 256zu, 65536zu }) {
+                std::vector<E> parallel_path {
+                    to_vector(sliced_subdivider<is_debug_mode(), G> { g, 0.0f64 }.subdivide(thread_pool, serial_node_cnt))
+                };
+                EXPECT_EQ(expected_path, parallel_path);
+            }
+        }
+    }
+
+    // Path found must be a valid root-to-leaf path whose weight matches the one found when always subdividing (the path itself may differ
+    // if there are multiple maximally-weighted paths).
+    void check_full_dp_node_cnts(const auto& g) {
+        using G = std::remove_cvref_t<decltype(g)>;
+        using E = typename G::E;
+        auto path_weight {
+            [&](const std::vector<E>& path) {
+                std::float64_t weight { 0.0f64 };
+                for (std::size_t i { 0zu }; i < path.size(); ++i) {
+                    if (i > 0zu) {
+                        EXPECT_EQ(g.get_edge_to(path[i - 1zu]), g.get_edge_from(path[i]));
+                    }
+                    weight += g.get_edge_data(path[i]);
+                }
+                return weight;
+            }
+        };
+        auto to_vector {
+            [](auto&& path) {
+                auto forward_path_view { path.walk_path_forward() };
+                return std::vector<E>(forward_path_view.begin(), forward_path_view.end());
+            }
+        };
+        std::vector<E> expected_path { to_vector(sliced_subdivider<is_debug_mode(), G> { g, 0.0f64 }.subdivide()) };
+        for (std::size_t full_dp_node_cnt : { 1zu, 16zu, 256zu, std::numeric_limits<std::size_t>::max() }) {
+            std::vector<E> path { to_vector(sliced_subdivider<is_debug_mode(), G> { g, 0.0f64, {}, full_dp_node_cnt }.subdivide()) };
+            ASSERT_FALSE(path.empty());
+            EXPECT_EQ(g.get_edge_from(path.front()), g.get_root_node());
+            EXPECT_EQ(g.get_edge_to(path.back()), g.get_leaf_node());
+            EXPECT_NEAR(path_weight(path), path_weight(expected_path), 0.000001f64);
+        }
+    }
+
+    TEST(OABSSSlicedSubdividerTest, FullDpTest) {
+        auto substitution_scorer {
+            simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_substitution(1.0f64, -1.0f64)
+        };
+        auto gap_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_gap(-1.0f64) };
+        auto freeride_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_freeride(0.0f64) };
+        for (const auto& [seq1, seq2] : {
+            std::pair<std::string, std::string> { "panamacanal", "bananaramacanal" },
+            std::pair<std::string, std::string> { "a", "" },
+            std::pair<std::string, std::string> {
+                "thequickbrownfoxjumpsoverthelazydogthequickbrownfoxjumpsoverthelazydog",
+                "aquickbrowndogjumpedoverthelazyfoxesthequickbrowncatjumpsoverthedog"
+            }
+        }) {
+            pairwise_global_alignment_graph<
+                is_debug_mode(),
+                std::size_t,
+                std::float64_t,
+                std::string,
+                std::string,
+                decltype(substitution_scorer),
+                decltype(gap_scorer)
+            > global_g { seq1, seq2, substitution_scorer, gap_scorer };
+            check_full_dp_node_cnts(global_g);
+        }
+        std::string seq1 { "aaaaalmnaaaaa" };
+        std::string seq2 { "zzzzzlmnzzzzz" };
+        pairwise_local_alignment_graph<
+            is_debug_mode(),
+            std::size_t,
+            std::float64_t,
+            decltype(seq1),
+            decltype(seq2),
+            decltype(substitution_scorer),
+            decltype(gap_scorer),
+            decltype(freeride_scorer)
+        > local_g { seq1, seq2, substitution_scorer, gap_scorer, freeride_scorer };
+        using N = typename decltype(local_g)::N;
+        middle_sliceable_pairwise_alignment_graph<is_debug_mode(), decltype(local_g)> middle_g {
+            local_g,
+            N { 2u, 3u },
+            N { 11u, 10u }
+        };
+        check_full_dp_node_cnts(middle_g);
+    }
 }
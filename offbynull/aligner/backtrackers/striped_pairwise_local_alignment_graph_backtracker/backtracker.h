@@ -0,0 +1,723 @@
+#ifndef OFFBYNULL_ALIGNER_BACKTRACKERS_STRIPED_PAIRWISE_LOCAL_ALIGNMENT_GRAPH_BACKTRACKER_BACKTRACKER_H
+#define OFFBYNULL_ALIGNER_BACKTRACKERS_STRIPED_PAIRWISE_LOCAL_ALIGNMENT_GRAPH_BACKTRACKER_BACKTRACKER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <ranges>
+#include <utility>
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <optional>
+#include <concepts>
+#include <stdexcept>
+#include <type_traits>
+#include "offbynull/aligner/backtrackers/striped_pairwise_local_alignment_graph_backtracker/concepts.h"
+#include "offbynull/aligner/backtrackers/striped_pairwise_local_alignment_graph_backtracker/lanes.h"
+#include "offbynull/aligner/backtrackers/striped_pairwise_local_alignment_graph_backtracker/backtracker_container_creator_pack.h"
+#include "offbynull/aligner/backtrackers/striped_pairwise_local_alignment_graph_backtracker/backtracker_heap_container_creator_pack.h"
+#include "offbynull/aligner/backtrackers/striped_pairwise_local_alignment_graph_backtracker/backtracker_stack_container_creator_pack.h"
+#include "offbynull/aligner/backtrackers/anti_diagonal_pairwise_alignment_graph_backtracker/backtracker.h"
+#include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/concepts.h"
+#include "offbynull/aligner/graphs/pairwise_local_alignment_graph.h"
+#include "offbynull/concepts.h"
+
+namespace offbynull::aligner::backtrackers::striped_pairwise_local_alignment_graph_backtracker::backtracker {
+    using offbynull::aligner::backtrackers::striped_pairwise_local_alignment_graph_backtracker::concepts::striped_backtrackable_graph;
+    using offbynull::aligner::backtrackers::striped_pairwise_local_alignment_graph_backtracker::concepts::profilable_sequence;
+    using offbynull::aligner::backtrackers::striped_pairwise_local_alignment_graph_backtracker::lanes::lane_cnt;
+    using offbynull::aligner::backtrackers::striped_pairwise_local_alignment_graph_backtracker::lanes::max_profile_stripe_cnt;
+    using offbynull::aligner::backtrackers::striped_pairwise_local_alignment_graph_backtracker::lanes::saturating_add;
+    using offbynull::aligner::backtrackers::striped_pairwise_local_alignment_graph_backtracker::backtracker_container_creator_pack
+        ::backtracker_container_creator_pack;
+    using offbynull::aligner::backtrackers::striped_pairwise_local_alignment_graph_backtracker::backtracker_heap_container_creator_pack
+        ::backtracker_heap_container_creator_pack;
+    using offbynull::aligner::backtrackers::striped_pairwise_local_alignment_graph_backtracker::backtracker_stack_container_creator_pack
+        ::backtracker_stack_container_creator_pack;
+    using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::concepts::backtracking_result;
+    using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::concepts::backtracking_result_without_explicit_weight;
+    using offbynull::aligner::graphs::pairwise_local_alignment_graph::edge_type;
+    using offbynull::concepts::widenable_to_size_t;
+
+    /**
+     * Backtracker for @ref offbynull::aligner::graphs::pairwise_local_alignment_graph::pairwise_local_alignment_graph instances with
+     * signed integer edge weights (e.g., local alignments scored by a substitution matrix with linear gap penalties). Results are identical
+     * to @ref offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtracker::backtracker (including which path is
+     * picked when multiple maximally-weighted paths exist).
+     *
+     * Nodes are walked one column at a time using Farrar's striped layout: the column's nodes (excluding the first row) are split across
+     * `L` lanes, where lane `l` holds the nodes at down offsets `l * S + 1` to `(l + 1) * S` (`S` being the number of segments in the
+     * column). Each segment is a contiguous array of `L` lane values, which makes the down / right / diagonal recurrences branch-free
+     * element-wise operations that compilers are able to auto-vectorize. Dependencies along the column (down edges) are first propagated
+     * within each lane and then fixed up by a "lazy-F" loop that typically terminates after a segment or two.
+     *
+     * ```
+     *  striped column layout (n=8, L=4, S=2)
+     *
+     *           lane0 lane1 lane2 lane3
+     *  segment0   1     3     5     7
+     *  segment1   2     4     6     8
+     * ```
+     *
+     * If the graph's rightward sequence is handed over alongside the graph, diagonal edge weights are pulled from the graph once per
+     * distinct rightward symbol (a query profile) rather than once per node, such that each column's walk is pure lane arithmetic.
+     *
+     * Lanes first hold saturating 8-bit values. If any score saturates, the column walk is restarted with saturating 16-bit values, and
+     * if that saturates as well, the walk is delegated to
+     * @ref offbynull::aligner::backtrackers::anti_diagonal_pairwise_alignment_graph_backtracker::backtracker::backtracker. Each node's
+     * selected incoming edge is recorded as a 1 byte code, which is what gets walked to produce the path.
+     *
+     * @tparam debug_mode `true` to enable debugging logic, `false` otherwise.
+     * @tparam G Graph type.
+     * @tparam PARENT_COUNT Graph node incoming edge counter type. Must be wide enough to hold the maximum number of incoming edges across
+     *      all nodes in the underlying pairwise alignment graph instance (e.g., across all nodes in any global pairwise alignment graph, a
+     *      node can have at most 3 incoming edges).
+     * @tparam SLOT_INDEX Slot indexer type. Must be wide enough to hold the value `grid_down_cnt * grid_right_cnt * grid_depth_cnt`
+     *     (variables being multiplied are the dimensions of the `G` instance).
+     * @tparam CONTAINER_CREATOR_PACK Container factory type.
+     */
+    template<
+        bool debug_mode,
+        striped_backtrackable_graph G,
+        widenable_to_size_t PARENT_COUNT,
+        widenable_to_size_t SLOT_INDEX,
+        backtracker_container_creator_pack<
+            typename G::N,
+            typename G::E,
+            typename G::ED,
+            PARENT_COUNT,
+            SLOT_INDEX
+        > CONTAINER_CREATOR_PACK = backtracker_heap_container_creator_pack<
+            debug_mode,
+            typename G::N,
+            typename G::E,
+            typename G::ED,
+            PARENT_COUNT,
+            SLOT_INDEX,
+            true
+        >
+    >
+    class backtracker {
+    public:
+        /** `G`'s node identifier type. */
+        using N = typename G::N;
+        /** `G`'s edge identifier type. */
+        using E = typename G::E;
+        /** `G`'s edge data type. */
+        using ED = typename G::ED;
+        /** `G`'s grid coordinate type. For example, `std::uint8_t` will allow up to 255 nodes on both the down and right axis. */
+        using N_INDEX = typename G::N_INDEX;
+
+        /**
+         * @ref offbynull::aligner::backtrackers::anti_diagonal_pairwise_alignment_graph_backtracker::backtracker::backtracker container
+         * factory type used by this backtracker implementation when scores don't fit within 16-bit lanes.
+         */
+        using ANTI_DIAGONAL_BACKTRACKER_CONTAINER_CREATOR_PACK =
+            decltype(std::declval<CONTAINER_CREATOR_PACK>().create_anti_diagonal_backtracker_container_creator_pack());
+        /**
+         * Path container type used by this backtracker implementation.
+         */
+        using PATH_CONTAINER = decltype(std::declval<CONTAINER_CREATOR_PACK>().create_path_container(0zu));
+
+    private:
+        template<std::signed_integral LANE>
+        using LANE_CONTAINER = decltype(std::declval<CONTAINER_CREATOR_PACK>().template create_lane_container<LANE>(0zu));
+        template<std::signed_integral LANE>
+        using PROFILE_CONTAINER = decltype(std::declval<CONTAINER_CREATOR_PACK>().template create_profile_container<LANE>(0zu));
+        using CODE_CONTAINER = decltype(std::declval<CONTAINER_CREATOR_PACK>().create_code_container(0zu));
+
+        // Traceback codes, in the same order as the non-leaf nodes' get_inputs() (first match wins on ties).
+        static constexpr std::uint8_t CODE_RIGHT { 0u };
+        static constexpr std::uint8_t CODE_DOWN { 1u };
+        static constexpr std::uint8_t CODE_DIAGONAL { 2u };
+        static constexpr std::uint8_t CODE_FREE_RIDE { 3u };
+
+        // Leaf sources, in the same order as the leaf node's get_inputs().
+        enum class leaf_source : std::uint8_t {
+            NORMAL,
+            NODE_FREE_RIDE,
+            ROOT_FREE_RIDE
+        };
+
+        struct column_walk_result {
+            std::size_t lanes;
+            std::size_t segment_cnt;
+            leaf_source source;
+            std::size_t node_down;  // free-ride source node for NODE_FREE_RIDE
+            std::size_t node_right;
+            ED weight;
+        };
+
+        /**
+         * Initial edge weight (e.g., 0).
+         */
+        ED zero_weight;
+
+        /**
+         * Container factory.
+         */
+        CONTAINER_CREATOR_PACK container_creator_pack;
+
+    public:
+        /**
+         * Construct an
+         * @ref offbynull::aligner::backtrackers::striped_pairwise_local_alignment_graph_backtracker::backtracker::backtracker instance.
+         *
+         * @param zero_weight_ Initial weight, equivalent to 0 for numeric weights. Defaults to `ED`'s default constructor, assuming it
+         *     exists.
+         * @param container_creator_pack_ Container factory.
+         */
+        backtracker(
+            ED zero_weight_ = {},
+            CONTAINER_CREATOR_PACK container_creator_pack_ = {}
+        )
+        : zero_weight { zero_weight_ }
+        , container_creator_pack { container_creator_pack_ } {}
+
+        /**
+         * Determine the maximally-weighted path (path with the highest sum of edge weights) connecting a pairwise alignment graph's root
+         * node and leaf node.
+         *
+         * @param g Graph.
+         * @return Maximally weighted path from `g`'s root node to `g`'s leaf node, along with that path's weight.
+         */
+        backtracking_result<ED> auto find_max_path(
+            const G& g
+        ) {
+            return find_max_path_profiled(g, std::nullopt);
+        }
+
+        /**
+         * Determine the maximally-weighted path (path with the highest sum of edge weights) connecting a pairwise alignment graph's root
+         * node and leaf node, profiling diagonal edge weights per distinct symbol in `right_seq` rather than pulling them from `g` per
+         * node.
+         *
+         * The behavior of this function is undefined if `right_seq` isn't `g`'s rightward sequence, or if `g`'s diagonal edge weights
+         * depend on anything other than the two elements being scored (e.g., their indices).
+         *
+         * @param g Graph.
+         * @param right_seq `g`'s rightward sequence.
+         * @return Maximally weighted path from `g`'s root node to `g`'s leaf node, along with that path's weight.
+         */
+        backtracking_result<ED> auto find_max_path(
+            const G& g,
+            const profilable_sequence auto& right_seq
+        ) {
+            return find_max_path_profiled(g, right_seq);
+        }
+
+    private:
+        backtracking_result<ED> auto find_max_path_profiled(
+            const G& g,
+            const auto& right_seq  // std::nullopt if not profiling
+        ) {
+            PATH_CONTAINER path { container_creator_pack.create_path_container(g.path_edge_capacity) };
+            const std::size_t grid_down_cnt { g.grid_down_cnt };
+            const std::size_t grid_right_cnt { g.grid_right_cnt };
+            if (grid_down_cnt >= 2zu && grid_right_cnt >= 2zu) {
+                const ED freeride_weight { g.get_edge_data(E { edge_type::FREE_RIDE, { g.get_root_node(), g.get_leaf_node() } }) };
+                // Sized for the lane type with the most lanes, which has the most padding.
+                const std::size_t code_stride { padded_column_length<std::int8_t>(grid_down_cnt - 1zu) + 1zu };
+                CODE_CONTAINER codes { container_creator_pack.create_code_container(grid_right_cnt * code_stride) };
+                std::optional<column_walk_result> walk { walk_columns<std::int8_t>(g, right_seq, freeride_weight, codes, code_stride) };
+                if (!walk.has_value()) {
+                    walk = walk_columns<std::int16_t>(g, right_seq, freeride_weight, codes, code_stride);
+                }
+                if (walk.has_value()) {
+                    backtrack(g, *walk, codes, code_stride, path);
+                    // At this point, path is in reverse order (from last to first). Reverse it (view) to get it into forward order.
+                    return std::make_pair(std::move(path) | std::views::reverse, walk->weight);
+                }
+            }
+            // Scores too wide for 16-bit lanes (or a degenerate grid) -- fall back to the anti-diagonal backtracker and copy its path over
+            // in reverse order (from last to first) so that both branches return the same type.
+            offbynull::aligner::backtrackers::anti_diagonal_pairwise_alignment_graph_backtracker::backtracker::backtracker<
+                debug_mode,
+                G,
+                PARENT_COUNT,
+                SLOT_INDEX,
+                ANTI_DIAGONAL_BACKTRACKER_CONTAINER_CREATOR_PACK
+            > fallback_backtracker {
+                zero_weight,
+                container_creator_pack.create_anti_diagonal_backtracker_container_creator_pack()
+            };
+            auto [fallback_path, fallback_weight] { fallback_backtracker.find_max_path(g) };
+            for (auto it { fallback_path.end() }; it != fallback_path.begin(); ) {
+                --it;
+                path.push_back(*it);
+            }
+            return std::make_pair(std::move(path) | std::views::reverse, fallback_weight);
+        }
+
+        template<std::signed_integral LANE>
+        static std::size_t padded_column_length(std::size_t column_length) {
+            constexpr std::size_t lanes { lane_cnt<LANE> };
+            return ((column_length + lanes - 1zu) / lanes) * lanes;
+        }
+
+        static E normal_edge(std::size_t src_down, std::size_t src_right, std::size_t dst_down, std::size_t dst_right) {
+            return E {
+                edge_type::NORMAL,
+                {
+                    N { static_cast<N_INDEX>(src_down), static_cast<N_INDEX>(src_right) },
+                    N { static_cast<N_INDEX>(dst_down), static_cast<N_INDEX>(dst_right) }
+                }
+            };
+        }
+
+        static E free_ride_edge(const N& src, const N& dst) {
+            return E { edge_type::FREE_RIDE, { src, dst } };
+        }
+
+        template<std::signed_integral LANE>
+        std::optional<column_walk_result> walk_columns(
+            const G& g,
+            const auto& right_seq,  // std::nullopt if not profiling
+            const ED freeride_weight,
+            CODE_CONTAINER& codes,
+            const std::size_t code_stride
+        ) {
+            constexpr std::size_t L { lane_cnt<LANE> };
+            constexpr LANE lo { std::numeric_limits<LANE>::min() };
+            constexpr LANE hi { std::numeric_limits<LANE>::max() };
+            const std::size_t n { static_cast<std::size_t>(g.grid_down_cnt) - 1zu };  // column length, excluding the first row
+            const std::size_t m { static_cast<std::size_t>(g.grid_right_cnt) - 1zu };  // column count, excluding the first column
+            const std::size_t segment_cnt { padded_column_length<LANE>(n) / L };
+            const std::size_t padded_n { segment_cnt * L };
+            // Weights at either extreme are reserved: the minimum acts as negative infinity and the maximum flags saturation.
+            const auto fits { [](const ED w) { return w > lo && w < hi; } };
+            const auto striped_idx { [&](const std::size_t k) { return (k % segment_cnt) * L + k / segment_cnt; } };
+
+            if (!fits(freeride_weight)) {
+                return std::nullopt;
+            }
+            const LANE freeride { static_cast<LANE>(freeride_weight) };
+
+            constexpr bool profiled { !std::same_as<std::remove_cvref_t<decltype(right_seq)>, std::nullopt_t> };
+            constexpr std::uint16_t NO_STRIPE { std::numeric_limits<std::uint16_t>::max() };
+            const auto symbol_idx { [](const auto& elem) { return static_cast<std::size_t>(static_cast<unsigned char>(elem)); } };
+
+            // Diagonal edge weights are held as 1 stripe (padded column) per distinct rightward symbol when profiling, each stripe pulled
+            // from the first column with that symbol. Otherwise, a single stripe gets refilled for each column.
+            std::array<std::uint16_t, max_profile_stripe_cnt> symbol_stripes {};
+            std::size_t stripe_cnt { 1zu };
+            if constexpr (profiled) {
+                if constexpr (debug_mode) {
+                    if (right_seq.size() != m) {
+                        throw std::runtime_error { "Rightward sequence doesn't match graph" };
+                    }
+                }
+                symbol_stripes.fill(NO_STRIPE);
+                stripe_cnt = 0zu;
+                for (std::size_t j { 0zu }; j < m; ++j) {
+                    std::uint16_t& stripe { symbol_stripes[symbol_idx(right_seq[j])] };
+                    if (stripe == NO_STRIPE) {
+                        stripe = static_cast<std::uint16_t>(stripe_cnt);  // Cast to prevent narrowing warning
+                        ++stripe_cnt;
+                    }
+                }
+            }
+
+            // Padded lanes only ever feed into other padded lanes (down offsets grow along a lane), so their values are never read back
+            // other than being masked out.
+            LANE_CONTAINER<LANE> down_gaps { container_creator_pack.template create_lane_container<LANE>(padded_n) };
+            PROFILE_CONTAINER<LANE> substitutions { container_creator_pack.template create_profile_container<LANE>(stripe_cnt * padded_n) };
+            LANE_CONTAINER<LANE> prev { container_creator_pack.template create_lane_container<LANE>(padded_n) };
+            LANE_CONTAINER<LANE> cur { container_creator_pack.template create_lane_container<LANE>(padded_n) };
+            for (std::size_t i { 0zu }; i < padded_n; ++i) {
+                down_gaps[i] = lo;
+                prev[i] = lo;
+                cur[i] = lo;
+            }
+            for (std::size_t i { 0zu }; i < stripe_cnt * padded_n; ++i) {
+                substitutions[i] = lo;
+            }
+            const auto fill_stripe {
+                [&](const std::size_t stripe_base, const std::size_t j) {
+                    for (std::size_t k { 0zu }; k < n; ++k) {
+                        const ED substitution_weight { g.get_edge_data(normal_edge(k, j - 1zu, k + 1zu, j)) };
+                        if (!fits(substitution_weight)) {
+                            return false;
+                        }
+                        substitutions[stripe_base + striped_idx(k)] = static_cast<LANE>(substitution_weight);
+                    }
+                    return true;
+                }
+            };
+            if constexpr (profiled) {
+                // Stripes were numbered in order of first appearance, so a column introduces a new symbol if its stripe is the next one.
+                std::size_t filled_stripe_cnt { 0zu };
+                for (std::size_t j { 1zu }; j <= m; ++j) {
+                    const std::size_t stripe { symbol_stripes[symbol_idx(right_seq[j - 1zu])] };
+                    if (stripe == filled_stripe_cnt) {
+                        if (!fill_stripe(stripe * padded_n, j)) {
+                            return std::nullopt;
+                        }
+                        ++filled_stripe_cnt;
+                    }
+                }
+            }
+
+            // Best node to free-ride to the leaf from. Ties go to the first node in row-major order, which is the order in which the
+            // leaf's free-ride edges are listed.
+            bool best_found { false };
+            ED best_weight { zero_weight };
+            std::size_t best_down { 0zu };
+            std::size_t best_right { 0zu };
+            const auto offer_best {
+                [&](const ED w, const std::size_t down, const std::size_t right) {
+                    if (!best_found
+                        || w > best_weight
+                        || (w == best_weight && (down < best_down || (down == best_down && right < best_right)))) {
+                        best_found = true;
+                        best_weight = w;
+                        best_down = down;
+                        best_right = right;
+                    }
+                }
+            };
+
+            // First column
+            // ------------
+            ED column_weight { zero_weight };
+            for (std::size_t k { 0zu }; k < n; ++k) {
+                const std::size_t idx { striped_idx(k) };
+                const ED gap_weight { g.get_edge_data(normal_edge(k, 0zu, k + 1zu, 0zu)) };
+                if (!fits(gap_weight)) {
+                    return std::nullopt;
+                }
+                down_gaps[idx] = static_cast<LANE>(gap_weight);
+                const ED down_weight { static_cast<ED>(column_weight + gap_weight) };
+                const bool take_down { down_weight >= freeride_weight };
+                column_weight = take_down ? down_weight : freeride_weight;
+                if (!fits(column_weight)) {
+                    return std::nullopt;
+                }
+                prev[idx] = static_cast<LANE>(column_weight);
+                codes[1zu + idx] = take_down ? CODE_DOWN : CODE_FREE_RIDE;
+                offer_best(column_weight, k + 1zu, 0zu);
+            }
+
+            // Remaining columns
+            // -----------------
+            ED top_prev_weight { zero_weight };  // first row node of the previous column
+            LANE leaf_lane_value { lo };
+            std::uint8_t leaf_code { CODE_FREE_RIDE };
+            std::array<LANE, L> diagonal_in {};  // shifted in predecessors for segment 0
+            std::array<LANE, L> down_in {};
+            std::array<LANE, L> vf {};
+            for (std::size_t j { 1zu }; j <= m; ++j) {
+                const std::size_t code_base { j * code_stride };
+
+                // First row node is computed as a scalar.
+                const ED right_gap_weight { g.get_edge_data(normal_edge(0zu, j - 1zu, 0zu, j)) };
+                if (!fits(right_gap_weight)) {
+                    return std::nullopt;
+                }
+                const LANE right_gap { static_cast<LANE>(right_gap_weight) };
+                const ED top_right_weight { static_cast<ED>(top_prev_weight + right_gap_weight) };
+                const bool top_take_right { top_right_weight >= freeride_weight };
+                const ED top_weight { top_take_right ? top_right_weight : freeride_weight };
+                if (!fits(top_weight)) {
+                    return std::nullopt;
+                }
+                codes[code_base] = top_take_right ? CODE_RIGHT : CODE_FREE_RIDE;
+                offer_best(top_weight, 0zu, j);
+                const LANE top_prev { static_cast<LANE>(top_prev_weight) };
+                const LANE top { static_cast<LANE>(top_weight) };
+
+                // Pick this column's diagonal edge weights out of the profile, or score them if not profiling.
+                std::size_t stripe_base { 0zu };
+                if constexpr (profiled) {
+                    stripe_base = symbol_stripes[symbol_idx(right_seq[j - 1zu])] * padded_n;
+                    if constexpr (debug_mode) {
+                        for (std::size_t k { 0zu }; k < n; ++k) {
+                            const ED substitution_weight { g.get_edge_data(normal_edge(k, j - 1zu, k + 1zu, j)) };
+                            if (substitution_weight != static_cast<ED>(substitutions[stripe_base + striped_idx(k)])) {
+                                throw std::runtime_error { "Profile doesn't match graph (diagonal weights not purely by element?)" };
+                            }
+                        }
+                    }
+                } else {
+                    if (!fill_stripe(stripe_base, j)) {
+                        return std::nullopt;
+                    }
+                }
+
+                // Main pass: down edges are only propagated within each lane.
+                for (std::size_t l { 0zu }; l < L; ++l) {
+                    diagonal_in[l] = l == 0zu ? top_prev : prev[(segment_cnt - 1zu) * L + l - 1zu];
+                    vf[l] = l == 0zu ? saturating_add(top, down_gaps[0zu]) : lo;
+                }
+                for (std::size_t s { 0zu }; s < segment_cnt; ++s) {
+                    const std::size_t base { s * L };
+                    for (std::size_t l { 0zu }; l < L; ++l) {
+                        const LANE diagonal_src { s == 0zu ? diagonal_in[l] : prev[base - L + l] };
+                        const LANE diagonal { saturating_add(diagonal_src, substitutions[stripe_base + base + l]) };
+                        const LANE right { saturating_add(prev[base + l], right_gap) };
+                        cur[base + l] = std::max({ freeride, diagonal, right, vf[l] });
+                    }
+                    if (s + 1zu < segment_cnt) {
+                        for (std::size_t l { 0zu }; l < L; ++l) {
+                            vf[l] = saturating_add(cur[base + l], down_gaps[base + L + l]);
+                        }
+                    }
+                }
+
+                // Lazy-F: carry down edges across lanes until they stop improving anything.
+                const auto shift_in_vf {
+                    [&]() {
+                        for (std::size_t l { 0zu }; l < L; ++l) {
+                            const LANE down_src { l == 0zu ? top : cur[(segment_cnt - 1zu) * L + l - 1zu] };
+                            vf[l] = saturating_add(down_src, down_gaps[l]);
+                        }
+                    }
+                };
+                shift_in_vf();
+                for (std::size_t s { 0zu }; ; ) {
+                    const std::size_t base { s * L };
+                    bool improved { false };
+                    for (std::size_t l { 0zu }; l < L; ++l) {
+                        improved = improved || (vf[l] > cur[base + l] && l * segment_cnt + s < n);
+                    }
+                    if (!improved) {
+                        break;
+                    }
+                    for (std::size_t l { 0zu }; l < L; ++l) {
+                        cur[base + l] = std::max(cur[base + l], vf[l]);
+                    }
+                    ++s;
+                    if (s == segment_cnt) {
+                        s = 0zu;
+                        shift_in_vf();
+                    } else {
+                        for (std::size_t l { 0zu }; l < L; ++l) {
+                            vf[l] = saturating_add(cur[base + l], down_gaps[base + L + l]);
+                        }
+                    }
+                }
+
+                // Codes, saturation, and column maximum.
+                for (std::size_t l { 0zu }; l < L; ++l) {
+                    down_in[l] = l == 0zu ? top : cur[(segment_cnt - 1zu) * L + l - 1zu];
+                }
+                bool saturated { false };
+                LANE column_max { lo };
+                const std::size_t leaf_idx { j == m ? striped_idx(n - 1zu) : padded_n };  // leaf isn't a free-ride source
+                for (std::size_t s { 0zu }; s < segment_cnt; ++s) {
+                    const std::size_t base { s * L };
+                    for (std::size_t l { 0zu }; l < L; ++l) {
+                        const LANE h { cur[base + l] };
+                        const LANE right { saturating_add(prev[base + l], right_gap) };
+                        const LANE down { saturating_add(s == 0zu ? down_in[l] : cur[base - L + l], down_gaps[base + l]) };
+                        const LANE diagonal_src { s == 0zu ? diagonal_in[l] : prev[base - L + l] };
+                        const LANE diagonal { saturating_add(diagonal_src, substitutions[stripe_base + base + l]) };
+                        codes[code_base + 1zu + base + l] =
+                            right == h ? CODE_RIGHT
+                            : down == h ? CODE_DOWN
+                            : diagonal == h ? CODE_DIAGONAL
+                            : CODE_FREE_RIDE;
+                        const bool valid { l * segment_cnt + s < n };
+                        saturated = saturated || (valid && h == hi);
+                        column_max = valid && base + l != leaf_idx && h > column_max ? h : column_max;
+                    }
+                }
+                if (saturated) {
+                    return std::nullopt;
+                }
+                // Only the first node in the column holding the maximum matters, so it's only searched for when it can win.
+                if (column_max != lo && (!best_found || static_cast<ED>(column_max) >= best_weight)) {
+                    for (std::size_t k { 0zu }; k < n; ++k) {
+                        if (cur[striped_idx(k)] == column_max) {
+                            offer_best(static_cast<ED>(column_max), k + 1zu, j);
+                            break;
+                        }
+                    }
+                }
+                if (j == m) {
+                    leaf_lane_value = cur[leaf_idx];
+                    leaf_code = codes[code_base + 1zu + leaf_idx];
+                }
+
+                std::swap(prev, cur);
+                top_prev_weight = top_weight;
+            }
+
+            // Leaf
+            // ----
+            // Normal edges come first, then the free-ride edges from every other node, then the free-ride edge from the root.
+            column_walk_result ret { L, segment_cnt, leaf_source::NORMAL, 0zu, 0zu, static_cast<ED>(leaf_lane_value) };
+            const ED node_freeride_weight { static_cast<ED>(best_weight + freeride_weight) };
+            if (leaf_code != CODE_FREE_RIDE) {
+                if (best_found && node_freeride_weight > ret.weight) {
+                    ret.source = leaf_source::NODE_FREE_RIDE;
+                }
+            } else {
+                if (best_found && node_freeride_weight >= freeride_weight) {
+                    ret.source = leaf_source::NODE_FREE_RIDE;
+                } else {
+                    ret.source = leaf_source::ROOT_FREE_RIDE;
+                    ret.weight = freeride_weight;
+                }
+            }
+            if (ret.source == leaf_source::NODE_FREE_RIDE) {
+                ret.node_down = best_down;
+                ret.node_right = best_right;
+                ret.weight = node_freeride_weight;
+            }
+            return ret;
+        }
+
+        void backtrack(
+            const G& g,
+            const column_walk_result& walk,
+            const CODE_CONTAINER& codes,
+            const std::size_t code_stride,
+            PATH_CONTAINER& path
+        ) const {
+            const N root { g.get_root_node() };
+            const N leaf { g.get_leaf_node() };
+            std::size_t down { static_cast<std::size_t>(g.grid_down_cnt) - 1zu };
+            std::size_t right { static_cast<std::size_t>(g.grid_right_cnt) - 1zu };
+            if (walk.source == leaf_source::ROOT_FREE_RIDE) {
+                path.push_back(free_ride_edge(root, leaf));
+                return;
+            } else if (walk.source == leaf_source::NODE_FREE_RIDE) {
+                down = walk.node_down;
+                right = walk.node_right;
+                path.push_back(
+                    free_ride_edge(N { static_cast<N_INDEX>(down), static_cast<N_INDEX>(right) }, leaf)
+                );
+            }
+            while (down != 0zu || right != 0zu) {
+                const std::size_t code_offset {
+                    down == 0zu ? 0zu : 1zu + ((down - 1zu) % walk.segment_cnt) * walk.lanes + (down - 1zu) / walk.segment_cnt
+                };
+                const std::uint8_t code { codes[right * code_stride + code_offset] };
+                if (code == CODE_RIGHT) {
+                    path.push_back(normal_edge(down, right - 1zu, down, right));
+                    --right;
+                } else if (code == CODE_DOWN) {
+                    path.push_back(normal_edge(down - 1zu, right, down, right));
+                    --down;
+                } else if (code == CODE_DIAGONAL) {
+                    path.push_back(normal_edge(down - 1zu, right - 1zu, down, right));
+                    --down;
+                    --right;
+                } else {
+                    path.push_back(
+                        free_ride_edge(root, N { static_cast<N_INDEX>(down), static_cast<N_INDEX>(right) })
+                    );
+                    break;
+                }
+            }
+        }
+    };
+
+    /**
+     * Helper function that constructs an
+     * @ref offbynull::aligner::backtrackers::striped_pairwise_local_alignment_graph_backtracker::backtracker::backtracker instance
+     * utilizing the heap for storage / computations and invokes `find_max_path(g)` on it.
+     *
+     * @tparam debug_mode `true` to enable debugging logic, `false` otherwise.
+     * @tparam PARENT_COUNT Graph node incoming edge counter type. Must be wide enough to hold the maximum number of incoming edges across
+     *      all nodes in the underlying pairwise alignment graph instance (e.g., across all nodes in any global pairwise alignment graph, a
+     *      node can have at most 3 incoming edges).
+     * @tparam SLOT_INDEX Slot indexer type. Must be wide enough to hold the value `grid_down_cnt * grid_right_cnt * grid_depth_cnt`
+     *     (variables being multiplied are the dimensions of `g`).
+     * @tparam minimize_allocations `true` to force the path container to reserve `g.path_edge_capacity` elements, thereby
+     *     removing/reducing the need for adhoc reallocations.
+     * @param g Graph.
+     * @return `find_max_path(g)` result.
+     */
+    template<
+        bool debug_mode,
+        widenable_to_size_t PARENT_COUNT,
+        widenable_to_size_t SLOT_INDEX,
+        bool minimize_allocations
+    >
+    backtracking_result_without_explicit_weight auto heap_find_max_path(
+        const striped_backtrackable_graph auto& g
+    ) {
+        using G = std::remove_cvref_t<decltype(g)>;
+        return backtracker<
+            debug_mode,
+            G,
+            PARENT_COUNT,
+            SLOT_INDEX,
+            backtracker_heap_container_creator_pack<
+                debug_mode,
+                typename G::N,
+                typename G::E,
+                typename G::ED,
+                PARENT_COUNT,
+                SLOT_INDEX,
+                minimize_allocations
+            >
+        > {}.find_max_path(g);
+    }
+
+    /**
+     * Helper function that constructs an
+     * @ref offbynull::aligner::backtrackers::striped_pairwise_local_alignment_graph_backtracker::backtracker::backtracker instance
+     * utilizing the stack for storage / computations and invokes `find_max_path(g)` on it.
+     *
+     * @tparam debug_mode `true` to enable debugging logic, `false` otherwise.
+     * @tparam PARENT_COUNT Graph node incoming edge counter type. Must be wide enough to hold the maximum number of incoming edges across
+     *      all nodes in the underlying pairwise alignment graph instance (e.g., across all nodes in any global pairwise alignment graph, a
+     *      node can have at most 3 incoming edges).
+     * @tparam SLOT_INDEX Slot indexer type. Must be wide enough to hold the value `grid_down_cnt * grid_right_cnt * grid_depth_cnt`
+     *     (variables being multiplied are the dimensions of `g`).
+     * @tparam grid_down_cnt `g`'s down dimension of the underlying pairwise alignment graph instance.
+     * @tparam grid_right_cnt `g`'s right dimension of the underlying pairwise alignment graph instance.
+     * @tparam grid_depth_cnt `g'`s depth dimension of the underlying pairwise alignment graph instance.
+     * @tparam path_edge_capacity Of all paths between root and leaf within `g`, the maximum number of edges.
+     * @param g Graph.
+     * @return `find_max_path(g)` result.
+     */
+    template<
+        bool debug_mode,
+        widenable_to_size_t PARENT_COUNT,
+        widenable_to_size_t SLOT_INDEX,
+        std::size_t grid_down_cnt,
+        std::size_t grid_right_cnt,
+        std::size_t grid_depth_cnt,
+        std::size_t path_edge_capacity
+    >
+    backtracking_result_without_explicit_weight auto stack_find_max_path(
+        const striped_backtrackable_graph auto& g
+    ) {
+        using G = std::remove_cvref_t<decltype(g)>;
+        using N = typename G::N;
+        using E = typename G::E;
+        using ED = typename G::ED;
+        if constexpr (debug_mode) {
+            if (g.grid_down_cnt != grid_down_cnt
+                || g.grid_right_cnt != grid_right_cnt
+                || g.grid_depth_cnt != grid_depth_cnt
+                || g.path_edge_capacity != path_edge_capacity) {
+                throw std::runtime_error { "Unexpected graph dimensions" };
+            }
+        }
+        return backtracker<
+            debug_mode,
+            G,
+            PARENT_COUNT,
+            SLOT_INDEX,
+            backtracker_stack_container_creator_pack<
+                debug_mode,
+                N,
+                E,
+                ED,
+                PARENT_COUNT,
+                SLOT_INDEX,
+                grid_down_cnt,
+                grid_right_cnt,
+                grid_depth_cnt,
+                path_edge_capacity
+            >
+        > {}.find_max_path(g);
+    }
+}
+
+#endif //OFFBYNULL_ALIGNER_BACKTRACKERS_STRIPED_PAIRWISE_LOCAL_ALIGNMENT_GRAPH_BACKTRACKER_BACKTRACKER_H
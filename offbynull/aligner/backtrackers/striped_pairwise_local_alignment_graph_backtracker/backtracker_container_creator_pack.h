@@ -0,0 +1,63 @@
+#ifndef OFFBYNULL_ALIGNER_BACKTRACKERS_STRIPED_PAIRWISE_LOCAL_ALIGNMENT_GRAPH_BACKTRACKER_BACKTRACKER_CONTAINER_CREATOR_PACK_H
+#define OFFBYNULL_ALIGNER_BACKTRACKERS_STRIPED_PAIRWISE_LOCAL_ALIGNMENT_GRAPH_BACKTRACKER_BACKTRACKER_CONTAINER_CREATOR_PACK_H
+
+#include <cstddef>
+#include <cstdint>
+#include "offbynull/aligner/concepts.h"
+#include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/backtrackable_node.h"
+#include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/backtrackable_edge.h"
+#include "offbynull/aligner/backtrackers/anti_diagonal_pairwise_alignment_graph_backtracker/backtracker_container_creator_pack.h"
+#include "offbynull/concepts.h"
+
+namespace offbynull::aligner::backtrackers::striped_pairwise_local_alignment_graph_backtracker::backtracker_container_creator_pack {
+    using offbynull::aligner::concepts::weight;
+    using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtrackable_node::backtrackable_node;
+    using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtrackable_edge::backtrackable_edge;
+    using offbynull::concepts::widenable_to_size_t;
+    using offbynull::concepts::random_access_sequence_container;
+    using offbynull::concepts::unqualified_object_type;
+
+    /**
+     * Concept that's satisfied if `T` has the traits for creating the containers required by
+     * @ref offbynull::aligner::backtrackers::striped_pairwise_local_alignment_graph_backtracker::backtracker::backtracker, referred to as
+     * a container creator pack.
+     *
+     * @tparam T Type to check.
+     * @tparam N Graph node identifier type.
+     * @tparam E Graph edge identifier type.
+     * @tparam ED Graph edge data type (edge weight).
+     * @tparam PARENT_COUNT Graph node incoming edge counter type. Must be wide enough to hold the maximum number of incoming edges across
+     *     all nodes in the underlying pairwise alignment graph instance (e.g., across all nodes in any global pairwise alignment graph, a
+     *     node can have at most 3 incoming edges).
+     * @tparam SLOT_INDEX Slot indexer type. Must be wide enough to hold the value `grid_down_cnt * grid_right_cnt * grid_depth_cnt`
+     *     (variables being multiplied are the dimensions of the underlying graph).
+     */
+    template<
+        typename T,
+        typename N,
+        typename E,
+        typename ED,
+        typename PARENT_COUNT,
+        typename SLOT_INDEX
+    >
+    concept backtracker_container_creator_pack =
+        unqualified_object_type<T>
+        && backtrackable_node<N>
+        && backtrackable_edge<E>
+        && weight<ED>
+        && widenable_to_size_t<PARENT_COUNT>
+        && widenable_to_size_t<SLOT_INDEX>
+        && requires(const T t, std::size_t cnt, std::size_t path_edge_capacity) {
+            { t.create_anti_diagonal_backtracker_container_creator_pack() }
+                -> offbynull::aligner::backtrackers::anti_diagonal_pairwise_alignment_graph_backtracker::backtracker_container_creator_pack
+                    ::backtracker_container_creator_pack<N, E, ED, PARENT_COUNT, SLOT_INDEX>;
+            { t.template create_lane_container<std::int8_t>(cnt) } -> random_access_sequence_container<std::int8_t>;
+            { t.template create_lane_container<std::int16_t>(cnt) } -> random_access_sequence_container<std::int16_t>;
+            { t.template create_profile_container<std::int8_t>(cnt) } -> random_access_sequence_container<std::int8_t>;
+            { t.template create_profile_container<std::int16_t>(cnt) } -> random_access_sequence_container<std::int16_t>;
+            { t.create_code_container(cnt) } -> random_access_sequence_container<std::uint8_t>;
+            { t.create_path_container(path_edge_capacity) } -> random_access_sequence_container<E>;
+        };
+}
+
+#endif //OFFBYNULL_ALIGNER_BACKTRACKERS_STRIPED_PAIRWISE_LOCAL_ALIGNMENT_GRAPH_BACKTRACKER_BACKTRACKER_CONTAINER_CREATOR_PACK_H
@@ -0,0 +1,162 @@
+#ifndef OFFBYNULL_ALIGNER_BACKTRACKERS_STRIPED_PAIRWISE_LOCAL_ALIGNMENT_GRAPH_BACKTRACKER_BACKTRACKER_STACK_CONTAINER_CREATOR_PACK_H
+#define OFFBYNULL_ALIGNER_BACKTRACKERS_STRIPED_PAIRWISE_LOCAL_ALIGNMENT_GRAPH_BACKTRACKER_BACKTRACKER_STACK_CONTAINER_CREATOR_PACK_H
+
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <concepts>
+#include <stdexcept>
+#include "offbynull/aligner/concepts.h"
+#include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/backtrackable_node.h"
+#include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/backtrackable_edge.h"
+#include "offbynull/aligner/backtrackers/anti_diagonal_pairwise_alignment_graph_backtracker/backtracker_stack_container_creator_pack.h"
+#include "offbynull/aligner/backtrackers/striped_pairwise_local_alignment_graph_backtracker/lanes.h"
+#include "offbynull/aligner/backtrackers/striped_pairwise_local_alignment_graph_backtracker/unimplemented_backtracker_container_creator_pack.h"
+#include "offbynull/concepts.h"
+#include "offbynull/utils.h"
+
+namespace offbynull::aligner::backtrackers::striped_pairwise_local_alignment_graph_backtracker::backtracker_stack_container_creator_pack {
+    using offbynull::aligner::concepts::weight;
+    using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtrackable_node::backtrackable_node;
+    using offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtrackable_edge::backtrackable_edge;
+    using offbynull::aligner::backtrackers::striped_pairwise_local_alignment_graph_backtracker::lanes::lane_cnt;
+    using offbynull::aligner::backtrackers::striped_pairwise_local_alignment_graph_backtracker::lanes::max_profile_stripe_cnt;
+    using offbynull::concepts::widenable_to_size_t;
+    using offbynull::utils::static_vector_typer;
+
+    /**
+     * @ref offbynull::aligner::backtrackers::striped_pairwise_local_alignment_graph_backtracker::backtracker_container_creator_pack::backtracker_container_creator_pack
+     * that allocates its containers on the stack.
+     *
+     * @tparam debug_mode `true` to enable debugging logic, `false` otherwise.
+     * @tparam N Graph node identifier type.
+     * @tparam E Graph edge identifier type.
+     * @tparam ED Graph edge data type (edge weight).
+     * @tparam PARENT_COUNT Graph node incoming edge counter type. Must be wide enough to hold the maximum number of incoming edges across
+     *     all nodes in the underlying pairwise alignment graph instance (e.g., across all nodes in any global pairwise alignment graph, a
+     *     node can have at most 3 incoming edges).
+     * @tparam SLOT_INDEX Slot indexer type. Must be wide enough to hold the value `grid_down_cnt * grid_right_cnt * grid_depth_cnt`
+     *     (variables being multiplied are the dimensions of the underlying graph).
+     * @tparam grid_down_cnt Expected down dimension of the underlying pairwise alignment graph instance.
+     * @tparam grid_right_cnt Expected right dimension of the underlying pairwise alignment graph instance.
+     * @tparam grid_depth_cnt Expected depth dimension of the underlying pairwise alignment graph instance.
+     * @tparam path_edge_capacity Of all paths between root and leaf within the underlying pairwise alignment graph, the maximum number of
+     *     edges.
+     */
+    template<
+        bool debug_mode,
+        backtrackable_node N,
+        backtrackable_edge E,
+        weight ED,
+        widenable_to_size_t PARENT_COUNT,
+        widenable_to_size_t SLOT_INDEX,
+        std::size_t grid_down_cnt,
+        std::size_t grid_right_cnt,
+        std::size_t grid_depth_cnt,
+        std::size_t path_edge_capacity
+    >
+    struct backtracker_stack_container_creator_pack {
+        /**
+         * @copydoc offbynull::aligner::backtrackers::striped_pairwise_local_alignment_graph_backtracker::unimplemented_backtracker_container_creator_pack::unimplemented_backtracker_container_creator_pack::create_anti_diagonal_backtracker_container_creator_pack
+         */
+        offbynull::aligner::backtrackers::anti_diagonal_pairwise_alignment_graph_backtracker::backtracker_stack_container_creator_pack
+            ::backtracker_stack_container_creator_pack<
+                debug_mode,
+                N,
+                E,
+                ED,
+                PARENT_COUNT,
+                SLOT_INDEX,
+                grid_down_cnt,
+                grid_right_cnt,
+                grid_depth_cnt,
+                path_edge_capacity
+            > create_anti_diagonal_backtracker_container_creator_pack() const {
+            return {};
+        }
+
+        /**
+         * Maximum number of elements any of the lane containers will need to hold. A column of `grid_down_cnt - 1` nodes (the first
+         * row is handled separately) gets padded up to a multiple of the lane count, and the narrowest lane type has the most lanes.
+         */
+        static constexpr std::size_t LANE_ELEM_COUNT { grid_down_cnt + lane_cnt<std::int8_t> };
+
+        /** `create_lane_container()` return type. */
+        template<std::signed_integral LANE>
+        using LANE_CONTAINER_TYPE = typename static_vector_typer<debug_mode, LANE, LANE_ELEM_COUNT>::type;
+
+        /**
+         * @copydoc offbynull::aligner::backtrackers::striped_pairwise_local_alignment_graph_backtracker::unimplemented_backtracker_container_creator_pack::unimplemented_backtracker_container_creator_pack::create_lane_container
+         */
+        template<std::signed_integral LANE>
+        LANE_CONTAINER_TYPE<LANE> create_lane_container(std::size_t cnt) const {
+            if constexpr (debug_mode) {
+                if (cnt > LANE_ELEM_COUNT) {
+                    throw std::runtime_error { "Bad element count" };
+                }
+            }
+            return LANE_CONTAINER_TYPE<LANE>(cnt);
+        }
+
+        /**
+         * Maximum number of elements the profile container will need to hold: 1 padded column for each distinct rightward symbol, of
+         * which there are at most 1 per column.
+         */
+        static constexpr std::size_t PROFILE_ELEM_COUNT { std::min(grid_right_cnt, max_profile_stripe_cnt) * LANE_ELEM_COUNT };
+
+        /** `create_profile_container()` return type. */
+        template<std::signed_integral LANE>
+        using PROFILE_CONTAINER_TYPE = typename static_vector_typer<debug_mode, LANE, PROFILE_ELEM_COUNT>::type;
+
+        /**
+         * @copydoc offbynull::aligner::backtrackers::striped_pairwise_local_alignment_graph_backtracker::unimplemented_backtracker_container_creator_pack::unimplemented_backtracker_container_creator_pack::create_profile_container
+         */
+        template<std::signed_integral LANE>
+        PROFILE_CONTAINER_TYPE<LANE> create_profile_container(std::size_t cnt) const {
+            if constexpr (debug_mode) {
+                if (cnt > PROFILE_ELEM_COUNT) {
+                    throw std::runtime_error { "Bad element count" };
+                }
+            }
+            return PROFILE_CONTAINER_TYPE<LANE>(cnt);
+        }
+
+        /**
+         * Maximum number of elements the code container will need to hold: 1 padded column (plus the node in the first row) for each
+         * column.
+         */
+        static constexpr std::size_t CODE_ELEM_COUNT { grid_right_cnt * (LANE_ELEM_COUNT + 1zu) };
+
+        /** `create_code_container()` return type. */
+        using CODE_CONTAINER_TYPE = typename static_vector_typer<debug_mode, std::uint8_t, CODE_ELEM_COUNT>::type;
+
+        /**
+         * @copydoc offbynull::aligner::backtrackers::striped_pairwise_local_alignment_graph_backtracker::unimplemented_backtracker_container_creator_pack::unimplemented_backtracker_container_creator_pack::create_code_container
+         */
+        CODE_CONTAINER_TYPE create_code_container(std::size_t cnt) const {
+            if constexpr (debug_mode) {
+                if (cnt > CODE_ELEM_COUNT) {
+                    throw std::runtime_error { "Bad element count" };
+                }
+            }
+            return CODE_CONTAINER_TYPE(cnt);
+        }
+
+        /** `create_path_container()` return type. */
+        using PATH_CONTAINER_TYPE = typename static_vector_typer<debug_mode, E, path_edge_capacity>::type;
+
+        /**
+         * @copydoc offbynull::aligner::backtrackers::striped_pairwise_local_alignment_graph_backtracker::unimplemented_backtracker_container_creator_pack::unimplemented_backtracker_container_creator_pack::create_path_container
+         */
+        PATH_CONTAINER_TYPE create_path_container(std::size_t path_edge_capacity_) const {
+            if constexpr (debug_mode) {
+                if (path_edge_capacity_ > path_edge_capacity) {
+                    throw std::runtime_error { "Path edge capacity too large" };
+                }
+            }
+            return {};
+        }
+    };
+}
+
+#endif //OFFBYNULL_ALIGNER_BACKTRACKERS_STRIPED_PAIRWISE_LOCAL_ALIGNMENT_GRAPH_BACKTRACKER_BACKTRACKER_STACK_CONTAINER_CREATOR_PACK_H
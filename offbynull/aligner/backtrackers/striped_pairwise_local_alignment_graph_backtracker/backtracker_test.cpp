@@ -0,0 +1,306 @@
+#include "offbynull/aligner/graphs/pairwise_global_alignment_graph.h"
+#include "offbynull/aligner/graphs/pairwise_local_alignment_graph.h"
+#include "offbynull/aligner/backtrackers/striped_pairwise_local_alignment_graph_backtracker/backtracker.h"
+#include "offbynull/aligner/backtrackers/striped_pairwise_local_alignment_graph_backtracker/concepts.h"
+#include "offbynull/aligner/backtrackers/pairwise_alignment_graph_backtracker/backtracker.h"
+#include "offbynull/aligner/scorers/simple_scorer.h"
+#include "offbynull/aligner/scorers/blosum_scorer.h"
+#include "offbynull/utils.h"
+#include "gtest/gtest.h"
+#include <cstddef>
+#include <cstdint>
+#include <stdfloat>
+#include <string>
+#include <vector>
+#include <random>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+namespace {
+    using offbynull::aligner::backtrackers::striped_pairwise_local_alignment_graph_backtracker::backtracker::backtracker;
+    using offbynull::aligner::backtrackers::striped_pairwise_local_alignment_graph_backtracker::backtracker::heap_find_max_path;
+    using offbynull::aligner::backtrackers::striped_pairwise_local_alignment_graph_backtracker::backtracker::stack_find_max_path;
+    using offbynull::aligner::backtrackers::striped_pairwise_local_alignment_graph_backtracker::concepts::striped_backtrackable_graph;
+    using offbynull::aligner::backtrackers::striped_pairwise_local_alignment_graph_backtracker::concepts::profilable_sequence;
+    using offbynull::aligner::backtrackers::striped_pairwise_local_alignment_graph_backtracker::backtracker_stack_container_creator_pack
+        ::backtracker_stack_container_creator_pack;
+    using offbynull::aligner::graphs::pairwise_global_alignment_graph::pairwise_global_alignment_graph;
+    using offbynull::aligner::graphs::pairwise_local_alignment_graph::pairwise_local_alignment_graph;
+    using offbynull::aligner::graphs::pairwise_local_alignment_graph::create_pairwise_local_alignment_graph;
+    using offbynull::aligner::graphs::pairwise_local_alignment_graph::edge_type;
+    using offbynull::aligner::scorers::simple_scorer::simple_scorer;
+    using offbynull::aligner::scorers::blosum_scorer::blosum_scorer;
+    using offbynull::aligner::scorers::blosum_scorer::threshold;
+    using offbynull::utils::copy_to_vector;
+    using offbynull::utils::is_debug_mode;
+
+    auto expected_max_path(const auto& g) {
+        using G = std::remove_cvref_t<decltype(g)>;
+        const auto& [path, weight] {
+            offbynull::aligner::backtrackers::pairwise_alignment_graph_backtracker::backtracker::backtracker<
+                is_debug_mode(),
+                G,
+                std::size_t,
+                std::size_t
+            > {}.find_max_path(g)
+        };
+        return std::make_pair(copy_to_vector(path), weight);
+    }
+
+    auto actual_max_path(const auto& g) {
+        using G = std::remove_cvref_t<decltype(g)>;
+        const auto& [path, weight] {
+            backtracker<
+                is_debug_mode(),
+                G,
+                std::size_t,
+                std::size_t
+            > {}.find_max_path(g)
+        };
+        return std::make_pair(copy_to_vector(path), weight);
+    }
+
+    auto actual_profiled_max_path(const auto& g, const auto& right_seq) {
+        using G = std::remove_cvref_t<decltype(g)>;
+        const auto& [path, weight] {
+            backtracker<
+                is_debug_mode(),
+                G,
+                std::size_t,
+                std::size_t
+            > {}.find_max_path(g, right_seq)
+        };
+        return std::make_pair(copy_to_vector(path), weight);
+    }
+
+    TEST(OABSBacktrackerTest, ConceptCheck) {
+        auto substitution_scorer {
+            simple_scorer<is_debug_mode(), std::size_t, char, char, std::int32_t>::create_substitution(1, -1)
+        };
+        auto gap_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, std::int32_t>::create_gap(-1) };
+        auto freeride_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, std::int32_t>::create_freeride(0) };
+        using G1 = pairwise_local_alignment_graph<
+            is_debug_mode(),
+            std::size_t,
+            std::int32_t,
+            std::string,
+            std::string,
+            decltype(substitution_scorer),
+            decltype(gap_scorer),
+            decltype(freeride_scorer)
+        >;
+        static_assert(striped_backtrackable_graph<G1>);
+        using G2 = pairwise_global_alignment_graph<
+            is_debug_mode(),
+            std::size_t,
+            std::int32_t,
+            std::string,
+            std::string,
+            decltype(substitution_scorer),
+            decltype(gap_scorer)
+        >;
+        static_assert(!striped_backtrackable_graph<G2>);  // not a local alignment graph
+        auto float_substitution_scorer {
+            simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_substitution(1.0f64, -1.0f64)
+        };
+        auto float_gap_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_gap(-1.0f64) };
+        auto float_freeride_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_freeride() };
+        using G3 = pairwise_local_alignment_graph<
+            is_debug_mode(),
+            std::size_t,
+            std::float64_t,
+            std::string,
+            std::string,
+            decltype(float_substitution_scorer),
+            decltype(float_gap_scorer),
+            decltype(float_freeride_scorer)
+        >;
+        static_assert(!striped_backtrackable_graph<G3>);  // weights not integers
+        static_assert(profilable_sequence<std::string>);
+        static_assert(!profilable_sequence<std::vector<std::int32_t>>);  // elements not single-byte
+    }
+
+    TEST(OABSBacktrackerTest, FindMaxPathOnGridGraph) {
+        auto substitution_scorer {
+            simple_scorer<is_debug_mode(), std::size_t, char, char, std::int32_t>::create_substitution(1, -1)
+        };
+        auto gap_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, std::int32_t>::create_gap(-1) };
+        auto freeride_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, std::int32_t>::create_freeride(0) };
+
+        std::string seq1 { "xac" };
+        std::string seq2 { "acy" };
+        pairwise_local_alignment_graph<
+            is_debug_mode(),
+            std::size_t,
+            std::int32_t,
+            decltype(seq1),
+            decltype(seq2),
+            decltype(substitution_scorer),
+            decltype(gap_scorer),
+            decltype(freeride_scorer)
+        > g {
+            seq1,
+            seq2,
+            substitution_scorer,
+            gap_scorer,
+            freeride_scorer
+        };
+
+        using E = decltype(g)::E;
+
+        const auto& [path, weight] { actual_max_path(g) };
+        EXPECT_EQ(
+            path,
+            (std::vector<E> {
+                E { edge_type::FREE_RIDE, { { 0zu, 0zu }, { 1zu, 0zu } } },
+                E { edge_type::NORMAL, { { 1zu, 0zu }, { 2zu, 1zu } } },
+                E { edge_type::NORMAL, { { 2zu, 1zu }, { 3zu, 2zu } } },
+                E { edge_type::FREE_RIDE, { { 3zu, 2zu }, { 3zu, 3zu } } }
+            })
+        );
+        EXPECT_EQ(weight, 2);
+    }
+
+    TEST(OABSBacktrackerTest, FindMaxPathViaHelpers) {
+        auto substitution_scorer {
+            simple_scorer<is_debug_mode(), std::size_t, char, char, std::int32_t>::create_substitution(1, -1)
+        };
+        auto gap_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, std::int32_t>::create_gap(-1) };
+        auto freeride_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, std::int32_t>::create_freeride(0) };
+
+        std::string seq1 { "xac" };
+        std::string seq2 { "acy" };
+        pairwise_local_alignment_graph<
+            is_debug_mode(),
+            std::size_t,
+            std::int32_t,
+            decltype(seq1),
+            decltype(seq2),
+            decltype(substitution_scorer),
+            decltype(gap_scorer),
+            decltype(freeride_scorer)
+        > g {
+            seq1,
+            seq2,
+            substitution_scorer,
+            gap_scorer,
+            freeride_scorer
+        };
+
+        using E = decltype(g)::E;
+
+        const std::vector<E> expected_path {
+            E { edge_type::FREE_RIDE, { { 0zu, 0zu }, { 1zu, 0zu } } },
+            E { edge_type::NORMAL, { { 1zu, 0zu }, { 2zu, 1zu } } },
+            E { edge_type::NORMAL, { { 2zu, 1zu }, { 3zu, 2zu } } },
+            E { edge_type::FREE_RIDE, { { 3zu, 2zu }, { 3zu, 3zu } } }
+        };
+        {
+            const auto& [path, weight] { heap_find_max_path<is_debug_mode(), std::size_t, std::size_t, true>(g) };
+            EXPECT_EQ(copy_to_vector(path), expected_path);
+            EXPECT_EQ(weight, 2);
+        }
+        {
+            const auto& [path, weight] {
+                stack_find_max_path<
+                    is_debug_mode(),
+                    std::size_t,
+                    std::size_t,
+                    4zu /*grid_down_cnt*/,
+                    4zu /*grid_right_cnt*/,
+                    1zu /*grid_depth_cnt*/,
+                    (4zu - 1zu) + (4zu - 1zu) /*path_edge_capacity*/
+                >(g)
+            };
+            EXPECT_EQ(copy_to_vector(path), expected_path);
+            EXPECT_EQ(weight, 2);
+        }
+        {
+            const auto& [path, weight] {
+                backtracker<
+                    is_debug_mode(),
+                    decltype(g),
+                    std::size_t,
+                    std::size_t,
+                    backtracker_stack_container_creator_pack<
+                        is_debug_mode(),
+                        decltype(g)::N,
+                        E,
+                        decltype(g)::ED,
+                        std::size_t,
+                        std::size_t,
+                        4zu /*grid_down_cnt*/,
+                        4zu /*grid_right_cnt*/,
+                        1zu /*grid_depth_cnt*/,
+                        (4zu - 1zu) + (4zu - 1zu) /*path_edge_capacity*/
+                    >
+                > {}.find_max_path(g, seq2)
+            };
+            EXPECT_EQ(copy_to_vector(path), expected_path);
+            EXPECT_EQ(weight, 2);
+        }
+    }
+
+    TEST(OABSBacktrackerTest, FindMaxPathWithSubstitutionMatrix) {
+        blosum_scorer<is_debug_mode(), threshold::_62, std::size_t, std::int32_t> substitution_scorer {};
+        auto gap_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, std::int32_t>::create_gap(-4) };
+        auto freeride_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, std::int32_t>::create_freeride(0) };
+
+        // Long enough to span several segments and overflow 8-bit lanes
+        std::string seq1 { "MKVLAAGIVALLLAAGCSSSKEETPATETAEVAEEAPKAEAPKAEEPKAEAPKAEEPKAEAPKAEWWWWCCCCHHHHYYYY" };
+        std::string seq2 { "GGGMKVLAAGIVGLLLAAGCSSKEETPATETAEVAEEAPKAEAPKAEEPKWWWWCCCCHHHHYYYYAEAPKAEEPKAEAPKAE" };
+        auto g {
+            create_pairwise_local_alignment_graph<is_debug_mode(), std::size_t>(
+                seq1, seq2, substitution_scorer, gap_scorer, freeride_scorer
+            )
+        };
+        EXPECT_EQ(expected_max_path(g), actual_max_path(g));
+        EXPECT_EQ(expected_max_path(g), actual_profiled_max_path(g, seq2));
+    }
+
+    TEST(OABSBacktrackerTest, RandomizedTestingAgainstReadyQueueBacktracker) {
+        std::mt19937_64 rand { 12345 };
+        auto random_integer { [&](auto a, auto b) -> decltype(a) { return std::uniform_int_distribution<decltype(a)>(a,b)(rand); } };
+        auto random_string {
+            [&](std::size_t max_len) {
+                std::string ret {};
+                for ([[maybe_unused]] auto _ : std::views::iota(0zu, random_integer(1zu, max_len))) {
+                    ret += random_integer('a', 'd');
+                }
+                return ret;
+            }
+        };
+        // Scales pick between 8-bit lanes, 16-bit lanes, and falling back to the anti-diagonal backtracker
+        for (const std::int32_t scale : { 1, 40, 20000 }) {
+            for ([[maybe_unused]] auto _ : std::views::iota(0u, 100u)) {
+                // Integer weights from a tiny range to force lots of ties, making sure ties get broken the same way
+                auto substitution_scorer {
+                    simple_scorer<is_debug_mode(), std::size_t, char, char, std::int32_t>::create_substitution(
+                        random_integer(-2, 2) * scale,
+                        random_integer(-2, 2) * scale
+                    )
+                };
+                auto gap_scorer {
+                    simple_scorer<is_debug_mode(), std::size_t, char, char, std::int32_t>::create_gap_asymmetric(
+                        random_integer(-2, 2) * scale,
+                        random_integer(-2, 2) * scale
+                    )
+                };
+                auto freeride_scorer {
+                    simple_scorer<is_debug_mode(), std::size_t, char, char, std::int32_t>::create_freeride(random_integer(-2, 2) * scale)
+                };
+                std::string seq1 { random_string(80zu) };
+                std::string seq2 { random_string(20zu) };
+                auto g {
+                    create_pairwise_local_alignment_graph<is_debug_mode(), std::size_t>(
+                        seq1, seq2, substitution_scorer, gap_scorer, freeride_scorer
+                    )
+                };
+                const auto expected { expected_max_path(g) };
+                EXPECT_EQ(expected, actual_max_path(g));
+                EXPECT_EQ(expected, actual_profiled_max_path(g, seq2));
+            }
+        }
+    }
+}
@@ -0,0 +1,54 @@
+#ifndef OFFBYNULL_ALIGNER_BACKTRACKERS_STRIPED_PAIRWISE_LOCAL_ALIGNMENT_GRAPH_BACKTRACKER_CONCEPTS_H
+#define OFFBYNULL_ALIGNER_BACKTRACKERS_STRIPED_PAIRWISE_LOCAL_ALIGNMENT_GRAPH_BACKTRACKER_CONCEPTS_H
+
+#include <concepts>
+#include <type_traits>
+#include <utility>
+#include "offbynull/aligner/sequence/sequence.h"
+#include "offbynull/aligner/backtrackers/anti_diagonal_pairwise_alignment_graph_backtracker/concepts.h"
+#include "offbynull/aligner/graphs/grid_graph.h"
+#include "offbynull/aligner/graphs/pairwise_local_alignment_graph.h"
+
+namespace offbynull::aligner::backtrackers::striped_pairwise_local_alignment_graph_backtracker::concepts {
+    using offbynull::aligner::backtrackers::anti_diagonal_pairwise_alignment_graph_backtracker::concepts::anti_diagonal_backtrackable_graph;
+    using offbynull::aligner::graphs::grid_graph::node;
+    using offbynull::aligner::graphs::pairwise_local_alignment_graph::local_edge;
+    using offbynull::aligner::sequence::sequence::sequence;
+
+    /**
+     * Concept that's satisfied if `G` can be walked by
+     * @ref offbynull::aligner::backtrackers::striped_pairwise_local_alignment_graph_backtracker::backtracker::backtracker. That is, `G`
+     * satisfies
+     * @ref offbynull::aligner::backtrackers::anti_diagonal_pairwise_alignment_graph_backtracker::concepts::anti_diagonal_backtrackable_graph
+     * and ...
+     *
+     *  * its node and edge identifiers are those of
+     *    @ref offbynull::aligner::graphs::pairwise_local_alignment_graph::pairwise_local_alignment_graph, such that the edges feeding into
+     *    each node can be constructed directly rather than enumerated.
+     *  * edge weights are signed integers, such that scores can be packed into narrow saturating lanes.
+     *
+     * @tparam G Type to check.
+     */
+    template<typename G>
+    concept striped_backtrackable_graph =
+        anti_diagonal_backtrackable_graph<G>
+        && std::signed_integral<typename G::ED>
+        && std::same_as<typename G::N, node<typename G::N_INDEX>>
+        && std::same_as<typename G::E, local_edge<typename G::N_INDEX>>;
+
+    /**
+     * Concept that's satisfied if `SEQ` can be handed to
+     * @ref offbynull::aligner::backtrackers::striped_pairwise_local_alignment_graph_backtracker::backtracker::backtracker as a graph's
+     * rightward sequence, such that substitution weights get profiled per rightward symbol rather than pulled from the graph per node.
+     * That is, `SEQ` is a @ref offbynull::aligner::sequence::sequence::sequence of single-byte integral elements (e.g., `char`).
+     *
+     * @tparam SEQ Type to check.
+     */
+    template<typename SEQ>
+    concept profilable_sequence =
+        sequence<SEQ>
+        && std::integral<std::remove_cvref_t<decltype(std::declval<SEQ>()[0zu])>>
+        && sizeof(std::remove_cvref_t<decltype(std::declval<SEQ>()[0zu])>) == 1zu;
+}
+
+#endif //OFFBYNULL_ALIGNER_BACKTRACKERS_STRIPED_PAIRWISE_LOCAL_ALIGNMENT_GRAPH_BACKTRACKER_CONCEPTS_H
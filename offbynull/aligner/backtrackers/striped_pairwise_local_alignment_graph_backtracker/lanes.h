@@ -0,0 +1,47 @@
+#ifndef OFFBYNULL_ALIGNER_BACKTRACKERS_STRIPED_PAIRWISE_LOCAL_ALIGNMENT_GRAPH_BACKTRACKER_LANES_H
+#define OFFBYNULL_ALIGNER_BACKTRACKERS_STRIPED_PAIRWISE_LOCAL_ALIGNMENT_GRAPH_BACKTRACKER_LANES_H
+
+#include <cstddef>
+#include <cstdint>
+#include <concepts>
+#include <limits>
+#include <algorithm>
+
+namespace offbynull::aligner::backtrackers::striped_pairwise_local_alignment_graph_backtracker::lanes {
+    /**
+     * Width of the vector registers that lane arrays are sized for, in bytes (32 bytes matches AVX2).
+     */
+    constexpr std::size_t vector_byte_width { 32zu };
+
+    /**
+     * Number of lanes of type `T` that fit within a single vector register.
+     *
+     * @tparam T Lane type.
+     */
+    template<std::signed_integral T>
+    constexpr std::size_t lane_cnt { vector_byte_width / sizeof(T) };
+
+    /**
+     * Maximum number of substitution stripes held by a query profile: 1 per distinct single-byte rightward symbol.
+     */
+    constexpr std::size_t max_profile_stripe_cnt { 1zu << std::numeric_limits<unsigned char>::digits };
+
+    /**
+     * Add two lane values, clamping the result to `T`'s range rather than wrapping around.
+     *
+     * @tparam T Lane type.
+     * @param lhs Left-hand operand.
+     * @param rhs Right-hand operand.
+     * @return `lhs + rhs` clamped to `[std::numeric_limits<T>::min(), std::numeric_limits<T>::max()]`.
+     */
+    template<std::signed_integral T>
+    T saturating_add(const T lhs, const T rhs) {
+        static_assert(sizeof(T) < sizeof(std::int32_t), "Lane type must be narrower than 32 bits");
+        constexpr std::int32_t lo { std::numeric_limits<T>::min() };
+        constexpr std::int32_t hi { std::numeric_limits<T>::max() };
+        const std::int32_t sum { static_cast<std::int32_t>(lhs) + static_cast<std::int32_t>(rhs) };
+        return static_cast<T>(std::min(std::max(sum, lo), hi));
+    }
+}
+
+#endif //OFFBYNULL_ALIGNER_BACKTRACKERS_STRIPED_PAIRWISE_LOCAL_ALIGNMENT_GRAPH_BACKTRACKER_LANES_H
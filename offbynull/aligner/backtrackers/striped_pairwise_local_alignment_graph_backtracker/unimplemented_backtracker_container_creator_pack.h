@@ -0,0 +1,66 @@
+#ifndef OFFBYNULL_ALIGNER_BACKTRACKERS_STRIPED_PAIRWISE_LOCAL_ALIGNMENT_GRAPH_BACKTRACKER_UNIMPLEMENTED_BACKTRACKER_CONTAINER_CREATOR_PACK_H
+#define OFFBYNULL_ALIGNER_BACKTRACKERS_STRIPED_PAIRWISE_LOCAL_ALIGNMENT_GRAPH_BACKTRACKER_UNIMPLEMENTED_BACKTRACKER_CONTAINER_CREATOR_PACK_H
+
+#include <cstddef>
+#include <concepts>
+#include "offbynull/aligner/backtrackers/striped_pairwise_local_alignment_graph_backtracker/backtracker_container_creator_pack.h"
+
+namespace offbynull::aligner::backtrackers::striped_pairwise_local_alignment_graph_backtracker
+        ::unimplemented_backtracker_container_creator_pack {
+    /**
+     * Unimplemented
+     * @ref offbynull::aligner::backtrackers::striped_pairwise_local_alignment_graph_backtracker::backtracker_container_creator_pack::backtracker_container_creator_pack,
+     * intended for documentation.
+     */
+    struct unimplemented_backtracker_container_creator_pack {
+        /**
+         * Create
+         * @ref offbynull::aligner::backtrackers::anti_diagonal_pairwise_alignment_graph_backtracker::backtracker::backtracker container
+         * creator pack, used when scores don't fit within 16-bit lanes.
+         *
+         * @return @ref offbynull::aligner::backtrackers::anti_diagonal_pairwise_alignment_graph_backtracker::backtracker::backtracker
+         * container creator pack.
+         */
+        auto create_anti_diagonal_backtracker_container_creator_pack() const;
+
+        /**
+         * Create random access container of lane values, used to hold striped per-column scores (and the striped gap / substitution
+         * weights feeding into them).
+         *
+         * @tparam LANE Lane type (8-bit or 16-bit signed integer).
+         * @param cnt Number of elements.
+         * @return Random access container of `cnt` zero-initialized elements.
+         */
+        template<std::signed_integral LANE>
+        auto create_lane_container(std::size_t cnt) const;
+
+        /**
+         * Create random access container of striped substitution weights (query profile), holding 1 padded column's worth of lane values
+         * for each distinct rightward symbol (or a single padded column, refilled per column, if the graph's rightward sequence isn't
+         * available).
+         *
+         * @tparam LANE Lane type (8-bit or 16-bit signed integer).
+         * @param cnt Number of elements.
+         * @return Random access container of `cnt` zero-initialized elements.
+         */
+        template<std::signed_integral LANE>
+        auto create_profile_container(std::size_t cnt) const;
+
+        /**
+         * Create random access container of traceback codes (which incoming edge each node selected), 1 per node.
+         *
+         * @param cnt Number of elements.
+         * @return Random access container of `cnt` zero-initialized elements.
+         */
+        auto create_code_container(std::size_t cnt) const;
+
+        /**
+         * Create random access container used to store path within a graph (sequence of graph edges).
+         *
+         * @return Empty random access container.
+         */
+        auto create_path_container() const;
+    };
+}
+
+#endif //OFFBYNULL_ALIGNER_BACKTRACKERS_STRIPED_PAIRWISE_LOCAL_ALIGNMENT_GRAPH_BACKTRACKER_UNIMPLEMENTED_BACKTRACKER_CONTAINER_CREATOR_PACK_H
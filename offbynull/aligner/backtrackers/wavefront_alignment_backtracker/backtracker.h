@@ -0,0 +1,767 @@
+#ifndef OFFBYNULL_ALIGNER_BACKTRACKERS_WAVEFRONT_ALIGNMENT_BACKTRACKER_BACKTRACKER_H
+#define OFFBYNULL_ALIGNER_BACKTRACKERS_WAVEFRONT_ALIGNMENT_BACKTRACKER_BACKTRACKER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <bit>
+#include <optional>
+#include <utility>
+#include <limits>
+#include <algorithm>
+#include <ranges>
+#include <stdexcept>
+#include <type_traits>
+#include "offbynull/aligner/backtrackers/wavefront_alignment_backtracker/penalties.h"
+#include "offbynull/aligner/backtrackers/wavefront_alignment_backtracker/wavefront.h"
+#include "offbynull/aligner/backtrackers/wavefront_alignment_backtracker/concepts.h"
+#include "offbynull/aligner/backtrackers/wavefront_alignment_backtracker/backtracker_container_creator_pack.h"
+#include "offbynull/aligner/backtrackers/wavefront_alignment_backtracker/backtracker_heap_container_creator_pack.h"
+#include "offbynull/aligner/sequence/sequence.h"
+#include "offbynull/concepts.h"
+
+namespace offbynull::aligner::backtrackers::wavefront_alignment_backtracker::backtracker {
+    using offbynull::aligner::backtrackers::wavefront_alignment_backtracker::penalties::penalties;
+    using offbynull::aligner::backtrackers::wavefront_alignment_backtracker::wavefront::wavefront;
+    using offbynull::aligner::backtrackers::wavefront_alignment_backtracker::concepts::word_comparable;
+    using offbynull::aligner::backtrackers::wavefront_alignment_backtracker::backtracker_container_creator_pack
+        ::backtracker_container_creator_pack;
+    using offbynull::aligner::backtrackers::wavefront_alignment_backtracker::backtracker_heap_container_creator_pack
+        ::backtracker_heap_container_creator_pack;
+    using offbynull::aligner::sequence::sequence::sequence;
+    using offbynull::concepts::widenable_to_size_t;
+
+    /**
+     * Wavefront alignment (WFA) engine for global alignments under gap-affine (or linear) penalties, producing the same alignment costs
+     * as walking a global or extended gap pairwise alignment graph but with work that scales with the cost of the alignment rather than
+     * with the product of the sequence lengths.
+     *
+     * Rather than computing the best cost of every node, WFA computes, for each cost `s` in increasing order, the furthest each diagonal
+     * can be walked by a path of exactly cost `s` (a wavefront). Matches are free, so each furthest point is slid along its diagonal for
+     * as long as elements keep matching. The first cost whose wavefront reaches the bottom-right corner is the alignment's cost.
+     *
+     * ```
+     *  diagonal k = right offset - down offset
+     *
+     *       k=-1  k=0  k=1
+     *         \    \    \
+     *  s=0     .    *====*          * = furthest point reached for s
+     *  s=x     *====*    .          = = slid over matching elements
+     * ```
+     *
+     * When sequences are contiguous runs of single byte integers (e.g., strings), matching elements are slid over 8 at a time by
+     * comparing whole 64-bit words.
+     *
+     * Three ways of tracing back are available:
+     *
+     *  * `find_global_cost()` keeps only the wavefronts still reachable by the largest penalty (`O(s)` space), producing the cost alone.
+     *  * `find_global_path()` keeps every wavefront (`O(s^2)` space) and traces back through them.
+     *  * `find_global_path_bidirectional()` walks wavefronts from both ends at once (BiWFA), keeping only the most recent few from each
+     *    end. Once the two ends overlap at an optimal point, the alignment is split there and each half is recursed into, keeping space
+     *    `O(s)` at the expense of roughly doubling the work.
+     *
+     * The alignment produced is a sequence of element offset pairs, same as what
+     * @ref offbynull::aligner::graphs::pairwise_global_alignment_graph::pairwise_global_alignment_graph::edge_to_element_offsets produces
+     * for each edge of a path.
+     *
+     * @tparam debug_mode `true` to enable debugging logic, `false` otherwise.
+     * @tparam N_INDEX Sequence offset type (must be wide enough to hold the length of the longer sequence).
+     * @tparam CONTAINER_CREATOR_PACK Container factory type.
+     */
+    template<
+        bool debug_mode,
+        widenable_to_size_t N_INDEX,
+        backtracker_container_creator_pack<N_INDEX> CONTAINER_CREATOR_PACK = backtracker_heap_container_creator_pack<
+            debug_mode,
+            N_INDEX,
+            true
+        >
+    >
+    class backtracker {
+    public:
+        /** Element offset pair type (a single step of the alignment). */
+        using ELEMENT_OFFSETS = std::optional<std::pair<std::optional<N_INDEX>, std::optional<N_INDEX>>>;
+        /** Path container type used by this backtracker implementation. */
+        using PATH_CONTAINER = decltype(std::declval<CONTAINER_CREATOR_PACK>().create_path_container(0zu));
+
+    private:
+        using OFFSET_CONTAINER = decltype(std::declval<CONTAINER_CREATOR_PACK>().create_offset_container(0zu));
+        using WAVEFRONT = wavefront<OFFSET_CONTAINER>;
+        using WAVEFRONT_CONTAINER = decltype(std::declval<CONTAINER_CREATOR_PACK>().create_wavefront_container(0zu));
+
+        // Offset of a point that no path reaches. Low enough that stepping from it never makes it look reachable.
+        static constexpr std::int64_t UNREACHED { std::numeric_limits<std::int64_t>::min() / 4 };
+
+        // State that a path is in at a point, doubling as the index of that state's block within a wavefront's offsets. ANY is the
+        // furthest reached regardless of state (what matches are slid along).
+        enum class state : std::size_t {
+            ANY = 0zu,
+            RIGHT_GAP = 1zu,
+            DOWN_GAP = 2zu
+        };
+
+        // Rectangle of the alignment being aligned, along with the states that the alignment must start / end in. Starting in a gap
+        // state means a gap left open by the rectangle before it may be continued without paying to open it. Ending in a gap state means
+        // the last step must be in that gap (the rectangle after it continues the gap).
+        struct subproblem {
+            std::size_t d_from;
+            std::size_t d_to;
+            std::size_t r_from;
+            std::size_t r_to;
+            state start;
+            state end;
+        };
+
+        // Wavefronts of a subproblem walked from one of its ends. If window is set, only the last window costs are kept (in a ring).
+        struct wavefront_walk {
+            WAVEFRONT_CONTAINER waves;
+            std::optional<std::size_t> window;
+            bool forward;
+            std::int64_t score;
+            std::int64_t last_reached_score;
+        };
+
+        // Wavefronts that a cost is computed from.
+        struct wavefront_sources {
+            const WAVEFRONT* mismatch;
+            const WAVEFRONT* right_open;
+            const WAVEFRONT* right_extend;
+            const WAVEFRONT* down_open;
+            const WAVEFRONT* down_extend;
+        };
+
+        // Offsets reaching a diagonal before sliding over matches: through a mismatch, ending in a right gap, ending in a down gap.
+        struct wavefront_cell {
+            std::int64_t mismatch;
+            std::int64_t right_gap;
+            std::int64_t down_gap;
+        };
+
+        // Point where an optimal alignment is split when walking from both ends.
+        struct breakpoint {
+            std::int64_t cost;
+            std::int64_t forward_cost;
+            std::int64_t diagonal;
+            std::int64_t offset;
+            state at;
+        };
+
+        CONTAINER_CREATOR_PACK container_creator_pack;
+        penalties costs;
+        std::int64_t max_step_cost;
+        std::int64_t max_gap_open;
+
+    public:
+        /**
+         * Construct an @ref offbynull::aligner::backtrackers::wavefront_alignment_backtracker::backtracker::backtracker instance.
+         *
+         * @param costs_ Penalties to align with.
+         * @param container_creator_pack_ Container factory.
+         * @throws std::runtime_error If `costs_` has a non-positive mismatch / gap extension penalty or a negative gap open penalty.
+         */
+        backtracker(
+            const penalties costs_,
+            CONTAINER_CREATOR_PACK container_creator_pack_ = {}
+        )
+        : container_creator_pack { container_creator_pack_ }
+        , costs { costs_ }
+        , max_step_cost {
+            std::max(
+                { costs_.mismatch, costs_.down_gap_open + costs_.down_gap_extend, costs_.right_gap_open + costs_.right_gap_extend }
+            )
+        }
+        , max_gap_open { std::max(costs_.down_gap_open, costs_.right_gap_open) } {
+            // Checked regardless of debug_mode: zero / negative costs would otherwise walk wavefronts forever.
+            if (costs.mismatch <= 0 || costs.down_gap_extend <= 0 || costs.right_gap_extend <= 0) {
+                throw std::runtime_error { "Mismatch and gap extension penalties must be positive" };
+            }
+            if (costs.down_gap_open < 0 || costs.right_gap_open < 0) {
+                throw std::runtime_error { "Gap open penalties must not be negative" };
+            }
+        }
+
+        /**
+         * Compute the cost of a global alignment (both sequences fully consumed).
+         *
+         * @param down Downward sequence.
+         * @param right Rightward sequence.
+         * @return Cost of aligning `down` vs `right`.
+         */
+        std::int64_t find_global_cost(
+            const sequence auto& down,
+            const sequence auto& right
+        ) {
+            validate(down, right);
+            const subproblem sub { 0zu, down.size(), 0zu, right.size(), state::ANY, state::ANY };
+            wavefront_walk walk { create_walk(true, static_cast<std::size_t>(max_step_cost) + 1zu) };
+            start_walk(walk, down, right, sub);
+            while (!reached_end(walk, sub)) {
+                advance_walk_or_throw(walk, down, right, sub);
+            }
+            return walk.score;
+        }
+
+        /**
+         * Find a global alignment (both sequences fully consumed) with the minimum cost, keeping every wavefront in memory.
+         *
+         * @param down Downward sequence.
+         * @param right Rightward sequence.
+         * @return Alignment of `down` vs `right` along with its cost.
+         */
+        std::pair<PATH_CONTAINER, std::int64_t> find_global_path(
+            const sequence auto& down,
+            const sequence auto& right
+        ) {
+            validate(down, right);
+            const subproblem sub { 0zu, down.size(), 0zu, right.size(), state::ANY, state::ANY };
+            PATH_CONTAINER path { container_creator_pack.create_path_container(down.size() + right.size()) };
+            const std::int64_t cost { trace(down, right, sub, path) };
+            return { std::move(path), cost };
+        }
+
+        /**
+         * Find a global alignment (both sequences fully consumed) with the minimum cost, walking wavefronts from both ends such that only
+         * the most recent few are held in memory.
+         *
+         * @param down Downward sequence.
+         * @param right Rightward sequence.
+         * @return Alignment of `down` vs `right` along with its cost.
+         */
+        std::pair<PATH_CONTAINER, std::int64_t> find_global_path_bidirectional(
+            const sequence auto& down,
+            const sequence auto& right
+        ) {
+            validate(down, right);
+            const subproblem sub { 0zu, down.size(), 0zu, right.size(), state::ANY, state::ANY };
+            PATH_CONTAINER path { container_creator_pack.create_path_container(down.size() + right.size()) };
+            const std::int64_t cost { split_and_trace(down, right, sub, std::numeric_limits<std::int64_t>::max(), path) };
+            if constexpr (debug_mode) {
+                if (path_cost(down, right, path) != cost) {
+                    throw std::runtime_error { "Traced path doesn't match breakpoint cost" };
+                }
+            }
+            return { std::move(path), cost };
+        }
+
+    private:
+        static void validate(
+            const sequence auto& down,
+            const sequence auto& right
+        ) {
+            if constexpr (debug_mode) {
+                if (std::numeric_limits<N_INDEX>::max() < down.size() || std::numeric_limits<N_INDEX>::max() < right.size()) {
+                    throw std::runtime_error { "N_INDEX not wide enough to support sequence lengths" };
+                }
+            }
+        }
+
+        std::int64_t open_cost(const state at) const {
+            switch (at) {
+                case state::RIGHT_GAP:
+                    return costs.right_gap_open;
+                case state::DOWN_GAP:
+                    return costs.down_gap_open;
+                default:
+                    return 0;
+            }
+        }
+
+        static std::size_t down_len(const subproblem& sub) {
+            return sub.d_to - sub.d_from;
+        }
+
+        static std::size_t right_len(const subproblem& sub) {
+            return sub.r_to - sub.r_from;
+        }
+
+        // Count how many elements match sliding along a diagonal from (v, h), both relative to the end of the subproblem being walked
+        // from.
+        static std::size_t count_matches(
+            const sequence auto& down,
+            const sequence auto& right,
+            const subproblem& sub,
+            const bool forward,
+            const std::size_t v,
+            const std::size_t h
+        ) {
+            const std::size_t limit { std::min(down_len(sub) - v, right_len(sub) - h) };
+            std::size_t matched { 0zu };
+            if constexpr (word_comparable<std::remove_cvref_t<decltype(down)>, std::remove_cvref_t<decltype(right)>>) {
+                // XOR-ing 8 elements of each sequence leaves non-zero bytes wherever elements differ. The first of those is the byte
+                // nearest to where the words were walked from: lowest address walking forward, highest address walking backward.
+                const auto* down_data { std::ranges::data(down) };
+                const auto* right_data { std::ranges::data(right) };
+                constexpr bool forward_is_low_first { std::endian::native == std::endian::little };
+                while (matched + 8zu <= limit) {
+                    std::uint64_t down_word;
+                    std::uint64_t right_word;
+                    if (forward) {
+                        std::memcpy(&down_word, down_data + sub.d_from + v + matched, 8zu);
+                        std::memcpy(&right_word, right_data + sub.r_from + h + matched, 8zu);
+                    } else {
+                        std::memcpy(&down_word, down_data + sub.d_to - v - matched - 8zu, 8zu);
+                        std::memcpy(&right_word, right_data + sub.r_to - h - matched - 8zu, 8zu);
+                    }
+                    const std::uint64_t diff { down_word ^ right_word };
+                    if (diff != 0u) {
+                        const int zero_bits { forward == forward_is_low_first ? std::countr_zero(diff) : std::countl_zero(diff) };
+                        return matched + static_cast<std::size_t>(zero_bits) / 8zu;
+                    }
+                    matched += 8zu;
+                }
+            }
+            if (forward) {
+                while (matched < limit && down[sub.d_from + v + matched] == right[sub.r_from + h + matched]) {
+                    ++matched;
+                }
+            } else {
+                while (matched < limit && down[sub.d_to - 1zu - v - matched] == right[sub.r_to - 1zu - h - matched]) {
+                    ++matched;
+                }
+            }
+            return matched;
+        }
+
+        WAVEFRONT create_empty_wavefront() const {
+            return { 1, 0, container_creator_pack.create_offset_container(0zu) };
+        }
+
+        wavefront_walk create_walk(const bool forward, const std::optional<std::size_t> window) const {
+            wavefront_walk walk {
+                container_creator_pack.create_wavefront_container(window.value_or(0zu)),
+                window,
+                forward,
+                -1,
+                -1
+            };
+            if (window.has_value()) {
+                for (std::size_t i { 0zu }; i < *window; ++i) {
+                    walk.waves.push_back(create_empty_wavefront());
+                }
+            }
+            return walk;
+        }
+
+        static void store(wavefront_walk& walk, WAVEFRONT&& wf) {
+            ++walk.score;
+            if (walk.window.has_value()) {
+                walk.waves[static_cast<std::size_t>(walk.score) % *walk.window] = std::move(wf);
+            } else {
+                walk.waves.push_back(std::move(wf));
+            }
+        }
+
+        static const WAVEFRONT* find_wavefront(const wavefront_walk& walk, const std::int64_t s) {
+            if (s < 0 || s > walk.score) {
+                return nullptr;
+            }
+            if (walk.window.has_value() && static_cast<std::size_t>(walk.score - s) >= *walk.window) {
+                return nullptr;
+            }
+            const std::size_t idx { walk.window.has_value() ? static_cast<std::size_t>(s) % *walk.window : static_cast<std::size_t>(s) };
+            const WAVEFRONT& wf { walk.waves[idx] };
+            return wf.lo > wf.hi ? nullptr : &wf;
+        }
+
+        static std::int64_t offset_at(const WAVEFRONT* wf, const state at, const std::int64_t k) {
+            if (wf == nullptr || k < wf->lo || k > wf->hi) {
+                return UNREACHED;
+            }
+            const std::int64_t width { wf->hi - wf->lo + 1 };
+            return wf->offsets[static_cast<std::size_t>(static_cast<std::int64_t>(at) * width + (k - wf->lo))];
+        }
+
+        static std::int64_t& offset_at(WAVEFRONT& wf, const state at, const std::int64_t k) {
+            const std::int64_t width { wf.hi - wf.lo + 1 };
+            return wf.offsets[static_cast<std::size_t>(static_cast<std::int64_t>(at) * width + (k - wf.lo))];
+        }
+
+        wavefront_sources find_sources(const wavefront_walk& walk, const std::int64_t s) const {
+            return {
+                find_wavefront(walk, s - costs.mismatch),
+                find_wavefront(walk, s - costs.right_gap_open - costs.right_gap_extend),
+                find_wavefront(walk, s - costs.right_gap_extend),
+                find_wavefront(walk, s - costs.down_gap_open - costs.down_gap_extend),
+                find_wavefront(walk, s - costs.down_gap_extend)
+            };
+        }
+
+        static wavefront_cell compute_cell(
+            const wavefront_sources& sources,
+            const std::int64_t k,
+            const std::int64_t n,
+            const std::int64_t m
+        ) {
+            const auto bound {
+                [&](const std::int64_t offset) {
+                    return offset >= 0 && offset <= m && offset - k >= 0 && offset - k <= n ? offset : UNREACHED;
+                }
+            };
+            return {
+                bound(offset_at(sources.mismatch, state::ANY, k) + 1),
+                bound(
+                    std::max(offset_at(sources.right_open, state::ANY, k - 1), offset_at(sources.right_extend, state::RIGHT_GAP, k - 1))
+                        + 1
+                ),
+                bound(std::max(offset_at(sources.down_open, state::ANY, k + 1), offset_at(sources.down_extend, state::DOWN_GAP, k + 1)))
+            };
+        }
+
+        // Place the wavefront for cost 0. Walking forward, a start in a gap state may continue that gap for free or leave it right away.
+        // Walking backward, an end in a gap state must be reached through that gap, so the gap is opened up front (placed at the cost of
+        // opening it) and can't be left without stepping through it.
+        void start_walk(
+            wavefront_walk& walk,
+            const sequence auto& down,
+            const sequence auto& right,
+            const subproblem& sub
+        ) const {
+            const state from { walk.forward ? sub.start : sub.end };
+            const std::int64_t first_score { walk.forward ? 0 : open_cost(from) };
+            for (std::int64_t s { 0 }; s < first_score; ++s) {
+                store(walk, create_empty_wavefront());
+            }
+            WAVEFRONT wf { 0, 0, container_creator_pack.create_offset_container(3zu) };
+            offset_at(wf, state::RIGHT_GAP, 0) = from == state::RIGHT_GAP ? 0 : UNREACHED;
+            offset_at(wf, state::DOWN_GAP, 0) = from == state::DOWN_GAP ? 0 : UNREACHED;
+            offset_at(wf, state::ANY, 0) = walk.forward || from == state::ANY
+                ? static_cast<std::int64_t>(count_matches(down, right, sub, walk.forward, 0zu, 0zu))
+                : UNREACHED;
+            store(walk, std::move(wf));
+            walk.last_reached_score = walk.score;
+        }
+
+        // Compute the wavefront for the next cost. Returns false if no path has that cost.
+        bool advance_walk(
+            wavefront_walk& walk,
+            const sequence auto& down,
+            const sequence auto& right,
+            const subproblem& sub
+        ) const {
+            const std::int64_t n { static_cast<std::int64_t>(down_len(sub)) };
+            const std::int64_t m { static_cast<std::int64_t>(right_len(sub)) };
+            const std::int64_t s { walk.score + 1 };
+            const wavefront_sources sources { find_sources(walk, s) };
+            std::int64_t lo { std::numeric_limits<std::int64_t>::max() };
+            std::int64_t hi { std::numeric_limits<std::int64_t>::min() };
+            const auto widen {
+                [&](const WAVEFRONT* wf, const std::int64_t shift) {
+                    if (wf != nullptr) {
+                        lo = std::min(lo, wf->lo + shift);
+                        hi = std::max(hi, wf->hi + shift);
+                    }
+                }
+            };
+            widen(sources.mismatch, 0);
+            widen(sources.right_open, 1);
+            widen(sources.right_extend, 1);
+            widen(sources.down_open, -1);
+            widen(sources.down_extend, -1);
+            lo = std::max(lo, -n);
+            hi = std::min(hi, m);
+            if (lo > hi) {
+                store(walk, create_empty_wavefront());
+                return false;
+            }
+            WAVEFRONT wf { lo, hi, container_creator_pack.create_offset_container(3zu * static_cast<std::size_t>(hi - lo + 1)) };
+            bool reached { false };
+            for (std::int64_t k { lo }; k <= hi; ++k) {
+                const wavefront_cell cell { compute_cell(sources, k, n, m) };
+                std::int64_t furthest { std::max({ cell.mismatch, cell.right_gap, cell.down_gap }) };
+                if (furthest >= 0) {
+                    const std::size_t v { static_cast<std::size_t>(furthest - k) };
+                    const std::size_t h { static_cast<std::size_t>(furthest) };
+                    furthest += static_cast<std::int64_t>(count_matches(down, right, sub, walk.forward, v, h));
+                    reached = true;
+                }
+                offset_at(wf, state::ANY, k) = furthest;
+                offset_at(wf, state::RIGHT_GAP, k) = cell.right_gap;
+                offset_at(wf, state::DOWN_GAP, k) = cell.down_gap;
+            }
+            store(walk, std::move(wf));
+            if (reached) {
+                walk.last_reached_score = walk.score;
+            }
+            return reached;
+        }
+
+        // Walks heading for the far end of a subproblem always get there, unless the subproblem's start / end states can't be joined
+        // (in which case more than a step's worth of costs go by without any path).
+        void advance_walk_or_throw(
+            wavefront_walk& walk,
+            const sequence auto& down,
+            const sequence auto& right,
+            const subproblem& sub
+        ) const {
+            if (!advance_walk(walk, down, right, sub) && walk.score - walk.last_reached_score > max_step_cost) {
+                throw std::runtime_error { "Alignment end unreachable" };
+            }
+        }
+
+        static bool reached_end(const wavefront_walk& walk, const subproblem& sub) {
+            const std::int64_t n { static_cast<std::int64_t>(down_len(sub)) };
+            const std::int64_t m { static_cast<std::int64_t>(right_len(sub)) };
+            return offset_at(find_wavefront(walk, walk.score), sub.end, m - n) == m;
+        }
+
+        static void push_step(PATH_CONTAINER& path, const std::optional<std::size_t> d, const std::optional<std::size_t> r) {
+            path.push_back(
+                ELEMENT_OFFSETS {
+                    {
+                        d.has_value() ? std::optional<N_INDEX> { static_cast<N_INDEX>(*d) } : std::nullopt,
+                        r.has_value() ? std::optional<N_INDEX> { static_cast<N_INDEX>(*r) } : std::nullopt
+                    }
+                }
+            );
+        }
+
+        // Walk forward keeping every wavefront, then trace back from the end, appending the subproblem's steps to path in order.
+        std::int64_t trace(
+            const sequence auto& down,
+            const sequence auto& right,
+            const subproblem& sub,
+            PATH_CONTAINER& path
+        ) const {
+            const std::int64_t n { static_cast<std::int64_t>(down_len(sub)) };
+            const std::int64_t m { static_cast<std::int64_t>(right_len(sub)) };
+            wavefront_walk walk { create_walk(true, std::nullopt) };
+            start_walk(walk, down, right, sub);
+            while (!reached_end(walk, sub)) {
+                advance_walk_or_throw(walk, down, right, sub);
+            }
+
+            const std::int64_t cost { walk.score };
+            const std::size_t path_begin { path.size() };
+            const auto push_diagonal {
+                [&](const std::int64_t k, const std::int64_t h) {
+                    push_step(
+                        path,
+                        { sub.d_from + static_cast<std::size_t>(h - k) - 1zu },
+                        { sub.r_from + static_cast<std::size_t>(h) - 1zu }
+                    );
+                }
+            };
+            std::int64_t s { cost };
+            std::int64_t k { m - n };
+            std::int64_t h { m };
+            state at { sub.end };
+            while (true) {
+                if (at == state::ANY) {
+                    if (s == 0) {
+                        for (; h > 0; --h) {
+                            push_diagonal(k, h);
+                        }
+                        break;
+                    }
+                    const wavefront_cell cell { compute_cell(find_sources(walk, s), k, n, m) };
+                    const std::int64_t base { std::max({ cell.mismatch, cell.right_gap, cell.down_gap }) };
+                    for (; h > base; --h) {
+                        push_diagonal(k, h);
+                    }
+                    if (base == cell.right_gap) {
+                        at = state::RIGHT_GAP;
+                    } else if (base == cell.down_gap) {
+                        at = state::DOWN_GAP;
+                    } else {
+                        push_diagonal(k, h);
+                        --h;
+                        s -= costs.mismatch;
+                    }
+                } else if (at == state::RIGHT_GAP) {
+                    if (s == 0) {
+                        break;
+                    }
+                    const wavefront_sources sources { find_sources(walk, s) };
+                    const bool opened { offset_at(sources.right_open, state::ANY, k - 1) + 1 == h };
+                    push_step(path, std::nullopt, { sub.r_from + static_cast<std::size_t>(h) - 1zu });
+                    --h;
+                    --k;
+                    if (opened) {
+                        s -= costs.right_gap_open + costs.right_gap_extend;
+                        at = state::ANY;
+                    } else {
+                        s -= costs.right_gap_extend;
+                    }
+                } else {
+                    if (s == 0) {
+                        break;
+                    }
+                    const wavefront_sources sources { find_sources(walk, s) };
+                    const bool opened { offset_at(sources.down_open, state::ANY, k + 1) == h };
+                    push_step(path, { sub.d_from + static_cast<std::size_t>(h - k) - 1zu }, std::nullopt);
+                    ++k;
+                    if (opened) {
+                        s -= costs.down_gap_open + costs.down_gap_extend;
+                        at = state::ANY;
+                    } else {
+                        s -= costs.down_gap_extend;
+                    }
+                }
+            }
+            std::reverse(
+                path.begin() + static_cast<std::ranges::range_difference_t<PATH_CONTAINER>>(path_begin),
+                path.end()
+            );
+            return cost;
+        }
+
+        // Check whether the forward wavefront for cost a overlaps the backward wavefront for cost b. Both ends pay to open a gap they
+        // overlap within, so that's taken back out of the overlap's cost.
+        void check_overlaps(
+            const wavefront_walk& forward_walk,
+            const std::int64_t a,
+            const wavefront_walk& backward_walk,
+            const std::int64_t b,
+            const subproblem& sub,
+            std::optional<breakpoint>& best
+        ) const {
+            const WAVEFRONT* forward_wf { find_wavefront(forward_walk, a) };
+            const WAVEFRONT* backward_wf { find_wavefront(backward_walk, b) };
+            if (forward_wf == nullptr || backward_wf == nullptr) {
+                return;
+            }
+            const std::int64_t m { static_cast<std::int64_t>(right_len(sub)) };
+            // Forward diagonal k is backward diagonal diagonal_sum - k.
+            const std::int64_t diagonal_sum { m - static_cast<std::int64_t>(down_len(sub)) };
+            const std::int64_t lo { std::max(forward_wf->lo, diagonal_sum - backward_wf->hi) };
+            const std::int64_t hi { std::min(forward_wf->hi, diagonal_sum - backward_wf->lo) };
+            for (std::int64_t k { lo }; k <= hi; ++k) {
+                for (const state at : { state::ANY, state::RIGHT_GAP, state::DOWN_GAP }) {
+                    const std::int64_t forward_offset { offset_at(forward_wf, at, k) };
+                    const std::int64_t backward_offset { offset_at(backward_wf, at, diagonal_sum - k) };
+                    if (forward_offset < 0 || backward_offset < 0 || forward_offset + backward_offset < m) {
+                        continue;
+                    }
+                    const std::int64_t cost { a + b - open_cost(at) };
+                    if (!best.has_value() || cost < best->cost) {
+                        best = breakpoint { cost, a, k, forward_offset, at };
+                    }
+                }
+            }
+        }
+
+        // Walk wavefronts from both ends of the subproblem, always advancing whichever end is behind, until the ends overlap at a point
+        // that no unchecked pair of costs can beat. Along any optimal path, some point has forward / backward costs within
+        // max_step_cost + max_gap_open of each other, so only pairs of costs that close together need checking.
+        breakpoint find_breakpoint(
+            const sequence auto& down,
+            const sequence auto& right,
+            const subproblem& sub
+        ) const {
+            const std::int64_t balance { max_step_cost + max_gap_open };
+            const std::size_t window { static_cast<std::size_t>(balance) + 1zu };
+            wavefront_walk forward_walk { create_walk(true, window) };
+            wavefront_walk backward_walk { create_walk(false, window) };
+            start_walk(forward_walk, down, right, sub);
+            start_walk(backward_walk, down, right, sub);
+            std::optional<breakpoint> best {};
+            for (std::int64_t b { 0 }; b <= backward_walk.score; ++b) {
+                check_overlaps(forward_walk, forward_walk.score, backward_walk, b, sub, best);
+            }
+            while (true) {
+                const std::int64_t trailing { std::min(forward_walk.score, backward_walk.score) };
+                if (best.has_value() && 2 * trailing + 2 - balance - max_gap_open >= best->cost) {
+                    break;
+                }
+                if (!best.has_value() && trailing - std::max(forward_walk.last_reached_score, backward_walk.last_reached_score) > balance) {
+                    throw std::runtime_error { "Alignment end unreachable" };
+                }
+                if (forward_walk.score <= backward_walk.score) {
+                    advance_walk(forward_walk, down, right, sub);
+                    const std::int64_t oldest { std::max(0l, backward_walk.score - balance) };
+                    for (std::int64_t b { oldest }; b <= backward_walk.score; ++b) {
+                        check_overlaps(forward_walk, forward_walk.score, backward_walk, b, sub, best);
+                    }
+                } else {
+                    advance_walk(backward_walk, down, right, sub);
+                    const std::int64_t oldest { std::max(0l, forward_walk.score - balance) };
+                    for (std::int64_t a { oldest }; a <= forward_walk.score; ++a) {
+                        check_overlaps(forward_walk, a, backward_walk, backward_walk.score, sub, best);
+                    }
+                }
+            }
+            return *best;
+        }
+
+        // Split the subproblem at a breakpoint and recurse into each side, appending steps to path in order. Subproblems known to be
+        // cheap (so their wavefronts are small) are traced back directly.
+        std::int64_t split_and_trace(
+            const sequence auto& down,
+            const sequence auto& right,
+            const subproblem& sub,
+            const std::int64_t cost_bound,
+            PATH_CONTAINER& path
+        ) const {
+            const std::size_t n { down_len(sub) };
+            const std::size_t m { right_len(sub) };
+            if (n == 0zu || m == 0zu || cost_bound <= 4 * (max_step_cost + max_gap_open)) {
+                return trace(down, right, sub, path);
+            }
+            const breakpoint split { find_breakpoint(down, right, sub) };
+            const std::size_t split_h { static_cast<std::size_t>(split.offset) };
+            const std::size_t split_v { static_cast<std::size_t>(split.offset - split.diagonal) };
+            // A breakpoint at either corner doesn't shrink anything.
+            if ((split_v == 0zu && split_h == 0zu) || (split_v == n && split_h == m)) {
+                return trace(down, right, sub, path);
+            }
+            const subproblem before { sub.d_from, sub.d_from + split_v, sub.r_from, sub.r_from + split_h, sub.start, split.at };
+            const subproblem after { sub.d_from + split_v, sub.d_to, sub.r_from + split_h, sub.r_to, split.at, sub.end };
+            split_and_trace(down, right, before, split.forward_cost, path);
+            split_and_trace(down, right, after, split.cost - split.forward_cost, path);
+            return split.cost;
+        }
+
+        std::int64_t path_cost(
+            const sequence auto& down,
+            const sequence auto& right,
+            const PATH_CONTAINER& path
+        ) const {
+            std::int64_t cost { 0 };
+            state prev { state::ANY };
+            for (const ELEMENT_OFFSETS& step : path) {
+                if (!step->first.has_value()) {
+                    cost += (prev == state::RIGHT_GAP ? 0 : costs.right_gap_open) + costs.right_gap_extend;
+                    prev = state::RIGHT_GAP;
+                } else if (!step->second.has_value()) {
+                    cost += (prev == state::DOWN_GAP ? 0 : costs.down_gap_open) + costs.down_gap_extend;
+                    prev = state::DOWN_GAP;
+                } else {
+                    cost += down[*step->first] == right[*step->second] ? 0 : costs.mismatch;
+                    prev = state::ANY;
+                }
+            }
+            return cost;
+        }
+    };
+
+    /**
+     * Helper function that constructs an
+     * @ref offbynull::aligner::backtrackers::wavefront_alignment_backtracker::backtracker::backtracker instance utilizing the heap for
+     * storage / computations.
+     *
+     * @tparam debug_mode `true` to enable debugging logic, `false` otherwise.
+     * @tparam N_INDEX Sequence offset type (must be wide enough to hold the length of the longer sequence).
+     * @tparam minimize_allocations `true` to force containers to reserve their expected size, thereby removing/reducing the need for adhoc
+     *     reallocations.
+     * @param costs Penalties to align with.
+     * @return Backtracker instance.
+     */
+    template<
+        bool debug_mode,
+        widenable_to_size_t N_INDEX,
+        bool minimize_allocations
+    >
+    auto create_heap_backtracker(const penalties costs) {
+        return backtracker<
+            debug_mode,
+            N_INDEX,
+            backtracker_heap_container_creator_pack<
+                debug_mode,
+                N_INDEX,
+                minimize_allocations
+            >
+        > { costs };
+    }
+}
+
+#endif //OFFBYNULL_ALIGNER_BACKTRACKERS_WAVEFRONT_ALIGNMENT_BACKTRACKER_BACKTRACKER_H
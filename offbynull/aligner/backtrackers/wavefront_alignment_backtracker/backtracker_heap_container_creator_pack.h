@@ -0,0 +1,65 @@
+#ifndef OFFBYNULL_ALIGNER_BACKTRACKERS_WAVEFRONT_ALIGNMENT_BACKTRACKER_BACKTRACKER_HEAP_CONTAINER_CREATOR_PACK_H
+#define OFFBYNULL_ALIGNER_BACKTRACKERS_WAVEFRONT_ALIGNMENT_BACKTRACKER_BACKTRACKER_HEAP_CONTAINER_CREATOR_PACK_H
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <utility>
+#include <vector>
+#include "offbynull/aligner/backtrackers/wavefront_alignment_backtracker/wavefront.h"
+#include "offbynull/aligner/backtrackers/wavefront_alignment_backtracker/unimplemented_backtracker_container_creator_pack.h"
+#include "offbynull/concepts.h"
+
+namespace offbynull::aligner::backtrackers::wavefront_alignment_backtracker::backtracker_heap_container_creator_pack {
+    using offbynull::aligner::backtrackers::wavefront_alignment_backtracker::wavefront::wavefront;
+    using offbynull::concepts::widenable_to_size_t;
+
+    /**
+     * @ref offbynull::aligner::backtrackers::wavefront_alignment_backtracker::backtracker_container_creator_pack::backtracker_container_creator_pack
+     * that allocates its containers on the heap.
+     *
+     * @tparam debug_mode `true` to enable debugging logic, `false` otherwise.
+     * @tparam N_INDEX Sequence offset type.
+     * @tparam minimize_allocations `true` to force `create_wavefront_container()` and `create_path_container()` to reserve `cnt` /
+     *     `path_capacity` elements, thereby removing/reducing the need for adhoc reallocations.
+     */
+    template<
+        bool debug_mode,
+        widenable_to_size_t N_INDEX,
+        bool minimize_allocations
+    >
+    struct backtracker_heap_container_creator_pack {
+        /**
+         * @copydoc offbynull::aligner::backtrackers::wavefront_alignment_backtracker::unimplemented_backtracker_container_creator_pack::unimplemented_backtracker_container_creator_pack::create_offset_container
+         */
+        std::vector<std::int64_t> create_offset_container(std::size_t cnt) const {
+            return std::vector<std::int64_t>(cnt);
+        }
+
+        /**
+         * @copydoc offbynull::aligner::backtrackers::wavefront_alignment_backtracker::unimplemented_backtracker_container_creator_pack::unimplemented_backtracker_container_creator_pack::create_wavefront_container
+         */
+        std::vector<wavefront<std::vector<std::int64_t>>> create_wavefront_container(std::size_t cnt) const {
+            std::vector<wavefront<std::vector<std::int64_t>>> ret {};
+            if constexpr (minimize_allocations) {
+                ret.reserve(cnt);
+            }
+            return ret;
+        }
+
+        /**
+         * @copydoc offbynull::aligner::backtrackers::wavefront_alignment_backtracker::unimplemented_backtracker_container_creator_pack::unimplemented_backtracker_container_creator_pack::create_path_container
+         */
+        std::vector<std::optional<std::pair<std::optional<N_INDEX>, std::optional<N_INDEX>>>> create_path_container(
+            std::size_t path_capacity
+        ) const {
+            std::vector<std::optional<std::pair<std::optional<N_INDEX>, std::optional<N_INDEX>>>> ret {};
+            if constexpr (minimize_allocations) {
+                ret.reserve(path_capacity);
+            }
+            return ret;
+        }
+    };
+}
+
+#endif //OFFBYNULL_ALIGNER_BACKTRACKERS_WAVEFRONT_ALIGNMENT_BACKTRACKER_BACKTRACKER_HEAP_CONTAINER_CREATOR_PACK_H
@@ -0,0 +1,236 @@
+#include "offbynull/aligner/backtrackers/wavefront_alignment_backtracker/backtracker.h"
+#include "offbynull/aligner/backtrackers/wavefront_alignment_backtracker/penalties.h"
+#include "offbynull/aligner/backtrackers/wavefront_alignment_backtracker/concepts.h"
+#include "offbynull/aligner/scorers/levenshtein_scorer.h"
+#include "offbynull/aligner/scorers/simple_scorer.h"
+#include "offbynull/utils.h"
+#include "gtest/gtest.h"
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+#include <random>
+#include <ranges>
+#include <utility>
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+namespace {
+    using offbynull::aligner::backtrackers::wavefront_alignment_backtracker::backtracker::create_heap_backtracker;
+    using offbynull::aligner::backtrackers::wavefront_alignment_backtracker::penalties::penalties;
+    using offbynull::aligner::backtrackers::wavefront_alignment_backtracker::penalties::to_penalties;
+    using offbynull::aligner::backtrackers::wavefront_alignment_backtracker::concepts::wavefront_scorer;
+    using offbynull::aligner::backtrackers::wavefront_alignment_backtracker::concepts::word_comparable;
+    using offbynull::aligner::scorers::levenshtein_scorer::levenshtein_scorer;
+    using offbynull::aligner::scorers::simple_scorer::simple_scorer;
+    using offbynull::utils::copy_to_vector;
+    using offbynull::utils::is_debug_mode;
+
+    using ELEMENT_OFFSETS = std::optional<std::pair<std::optional<std::size_t>, std::optional<std::size_t>>>;
+
+    // Gotoh's recurrences, computing the minimum gap-affine cost over every node.
+    std::int64_t expected_cost(const auto& down, const auto& right, const penalties& costs) {
+        constexpr std::int64_t inf { std::numeric_limits<std::int64_t>::max() / 4 };
+        const std::size_t n { down.size() };
+        const std::size_t m { right.size() };
+        std::vector<std::vector<std::int64_t>> any(n + 1zu, std::vector<std::int64_t>(m + 1zu, inf));
+        std::vector<std::vector<std::int64_t>> rgap(n + 1zu, std::vector<std::int64_t>(m + 1zu, inf));
+        std::vector<std::vector<std::int64_t>> dgap(n + 1zu, std::vector<std::int64_t>(m + 1zu, inf));
+        any[0][0] = 0;
+        for (std::size_t v { 0zu }; v <= n; ++v) {
+            for (std::size_t h { 0zu }; h <= m; ++h) {
+                if (h > 0zu) {
+                    rgap[v][h] = std::min(any[v][h - 1zu] + costs.right_gap_open, rgap[v][h - 1zu]) + costs.right_gap_extend;
+                }
+                if (v > 0zu) {
+                    dgap[v][h] = std::min(any[v - 1zu][h] + costs.down_gap_open, dgap[v - 1zu][h]) + costs.down_gap_extend;
+                }
+                if (v > 0zu && h > 0zu) {
+                    any[v][h] = any[v - 1zu][h - 1zu] + (down[v - 1zu] == right[h - 1zu] ? 0 : costs.mismatch);
+                }
+                any[v][h] = std::min({ any[v][h], rgap[v][h], dgap[v][h] });
+            }
+        }
+        return any[n][m];
+    }
+
+    // Replay an alignment, making sure it consumes both sequences fully and in order while summing up its cost.
+    std::int64_t replay(const auto& down, const auto& right, const std::vector<ELEMENT_OFFSETS>& path, const penalties& costs) {
+        std::size_t next_down { 0zu };
+        std::size_t next_right { 0zu };
+        std::int64_t cost { 0 };
+        int prev { 0 };
+        for (const ELEMENT_OFFSETS& step : path) {
+            EXPECT_TRUE(step.has_value());
+            const auto& [d, r] { *step };
+            if (d.has_value()) {
+                EXPECT_EQ(*d, next_down);
+                next_down = *d + 1zu;
+            }
+            if (r.has_value()) {
+                EXPECT_EQ(*r, next_right);
+                next_right = *r + 1zu;
+            }
+            if (d.has_value() && r.has_value()) {
+                cost += down[*d] == right[*r] ? 0 : costs.mismatch;
+                prev = 0;
+            } else if (r.has_value()) {
+                cost += (prev == 1 ? 0 : costs.right_gap_open) + costs.right_gap_extend;
+                prev = 1;
+            } else {
+                cost += (prev == 2 ? 0 : costs.down_gap_open) + costs.down_gap_extend;
+                prev = 2;
+            }
+        }
+        EXPECT_EQ(next_down, down.size());
+        EXPECT_EQ(next_right, right.size());
+        return cost;
+    }
+
+    TEST(OABWBacktrackerTest, ConceptCheck) {
+        static_assert(wavefront_scorer<simple_scorer<is_debug_mode(), std::size_t, char, char, std::int32_t>>);
+        static_assert(wavefront_scorer<levenshtein_scorer<is_debug_mode(), std::size_t, char, char, std::int32_t>>);
+        static_assert(!wavefront_scorer<simple_scorer<is_debug_mode(), std::size_t, char, char, float>>);  // not integral
+        static_assert(word_comparable<std::string, std::string>);
+        static_assert(!word_comparable<std::vector<std::int32_t>, std::vector<std::int32_t>>);  // elements not single byte
+        static_assert(!word_comparable<std::string, std::vector<unsigned char>>);  // elements differ
+    }
+
+    TEST(OABWBacktrackerTest, ToPenalties) {
+        // match=1, mismatch=-1, gap=-1 (linear): mismatch=4, open=0, extend=3
+        const auto linear { to_penalties(1, -1, -1, -1, -1, -1, 0) };
+        EXPECT_EQ(linear.costs.mismatch, 4);
+        EXPECT_EQ(linear.costs.down_gap_open, 0);
+        EXPECT_EQ(linear.costs.down_gap_extend, 3);
+        EXPECT_EQ(linear.scale, 1);
+        // match=0, mismatch=-4, gap=-2 (linear): mismatch=8, open=0, extend=4, scaled down by 4
+        const auto scaled { to_penalties(0, -4, -2, -2, -2, -2, 0) };
+        EXPECT_EQ(scaled.costs.mismatch, 2);
+        EXPECT_EQ(scaled.costs.right_gap_extend, 1);
+        EXPECT_EQ(scaled.scale, 4);
+        EXPECT_EQ(scaled.to_weight(3zu, 3zu, 4), -8);
+        // match=0, mismatch=-1, initial gap=-3, extended gap=-1 (affine): mismatch=2, open=4, extend=2, scaled down by 2
+        const auto affine { to_penalties(0, -1, -3, -3, -1, -1, 0) };
+        EXPECT_EQ(affine.costs.mismatch, 1);
+        EXPECT_EQ(affine.costs.down_gap_open, 2);
+        EXPECT_EQ(affine.costs.down_gap_extend, 1);
+        EXPECT_EQ(affine.scale, 2);
+        // invalid
+        EXPECT_THROW(to_penalties(0, 0, -1, -1, -1, -1, 0), std::runtime_error);
+        EXPECT_THROW(to_penalties(0, -1, -1, -1, -3, -3, 0), std::runtime_error);
+        EXPECT_THROW((create_heap_backtracker<is_debug_mode(), std::size_t, true>(penalties { 1, 0, 0, 0, 1 })), std::runtime_error);
+    }
+
+    TEST(OABWBacktrackerTest, FindGlobalPath) {
+        std::string seq1 { "kitten" };
+        std::string seq2 { "sitting" };
+        auto backtracker { create_heap_backtracker<is_debug_mode(), std::size_t, true>(penalties { 1, 0, 1, 0, 1 }) };
+        const auto& [path, cost] { backtracker.find_global_path(seq1, seq2) };
+        EXPECT_EQ(
+            copy_to_vector(path),
+            (std::vector<ELEMENT_OFFSETS> {
+                { { { 0zu }, { 0zu } } },
+                { { { 1zu }, { 1zu } } },
+                { { { 2zu }, { 2zu } } },
+                { { { 3zu }, { 3zu } } },
+                { { { 4zu }, { 4zu } } },
+                { { { 5zu }, { 5zu } } },
+                { { std::nullopt, { 6zu } } }
+            })
+        );
+        EXPECT_EQ(cost, 3);
+        EXPECT_EQ(backtracker.find_global_cost(seq1, seq2), 3);
+        const auto& [bidi_path, bidi_cost] { backtracker.find_global_path_bidirectional(seq1, seq2) };
+        EXPECT_EQ(bidi_cost, 3);
+        EXPECT_EQ(replay(seq1, seq2, copy_to_vector(bidi_path), penalties { 1, 0, 1, 0, 1 }), 3);
+    }
+
+    TEST(OABWBacktrackerTest, FindGlobalPathEmpty) {
+        auto backtracker { create_heap_backtracker<is_debug_mode(), std::size_t, true>(penalties { 4, 6, 2, 6, 2 }) };
+        for (const auto& [seq1, seq2] : std::vector<std::pair<std::string, std::string>> { { "", "" }, { "", "abc" }, { "abc", "" } }) {
+            const std::int64_t expected { seq1.size() + seq2.size() == 0zu ? 0 : 6 + 2 * 3 };
+            EXPECT_EQ(backtracker.find_global_cost(seq1, seq2), expected);
+            const auto& [path, cost] { backtracker.find_global_path(seq1, seq2) };
+            EXPECT_EQ(cost, expected);
+            EXPECT_EQ(path.size(), seq1.size() + seq2.size());
+            const auto& [bidi_path, bidi_cost] { backtracker.find_global_path_bidirectional(seq1, seq2) };
+            EXPECT_EQ(bidi_cost, expected);
+            EXPECT_EQ(copy_to_vector(bidi_path), copy_to_vector(path));
+        }
+    }
+
+    TEST(OABWBacktrackerTest, FindGlobalPathNonWordComparable) {
+        std::vector<std::int32_t> seq1 { 1000, 2000, 3000, 4000, 5000, 6000, 7000, 8000, 9000, 1000, 2000 };
+        std::vector<std::int32_t> seq2 { 1000, 2000, 3000, 4000, 5000, 6000, 7000, 8000, 9000, 2000 };
+        const penalties costs { 4, 6, 2, 6, 2 };
+        auto backtracker { create_heap_backtracker<is_debug_mode(), std::size_t, true>(costs) };
+        const auto& [path, cost] { backtracker.find_global_path(seq1, seq2) };
+        EXPECT_EQ(cost, 8);
+        EXPECT_EQ(replay(seq1, seq2, copy_to_vector(path), costs), 8);
+        EXPECT_EQ(backtracker.find_global_path_bidirectional(seq1, seq2).second, 8);
+    }
+
+    TEST(OABWBacktrackerTest, RandomizedTestingAgainstGotoh) {
+        std::mt19937_64 rand { 12345 };
+        auto random_integer { [&](auto a, auto b) -> decltype(a) { return std::uniform_int_distribution<decltype(a)>(a,b)(rand); } };
+        auto random_string {
+            [&](std::size_t max_len) {
+                std::string ret {};
+                for ([[maybe_unused]] auto _ : std::views::iota(0zu, random_integer(0zu, max_len))) {
+                    ret += random_integer('a', 'd');
+                }
+                return ret;
+            }
+        };
+        auto mutate {
+            [&](std::string seq) {
+                for ([[maybe_unused]] auto _ : std::views::iota(0zu, seq.size() / 10zu + 1zu)) {
+                    const std::size_t idx { random_integer(0zu, seq.size()) };
+                    switch (random_integer(0, 2)) {
+                        case 0:
+                            seq.insert(idx, random_string(5zu));
+                            break;
+                        case 1:
+                            seq.erase(idx, random_integer(0zu, 5zu));
+                            break;
+                        default:
+                            if (idx < seq.size()) {
+                                seq[idx] = random_integer('a', 'd');
+                            }
+                            break;
+                    }
+                }
+                return seq;
+            }
+        };
+        const std::vector<penalties> all_costs {
+            { 1, 0, 1, 0, 1 },  // edit distance
+            { 4, 0, 2, 0, 3 },  // linear, asymmetric
+            { 4, 6, 2, 6, 2 },  // affine
+            { 3, 5, 1, 2, 4 },  // affine, asymmetric
+            { 9, 1, 1, 20, 1 }  // affine, lopsided
+        };
+        // Lengths span sequences that slide over matches within a single word as well as ones that span many words, and related sequences
+        // (cheap alignments) as well as unrelated ones (expensive alignments)
+        for (const std::size_t max_len : { 10zu, 200zu }) {
+            for ([[maybe_unused]] auto _ : std::views::iota(0u, 20u)) {
+                std::string seq1 { random_string(max_len) };
+                for (const std::string& seq2 : { random_string(max_len), mutate(seq1) }) {
+                    for (const penalties& costs : all_costs) {
+                        auto backtracker { create_heap_backtracker<is_debug_mode(), std::size_t, true>(costs) };
+                        const std::int64_t expected { expected_cost(seq1, seq2, costs) };
+                        EXPECT_EQ(backtracker.find_global_cost(seq1, seq2), expected);
+                        const auto& [path, cost] { backtracker.find_global_path(seq1, seq2) };
+                        EXPECT_EQ(cost, expected);
+                        EXPECT_EQ(replay(seq1, seq2, copy_to_vector(path), costs), expected);
+                        const auto& [bidi_path, bidi_cost] { backtracker.find_global_path_bidirectional(seq1, seq2) };
+                        EXPECT_EQ(bidi_cost, expected);
+                        EXPECT_EQ(replay(seq1, seq2, copy_to_vector(bidi_path), costs), expected);
+                    }
+                }
+            }
+        }
+    }
+}
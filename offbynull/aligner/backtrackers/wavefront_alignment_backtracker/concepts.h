@@ -0,0 +1,44 @@
+#ifndef OFFBYNULL_ALIGNER_BACKTRACKERS_WAVEFRONT_ALIGNMENT_BACKTRACKER_CONCEPTS_H
+#define OFFBYNULL_ALIGNER_BACKTRACKERS_WAVEFRONT_ALIGNMENT_BACKTRACKER_CONCEPTS_H
+
+#include <concepts>
+#include <ranges>
+
+namespace offbynull::aligner::backtrackers::wavefront_alignment_backtracker::concepts {
+    /**
+     * Concept that's satisfied if `T` is a scorer whose weights depend only on whether elements are equal / missing, and which exposes
+     * those weights as integers (e.g., @ref offbynull::aligner::scorers::simple_scorer::simple_scorer and
+     * @ref offbynull::aligner::scorers::levenshtein_scorer::levenshtein_scorer). Such weights can be turned into the penalties that
+     * @ref offbynull::aligner::backtrackers::wavefront_alignment_backtracker::backtracker::backtracker walks.
+     *
+     * @tparam T Type to check.
+     */
+    template<typename T>
+    concept wavefront_scorer =
+        requires(const T t) {
+            typename T::WEIGHT;
+            { t.get_match_weight() } -> std::same_as<typename T::WEIGHT>;
+            { t.get_mismatch_weight() } -> std::same_as<typename T::WEIGHT>;
+            { t.get_down_missing_weight() } -> std::same_as<typename T::WEIGHT>;
+            { t.get_right_missing_weight() } -> std::same_as<typename T::WEIGHT>;
+            { t.get_both_missing_weight() } -> std::same_as<typename T::WEIGHT>;
+        }
+        && std::integral<typename T::WEIGHT>;
+
+    /**
+     * Concept that's satisfied if `DOWN_SEQ` and `RIGHT_SEQ` are contiguous sequences of the same single byte integral element type, such
+     * that runs of matching elements can be found by comparing whole machine words at once rather than element by element.
+     *
+     * @tparam DOWN_SEQ Downward sequence type.
+     * @tparam RIGHT_SEQ Rightward sequence type.
+     */
+    template<typename DOWN_SEQ, typename RIGHT_SEQ>
+    concept word_comparable =
+        std::ranges::contiguous_range<DOWN_SEQ>
+        && std::ranges::contiguous_range<RIGHT_SEQ>
+        && std::same_as<std::ranges::range_value_t<DOWN_SEQ>, std::ranges::range_value_t<RIGHT_SEQ>>
+        && std::integral<std::ranges::range_value_t<DOWN_SEQ>>
+        && sizeof(std::ranges::range_value_t<DOWN_SEQ>) == 1zu;
+}
+
+#endif //OFFBYNULL_ALIGNER_BACKTRACKERS_WAVEFRONT_ALIGNMENT_BACKTRACKER_CONCEPTS_H
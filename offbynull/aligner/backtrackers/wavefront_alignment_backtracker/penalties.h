@@ -0,0 +1,114 @@
+#ifndef OFFBYNULL_ALIGNER_BACKTRACKERS_WAVEFRONT_ALIGNMENT_BACKTRACKER_PENALTIES_H
+#define OFFBYNULL_ALIGNER_BACKTRACKERS_WAVEFRONT_ALIGNMENT_BACKTRACKER_PENALTIES_H
+
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <stdexcept>
+
+namespace offbynull::aligner::backtrackers::wavefront_alignment_backtracker::penalties {
+    /**
+     * Gap-affine penalties for @ref offbynull::aligner::backtrackers::wavefront_alignment_backtracker::backtracker::backtracker. Matches
+     * are free, a mismatch costs `mismatch`, and a gap of length `L` costs `open + L * extend` (linear gaps have an `open` of 0).
+     *
+     * A down gap consumes downward elements on their own (a vertical run of edges in a pairwise alignment graph), while a right gap
+     * consumes rightward elements on their own (a horizontal run of edges).
+     */
+    struct penalties {
+        /** Cost of a mismatch. Must be positive. */
+        std::int64_t mismatch;
+        /** Cost of opening a down gap. Must not be negative. */
+        std::int64_t down_gap_open;
+        /** Cost of each element in a down gap. Must be positive. */
+        std::int64_t down_gap_extend;
+        /** Cost of opening a right gap. Must not be negative. */
+        std::int64_t right_gap_open;
+        /** Cost of each element in a right gap. Must be positive. */
+        std::int64_t right_gap_extend;
+    };
+
+    /**
+     * @ref offbynull::aligner::backtrackers::wavefront_alignment_backtracker::penalties::penalties derived from alignment weights, along
+     * with what's needed to turn a cost back into a weight.
+     *
+     * A global alignment of sequences of length `n` and `m` consumes `n + m` elements, 2 per match / mismatch and 1 per gap element.
+     * Scaling each step's weight against a match's weight therefore turns maximizing weight into minimizing cost, where
+     * `weight = (match_weight * (n + m) - scale * cost) / 2`. Penalties are divided by their greatest common divisor (stored as `scale`)
+     * to keep costs, and so the number of wavefronts walked, small.
+     */
+    struct scaled_penalties {
+        /** Penalties to align with. */
+        penalties costs;
+        /** Weight of a match. */
+        std::int64_t match_weight;
+        /** Factor that costs were divided by. */
+        std::int64_t scale;
+
+        /**
+         * Convert the cost of a global alignment back into the alignment's weight.
+         *
+         * @param down_len Downward sequence length.
+         * @param right_len Rightward sequence length.
+         * @param cost Cost of the alignment.
+         * @return Weight of the alignment.
+         */
+        std::int64_t to_weight(const std::size_t down_len, const std::size_t right_len, const std::int64_t cost) const {
+            return (match_weight * static_cast<std::int64_t>(down_len + right_len) - scale * cost) / 2;
+        }
+    };
+
+    /**
+     * Derive penalties from gap-affine alignment weights. A down gap of length `L` weighs
+     * `down_initial_gap_weight + (L - 1) * down_extended_gap_weight + freeride_weight`, and likewise for right gaps (the layout of
+     * @ref offbynull::aligner::graphs::pairwise_extended_gap_alignment_graph::pairwise_extended_gap_alignment_graph). Pass an extended gap
+     * weight equal to the initial gap weight and a free ride weight of 0 for linear gaps.
+     *
+     * @param match_weight Weight of a match.
+     * @param mismatch_weight Weight of a mismatch.
+     * @param down_initial_gap_weight Weight of the first element of a down gap.
+     * @param right_initial_gap_weight Weight of the first element of a right gap.
+     * @param down_extended_gap_weight Weight of each subsequent element of a down gap.
+     * @param right_extended_gap_weight Weight of each subsequent element of a right gap.
+     * @param freeride_weight Weight of leaving a gap.
+     * @return Penalties.
+     * @throws std::runtime_error If the weights don't map to valid penalties (a mismatch or gap element must weigh less than a match / half
+     *     a match respectively, and opening a gap mustn't weigh more than extending one).
+     */
+    inline scaled_penalties to_penalties(
+        const std::int64_t match_weight,
+        const std::int64_t mismatch_weight,
+        const std::int64_t down_initial_gap_weight,
+        const std::int64_t right_initial_gap_weight,
+        const std::int64_t down_extended_gap_weight,
+        const std::int64_t right_extended_gap_weight,
+        const std::int64_t freeride_weight
+    ) {
+        penalties costs {
+            2 * (match_weight - mismatch_weight),
+            2 * (down_extended_gap_weight - down_initial_gap_weight - freeride_weight),
+            match_weight - 2 * down_extended_gap_weight,
+            2 * (right_extended_gap_weight - right_initial_gap_weight - freeride_weight),
+            match_weight - 2 * right_extended_gap_weight
+        };
+        // Checked regardless of debug_mode: zero / negative costs would otherwise walk wavefronts forever.
+        if (costs.mismatch <= 0 || costs.down_gap_extend <= 0 || costs.right_gap_extend <= 0) {
+            throw std::runtime_error { "Mismatches and gaps must weigh less than matches" };
+        }
+        if (costs.down_gap_open < 0 || costs.right_gap_open < 0) {
+            throw std::runtime_error { "Opening a gap must not weigh more than extending one" };
+        }
+        std::int64_t scale { costs.mismatch };
+        scale = std::gcd(scale, costs.down_gap_open);
+        scale = std::gcd(scale, costs.down_gap_extend);
+        scale = std::gcd(scale, costs.right_gap_open);
+        scale = std::gcd(scale, costs.right_gap_extend);
+        costs.mismatch /= scale;
+        costs.down_gap_open /= scale;
+        costs.down_gap_extend /= scale;
+        costs.right_gap_open /= scale;
+        costs.right_gap_extend /= scale;
+        return { costs, match_weight, scale };
+    }
+}
+
+#endif //OFFBYNULL_ALIGNER_BACKTRACKERS_WAVEFRONT_ALIGNMENT_BACKTRACKER_PENALTIES_H
@@ -0,0 +1,43 @@
+#ifndef OFFBYNULL_ALIGNER_BACKTRACKERS_WAVEFRONT_ALIGNMENT_BACKTRACKER_UNIMPLEMENTED_BACKTRACKER_CONTAINER_CREATOR_PACK_H
+#define OFFBYNULL_ALIGNER_BACKTRACKERS_WAVEFRONT_ALIGNMENT_BACKTRACKER_UNIMPLEMENTED_BACKTRACKER_CONTAINER_CREATOR_PACK_H
+
+#include <cstddef>
+#include "offbynull/aligner/backtrackers/wavefront_alignment_backtracker/backtracker_container_creator_pack.h"
+
+namespace offbynull::aligner::backtrackers::wavefront_alignment_backtracker::unimplemented_backtracker_container_creator_pack {
+    /**
+     * Unimplemented
+     * @ref offbynull::aligner::backtrackers::wavefront_alignment_backtracker::backtracker_container_creator_pack::backtracker_container_creator_pack,
+     * intended for documentation.
+     */
+    struct unimplemented_backtracker_container_creator_pack {
+        /**
+         * Create random access container of right offsets, used to hold the furthest reaching points of a single wavefront.
+         *
+         * @param cnt Number of elements.
+         * @return Random access container of `cnt` elements.
+         */
+        auto create_offset_container(std::size_t cnt) const;
+
+        /**
+         * Create random access container of wavefronts (see
+         * @ref offbynull::aligner::backtrackers::wavefront_alignment_backtracker::wavefront::wavefront). Wavefronts are either pushed as
+         * each cost is reached (tracing back, where every wavefront is kept) or overwritten in a ring (where only the wavefronts still
+         * reachable by the largest penalty are kept).
+         *
+         * @param cnt Number of elements the container is expected to hold.
+         * @return Empty random access container.
+         */
+        auto create_wavefront_container(std::size_t cnt) const;
+
+        /**
+         * Create random access container used to store an alignment (sequence of element offset pairs).
+         *
+         * @param path_capacity Maximum number of elements the alignment can have.
+         * @return Empty random access container.
+         */
+        auto create_path_container(std::size_t path_capacity) const;
+    };
+}
+
+#endif //OFFBYNULL_ALIGNER_BACKTRACKERS_WAVEFRONT_ALIGNMENT_BACKTRACKER_UNIMPLEMENTED_BACKTRACKER_CONTAINER_CREATOR_PACK_H
@@ -0,0 +1,29 @@
+#ifndef OFFBYNULL_ALIGNER_BACKTRACKERS_WAVEFRONT_ALIGNMENT_BACKTRACKER_WAVEFRONT_H
+#define OFFBYNULL_ALIGNER_BACKTRACKERS_WAVEFRONT_ALIGNMENT_BACKTRACKER_WAVEFRONT_H
+
+#include <cstdint>
+
+namespace offbynull::aligner::backtrackers::wavefront_alignment_backtracker::wavefront {
+    /**
+     * Furthest reaching points for a single cost within
+     * @ref offbynull::aligner::backtrackers::wavefront_alignment_backtracker::backtracker::backtracker.
+     *
+     * Diagonal `k` holds the cells where `right offset - down offset == k`. For each diagonal in `[lo, hi]`, `offsets` holds 3 right
+     * offsets: the furthest a path of exactly this cost reaches along that diagonal in any state, ending in a right gap, and ending in a
+     * down gap. They're laid out as 3 consecutive blocks of `hi - lo + 1` offsets. A wavefront where `lo > hi` is empty (no path has
+     * exactly this cost).
+     *
+     * @tparam OFFSET_CONTAINER Offset container type.
+     */
+    template<typename OFFSET_CONTAINER>
+    struct wavefront {
+        /** Lowest diagonal. */
+        std::int64_t lo;
+        /** Highest diagonal. */
+        std::int64_t hi;
+        /** Right offsets, per state per diagonal. */
+        OFFSET_CONTAINER offsets;
+    };
+}
+
+#endif //OFFBYNULL_ALIGNER_BACKTRACKERS_WAVEFRONT_ALIGNMENT_BACKTRACKER_WAVEFRONT_H
@@ -107,6 +107,27 @@ namespace offbynull::aligner::graph::pairwise_alignment_graph {
             >;
         };
 
+    /**
+     * An @ref offbynull::aligner::graph::pairwise_alignment_graph::pairwise_alignment_graph where walking grid positions in row-major
+     * order (row by row, each row left-to-right, each position's nodes in the order returned by `grid_offset_to_nodes()`) is guaranteed
+     * to be a topological order over every node in the graph. That is, every edge's source node is at a grid position that's neither below
+     * nor to the right of its destination node's grid position, and if both are at the same grid position, the source node is returned
+     * earlier by `grid_offset_to_nodes()`. Because of this, walking the grid in rectangular tiles (tiles in row-major order, each tile's
+     * grid positions in row-major order) is also a topological order.
+     *
+     * `G` opts in by exposing a `static constexpr bool row_major_sweepable` set to `true`. Algorithms that need a topological walk (e.g.,
+     * backtrackers) can then visit nodes directly rather than tracking how many parents of each node remain unwalked.
+     *
+     * @tparam G Type to check.
+     */
+    template <typename G>
+    concept row_major_sweepable_pairwise_alignment_graph =
+        pairwise_alignment_graph<G>
+        && requires {
+            { G::row_major_sweepable } -> std::same_as<const bool&>;
+            requires G::row_major_sweepable;
+        };
+
     /**
      * Unimplemented @ref offbynull::aligner::graph::pairwise_alignment_graph::pairwise_alignment_graph, intended for
      * documentation.
@@ -159,6 +180,12 @@ namespace offbynull::aligner::graph::pairwise_alignment_graph {
         static constexpr N_INDEX grid_depth_cnt { I0 };
         /** Maximum number of resident nodes. */
         static constexpr std::size_t resident_nodes_capacity { 0zu };
+        /**
+         * Optional. `true` if walking grid positions in row-major order is a topological walk of this graph (see
+         * @ref offbynull::aligner::graph::pairwise_alignment_graph::row_major_sweepable_pairwise_alignment_graph). Omitting this member is
+         * the same as setting it to `false`.
+         */
+        static constexpr bool row_major_sweepable { false };
         /** Of all paths between root and leaf, the maximum number of edges. */
         const std::size_t path_edge_capacity;
         /** Of all nodes, the maximum in-degree. */
@@ -0,0 +1,432 @@
+#ifndef OFFBYNULL_ALIGNER_GRAPHS_BANDED_SLICEABLE_PAIRWISE_ALIGNMENT_GRAPH_H
+#define OFFBYNULL_ALIGNER_GRAPHS_BANDED_SLICEABLE_PAIRWISE_ALIGNMENT_GRAPH_H
+
+#include <cstddef>
+#include <ranges>
+#include <tuple>
+#include <utility>
+#include <optional>
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+#include "offbynull/aligner/graph/graph.h"
+#include "offbynull/aligner/graph/sliceable_pairwise_alignment_graph.h"
+#include "offbynull/aligner/concepts.h"
+#include "offbynull/helpers/filter_bidirectional_view.h"
+#include "offbynull/helpers/join_bidirectional_view.h"
+
+namespace offbynull::aligner::graphs::banded_sliceable_pairwise_alignment_graph {
+    using offbynull::aligner::graph::sliceable_pairwise_alignment_graph::sliceable_pairwise_alignment_graph;
+    using offbynull::aligner::concepts::weight;
+    using offbynull::concepts::bidirectional_range_of_non_cvref;
+    using offbynull::aligner::graph::graph::full_input_output_range;
+    using offbynull::helpers::filter_bidirectional_view::filter_bidirectional;
+    using offbynull::helpers::join_bidirectional_view::join_bidirectional;
+
+    /**
+     * View into an existing
+     * @ref offbynull::aligner::graph::sliceable_pairwise_alignment_graph::sliceable_pairwise_alignment_graph, where the view is
+     * isolated to the nodes within a diagonal band of the grid. A node at grid position `(down, right)` is within the band if
+     * `right - down` is within `[-band_down_extent, band_right_extent]`, meaning each row of the band spans at most
+     * `band_down_extent + band_right_extent + 1` columns.
+     *
+     * Paths that stray outside the band are hidden, so the maximally weighted path found within this view is only the maximally weighted
+     * path within the backing graph if that path stays within the band (e.g., the sequences being aligned are highly similar). In
+     * exchange, backtrackers only have to walk `O(grid_down_cnt * band_width)` nodes rather than `O(grid_down_cnt * grid_right_cnt)`
+     * nodes. Pair with the banded container creator packs (e.g.,
+     * @ref offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::backtracker_banded_container_creator_pack::backtracker_banded_container_creator_pack)
+     * to also limit memory to band-width storage per row.
+     *
+     * @tparam debug_mode `true` to enable debugging logic, `false` otherwise.
+     * @tparam G Backing graph type.
+     */
+    template<
+        bool debug_mode,
+        sliceable_pairwise_alignment_graph G
+    >
+    class banded_sliceable_pairwise_alignment_graph {
+    public:
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::N_INDEX */
+        using N_INDEX = typename G::N_INDEX;
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::N */
+        using N = typename G::N;
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::E */
+        using E = typename G::E;
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::ED */
+        using ED = typename G::ED;
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::ND */
+        using ND = typename G::ND;
+
+    private:
+        static constexpr N_INDEX I0 { static_cast<N_INDEX>(0zu) };
+        static constexpr N_INDEX I1 { static_cast<N_INDEX>(1zu) };
+
+        const G& g;
+
+        bool grid_offset_out_of_band(std::size_t down_offset, std::size_t right_offset) const {
+            return right_offset > down_offset + band_right_extent || down_offset > right_offset + band_down_extent;
+        }
+
+        bool node_out_of_band(const N& node) const {
+            const auto& [down_offset, right_offset, _] { g.node_to_grid_offset(node) };
+            return grid_offset_out_of_band(down_offset, right_offset);
+        }
+
+        bool edge_out_of_band(const E& edge) const {
+            return node_out_of_band(g.get_edge_from(edge)) || node_out_of_band(g.get_edge_to(edge));
+        }
+
+    public:
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::grid_down_cnt */
+        const N_INDEX grid_down_cnt;
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::grid_right_cnt */
+        const N_INDEX grid_right_cnt;
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::grid_depth_cnt */
+        static constexpr N_INDEX grid_depth_cnt { G::grid_depth_cnt };
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::resident_nodes_capacity */
+        const std::size_t resident_nodes_capacity;
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::path_edge_capacity */
+        const std::size_t path_edge_capacity;
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::node_incoming_edge_capacity */
+        const std::size_t node_incoming_edge_capacity;
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::node_outgoing_edge_capacity */
+        const std::size_t node_outgoing_edge_capacity;
+        /** Number of diagonals below the main diagonal that the band covers (how far `down` may run ahead of `right`). */
+        const std::size_t band_down_extent;
+        /** Number of diagonals above the main diagonal that the band covers (how far `right` may run ahead of `down`). */
+        const std::size_t band_right_extent;
+        /** Maximum number of grid columns covered by the band within any single row. */
+        const std::size_t band_width;
+
+        /**
+         * Construct an
+         * @ref offbynull::aligner::graphs::banded_sliceable_pairwise_alignment_graph::banded_sliceable_pairwise_alignment_graph instance.
+         *
+         * The behavior of this constructor / class is undefined if `g_`'s leaf node is outside of the band (no path exists from root to
+         * leaf).
+         *
+         * @param g_ Backing graph.
+         * @param band_down_extent_ Number of diagonals below the main diagonal to keep.
+         * @param band_right_extent_ Number of diagonals above the main diagonal to keep.
+         */
+        banded_sliceable_pairwise_alignment_graph(
+            const G& g_,
+            const std::size_t band_down_extent_,
+            const std::size_t band_right_extent_
+        )
+        : g { g_ }
+        , grid_down_cnt { g.grid_down_cnt }
+        , grid_right_cnt { g.grid_right_cnt }
+        , resident_nodes_capacity { g.resident_nodes_capacity }
+        , path_edge_capacity { g.path_edge_capacity }
+        , node_incoming_edge_capacity { g.node_incoming_edge_capacity }
+        , node_outgoing_edge_capacity { g.node_outgoing_edge_capacity }
+        , band_down_extent { band_down_extent_ }
+        , band_right_extent { band_right_extent_ }
+        , band_width {
+            std::min(
+                std::min(band_down_extent, static_cast<std::size_t>(grid_right_cnt))
+                    + std::min(band_right_extent, static_cast<std::size_t>(grid_right_cnt))
+                    + 1zu,
+                static_cast<std::size_t>(grid_right_cnt)
+            )
+        } {
+            if constexpr (debug_mode) {
+                if (node_out_of_band(g.get_root_node()) || node_out_of_band(g.get_leaf_node())) {
+                    throw std::runtime_error { "Root / leaf node outside of band" };
+                }
+            }
+        }
+
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::get_node_data */
+        ND get_node_data(const N& n) const {
+            if constexpr (debug_mode) {
+                if (!has_node(n)) {
+                    throw std::runtime_error { "Node doesn't exist" };
+                }
+            }
+            return g.get_node_data(n);
+        }
+
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::get_edge_data */
+        ED get_edge_data(const E& e) const {
+            if constexpr (debug_mode) {
+                if (!has_edge(e)) {
+                    throw std::runtime_error { "Edge doesn't exist" };
+                }
+            }
+            return g.get_edge_data(e);
+        }
+
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::get_edge_from */
+        N get_edge_from(const E& e) const {
+            if constexpr (debug_mode) {
+                if (!has_edge(e)) {
+                    throw std::runtime_error { "Edge doesn't exist" };
+                }
+            }
+            return g.get_edge_from(e);
+        }
+
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::get_edge_to */
+        N get_edge_to(const E& e) const {
+            if constexpr (debug_mode) {
+                if (!has_edge(e)) {
+                    throw std::runtime_error { "Edge doesn't exist" };
+                }
+            }
+            return g.get_edge_to(e);
+        }
+
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::get_edge */
+        std::tuple<N, N, ED> get_edge(const E& e) const {
+            if constexpr (debug_mode) {
+                if (!has_edge(e)) {
+                    throw std::runtime_error { "Edge doesn't exist" };
+                }
+            }
+            return g.get_edge(e);
+        }
+
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::get_root_nodes */
+        bidirectional_range_of_non_cvref<N> auto get_root_nodes() const {
+            return g.get_root_nodes();
+        }
+
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::get_root_node */
+        N get_root_node() const {
+            return g.get_root_node();
+        }
+
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::get_leaf_nodes */
+        bidirectional_range_of_non_cvref<N> auto get_leaf_nodes() const {
+            return g.get_leaf_nodes();
+        }
+
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::get_leaf_node */
+        N get_leaf_node() const {
+            return g.get_leaf_node();
+        }
+
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::get_nodes */
+        bidirectional_range_of_non_cvref<N> auto get_nodes() const {
+            // Walk the band row-by-row rather than filtering all of g's nodes, otherwise listing nodes would still be O(nm).
+            return std::views::iota(I0, grid_down_cnt)
+                | std::views::transform([this](const N_INDEX grid_down) { return row_nodes(grid_down); })
+                | join_bidirectional();
+        }
+
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::get_edges */
+        bidirectional_range_of_non_cvref<E> auto get_edges() const {
+            return g.get_edges()
+                | filter_bidirectional([this](const E& edge) { return !edge_out_of_band(edge); });
+        }
+
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::has_node */
+        bool has_node(const N& n) const {
+            return g.has_node(n) && !node_out_of_band(n);
+        }
+
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::has_edge */
+        bool has_edge(const E& e) const {
+            return g.has_edge(e) && !edge_out_of_band(e);
+        }
+
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::get_outputs_full */
+        full_input_output_range<N, E, ED> auto get_outputs_full(const N& n) const {
+            if constexpr (debug_mode) {
+                if (!has_node(n)) {
+                    throw std::runtime_error { "Node doesn't exist" };
+                }
+            }
+            return g.get_outputs_full(n)
+                | filter_bidirectional([this](const auto& vals) { return !node_out_of_band(std::get<2zu>(vals)); });
+        }
+
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::get_inputs_full */
+        full_input_output_range<N, E, ED> auto get_inputs_full(const N& n) const {
+            if constexpr (debug_mode) {
+                if (!has_node(n)) {
+                    throw std::runtime_error { "Node doesn't exist" };
+                }
+            }
+            return g.get_inputs_full(n)
+                | filter_bidirectional([this](const auto& vals) { return !node_out_of_band(std::get<1zu>(vals)); });
+        }
+
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::get_outputs */
+        bidirectional_range_of_non_cvref<E> auto get_outputs(const N& n) const {
+            if constexpr (debug_mode) {
+                if (!has_node(n)) {
+                    throw std::runtime_error { "Node doesn't exist" };
+                }
+            }
+            return g.get_outputs(n)
+                | filter_bidirectional([this](const E& edge) { return !node_out_of_band(g.get_edge_to(edge)); });
+        }
+
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::get_inputs */
+        bidirectional_range_of_non_cvref<E> auto get_inputs(const N& n) const {
+            if constexpr (debug_mode) {
+                if (!has_node(n)) {
+                    throw std::runtime_error { "Node doesn't exist" };
+                }
+            }
+            return g.get_inputs(n)
+                | filter_bidirectional([this](const E& edge) { return !node_out_of_band(g.get_edge_from(edge)); });
+        }
+
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::has_outputs */
+        bool has_outputs(const N& n) const {
+            if constexpr (debug_mode) {
+                if (!has_node(n)) {
+                    throw std::runtime_error { "Node doesn't exist" };
+                }
+            }
+            return get_out_degree(n) > 0zu;
+        }
+
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::has_inputs */
+        bool has_inputs(const N& n) const {
+            if constexpr (debug_mode) {
+                if (!has_node(n)) {
+                    throw std::runtime_error { "Node doesn't exist" };
+                }
+            }
+            return get_in_degree(n) > 0zu;
+        }
+
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::get_out_degree */
+        std::size_t get_out_degree(const N& n) const {
+            if constexpr (debug_mode) {
+                if (!has_node(n)) {
+                    throw std::runtime_error { "Node doesn't exist" };
+                }
+            }
+            auto outputs { std::views::common(get_outputs(n)) };
+            auto dist { std::ranges::distance(outputs) };
+            return static_cast<std::size_t>(dist);
+        }
+
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::get_in_degree */
+        std::size_t get_in_degree(const N& n) const {
+            if constexpr (debug_mode) {
+                if (!has_node(n)) {
+                    throw std::runtime_error { "Node doesn't exist" };
+                }
+            }
+            auto inputs { std::views::common(get_inputs(n)) };
+            auto dist { std::ranges::distance(inputs) };
+            return static_cast<std::size_t>(dist);
+        }
+
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::edge_to_element_offsets */
+        std::optional<std::pair<std::optional<N_INDEX>, std::optional<N_INDEX>>> edge_to_element_offsets(
+            const E& e
+        ) const {
+            return g.edge_to_element_offsets(e);
+        }
+
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::node_to_grid_offset */
+        std::tuple<N_INDEX, N_INDEX, std::size_t> node_to_grid_offset(const N& n) const {
+            return g.node_to_grid_offset(n);
+        }
+
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::grid_offset_to_nodes */
+        bidirectional_range_of_non_cvref<N> auto grid_offset_to_nodes(N_INDEX grid_down, N_INDEX grid_right) const {
+            if constexpr (debug_mode) {
+                if (grid_down >= grid_down_cnt || grid_right >= grid_right_cnt) {
+                    throw std::runtime_error { "Out of bounds" };
+                }
+            }
+            const bool out_of_band { grid_offset_out_of_band(grid_down, grid_right) };
+            return g.grid_offset_to_nodes(grid_down, grid_right)
+                | filter_bidirectional([out_of_band](const N&) { return !out_of_band; });
+        }
+
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::row_nodes */
+        bidirectional_range_of_non_cvref<N> auto row_nodes(N_INDEX grid_down) const {
+            return row_nodes(grid_down, g.get_root_node(), g.get_leaf_node());
+        }
+
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::row_nodes */
+        bidirectional_range_of_non_cvref<N> auto row_nodes(N_INDEX grid_down, const N& root_node, const N& leaf_node) const {
+            if constexpr (debug_mode) {
+                if (!has_node(root_node) || !has_node(leaf_node)) {
+                    throw std::runtime_error { "Node doesn't exist" };
+                }
+            }
+            // Only walk the columns that the band covers in this row, as opposed to walking the entire row and filtering.
+            const std::size_t band_right_first { grid_down > band_down_extent ? grid_down - band_down_extent : 0zu };
+            const std::size_t band_right_last { grid_down + band_right_extent };
+            const std::size_t root_right { std::get<1zu>(g.node_to_grid_offset(root_node)) };
+            const std::size_t leaf_right { std::get<1zu>(g.node_to_grid_offset(leaf_node)) };
+            const N_INDEX right_first { static_cast<N_INDEX>(std::max(root_right, band_right_first)) };
+            const N_INDEX right_end {
+                static_cast<N_INDEX>(std::max(std::min(leaf_right, band_right_last) + 1zu, static_cast<std::size_t>(right_first)))
+            };
+            return std::views::iota(right_first, right_end)
+                | std::views::transform([this, grid_down](const N_INDEX grid_right) {
+                    return g.grid_offset_to_nodes(grid_down, grid_right);
+                })
+                | join_bidirectional()
+                | filter_bidirectional([this, root_node, leaf_node](const N& node) {
+                    return g.is_reachable(root_node, node) && g.is_reachable(node, leaf_node);
+                });
+        }
+
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::is_reachable */
+        bool is_reachable(const N& n1, const N& n2) const {
+            if constexpr (debug_mode) {
+                if (!has_node(n1) || !has_node(n2)) {
+                    throw std::runtime_error { "Node doesn't exist" };
+                }
+            }
+            // Any path through the backing grid between two nodes within the band can be shifted to stay within the band.
+            return g.is_reachable(n1, n2);
+        }
+
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::resident_nodes */
+        bidirectional_range_of_non_cvref<N> auto resident_nodes() const {
+            return g.resident_nodes()
+                | filter_bidirectional([this](const N& node) { return !node_out_of_band(node); });
+        }
+
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::outputs_to_residents */
+        bidirectional_range_of_non_cvref<E> auto outputs_to_residents(const N& n) const {
+            return g.outputs_to_residents(n)
+                | filter_bidirectional([this](const E& edge) { return !edge_out_of_band(edge); });
+        }
+
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::inputs_from_residents */
+        bidirectional_range_of_non_cvref<E> auto inputs_from_residents(const N& n) const {
+            return g.inputs_from_residents(n)
+                | filter_bidirectional([this](const E& edge) { return !edge_out_of_band(edge); });
+        }
+    };
+
+
+    /**
+     * Create @ref offbynull::aligner::graphs::banded_sliceable_pairwise_alignment_graph::banded_sliceable_pairwise_alignment_graph
+     * instance, where template parameters are deduced / inferred from arguments passed in.
+     *
+     * @tparam debug_mode `true` to enable debugging logic, `false` otherwise.
+     * @param g Backing graph.
+     * @param band_down_extent Number of diagonals below the main diagonal to keep.
+     * @param band_right_extent Number of diagonals above the main diagonal to keep.
+     * @return New @ref offbynull::aligner::graphs::banded_sliceable_pairwise_alignment_graph::banded_sliceable_pairwise_alignment_graph
+     *     instance.
+     */
+    template<
+        bool debug_mode
+    >
+    auto create_banded_sliceable_pairwise_alignment_graph(
+        const sliceable_pairwise_alignment_graph auto& g,
+        const std::size_t band_down_extent,
+        const std::size_t band_right_extent
+    ) {
+        using G = std::remove_cvref_t<decltype(g)>;
+        return banded_sliceable_pairwise_alignment_graph<debug_mode, G> { g, band_down_extent, band_right_extent };
+    }
+}
+#endif //OFFBYNULL_ALIGNER_GRAPHS_BANDED_SLICEABLE_PAIRWISE_ALIGNMENT_GRAPH_H
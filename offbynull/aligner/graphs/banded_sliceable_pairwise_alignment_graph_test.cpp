@@ -0,0 +1,243 @@
+#include <cstddef>
+#include <stdfloat>
+#include <string>
+#include <set>
+#include <vector>
+#include <type_traits>
+#include "offbynull/aligner/graph/sliceable_pairwise_alignment_graph.h"
+#include "offbynull/aligner/graph/pairwise_alignment_graph.h"
+#include "offbynull/aligner/graphs/pairwise_global_alignment_graph.h"
+#include "offbynull/aligner/graphs/banded_sliceable_pairwise_alignment_graph.h"
+#include "offbynull/aligner/scorers/simple_scorer.h"
+#include "offbynull/utils.h"
+#include "gtest/gtest.h"
+
+namespace {
+    using offbynull::aligner::graphs::pairwise_global_alignment_graph::pairwise_global_alignment_graph;
+    using offbynull::aligner::graphs::banded_sliceable_pairwise_alignment_graph::banded_sliceable_pairwise_alignment_graph;
+    using offbynull::aligner::graphs::banded_sliceable_pairwise_alignment_graph::create_banded_sliceable_pairwise_alignment_graph;
+    using offbynull::aligner::scorers::simple_scorer::simple_scorer;
+    using offbynull::utils::copy_to_vector;
+    using offbynull::utils::copy_to_set;
+    using offbynull::utils::is_debug_mode;
+
+    auto substitution_scorer {
+        simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_substitution(1.0f64, -1.0f64)
+    };
+    auto gap_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_gap(0.0f64) };
+
+    struct graph_bundle {
+        std::string down_seq;
+        std::string right_seq;
+        pairwise_global_alignment_graph<
+            is_debug_mode(),
+            std::size_t,
+            std::float64_t,
+            std::string,
+            std::string,
+            decltype(substitution_scorer),
+            decltype(gap_scorer)
+        > backing_g;
+        banded_sliceable_pairwise_alignment_graph<is_debug_mode(), decltype(backing_g)> banded_g;
+
+        graph_bundle(
+            std::string down_seq_,
+            std::string right_seq_,
+            std::size_t band_down_extent,
+            std::size_t band_right_extent
+        )
+        : down_seq { down_seq_ }
+        , right_seq { right_seq_ }
+        , backing_g {
+            down_seq,
+            right_seq,
+            substitution_scorer,
+            gap_scorer
+        }
+        , banded_g { backing_g, band_down_extent, band_right_extent } {}
+    };
+
+    TEST(OAGBandedSliceablePairwiseAlignmentGraphTest, ConceptCheck) {
+        using G = decltype(graph_bundle { "ab", "ab", 1zu, 1zu }.banded_g);
+        static_assert(offbynull::aligner::graph::graph::graph<G>);
+        static_assert(offbynull::aligner::graph::pairwise_alignment_graph::pairwise_alignment_graph<G>);
+        static_assert(offbynull::aligner::graph::sliceable_pairwise_alignment_graph::sliceable_pairwise_alignment_graph<G>);
+    }
+
+    TEST(OAGBandedSliceablePairwiseAlignmentGraphTest, BandWidth) {
+        EXPECT_EQ((graph_bundle { "abcdef", "abcdef", 1zu, 1zu }.banded_g.band_width), 3zu);
+        EXPECT_EQ((graph_bundle { "abcdef", "abcdef", 2zu, 1zu }.banded_g.band_width), 4zu);
+        EXPECT_EQ((graph_bundle { "ab", "ab", 5zu, 5zu }.banded_g.band_width), 3zu);
+    }
+
+    TEST(OAGBandedSliceablePairwiseAlignmentGraphTest, ListNodes) {
+        graph_bundle g_bundle { "ab", "ab", 1zu, 1zu };
+        auto g { g_bundle.banded_g };
+
+        using N = typename decltype(g)::N;
+
+        EXPECT_EQ(
+            copy_to_set(g.get_nodes()),
+            (std::set {
+                N { 0zu, 0zu }, N { 0zu, 1zu },
+                N { 1zu, 0zu }, N { 1zu, 1zu }, N { 1zu, 2zu },
+                N { 2zu, 1zu }, N { 2zu, 2zu }
+            })
+        );
+    }
+
+    TEST(OAGBandedSliceablePairwiseAlignmentGraphTest, ListEdges) {
+        graph_bundle g_bundle { "ab", "ab", 1zu, 1zu };
+        auto g { g_bundle.banded_g };
+
+        using N = typename decltype(g)::N;
+        using E = typename decltype(g)::E;
+
+        EXPECT_EQ(
+            copy_to_set(g.get_edges()),
+            (std::set<E> {
+                E { N { 0zu, 0zu }, N { 0zu, 1zu } },
+                E { N { 1zu, 0zu }, N { 1zu, 1zu } },
+                E { N { 1zu, 1zu }, N { 1zu, 2zu } },
+                E { N { 2zu, 1zu }, N { 2zu, 2zu } },
+                E { N { 0zu, 0zu }, N { 1zu, 0zu } },
+                E { N { 0zu, 1zu }, N { 1zu, 1zu } },
+                E { N { 1zu, 1zu }, N { 2zu, 1zu } },
+                E { N { 1zu, 2zu }, N { 2zu, 2zu } },
+                E { N { 0zu, 0zu }, N { 1zu, 1zu } },
+                E { N { 0zu, 1zu }, N { 1zu, 2zu } },
+                E { N { 1zu, 0zu }, N { 2zu, 1zu } },
+                E { N { 1zu, 1zu }, N { 2zu, 2zu } }
+            })
+        );
+    }
+
+    TEST(OAGBandedSliceablePairwiseAlignmentGraphTest, NodesExist) {
+        graph_bundle g_bundle { "ab", "ab", 1zu, 1zu };
+        auto g { g_bundle.banded_g };
+
+        using N = typename decltype(g)::N;
+
+        EXPECT_TRUE(g.has_node(N { 0zu, 0zu }));
+        EXPECT_TRUE(g.has_node(N { 0zu, 1zu }));
+        EXPECT_FALSE(g.has_node(N { 0zu, 2zu }));
+        EXPECT_TRUE(g.has_node(N { 1zu, 0zu }));
+        EXPECT_TRUE(g.has_node(N { 1zu, 1zu }));
+        EXPECT_TRUE(g.has_node(N { 1zu, 2zu }));
+        EXPECT_FALSE(g.has_node(N { 2zu, 0zu }));
+        EXPECT_TRUE(g.has_node(N { 2zu, 1zu }));
+        EXPECT_TRUE(g.has_node(N { 2zu, 2zu }));
+        EXPECT_FALSE(g.has_node(N { 3zu, 3zu }));
+    }
+
+    TEST(OAGBandedSliceablePairwiseAlignmentGraphTest, EdgesExist) {
+        graph_bundle g_bundle { "ab", "ab", 1zu, 1zu };
+        auto g { g_bundle.banded_g };
+
+        using N = typename decltype(g)::N;
+        using E = typename decltype(g)::E;
+
+        EXPECT_TRUE(g.has_edge(E { N { 0zu, 0zu }, N { 0zu, 1zu } }));
+        EXPECT_FALSE(g.has_edge(E { N { 0zu, 1zu }, N { 0zu, 2zu } }));
+        EXPECT_TRUE(g.has_edge(E { N { 1zu, 0zu }, N { 2zu, 1zu } }));
+        EXPECT_FALSE(g.has_edge(E { N { 1zu, 0zu }, N { 2zu, 0zu } }));
+        EXPECT_FALSE(g.has_edge(E { N { 0zu, 2zu }, N { 1zu, 2zu } }));
+    }
+
+    TEST(OAGBandedSliceablePairwiseAlignmentGraphTest, GetOutputs) {
+        graph_bundle g_bundle { "ab", "ab", 1zu, 1zu };
+        auto g { g_bundle.banded_g };
+
+        using N = typename decltype(g)::N;
+        using E = typename decltype(g)::E;
+
+        EXPECT_EQ(
+            copy_to_set(g.get_outputs(N { 0zu, 1zu })),
+            (std::set<E> {
+                E { N { 0zu, 1zu }, N { 1zu, 1zu } },
+                E { N { 0zu, 1zu }, N { 1zu, 2zu } }
+            })
+        );
+        EXPECT_EQ(
+            copy_to_set(g.get_outputs(N { 1zu, 0zu })),
+            (std::set<E> {
+                E { N { 1zu, 0zu }, N { 1zu, 1zu } },
+                E { N { 1zu, 0zu }, N { 2zu, 1zu } }
+            })
+        );
+        EXPECT_EQ(g.get_out_degree(N { 0zu, 1zu }), 2zu);
+        EXPECT_EQ(g.get_out_degree(N { 2zu, 2zu }), 0zu);
+        EXPECT_FALSE(g.has_outputs(N { 2zu, 2zu }));
+    }
+
+    TEST(OAGBandedSliceablePairwiseAlignmentGraphTest, GetInputs) {
+        graph_bundle g_bundle { "ab", "ab", 1zu, 1zu };
+        auto g { g_bundle.banded_g };
+
+        using N = typename decltype(g)::N;
+        using E = typename decltype(g)::E;
+
+        EXPECT_EQ(
+            copy_to_set(g.get_inputs(N { 1zu, 2zu })),
+            (std::set<E> {
+                E { N { 1zu, 1zu }, N { 1zu, 2zu } },
+                E { N { 0zu, 1zu }, N { 1zu, 2zu } }
+            })
+        );
+        EXPECT_EQ(
+            copy_to_set(g.get_inputs(N { 2zu, 1zu })),
+            (std::set<E> {
+                E { N { 1zu, 1zu }, N { 2zu, 1zu } },
+                E { N { 1zu, 0zu }, N { 2zu, 1zu } }
+            })
+        );
+        EXPECT_EQ(g.get_in_degree(N { 1zu, 2zu }), 2zu);
+        EXPECT_EQ(g.get_in_degree(N { 0zu, 0zu }), 0zu);
+        EXPECT_FALSE(g.has_inputs(N { 0zu, 0zu }));
+    }
+
+    TEST(OAGBandedSliceablePairwiseAlignmentGraphTest, RowWalk) {
+        graph_bundle g_bundle { "abc", "abc", 1zu, 0zu };
+        auto g { g_bundle.banded_g };
+
+        using N = typename decltype(g)::N;
+
+        EXPECT_EQ(
+            copy_to_vector(g.row_nodes(0u)),
+            (std::vector<N> {
+                N { 0zu, 0zu }
+            })
+        );
+        EXPECT_EQ(
+            copy_to_vector(g.row_nodes(2u)),
+            (std::vector<N> {
+                N { 2zu, 1zu },
+                N { 2zu, 2zu }
+            })
+        );
+        EXPECT_EQ(
+            copy_to_vector(g.row_nodes(3u, N { 1zu, 1zu }, N { 3zu, 3zu })),
+            (std::vector<N> {
+                N { 3zu, 2zu },
+                N { 3zu, 3zu }
+            })
+        );
+        EXPECT_EQ(
+            copy_to_vector(g.row_nodes(2u, N { 1zu, 1zu }, N { 2zu, 1zu })),
+            (std::vector<N> {
+                N { 2zu, 1zu }
+            })
+        );
+        EXPECT_EQ(
+            copy_to_vector(g.grid_offset_to_nodes(1u, 3u)),
+            (std::vector<N> {})
+        );
+    }
+
+    TEST(OAGBandedSliceablePairwiseAlignmentGraphTest, CreateViaFactory) {
+        graph_bundle g_bundle { "ab", "ab", 1zu, 1zu };
+        auto g1 { g_bundle.banded_g };
+        auto g2 { create_banded_sliceable_pairwise_alignment_graph<is_debug_mode()>(g_bundle.backing_g, 1zu, 1zu) };
+        EXPECT_TRUE((std::is_same_v<decltype(g1), decltype(g2)>));
+    }
+}
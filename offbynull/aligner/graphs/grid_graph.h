@@ -164,6 +164,8 @@ namespace offbynull::aligner::graphs::grid_graph {
         static constexpr N_INDEX grid_depth_cnt { I1 };
         /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::resident_nodes_capacity */
         static constexpr std::size_t resident_nodes_capacity { 0zu };
+        /** @copydoc offbynull::aligner::graph::pairwise_alignment_graph::unimplemented_pairwise_alignment_graph::row_major_sweepable */
+        static constexpr bool row_major_sweepable { true };
         /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::path_edge_capacity */
         const std::size_t path_edge_capacity;
         /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::node_incoming_edge_capacity */
@@ -373,6 +375,21 @@ namespace offbynull::aligner::graphs::grid_graph {
 
         /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::get_outputs_full */
         full_input_output_range<N, E, ED> auto get_outputs_full(const N& n) const {
+            return this->get_outputs(n)
+                | std::views::transform([this](const E& e) { return this->construct_full_edge(e.source, e.destination); });
+        }
+
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::get_inputs_full */
+        full_input_output_range<N, E, ED> auto get_inputs_full(const N& n) const {
+            return this->get_inputs(n)
+                | std::views::transform([this](const E& e) { return this->construct_full_edge(e.source, e.destination); });
+        }
+
+        // Edges are enumerated directly rather than projected out of get_outputs_full() / get_inputs_full(), such that walking a node's
+        // edges doesn't invoke the scorers.
+
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::get_outputs */
+        bidirectional_range_of_non_cvref<E> auto get_outputs(const N& n) const {
             if constexpr (debug_mode) {
                 if (!has_node(n)) {
                     throw std::runtime_error { "Node doesn't exist" };
@@ -396,19 +413,19 @@ namespace offbynull::aligner::graphs::grid_graph {
                     }
                     return true;
                 })
-                | std::views::transform([node = n, this](const auto& offset) {
+                | std::views::transform([node = n](const auto& offset) -> E {
                     const auto& [down_offset, right_offset] { offset };
                     const auto& [grid_down, grid_right] { node };
                     N n2 {
                         static_cast<N_INDEX>(grid_down + down_offset),  // Cast to prevent narrowing warning
                         static_cast<N_INDEX>(grid_right + right_offset)  // Cast to prevent narrowing warning
                     };
-                    return this->construct_full_edge(node, n2);
+                    return E { node, n2 };
                 });
         }
 
-        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::get_inputs_full */
-        full_input_output_range<N, E, ED> auto get_inputs_full(const N& n) const {
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::get_inputs */
+        bidirectional_range_of_non_cvref<E> auto get_inputs(const N& n) const {
             if constexpr (debug_mode) {
                 if (!has_node(n)) {
                     throw std::runtime_error { "Node doesn't exist" };
@@ -420,7 +437,7 @@ namespace offbynull::aligner::graphs::grid_graph {
                     std::views::iota(I0, I2)
                 )
                 | std::views::drop(1zu)
-                | filter_bidirectional([node = n, this](const auto& offset) {
+                | filter_bidirectional([node = n](const auto& offset) {
                     const auto& [down_offset, right_offset] { offset };
                     const auto& [grid_down, grid_right] { node };
                     if (down_offset == I1 && grid_down == I0) {
@@ -431,39 +448,17 @@ namespace offbynull::aligner::graphs::grid_graph {
                     }
                     return true;
                 })
-                | std::views::transform([node = n, this](const auto& offset) {
+                | std::views::transform([node = n](const auto& offset) -> E {
                     const auto& [down_offset, right_offset] { offset };
                     const auto& [grid_down, grid_right] { node };
                     N n1 {
                         static_cast<N_INDEX>(grid_down - down_offset),  // Cast to prevent narrowing warning
                         static_cast<N_INDEX>(grid_right - right_offset)  // Cast to prevent narrowing warning
                     };
-                    return this->construct_full_edge(n1, node);
+                    return E { n1, node };
                 });
         }
 
-        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::get_outputs */
-        bidirectional_range_of_non_cvref<E> auto get_outputs(const N& n) const {
-            if constexpr (debug_mode) {
-                if (!has_node(n)) {
-                    throw std::runtime_error { "Node doesn't exist" };
-                }
-            }
-            return this->get_outputs_full(n)
-                | std::views::transform([](const auto& v) -> E { return std::get<0zu>(v); });
-        }
-
-        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::get_inputs */
-        bidirectional_range_of_non_cvref<E> auto get_inputs(const N& n) const {
-            if constexpr (debug_mode) {
-                if (!has_node(n)) {
-                    throw std::runtime_error { "Node doesn't exist" };
-                }
-            }
-            return this->get_inputs_full(n)
-                | std::views::transform([](const auto& v) -> E { return std::get<0zu>(v); });
-        }
-
         /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::has_outputs */
         bool has_outputs(const N& n) const {
             if constexpr (debug_mode) {
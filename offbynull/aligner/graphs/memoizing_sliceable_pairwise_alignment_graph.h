@@ -0,0 +1,327 @@
+#ifndef OFFBYNULL_ALIGNER_GRAPHS_MEMOIZING_SLICEABLE_PAIRWISE_ALIGNMENT_GRAPH_H
+#define OFFBYNULL_ALIGNER_GRAPHS_MEMOIZING_SLICEABLE_PAIRWISE_ALIGNMENT_GRAPH_H
+
+#include <cstddef>
+#include <utility>
+#include <tuple>
+#include <optional>
+#include <ranges>
+#include <vector>
+#include <algorithm>
+#include <type_traits>
+#include <stdexcept>
+#include "offbynull/aligner/graph/graph.h"
+#include "offbynull/aligner/graph/pairwise_alignment_graph.h"
+#include "offbynull/aligner/graph/sliceable_pairwise_alignment_graph.h"
+#include "offbynull/aligner/concepts.h"
+#include "offbynull/utils.h"
+
+namespace offbynull::aligner::graphs::memoizing_sliceable_pairwise_alignment_graph {
+    using offbynull::aligner::graph::sliceable_pairwise_alignment_graph::sliceable_pairwise_alignment_graph;
+    using offbynull::aligner::graph::pairwise_alignment_graph::row_major_sweepable_pairwise_alignment_graph;
+    using offbynull::aligner::concepts::weight;
+    using offbynull::concepts::bidirectional_range_of_non_cvref;
+    using offbynull::aligner::graph::graph::full_input_output_range;
+    using offbynull::utils::check_multiplication_nonoverflow_throwable;
+
+    /**
+     * View into an existing
+     * @ref offbynull::aligner::graph::sliceable_pairwise_alignment_graph::sliceable_pairwise_alignment_graph, where the view
+     * remembers edge weights it has already computed such that they don't need to be computed again (e.g., re-invoking an expensive
+     * scorer). Algorithms such as sliced subdivision walk the same portions of a graph many times over (once per recursion level), so
+     * scoring can end up dominating runtime if the backing graph's scorers are expensive.
+     *
+     * The cache is bounded. It's direct-mapped and keyed by grid offset: An edge's cache entry is picked by its destination node's grid
+     * offset (row wrapped around the number of cached rows) and its source node's grid offset relative to that destination. A walk that
+     * progresses row-by-row therefore keeps the most recently walked rows cached, and if the number of cached rows is at least the
+     * number of rows in the graph, each edge between neighbouring grid positions is scored at most once. Edges that span more than one
+     * grid position (e.g., free rides to/from resident nodes) may share entries and evict one another, in which case they're re-scored.
+     * Evictions never change results, only how many times an edge gets scored.
+     *
+     * Edges are enumerated through the backing graph's `get_inputs()` / `get_outputs()`, so the savings depend on those functions not
+     * computing edge weights themselves.
+     *
+     * Because the cache is updated from `const` member functions, instances of this class aren't safe to access concurrently.
+     *
+     * @tparam debug_mode `true` to enable debugging logic, `false` otherwise.
+     * @tparam G Backing graph type.
+     */
+    template<
+        bool debug_mode,
+        sliceable_pairwise_alignment_graph G
+    >
+    class memoizing_sliceable_pairwise_alignment_graph {
+    public:
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::N_INDEX */
+        using N_INDEX = typename G::N_INDEX;
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::N */
+        using N = typename G::N;
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::E */
+        using E = typename G::E;
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::ED */
+        using ED = typename G::ED;
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::ND */
+        using ND = typename G::ND;
+
+    private:
+        // Each destination node has one entry per source layer for each of the 4 source positions (same position, one up, one left, one
+        // up-left). Sources further away share these entries.
+        static constexpr std::size_t entries_per_node { 4zu * G::grid_depth_cnt };
+
+        const G& g;
+        const std::size_t cached_rows;
+        mutable std::vector<std::optional<std::pair<E, ED>>> cache;
+
+        std::size_t to_cache_idx(const E& e) const {
+            const auto& [from_down, from_right, from_depth] { g.node_to_grid_offset(g.get_edge_from(e)) };
+            const auto& [to_down, to_right, to_depth] { g.node_to_grid_offset(g.get_edge_to(e)) };
+            const std::size_t down_step { from_down == to_down ? 0zu : 1zu };
+            const std::size_t right_step { from_right == to_right ? 0zu : 1zu };
+            const std::size_t node_idx {
+                ((static_cast<std::size_t>(to_down) % cached_rows) * grid_right_cnt + to_right) * grid_depth_cnt + to_depth
+            };
+            return node_idx * entries_per_node + (down_step * 2zu + right_step) * grid_depth_cnt + from_depth;
+        }
+
+    public:
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::grid_down_cnt */
+        const N_INDEX grid_down_cnt;
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::grid_right_cnt */
+        const N_INDEX grid_right_cnt;
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::grid_depth_cnt */
+        static constexpr N_INDEX grid_depth_cnt { G::grid_depth_cnt };
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::resident_nodes_capacity */
+        const std::size_t resident_nodes_capacity;
+        /** @copydoc offbynull::aligner::graph::pairwise_alignment_graph::unimplemented_pairwise_alignment_graph::row_major_sweepable */
+        static constexpr bool row_major_sweepable { row_major_sweepable_pairwise_alignment_graph<G> };
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::path_edge_capacity */
+        const std::size_t path_edge_capacity;
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::node_incoming_edge_capacity */
+        const std::size_t node_incoming_edge_capacity;
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::node_outgoing_edge_capacity */
+        const std::size_t node_outgoing_edge_capacity;
+
+        /**
+         * Construct an
+         * @ref offbynull::aligner::graphs::memoizing_sliceable_pairwise_alignment_graph::memoizing_sliceable_pairwise_alignment_graph
+         * instance.
+         *
+         * @param g_ Backing graph.
+         * @param cached_rows_ Number of grid rows to cache edge weights for (clamped to `[1, g_.grid_down_cnt]`). The cache holds
+         *     `cached_rows_ * g_.grid_right_cnt * g_.grid_depth_cnt * 4 * g_.grid_depth_cnt` entries.
+         * @throws std::runtime_error If debug mode is enabled and the number of cache entries overflows `std::size_t`.
+         */
+        memoizing_sliceable_pairwise_alignment_graph(const G& g_, std::size_t cached_rows_)
+        : g { g_ }
+        , cached_rows { std::max(1zu, std::min(cached_rows_, static_cast<std::size_t>(g_.grid_down_cnt))) }
+        , cache {}
+        , grid_down_cnt { g.grid_down_cnt }
+        , grid_right_cnt { g.grid_right_cnt }
+        , resident_nodes_capacity { g.resident_nodes_capacity }
+        , path_edge_capacity { g.path_edge_capacity }
+        , node_incoming_edge_capacity { g.node_incoming_edge_capacity }
+        , node_outgoing_edge_capacity { g.node_outgoing_edge_capacity } {
+            if constexpr (debug_mode) {
+                check_multiplication_nonoverflow_throwable<std::size_t>(
+                    cached_rows,
+                    static_cast<std::size_t>(grid_right_cnt),
+                    static_cast<std::size_t>(grid_depth_cnt),
+                    entries_per_node
+                );
+            }
+            cache.resize(cached_rows * grid_right_cnt * grid_depth_cnt * entries_per_node);
+        }
+
+        memoizing_sliceable_pairwise_alignment_graph(G&&, std::size_t) = delete; // No rvalues
+        memoizing_sliceable_pairwise_alignment_graph(const G&&, std::size_t) = delete; // No rvalues, even if a const
+
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::get_node_data */
+        ND get_node_data(const N& n) const {
+            return g.get_node_data(n);
+        }
+
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::get_edge_data */
+        ED get_edge_data(const E& e) const {
+            std::optional<std::pair<E, ED>>& entry { cache[to_cache_idx(e)] };
+            if (entry.has_value() && (*entry).first == e) {
+                return (*entry).second;
+            }
+            ED ret { g.get_edge_data(e) };
+            entry = { e, ret };
+            return ret;
+        }
+
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::get_edge_from */
+        N get_edge_from(const E& e) const {
+            return g.get_edge_from(e);
+        }
+
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::get_edge_to */
+        N get_edge_to(const E& e) const {
+            return g.get_edge_to(e);
+        }
+
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::get_edge */
+        std::tuple<N, N, ED> get_edge(const E& e) const {
+            return { g.get_edge_from(e), g.get_edge_to(e), get_edge_data(e) };
+        }
+
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::get_root_nodes */
+        bidirectional_range_of_non_cvref<N> auto get_root_nodes() const {
+            return g.get_root_nodes();
+        }
+
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::get_root_node */
+        N get_root_node() const {
+            return g.get_root_node();
+        }
+
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::get_leaf_nodes */
+        bidirectional_range_of_non_cvref<N> auto get_leaf_nodes() const {
+            return g.get_leaf_nodes();
+        }
+
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::get_leaf_node */
+        N get_leaf_node() const {
+            return g.get_leaf_node();
+        }
+
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::get_nodes */
+        bidirectional_range_of_non_cvref<N> auto get_nodes() const {
+            return g.get_nodes();
+        }
+
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::get_edges */
+        bidirectional_range_of_non_cvref<E> auto get_edges() const {
+            return g.get_edges();
+        }
+
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::has_node */
+        bool has_node(const N& n) const {
+            return g.has_node(n);
+        }
+
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::has_edge */
+        bool has_edge(const E& e) const {
+            return g.has_edge(e);
+        }
+
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::get_outputs_full */
+        full_input_output_range<N, E, ED> auto get_outputs_full(const N& n) const {
+            return
+                g.get_outputs(n)
+                | std::views::transform([this](const E& e) {
+                    return std::tuple<E, N, N, ED> { e, get_edge_from(e), get_edge_to(e), get_edge_data(e) };
+                });
+        }
+
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::get_inputs_full */
+        full_input_output_range<N, E, ED> auto get_inputs_full(const N& n) const {
+            return
+                g.get_inputs(n)
+                | std::views::transform([this](const E& e) {
+                    return std::tuple<E, N, N, ED> { e, get_edge_from(e), get_edge_to(e), get_edge_data(e) };
+                });
+        }
+
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::get_outputs */
+        bidirectional_range_of_non_cvref<E> auto get_outputs(const N& n) const {
+            return g.get_outputs(n);
+        }
+
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::get_inputs */
+        bidirectional_range_of_non_cvref<E> auto get_inputs(const N& n) const {
+            return g.get_inputs(n);
+        }
+
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::has_outputs */
+        bool has_outputs(const N& n) const {
+            return g.has_outputs(n);
+        }
+
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::has_inputs */
+        bool has_inputs(const N& n) const {
+            return g.has_inputs(n);
+        }
+
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::get_out_degree */
+        std::size_t get_out_degree(const N& n) const {
+            return g.get_out_degree(n);
+        }
+
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::get_in_degree */
+        std::size_t get_in_degree(const N& n) const {
+            return g.get_in_degree(n);
+        }
+
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::edge_to_element_offsets */
+        std::optional<std::pair<std::optional<N_INDEX>, std::optional<N_INDEX>>> edge_to_element_offsets(
+            const E& e
+        ) const {
+            return g.edge_to_element_offsets(e);
+        }
+
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::node_to_grid_offset */
+        std::tuple<N_INDEX, N_INDEX, std::size_t> node_to_grid_offset(const N& n) const {
+            return g.node_to_grid_offset(n);
+        }
+
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::grid_offset_to_nodes */
+        bidirectional_range_of_non_cvref<N> auto grid_offset_to_nodes(N_INDEX grid_down, N_INDEX grid_right) const {
+            return g.grid_offset_to_nodes(grid_down, grid_right);
+        }
+
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::row_nodes */
+        bidirectional_range_of_non_cvref<N> auto row_nodes(N_INDEX grid_down) const {
+            return g.row_nodes(grid_down);
+        }
+
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::row_nodes */
+        bidirectional_range_of_non_cvref<N> auto row_nodes(N_INDEX grid_down, const N& root_node, const N& leaf_node) const {
+            return g.row_nodes(grid_down, root_node, leaf_node);
+        }
+
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::is_reachable */
+        bool is_reachable(const N& n1, const N& n2) const {
+            return g.is_reachable(n1, n2);
+        }
+
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::resident_nodes */
+        bidirectional_range_of_non_cvref<N> auto resident_nodes() const {
+            return g.resident_nodes();
+        }
+
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::outputs_to_residents */
+        bidirectional_range_of_non_cvref<E> auto outputs_to_residents(const N& n) const {
+            return g.outputs_to_residents(n);
+        }
+
+        /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::inputs_from_residents */
+        bidirectional_range_of_non_cvref<E> auto inputs_from_residents(const N& n) const {
+            return g.inputs_from_residents(n);
+        }
+    };
+
+
+    /**
+     * Create @ref offbynull::aligner::graphs::memoizing_sliceable_pairwise_alignment_graph::memoizing_sliceable_pairwise_alignment_graph
+     * instance, where template parameters are deduced / inferred from arguments passed in.
+     *
+     * @tparam debug_mode `true` to enable debugging logic, `false` otherwise.
+     * @param g Backing graph.
+     * @param cached_rows Number of grid rows to cache edge weights for.
+     * @return New @ref offbynull::aligner::graphs::memoizing_sliceable_pairwise_alignment_graph::memoizing_sliceable_pairwise_alignment_graph
+     *      instance.
+     */
+    template<
+        bool debug_mode
+    >
+    auto create_memoizing_sliceable_pairwise_alignment_graph(
+        const sliceable_pairwise_alignment_graph auto& g,
+        std::size_t cached_rows
+    ) {
+        using G = std::remove_cvref_t<decltype(g)>;
+        return memoizing_sliceable_pairwise_alignment_graph<debug_mode, G> { g, cached_rows };
+    }
+}
+#endif //OFFBYNULL_ALIGNER_GRAPHS_MEMOIZING_SLICEABLE_PAIRWISE_ALIGNMENT_GRAPH_H
@@ -0,0 +1,166 @@
+#include <cstddef>
+#include <stdfloat>
+#include <string>
+#include <optional>
+#include <utility>
+#include <functional>
+#include "offbynull/aligner/graph/graph.h"
+#include "offbynull/aligner/graph/pairwise_alignment_graph.h"
+#include "offbynull/aligner/graph/sliceable_pairwise_alignment_graph.h"
+#include "offbynull/aligner/graphs/pairwise_global_alignment_graph.h"
+#include "offbynull/aligner/graphs/pairwise_local_alignment_graph.h"
+#include "offbynull/aligner/graphs/memoizing_sliceable_pairwise_alignment_graph.h"
+#include "offbynull/aligner/backtrackers/sliceable_pairwise_alignment_graph_backtracker/backtracker.h"
+#include "offbynull/aligner/scorers/simple_scorer.h"
+#include "offbynull/utils.h"
+#include "gtest/gtest.h"
+
+namespace {
+    using offbynull::aligner::graphs::pairwise_global_alignment_graph::pairwise_global_alignment_graph;
+    using offbynull::aligner::graphs::pairwise_local_alignment_graph::pairwise_local_alignment_graph;
+    using offbynull::aligner::graphs::memoizing_sliceable_pairwise_alignment_graph::memoizing_sliceable_pairwise_alignment_graph;
+    using offbynull::aligner::graphs::memoizing_sliceable_pairwise_alignment_graph::create_memoizing_sliceable_pairwise_alignment_graph;
+    using offbynull::aligner::backtrackers::sliceable_pairwise_alignment_graph_backtracker::backtracker::heap_find_max_path;
+    using offbynull::aligner::scorers::simple_scorer::simple_scorer;
+    using offbynull::utils::copy_to_vector;
+    using offbynull::utils::is_debug_mode;
+
+    // Scorer that counts how many times it gets invoked.
+    struct counting_scorer {
+        using SEQ_INDEX = std::size_t;
+        using WEIGHT = std::float64_t;
+
+        std::size_t& call_cnt;
+
+        WEIGHT operator()(
+            const std::optional<std::pair<SEQ_INDEX, std::reference_wrapper<const char>>> down_elem,
+            const std::optional<std::pair<SEQ_INDEX, std::reference_wrapper<const char>>> right_elem
+        ) const {
+            ++call_cnt;
+            if (!down_elem.has_value() || !right_elem.has_value()) {
+                return -1.0f64;
+            }
+            return (*down_elem).second.get() == (*right_elem).second.get() ? 1.0f64 : -1.0f64;
+        }
+    };
+
+    TEST(OAGMemoizingSliceablePairwiseAlignmentGraphTest, ConceptCheck) {
+        auto substitution_scorer {
+            simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_substitution(1.0f64, -1.0f64)
+        };
+        auto gap_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_gap(0.0f64) };
+        using BACKING_G = pairwise_global_alignment_graph<
+            is_debug_mode(),
+            std::size_t,
+            std::float64_t,
+            std::string,
+            std::string,
+            decltype(substitution_scorer),
+            decltype(gap_scorer)
+        >;
+        using G = memoizing_sliceable_pairwise_alignment_graph<is_debug_mode(), BACKING_G>;
+        static_assert(offbynull::aligner::graph::graph::graph<G>);
+        static_assert(offbynull::aligner::graph::pairwise_alignment_graph::pairwise_alignment_graph<G>);
+        static_assert(offbynull::aligner::graph::sliceable_pairwise_alignment_graph::sliceable_pairwise_alignment_graph<G>);
+        static_assert(offbynull::aligner::graph::pairwise_alignment_graph::row_major_sweepable_pairwise_alignment_graph<G>);
+    }
+
+    TEST(OAGMemoizingSliceablePairwiseAlignmentGraphTest, EdgeDataMatchesBackingGraph) {
+        std::size_t call_cnt { 0zu };
+        counting_scorer scorer { call_cnt };
+        std::string down_seq { "abcdefgh" };
+        std::string right_seq { "abcxefg" };
+        pairwise_global_alignment_graph<
+            is_debug_mode(),
+            std::size_t,
+            std::float64_t,
+            std::string,
+            std::string,
+            decltype(scorer),
+            decltype(scorer)
+        > backing_g { down_seq, right_seq, scorer, scorer };
+        auto g { create_memoizing_sliceable_pairwise_alignment_graph<is_debug_mode()>(backing_g, backing_g.grid_down_cnt) };
+
+        std::size_t edge_cnt { 0zu };
+        for (const auto& e : g.get_edges()) {
+            EXPECT_EQ(backing_g.get_edge_data(e), g.get_edge_data(e));
+            ++edge_cnt;
+        }
+        // Every row is cached, so walking the edges a second time never reaches the scorer
+        call_cnt = 0zu;
+        for (const auto& e : g.get_edges()) {
+            g.get_edge_data(e);
+        }
+        EXPECT_EQ(0zu, call_cnt);
+        for (const auto& n : g.get_nodes()) {
+            for (const auto& [e, n_from, n_to, ed] : g.get_inputs_full(n)) {
+                EXPECT_EQ(backing_g.get_edge_data(e), ed);
+            }
+        }
+        EXPECT_EQ(edge_cnt, call_cnt);  // Only calls were the backing_g.get_edge_data() invocations above
+    }
+
+    TEST(OAGMemoizingSliceablePairwiseAlignmentGraphTest, SlicedSubdivisionScoresLess) {
+        std::string down_seq { "abcdefghijklmnopqrstuvwxyz" };
+        std::string right_seq { "abcxefghijkmnopqrstuvwyz" };
+
+        std::size_t unmemoized_call_cnt { 0zu };
+        counting_scorer unmemoized_scorer { unmemoized_call_cnt };
+        pairwise_global_alignment_graph<
+            is_debug_mode(),
+            std::size_t,
+            std::float64_t,
+            std::string,
+            std::string,
+            decltype(unmemoized_scorer),
+            decltype(unmemoized_scorer)
+        > unmemoized_g { down_seq, right_seq, unmemoized_scorer, unmemoized_scorer };
+        const auto& [unmemoized_path, unmemoized_weight] { heap_find_max_path<is_debug_mode(), true>(unmemoized_g, 0.000001f64) };
+
+        std::size_t memoized_call_cnt { 0zu };
+        counting_scorer memoized_scorer { memoized_call_cnt };
+        pairwise_global_alignment_graph<
+            is_debug_mode(),
+            std::size_t,
+            std::float64_t,
+            std::string,
+            std::string,
+            decltype(memoized_scorer),
+            decltype(memoized_scorer)
+        > backing_g { down_seq, right_seq, memoized_scorer, memoized_scorer };
+        auto g { create_memoizing_sliceable_pairwise_alignment_graph<is_debug_mode()>(backing_g, backing_g.grid_down_cnt) };
+        const auto& [path, weight] { heap_find_max_path<is_debug_mode(), true>(g, 0.000001f64) };
+
+        EXPECT_EQ(copy_to_vector(unmemoized_path), copy_to_vector(path));
+        EXPECT_EQ(unmemoized_weight, weight);
+        std::size_t edge_cnt { copy_to_vector(backing_g.get_edges()).size() };
+        EXPECT_LE(memoized_call_cnt, edge_cnt);
+        EXPECT_LT(memoized_call_cnt, unmemoized_call_cnt);
+    }
+
+    TEST(OAGMemoizingSliceablePairwiseAlignmentGraphTest, EvictionsDontChangeResult) {
+        auto substitution_scorer {
+            simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_substitution(1.0f64, -1.0f64)
+        };
+        auto gap_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_gap(-1.0f64) };
+        auto freeride_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, std::float64_t>::create_freeride(0.0f64) };
+        std::string down_seq { "xxxabcdefghxxx" };
+        std::string right_seq { "yyabcxefghyy" };
+        pairwise_local_alignment_graph<
+            is_debug_mode(),
+            std::size_t,
+            std::float64_t,
+            std::string,
+            std::string,
+            decltype(substitution_scorer),
+            decltype(gap_scorer),
+            decltype(freeride_scorer)
+        > backing_g { down_seq, right_seq, substitution_scorer, gap_scorer, freeride_scorer };
+        const auto& [expected_path, expected_weight] { heap_find_max_path<is_debug_mode(), true>(backing_g, 0.000001f64) };
+        // A single cached row means most edges get evicted before they're looked up again
+        auto g { create_memoizing_sliceable_pairwise_alignment_graph<is_debug_mode()>(backing_g, 1zu) };
+        const auto& [path, weight] { heap_find_max_path<is_debug_mode(), true>(g, 0.000001f64) };
+        EXPECT_EQ(copy_to_vector(expected_path), copy_to_vector(path));
+        EXPECT_EQ(expected_weight, weight);
+    }
+}
@@ -8,6 +8,7 @@
 #include <stdexcept>
 #include <type_traits>
 #include "offbynull/aligner/graph/graph.h"
+#include "offbynull/aligner/graph/pairwise_alignment_graph.h"
 #include "offbynull/aligner/graph/sliceable_pairwise_alignment_graph.h"
 #include "offbynull/aligner/graphs/prefix_sliceable_pairwise_alignment_graph.h"
 #include "offbynull/aligner/graphs/suffix_sliceable_pairwise_alignment_graph.h"
@@ -17,6 +18,7 @@ namespace offbynull::aligner::graphs::middle_sliceable_pairwise_alignment_graph
     using offbynull::aligner::graphs::prefix_sliceable_pairwise_alignment_graph::prefix_sliceable_pairwise_alignment_graph;
     using offbynull::aligner::graphs::suffix_sliceable_pairwise_alignment_graph::suffix_sliceable_pairwise_alignment_graph;
     using offbynull::aligner::graph::sliceable_pairwise_alignment_graph::sliceable_pairwise_alignment_graph;
+    using offbynull::aligner::graph::pairwise_alignment_graph::row_major_sweepable_pairwise_alignment_graph;
     using offbynull::aligner::concepts::weight;
     using offbynull::concepts::bidirectional_range_of_non_cvref;
     using offbynull::aligner::graph::graph::full_input_output_range;
@@ -69,6 +71,8 @@ namespace offbynull::aligner::graphs::middle_sliceable_pairwise_alignment_graph
         static constexpr N_INDEX grid_depth_cnt { G::grid_depth_cnt };
         /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::resident_nodes_capacity */
         const std::size_t resident_nodes_capacity;
+        /** @copydoc offbynull::aligner::graph::pairwise_alignment_graph::unimplemented_pairwise_alignment_graph::row_major_sweepable */
+        static constexpr bool row_major_sweepable { row_major_sweepable_pairwise_alignment_graph<G> };
         /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::path_edge_capacity */
         const std::size_t path_edge_capacity;
         /** @copydoc offbynull::aligner::graph::sliceable_pairwise_alignment_graph::unimplemented_sliceable_pairwise_alignment_graph::node_incoming_edge_capacity */
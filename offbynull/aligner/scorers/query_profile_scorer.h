@@ -0,0 +1,191 @@
+#ifndef OFFBYNULL_ALIGNER_SCORERS_QUERY_PROFILE_SCORER_H
+#define OFFBYNULL_ALIGNER_SCORERS_QUERY_PROFILE_SCORER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <array>
+#include <vector>
+#include <utility>
+#include <optional>
+#include <functional>
+#include <limits>
+#include <concepts>
+#include <stdexcept>
+#include "offbynull/aligner/scorer/scorer.h"
+#include "offbynull/aligner/scorers/simple_scorer.h"
+#include "offbynull/aligner/sequence/sequence.h"
+#include "offbynull/aligner/concepts.h"
+#include "offbynull/concepts.h"
+
+namespace offbynull::aligner::scorers::query_profile_scorer {
+    using offbynull::aligner::concepts::weight;
+    using offbynull::aligner::scorer::scorer::scorer;
+    using offbynull::aligner::scorers::simple_scorer::simple_scorer;
+    using offbynull::aligner::sequence::sequence::sequence;
+    using offbynull::concepts::widenable_to_size_t;
+    using offbynull::concepts::forward_range_of_non_cvref;
+
+    /**
+     * @ref offbynull::aligner::scorer::scorer::scorer which precomputes (profiles) a backing substitution scorer against a fixed rightward
+     * sequence (the query), such that scoring a downward element against a rightward element becomes a single table lookup rather than a
+     * call into the backing scorer.
+     *
+     * The profile holds, for each symbol in a finite alphabet of single-byte downward elements, a row of scores against every element of
+     * the rightward sequence. Rows are laid out contiguously, so walking across a row of an alignment graph reads adjacent scores. The
+     * profile doesn't depend on the downward sequence, meaning the same instance can be reused to align many downward sequences against
+     * the same rightward sequence (one-vs-many search).
+     *
+     * The backing scorer is consulted directly (not the profile) if ...
+     *
+     *  * either element is missing (e.g., indel).
+     *  * the downward element isn't in the alphabet.
+     *  * the rightward element's index extends past the rightward sequence's length.
+     *
+     * The behavior of this class is undefined if a rightward element's index isn't its offset within the profiled rightward sequence (e.g.,
+     * the scorer is used with a graph over some other rightward sequence), or if the backing scorer's result depends on anything other than
+     * the two elements being scored (e.g., their indices).
+     *
+     * @tparam debug_mode `true` to enable debugging logic, `false` otherwise.
+     * @tparam SEQ_INDEX_ Sequence indexer type.
+     * @tparam DOWN_ELEM Downward sequence element type. Must be a single-byte integral type (e.g., `char`).
+     * @tparam RIGHT_ELEM Rightward sequence element type.
+     * @tparam WEIGHT_ Pairwise alignment graph's edge data type (edge's weight).
+     * @tparam BACKING_SCORER Backing score type.
+     */
+    template<
+        bool debug_mode,
+        widenable_to_size_t SEQ_INDEX_,
+        typename DOWN_ELEM,
+        typename RIGHT_ELEM,
+        weight WEIGHT_,
+        scorer<SEQ_INDEX_, DOWN_ELEM, RIGHT_ELEM, WEIGHT_> BACKING_SCORER
+    >
+    requires std::integral<DOWN_ELEM> && (sizeof(DOWN_ELEM) == 1zu)
+    class query_profile_scorer {
+    public:
+        /** @copydoc offbynull::aligner::scorer::scorer::unimplemented_scorer::WEIGHT */
+        using WEIGHT = WEIGHT_;
+        /** @copydoc offbynull::aligner::scorer::scorer::unimplemented_scorer::SEQ_INDEX */
+        using SEQ_INDEX = SEQ_INDEX_;
+
+    private:
+        static constexpr std::size_t symbol_cnt { 1zu << std::numeric_limits<unsigned char>::digits };
+        static constexpr std::uint16_t NO_ROW { std::numeric_limits<std::uint16_t>::max() };
+
+        const BACKING_SCORER& backing_scorer;
+        std::size_t right_cnt;
+        std::array<std::uint16_t, symbol_cnt> symbol_rows;
+        std::vector<WEIGHT> profile;
+
+        static std::size_t to_symbol_idx(const DOWN_ELEM elem) {
+            return static_cast<unsigned char>(elem);
+        }
+
+    public:
+        /**
+         * Construct an @ref offbynull::aligner::scorers::query_profile_scorer::query_profile_scorer instance, profiling `backing_scorer_`
+         * against `right_seq` for each symbol in `alphabet`.
+         *
+         * @param backing_scorer_ Substitution scorer to profile and forward to for anything the profile doesn't cover.
+         * @param right_seq Rightward sequence (query).
+         * @param alphabet Downward symbols to profile. Duplicates are ignored.
+         */
+        query_profile_scorer(
+            const BACKING_SCORER& backing_scorer_,
+            const sequence auto& right_seq,
+            const forward_range_of_non_cvref<DOWN_ELEM> auto& alphabet
+        )
+        : backing_scorer { backing_scorer_ }
+        , right_cnt { right_seq.size() }
+        , symbol_rows {}
+        , profile {} {
+            symbol_rows.fill(NO_ROW);
+            std::size_t row_cnt { 0zu };
+            for (const DOWN_ELEM& symbol : alphabet) {
+                std::uint16_t& row { symbol_rows[to_symbol_idx(symbol)] };
+                if (row == NO_ROW) {
+                    row = static_cast<std::uint16_t>(row_cnt);
+                    ++row_cnt;
+                }
+            }
+            profile.resize(row_cnt * right_cnt);
+            for (std::size_t i { 0zu }; i < symbol_cnt; ++i) {
+                if (symbol_rows[i] == NO_ROW) {
+                    continue;
+                }
+                const DOWN_ELEM symbol { static_cast<DOWN_ELEM>(i) };
+                const std::size_t row_start { symbol_rows[i] * right_cnt };
+                for (std::size_t j { 0zu }; j < right_cnt; ++j) {
+                    const RIGHT_ELEM& right_elem { right_seq[j] };
+                    profile[row_start + j] = backing_scorer(
+                        { { static_cast<SEQ_INDEX>(0zu), { symbol } } },
+                        { { static_cast<SEQ_INDEX>(j), { right_elem } } }
+                    );
+                }
+            }
+        }
+
+        query_profile_scorer(BACKING_SCORER&&, const sequence auto&, const auto&) = delete; // No rvalues
+        query_profile_scorer(const BACKING_SCORER&&, const sequence auto&, const auto&) = delete; // No rvalues, even if a const
+
+        // This must be operator()() - if you do operator(), doxygen won't recognize it. This isn't the case with other functions (if you
+        // leave out the parenthesis, doxygen copies the documentation just fine).
+        /**
+         * @copydoc offbynull::aligner::scorer::scorer::unimplemented_scorer::operator()()
+         */
+        WEIGHT operator()(
+            const std::optional<
+                std::pair<
+                    SEQ_INDEX,
+                    std::reference_wrapper<const DOWN_ELEM>
+                >
+            > down_elem,
+            const std::optional<
+                std::pair<
+                    SEQ_INDEX,
+                    std::reference_wrapper<const RIGHT_ELEM>
+                >
+            > right_elem
+        ) const {
+            if (down_elem.has_value() && right_elem.has_value()) {
+                const std::uint16_t row { symbol_rows[to_symbol_idx((*down_elem).second.get())] };
+                const std::size_t right_idx { (*right_elem).first };
+                if (row != NO_ROW && right_idx < right_cnt) {
+                    const WEIGHT ret { profile[row * right_cnt + right_idx] };
+                    if constexpr (debug_mode) {
+                        if (ret != backing_scorer(down_elem, right_elem)) {
+                            throw std::runtime_error { "Profile doesn't match backing scorer (rightward sequence not profiled one?)" };
+                        }
+                    }
+                    return ret;
+                }
+            }
+            return backing_scorer(down_elem, right_elem);
+        }
+    };
+
+    static_assert(
+        scorer<
+            query_profile_scorer<
+                true,
+                std::size_t,
+                char,
+                char,
+                float,
+                simple_scorer<
+                    true,
+                    std::size_t,
+                    char,
+                    char,
+                    float
+                >
+            >,
+            std::size_t,
+            char,
+            char,
+            float
+        >
+    );
+}
+
+#endif //OFFBYNULL_ALIGNER_SCORERS_QUERY_PROFILE_SCORER_H
@@ -0,0 +1,134 @@
+#include "offbynull/aligner/scorers/query_profile_scorer.h"
+#include "offbynull/aligner/scorers/simple_scorer.h"
+#include "offbynull/aligner/scorers/single_character_substitution_matrix_scorer.h"
+#include "offbynull/aligner/scorers/blosum_scorer.h"
+#include "offbynull/aligner/scorers/pam_scorer.h"
+#include "offbynull/aligner/scorers/qwerty_scorer.h"
+#include "offbynull/aligner/aligners/global_dynamic_programming_heap_aligner.h"
+#include "offbynull/utils.h"
+#include "gtest/gtest.h"
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <vector>
+#include <type_traits>
+
+namespace {
+    using offbynull::aligner::scorers::query_profile_scorer::query_profile_scorer;
+    using offbynull::aligner::scorers::simple_scorer::simple_scorer;
+    using offbynull::aligner::scorers::single_character_substitution_matrix_scorer::single_character_substitution_matrix_scorer;
+    using offbynull::aligner::scorers::blosum_scorer::blosum_scorer;
+    using offbynull::aligner::scorers::blosum_scorer::threshold;
+    using offbynull::aligner::scorers::pam_scorer::pam_scorer;
+    using offbynull::aligner::scorers::pam_scorer::distance;
+    using offbynull::aligner::scorers::qwerty_scorer::qwerty_scorer;
+    using offbynull::aligner::aligners::global_dynamic_programming_heap_aligner::global_dynamic_programming_heap_aligner;
+    using offbynull::utils::copy_to_vector;
+    using offbynull::utils::is_debug_mode;
+
+    template<typename WEIGHT>
+    void expect_profile_matches_backing_scorer(const auto& backing_scorer, const std::string& alphabet, const std::string& right) {
+        query_profile_scorer<
+            is_debug_mode(),
+            std::size_t,
+            char,
+            char,
+            WEIGHT,
+            std::remove_cvref_t<decltype(backing_scorer)>
+        > scorer { backing_scorer, right, alphabet };
+        for (const char& down_ch : alphabet) {
+            for (std::size_t i { 0zu }; i < right.size(); ++i) {
+                EXPECT_EQ(
+                    (backing_scorer({ { 0zu, { down_ch } } }, { { i, { right[i] } } })),
+                    (scorer({ { 0zu, { down_ch } } }, { { i, { right[i] } } }))
+                );
+            }
+        }
+    }
+
+    TEST(OASQueryProfileScorerTest, SanityTest) {
+        simple_scorer<is_debug_mode(), std::size_t, char, char, int> backing_scorer { 1, -1, -2, -3, 0 };
+        std::string right { "acgt" };
+        query_profile_scorer<
+            is_debug_mode(),
+            std::size_t,
+            char,
+            char,
+            int,
+            decltype(backing_scorer)
+        > scorer { backing_scorer, right, std::string { "acgtt" } };
+        char a_ { 'a' };
+        char g_ { 'g' };
+        char n_ { 'n' };
+        EXPECT_EQ(1, (scorer({ { 5zu, { a_ } } }, { { 0zu, { right[0zu] } } })));
+        EXPECT_EQ(-1, (scorer({ { 5zu, { a_ } } }, { { 1zu, { right[1zu] } } })));
+        EXPECT_EQ(1, (scorer({ { 5zu, { g_ } } }, { { 2zu, { right[2zu] } } })));
+        // Not in alphabet / past end of rightward sequence / indel forward to the backing scorer
+        EXPECT_EQ(-1, (scorer({ { 5zu, { n_ } } }, { { 0zu, { right[0zu] } } })));
+        EXPECT_EQ(1, (scorer({ { 5zu, { a_ } } }, { { 9zu, { a_ } } })));
+        EXPECT_EQ(backing_scorer({ { 5zu, { a_ } } }, { std::nullopt }), (scorer({ { 5zu, { a_ } } }, { std::nullopt })));
+        EXPECT_EQ(
+            backing_scorer({ std::nullopt }, { { 0zu, { right[0zu] } } }),
+            (scorer({ std::nullopt }, { { 0zu, { right[0zu] } } }))
+        );
+        EXPECT_EQ(0, (scorer({ std::nullopt }, { std::nullopt })));
+    }
+
+    TEST(OASQueryProfileScorerTest, MatchesBackingScorers) {
+        std::string amino_acids { "ACDEFGHIKLMNPQRSTVWY" };
+        std::string protein { "MKTAYIAKQRQISFVKSHFSRQ" };
+        expect_profile_matches_backing_scorer<int>(
+            blosum_scorer<is_debug_mode(), threshold::_62, std::size_t, int> {},
+            amino_acids,
+            protein
+        );
+        expect_profile_matches_backing_scorer<int>(
+            pam_scorer<is_debug_mode(), distance::_250, std::size_t, int> {},
+            amino_acids,
+            protein
+        );
+        expect_profile_matches_backing_scorer<float>(
+            qwerty_scorer<is_debug_mode(), std::size_t, float> {},
+            std::string { "QWERTYASDFZXCV" },
+            std::string { "QWERTY" }
+        );
+        expect_profile_matches_backing_scorer<int>(
+            single_character_substitution_matrix_scorer<is_debug_mode(), 4zu, std::size_t, int> {
+                "   A  C  T  G\n"
+                "A  1 -1 -1 -1\n"
+                "C -1  1 -1  0\n"
+                "T -1 -1  1 -1\n"
+                "G -1  0 -1  1\n"
+            },
+            std::string { "ACGT" },
+            std::string { "GATTACA" }
+        );
+        expect_profile_matches_backing_scorer<int>(
+            simple_scorer<is_debug_mode(), std::size_t, char, char, int>::create_substitution(2, -3),
+            std::string { "ACGT" },
+            std::string { "GATTACA" }
+        );
+    }
+
+    TEST(OASQueryProfileScorerTest, ReuseAcrossDownSequences) {
+        global_dynamic_programming_heap_aligner<is_debug_mode()> aligner {};
+        blosum_scorer<is_debug_mode(), threshold::_62, std::size_t, int> substitution_scorer {};
+        auto gap_scorer { simple_scorer<is_debug_mode(), std::size_t, char, char, int>::create_gap(-4) };
+        std::string right { "MKTAYIAKQRQISFVKSHFSRQ" };
+        query_profile_scorer<
+            is_debug_mode(),
+            std::size_t,
+            char,
+            char,
+            int,
+            decltype(substitution_scorer)
+        > profiled_substitution_scorer { substitution_scorer, right, std::string { "ACDEFGHIKLMNPQRSTVWY" } };
+        std::vector<std::string> downs { "MKTAYIAKQRQ", "KSHFSRQMKTA", "MKTWYIAKQRQISFVKSHFSRQ", "" };
+        for (const std::string& down : downs) {
+            const auto& [alignment, score] { aligner.align(down, right, substitution_scorer, gap_scorer) };
+            const auto& [profiled_alignment, profiled_score] { aligner.align(down, right, profiled_substitution_scorer, gap_scorer) };
+            EXPECT_EQ(copy_to_vector(alignment), copy_to_vector(profiled_alignment));
+            EXPECT_EQ(score, profiled_score);
+        }
+    }
+}
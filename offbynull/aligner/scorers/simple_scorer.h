@@ -156,6 +156,51 @@ namespace offbynull::aligner::scorers::simple_scorer {
             };
         }
 
+        /**
+         * Get the weight returned when both elements are present and equal.
+         *
+         * @return Match weight.
+         */
+        WEIGHT get_match_weight() const {
+            return match_weight;
+        }
+
+        /**
+         * Get the weight returned when both elements are present but not equal.
+         *
+         * @return Mismatch weight.
+         */
+        WEIGHT get_mismatch_weight() const {
+            return mismatch_weight;
+        }
+
+        /**
+         * Get the weight returned when only the downward element is missing (rightward element consumed on its own).
+         *
+         * @return Down missing weight.
+         */
+        WEIGHT get_down_missing_weight() const {
+            return down_missing_weight;
+        }
+
+        /**
+         * Get the weight returned when only the rightward element is missing (downward element consumed on its own).
+         *
+         * @return Right missing weight.
+         */
+        WEIGHT get_right_missing_weight() const {
+            return right_missing_weight;
+        }
+
+        /**
+         * Get the weight returned when both elements are missing.
+         *
+         * @return Both missing weight.
+         */
+        WEIGHT get_both_missing_weight() const {
+            return both_missing_weight;
+        }
+
         // This must be operator()() - if you do operator(), doxygen won't recognize it. This isn't the case with other functions (if you
         // leave out the parenthesis, doxygen copies the documentation just fine).
         /**
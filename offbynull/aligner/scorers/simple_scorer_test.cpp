@@ -18,4 +18,12 @@ namespace {
         EXPECT_EQ(-1, (scorer({ std::nullopt }, { { 0zu, { b_ } } })));
         EXPECT_EQ(0, (scorer({ std::nullopt }, { std::nullopt })));
     }
-}
\ No newline at end of file
+    TEST(OASSimpleScorerTest, WeightAccessorTest) {
+        simple_scorer<is_debug_mode(), std::size_t, char, char, int> scorer { 2, -1, -3, -4, 5 };
+        EXPECT_EQ(2, scorer.get_match_weight());
+        EXPECT_EQ(-1, scorer.get_mismatch_weight());
+        EXPECT_EQ(-3, scorer.get_down_missing_weight());
+        EXPECT_EQ(-4, scorer.get_right_missing_weight());
+        EXPECT_EQ(5, scorer.get_both_missing_weight());
+    }
+}
@@ -0,0 +1,108 @@
+#ifndef OFFBYNULL_ALIGNER_SCORERS_TRANSPOSING_SCORER_H
+#define OFFBYNULL_ALIGNER_SCORERS_TRANSPOSING_SCORER_H
+
+#include <utility>
+#include <cstddef>
+#include <optional>
+#include <functional>
+#include "offbynull/aligner/scorer/scorer.h"
+#include "offbynull/aligner/scorers/constant_scorer.h"
+#include "offbynull/aligner/concepts.h"
+#include "offbynull/concepts.h"
+
+namespace offbynull::aligner::scorers::transposing_scorer {
+    using offbynull::aligner::concepts::weight;
+    using offbynull::aligner::scorer::scorer::scorer;
+    using offbynull::aligner::scorers::constant_scorer::constant_scorer;
+    using offbynull::concepts::widenable_to_size_t;
+
+    /**
+     * @ref offbynull::aligner::scorer::scorer::scorer which forwards to a backing scorer with its downward and rightward elements swapped,
+     * such that a backing scorer written for a `DOWN_ELEM` vs `RIGHT_ELEM` alignment can score the transposed `RIGHT_ELEM` vs `DOWN_ELEM`
+     * alignment (e.g., a graph with its sequences swapped).
+     *
+     * @tparam debug_mode `true` to enable debugging logic, `false` otherwise.
+     * @tparam SEQ_INDEX_ Sequence indexer type.
+     * @tparam DOWN_ELEM Backing scorer's downward sequence element type (transposed scorer's rightward sequence element type).
+     * @tparam RIGHT_ELEM Backing scorer's rightward sequence element type (transposed scorer's downward sequence element type).
+     * @tparam WEIGHT_ Pairwise alignment graph's edge data type (edge's weight).
+     * @tparam BACKING_SCORER Backing score type.
+     */
+    template<
+        bool debug_mode,
+        widenable_to_size_t SEQ_INDEX_,
+        typename DOWN_ELEM,
+        typename RIGHT_ELEM,
+        weight WEIGHT_,
+        scorer<SEQ_INDEX_, DOWN_ELEM, RIGHT_ELEM, WEIGHT_> BACKING_SCORER
+    >
+    class transposing_scorer {
+    public:
+        /** @copydoc offbynull::aligner::scorer::scorer::unimplemented_scorer::WEIGHT */
+        using WEIGHT = WEIGHT_;
+        /** @copydoc offbynull::aligner::scorer::scorer::unimplemented_scorer::SEQ_INDEX */
+        using SEQ_INDEX = SEQ_INDEX_;
+
+    private:
+        const BACKING_SCORER& backing_scorer;
+
+    public:
+        /**
+         * Construct an @ref offbynull::aligner::scorers::transposing_scorer::transposing_scorer instance.
+         *
+         * @param backing_scorer_ Scorer to forward to.
+         */
+        transposing_scorer(const BACKING_SCORER& backing_scorer_)
+        : backing_scorer { backing_scorer_ } {}
+
+        transposing_scorer(BACKING_SCORER&&) = delete; // No rvalues
+        transposing_scorer(const BACKING_SCORER&&) = delete; // No rvalues, even if a const (how do you move a const rvalue?)
+
+        // This must be operator()() - if you do operator(), doxygen won't recognize it. This isn't the case with other functions (if you
+        // leave out the parenthesis, doxygen copies the documentation just fine).
+        /**
+         * @copydoc offbynull::aligner::scorer::scorer::unimplemented_scorer::operator()()
+         */
+        WEIGHT operator()(
+            const std::optional<
+                std::pair<
+                    SEQ_INDEX,
+                    std::reference_wrapper<const RIGHT_ELEM>
+                >
+            > down_elem,
+            const std::optional<
+                std::pair<
+                    SEQ_INDEX,
+                    std::reference_wrapper<const DOWN_ELEM>
+                >
+            > right_elem
+        ) const {
+            return backing_scorer(right_elem, down_elem);
+        }
+    };
+
+    static_assert(
+        scorer<
+            transposing_scorer<
+                true,
+                std::size_t,
+                char,
+                int,
+                float,
+                constant_scorer<
+                    true,
+                    std::size_t,
+                    char,
+                    int,
+                    float
+                >
+            >,
+            std::size_t,
+            int,
+            char,
+            float
+        >
+    );
+}
+
+#endif //OFFBYNULL_ALIGNER_SCORERS_TRANSPOSING_SCORER_H
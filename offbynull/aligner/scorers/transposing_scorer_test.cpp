@@ -0,0 +1,32 @@
+#include "offbynull/aligner/scorers/simple_scorer.h"
+#include "offbynull/aligner/scorers/transposing_scorer.h"
+#include "offbynull/utils.h"
+#include "gtest/gtest.h"
+#include <optional>
+#include <cstddef>
+
+namespace {
+    using offbynull::aligner::scorers::transposing_scorer::transposing_scorer;
+    using offbynull::aligner::scorers::simple_scorer::simple_scorer;
+    using offbynull::utils::is_debug_mode;
+
+    TEST(OASTransposingScorerTest, SanityTest) {
+        simple_scorer<is_debug_mode(), std::size_t, char, char, int> backing_scorer { 1, 0, -1, -2, 0 };
+        transposing_scorer<
+            is_debug_mode(),
+            std::size_t,
+            char,
+            char,
+            int,
+            decltype(backing_scorer)
+        > scorer { backing_scorer };
+        char a_ { 'a' };
+        char b_ { 'b' };
+        EXPECT_EQ(1, (scorer({ { 0zu, { a_ } } }, { { 0zu, { a_ } } })));
+        EXPECT_EQ(0, (scorer({ { 0zu, { a_ } } }, { { 0zu, { b_ } } })));
+        EXPECT_EQ(backing_scorer({ std::nullopt }, { { 0zu, { a_ } } }), (scorer({ { 0zu, { a_ } } }, { std::nullopt })));
+        EXPECT_EQ(backing_scorer({ { 0zu, { b_ } } }, { std::nullopt }), (scorer({ std::nullopt }, { { 0zu, { b_ } } })));
+        EXPECT_NE(scorer({ { 0zu, { a_ } } }, { std::nullopt }), (scorer({ std::nullopt }, { { 0zu, { b_ } } })));
+        EXPECT_EQ(0, (scorer({ std::nullopt }, { std::nullopt })));
+    }
+}
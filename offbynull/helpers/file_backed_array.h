@@ -0,0 +1,136 @@
+#ifndef OFFBYNULL_HELPERS_FILE_BACKED_ARRAY_H
+#define OFFBYNULL_HELPERS_FILE_BACKED_ARRAY_H
+
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <sys/mman.h>
+#include <boost/filesystem.hpp>
+#include <boost/iostreams/device/mapped_file.hpp>
+
+namespace offbynull::helpers::file_backed_array {
+    /**
+     * Fixed-size array backed by a memory-mapped scratch file rather than RAM, intended for arrays that are larger than physical memory
+     * but fit on local disk (e.g., the slots of a dynamic programming matrix for a very large alignment).
+     *
+     * The scratch file is created in some directory and unlinked as soon as it's mapped, meaning that it never outlives the array (not
+     * even if the process crashes). Since the mapping is shared, the kernel evicts pages by writing them back to the scratch file rather
+     * than to swap, and reads them back in on access. The mapping is marked with `madvise(MADV_SEQUENTIAL)`, which tells the kernel to
+     * read ahead aggressively and to evict pages soon after they've been walked over. This suits walking the array in order (e.g., a
+     * row-by-row sweep over a dynamic programming matrix). Since a freshly sized file reads back as all zero bytes, elements aren't
+     * written at all when the value they're initialized to is all zero bytes.
+     *
+     * This class is only available on POSIX systems.
+     *
+     * @tparam T Element type (must be trivially copyable and trivially destructible).
+     */
+    template<typename T>
+    requires std::is_trivially_copyable_v<T> && std::is_trivially_destructible_v<T>
+    class file_backed_array {
+    private:
+        std::unique_ptr<boost::iostreams::mapped_file> file;
+        T* elements;
+        std::size_t cnt;
+
+        static bool is_zero_bytes(const T& value) {
+            unsigned char bytes[sizeof(T)];
+            std::memcpy(bytes, &value, sizeof(T));
+            for (unsigned char b : bytes) {
+                if (b != 0u) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+    public:
+        /**
+         * Construct an empty @ref offbynull::helpers::file_backed_array::file_backed_array::file_backed_array instance.
+         */
+        file_backed_array()
+        : file {}
+        , elements { nullptr }
+        , cnt { 0zu } {}
+
+        /**
+         * Construct an @ref offbynull::helpers::file_backed_array::file_backed_array::file_backed_array instance of `cnt_` copies of
+         * `value`, backed by a scratch file within `directory`.
+         *
+         * @param cnt_ Number of elements.
+         * @param value Value to initialize elements to.
+         * @param directory Directory to create scratch file in (must have at least `cnt_ * sizeof(T)` bytes free).
+         * @throws std::bad_alloc If `cnt_ * sizeof(T)` overflows.
+         * @throws std::runtime_error If the scratch file couldn't be created or mapped.
+         */
+        file_backed_array(std::size_t cnt_, const T& value, const boost::filesystem::path& directory)
+        : file_backed_array() {
+            if (cnt_ == 0zu) {
+                return;
+            }
+            if (cnt_ > std::numeric_limits<std::size_t>::max() / sizeof(T)) {
+                throw std::bad_alloc {};
+            }
+            const std::size_t byte_cnt { cnt_ * sizeof(T) };
+            const boost::filesystem::path path { directory / boost::filesystem::unique_path() };
+            boost::iostreams::mapped_file_params params { path.string() };
+            params.flags = boost::iostreams::mapped_file_base::readwrite;
+            params.new_file_size = static_cast<boost::iostreams::stream_offset>(byte_cnt);
+            file = std::make_unique<boost::iostreams::mapped_file>();
+            try {
+                file->open(params);
+            } catch (...) {
+                throw std::runtime_error { "Unable to create scratch file" };
+            }
+            // Unlinking doesn't invalidate the mapping, it only means the file's disk space gets reclaimed once the mapping is closed.
+            boost::system::error_code ec {};
+            boost::filesystem::remove(path, ec);
+            madvise(file->data(), byte_cnt, MADV_SEQUENTIAL);  // Advisory only, failure is fine
+            if (is_zero_bytes(value)) {
+                // A newly sized file reads back as zeros. Beginning the lifetime of a byte array over the mapping implicitly creates the
+                // elements within it without writing to (and dirtying) any pages.
+                elements = std::launder(reinterpret_cast<T*>(::new (file->data()) std::byte[byte_cnt]));
+            } else {
+                elements = reinterpret_cast<T*>(file->data());
+                std::uninitialized_fill_n(elements, cnt_, value);
+            }
+            cnt = cnt_;
+        }
+
+        file_backed_array(const file_backed_array&) = delete;
+        file_backed_array& operator=(const file_backed_array&) = delete;
+
+        file_backed_array(file_backed_array&& other) noexcept
+        : file { std::move(other.file) }
+        , elements { std::exchange(other.elements, nullptr) }
+        , cnt { std::exchange(other.cnt, 0zu) } {}
+
+        file_backed_array& operator=(file_backed_array&& other) noexcept {
+            if (this != &other) {
+                file = std::move(other.file);
+                elements = std::exchange(other.elements, nullptr);
+                cnt = std::exchange(other.cnt, 0zu);
+            }
+            return *this;
+        }
+
+        ~file_backed_array() = default;
+
+        T* begin() { return elements; }
+        const T* begin() const { return elements; }
+        T* end() { return elements + cnt; }
+        const T* end() const { return elements + cnt; }
+        T* data() { return elements; }
+        const T* data() const { return elements; }
+        std::size_t size() const { return cnt; }
+        bool empty() const { return cnt == 0zu; }
+        T& operator[](std::size_t idx) { return elements[idx]; }
+        const T& operator[](std::size_t idx) const { return elements[idx]; }
+    };
+}
+
+#endif //OFFBYNULL_HELPERS_FILE_BACKED_ARRAY_H
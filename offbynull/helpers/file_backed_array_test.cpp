@@ -0,0 +1,66 @@
+#include <cstdint>
+#include <utility>
+#include <boost/filesystem.hpp>
+#include "offbynull/helpers/file_backed_array.h"
+#include "gtest/gtest.h"
+
+namespace {
+    using offbynull::helpers::file_backed_array::file_backed_array;
+
+    struct pair_of_ints {
+        std::int32_t a;
+        std::int64_t b;
+    };
+
+    TEST(OHFileBackedArrayTest, ZeroValueTest) {
+        file_backed_array<pair_of_ints> arr(100000zu, pair_of_ints { 0, 0 }, boost::filesystem::temp_directory_path());
+        EXPECT_EQ(arr.size(), 100000zu);
+        for (const pair_of_ints& e : arr) {
+            EXPECT_EQ(e.a, 0);
+            EXPECT_EQ(e.b, 0);
+        }
+        arr[99999zu] = { 1, 2 };
+        EXPECT_EQ(arr[99999zu].a, 1);
+        EXPECT_EQ(arr[99999zu].b, 2);
+    }
+
+    TEST(OHFileBackedArrayTest, NonZeroValueTest) {
+        file_backed_array<pair_of_ints> arr(100zu, pair_of_ints { 7, -3 }, boost::filesystem::temp_directory_path());
+        EXPECT_EQ(arr.size(), 100zu);
+        for (const pair_of_ints& e : arr) {
+            EXPECT_EQ(e.a, 7);
+            EXPECT_EQ(e.b, -3);
+        }
+    }
+
+    TEST(OHFileBackedArrayTest, ScratchFileUnlinkedTest) {
+        boost::filesystem::path directory { boost::filesystem::temp_directory_path() / boost::filesystem::unique_path() };
+        boost::filesystem::create_directory(directory);
+        {
+            file_backed_array<std::int32_t> arr(10zu, 5, directory);
+            EXPECT_TRUE(boost::filesystem::is_empty(directory));
+            EXPECT_EQ(arr[9zu], 5);
+        }
+        boost::filesystem::remove(directory);
+    }
+
+    TEST(OHFileBackedArrayTest, MoveTest) {
+        file_backed_array<std::int32_t> arr1(10zu, 5, boost::filesystem::temp_directory_path());
+        file_backed_array<std::int32_t> arr2 { std::move(arr1) };
+        EXPECT_TRUE(arr1.empty());
+        EXPECT_EQ(arr2.size(), 10zu);
+        EXPECT_EQ(arr2[9zu], 5);
+        file_backed_array<std::int32_t> arr3 {};
+        EXPECT_TRUE(arr3.empty());
+        arr3 = std::move(arr2);
+        EXPECT_TRUE(arr2.empty());
+        EXPECT_EQ(arr3.size(), 10zu);
+        EXPECT_EQ(arr3[0zu], 5);
+    }
+
+    TEST(OHFileBackedArrayTest, EmptyTest) {
+        file_backed_array<std::int32_t> arr(0zu, 5, boost::filesystem::temp_directory_path());
+        EXPECT_TRUE(arr.empty());
+        EXPECT_EQ(arr.begin(), arr.end());
+    }
+}
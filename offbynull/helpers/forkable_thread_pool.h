@@ -126,12 +126,14 @@ namespace offbynull::helpers::forkable_thread_pool {
         /**
          * Wait for queued task to complete.
          *
-         * This function must only be invoked from a thread within this thread pool. The intent is to allow a task to queue a subtask (by
-         * invoking `queue()`) and wait for its completion by invoking this function.
+         * The intent is to allow a task to queue a subtask (by invoking `queue()`) and wait for its completion by invoking this function.
+         * Rather than blocking, the invoking thread runs queued tasks while it waits, meaning that a task waiting on a subtask never ties
+         * up a thread that the subtask needs. The invoking thread may also be a thread outside of this thread pool, in which case it lends
+         * a hand to this thread pool until `future` is ready.
          *
-         * If invoked from a thread outside of this thread pool, the behavior of this function is undefined.
+         * `future` may be any future that gets fulfilled by a task running on this thread pool, not just one returned by `queue()`.
          *
-         * @param future Future returned by `queue()`.
+         * @param future Future to wait on (e.g., one returned by `queue()`).
          * @return `future`.
          */
         std::future<TASK_RESULT>& join(std::future<TASK_RESULT>& future) {
@@ -167,6 +169,11 @@ namespace offbynull::helpers::forkable_thread_pool {
                 } catch (const std::exception& e) {
                     // Do nothing
                 }
+                {
+                    // A join() may have checked the task's future just before it became ready. Acquiring the lock before notifying
+                    // guarantees that the join() is already waiting on signal, meaning it won't miss the notification.
+                    std::unique_lock lock { mutex };
+                }
                 signal.notify_all(); // Something may be waiting on this task -- notify all so the waiting thread can move forward
             }
         }
@@ -239,6 +246,10 @@ namespace offbynull::helpers::forkable_thread_pool {
                 } catch (const std::exception& e) {
                     // Do nothing
                 }
+                {
+                    // See the same block in forkable_thread_pool::join().
+                    std::unique_lock lock { owner.mutex };
+                }
                 owner.signal.notify_all(); // Something may be waiting on this task -- notify all so the waiting thread can move forward
             }
         }
@@ -0,0 +1,171 @@
+#ifndef OFFBYNULL_HELPERS_HUGE_PAGE_ARRAY_H
+#define OFFBYNULL_HELPERS_HUGE_PAGE_ARRAY_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <sys/mman.h>
+
+namespace offbynull::helpers::huge_page_array {
+    /**
+     * Fixed-size array backed by an anonymous memory mapping rather than the heap, intended for very large arrays (e.g., the slots of a
+     * multi-gigabyte dynamic programming matrix).
+     *
+     * Mappings of at least @ref offbynull::helpers::huge_page_array::huge_page_array::huge_page_size bytes are aligned to that size and
+     * marked with `madvise(MADV_HUGEPAGE)`, such that the kernel backs them with transparent huge pages (if enabled), which cuts down on
+     * TLB misses when the array is walked. Since the kernel hands out anonymous mappings zero-filled, elements aren't written at all when
+     * the value they're initialized to is all zero bytes, meaning that pages are only faulted in once they're first used.
+     *
+     * This class is only available on POSIX systems.
+     *
+     * @tparam T Element type (must be trivially copyable and trivially destructible).
+     */
+    template<typename T>
+    requires std::is_trivially_copyable_v<T> && std::is_trivially_destructible_v<T>
+    class huge_page_array {
+    private:
+        void* mapping;
+        std::size_t mapping_size;
+        T* elements;
+        std::size_t cnt;
+
+        static bool is_zero_bytes(const T& value) {
+            unsigned char bytes[sizeof(T)];
+            std::memcpy(bytes, &value, sizeof(T));
+            for (unsigned char b : bytes) {
+                if (b != 0u) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        static std::size_t round_up(std::size_t value, std::size_t multiple) {
+            return ((value + multiple - 1zu) / multiple) * multiple;
+        }
+
+        void unmap() {
+            if (mapping != nullptr) {
+                munmap(mapping, mapping_size);
+            }
+            mapping = nullptr;
+            mapping_size = 0zu;
+            elements = nullptr;
+            cnt = 0zu;
+        }
+
+    public:
+        /**
+         * Size of a transparent huge page (2 MiB on x86-64 and on ARM64 with 4 KiB base pages).
+         */
+        static constexpr std::size_t huge_page_size { 2zu * 1024zu * 1024zu };
+
+        /**
+         * Construct an empty @ref offbynull::helpers::huge_page_array::huge_page_array::huge_page_array instance.
+         */
+        huge_page_array()
+        : mapping { nullptr }
+        , mapping_size { 0zu }
+        , elements { nullptr }
+        , cnt { 0zu } {}
+
+        /**
+         * Construct an @ref offbynull::helpers::huge_page_array::huge_page_array::huge_page_array instance of `cnt_` copies of `value`.
+         *
+         * @param cnt_ Number of elements.
+         * @param value Value to initialize elements to.
+         * @throws std::bad_alloc If the mapping couldn't be created.
+         */
+        huge_page_array(std::size_t cnt_, const T& value)
+        : huge_page_array() {
+            if (cnt_ == 0zu) {
+                return;
+            }
+            if (cnt_ > std::numeric_limits<std::size_t>::max() / sizeof(T)) {
+                throw std::bad_alloc {};
+            }
+            const std::size_t byte_cnt { cnt_ * sizeof(T) };
+            if (byte_cnt < huge_page_size) {
+                void* ptr { mmap(nullptr, byte_cnt, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0) };
+                if (ptr == MAP_FAILED) {
+                    throw std::bad_alloc {};
+                }
+                mapping = ptr;
+                mapping_size = byte_cnt;
+            } else {
+                // The kernel only backs huge page aligned ranges with huge pages, so over-map by a huge page and trim the excess off both
+                // ends to end up with an aligned range.
+                const std::size_t aligned_size { round_up(byte_cnt, huge_page_size) };
+                const std::size_t padded_size { aligned_size + huge_page_size };
+                void* ptr { mmap(nullptr, padded_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0) };
+                if (ptr == MAP_FAILED) {
+                    throw std::bad_alloc {};
+                }
+                const std::uintptr_t start { reinterpret_cast<std::uintptr_t>(ptr) };
+                const std::uintptr_t aligned_start { round_up(start, huge_page_size) };
+                const std::size_t head_size { aligned_start - start };
+                const std::size_t tail_size { padded_size - head_size - aligned_size };
+                if (head_size != 0zu) {
+                    munmap(ptr, head_size);
+                }
+                if (tail_size != 0zu) {
+                    munmap(reinterpret_cast<void*>(aligned_start + aligned_size), tail_size);
+                }
+                mapping = reinterpret_cast<void*>(aligned_start);
+                mapping_size = aligned_size;
+                madvise(mapping, mapping_size, MADV_HUGEPAGE);  // Advisory only, failure (e.g., huge pages disabled) is fine
+            }
+            if (is_zero_bytes(value)) {
+                // Mapped pages are already zeroed. Beginning the lifetime of a byte array over the mapping implicitly creates the
+                // elements within it without writing to (and faulting in) any pages.
+                elements = std::launder(reinterpret_cast<T*>(::new (mapping) std::byte[byte_cnt]));
+            } else {
+                elements = static_cast<T*>(mapping);
+                std::uninitialized_fill_n(elements, cnt_, value);
+            }
+            cnt = cnt_;
+        }
+
+        huge_page_array(const huge_page_array&) = delete;
+        huge_page_array& operator=(const huge_page_array&) = delete;
+
+        huge_page_array(huge_page_array&& other) noexcept
+        : mapping { std::exchange(other.mapping, nullptr) }
+        , mapping_size { std::exchange(other.mapping_size, 0zu) }
+        , elements { std::exchange(other.elements, nullptr) }
+        , cnt { std::exchange(other.cnt, 0zu) } {}
+
+        huge_page_array& operator=(huge_page_array&& other) noexcept {
+            if (this != &other) {
+                unmap();
+                mapping = std::exchange(other.mapping, nullptr);
+                mapping_size = std::exchange(other.mapping_size, 0zu);
+                elements = std::exchange(other.elements, nullptr);
+                cnt = std::exchange(other.cnt, 0zu);
+            }
+            return *this;
+        }
+
+        ~huge_page_array() {
+            unmap();
+        }
+
+        T* begin() { return elements; }
+        const T* begin() const { return elements; }
+        T* end() { return elements + cnt; }
+        const T* end() const { return elements + cnt; }
+        T* data() { return elements; }
+        const T* data() const { return elements; }
+        std::size_t size() const { return cnt; }
+        bool empty() const { return cnt == 0zu; }
+        T& operator[](std::size_t idx) { return elements[idx]; }
+        const T& operator[](std::size_t idx) const { return elements[idx]; }
+    };
+}
+
+#endif //OFFBYNULL_HELPERS_HUGE_PAGE_ARRAY_H
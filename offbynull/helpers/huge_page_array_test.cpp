@@ -0,0 +1,58 @@
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include "offbynull/helpers/huge_page_array.h"
+#include "gtest/gtest.h"
+
+namespace {
+    using offbynull::helpers::huge_page_array::huge_page_array;
+
+    struct pair_of_ints {
+        std::int32_t a;
+        std::int64_t b;
+    };
+
+    TEST(OHHugePageArrayTest, ZeroValueTest) {
+        // Large enough to be huge page aligned
+        constexpr std::size_t cnt { huge_page_array<pair_of_ints>::huge_page_size / sizeof(pair_of_ints) * 3zu + 5zu };
+        huge_page_array<pair_of_ints> arr(cnt, pair_of_ints { 0, 0 });
+        EXPECT_EQ(arr.size(), cnt);
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(arr.data()) % huge_page_array<pair_of_ints>::huge_page_size, 0zu);
+        for (std::size_t i { 0zu }; i < cnt; ++i) {
+            EXPECT_EQ(arr[i].a, 0);
+            EXPECT_EQ(arr[i].b, 0);
+        }
+        arr[cnt - 1zu] = { 1, 2 };
+        EXPECT_EQ(arr[cnt - 1zu].a, 1);
+        EXPECT_EQ(arr[cnt - 1zu].b, 2);
+    }
+
+    TEST(OHHugePageArrayTest, NonZeroValueTest) {
+        huge_page_array<pair_of_ints> arr(100zu, pair_of_ints { 7, -3 });
+        EXPECT_EQ(arr.size(), 100zu);
+        for (const pair_of_ints& e : arr) {
+            EXPECT_EQ(e.a, 7);
+            EXPECT_EQ(e.b, -3);
+        }
+    }
+
+    TEST(OHHugePageArrayTest, MoveTest) {
+        huge_page_array<std::int32_t> arr1(10zu, 5);
+        huge_page_array<std::int32_t> arr2 { std::move(arr1) };
+        EXPECT_TRUE(arr1.empty());
+        EXPECT_EQ(arr2.size(), 10zu);
+        EXPECT_EQ(arr2[9zu], 5);
+        huge_page_array<std::int32_t> arr3 {};
+        EXPECT_TRUE(arr3.empty());
+        arr3 = std::move(arr2);
+        EXPECT_TRUE(arr2.empty());
+        EXPECT_EQ(arr3.size(), 10zu);
+        EXPECT_EQ(arr3[0zu], 5);
+    }
+
+    TEST(OHHugePageArrayTest, EmptyTest) {
+        huge_page_array<std::int32_t> arr(0zu, 5);
+        EXPECT_TRUE(arr.empty());
+        EXPECT_EQ(arr.begin(), arr.end());
+    }
+}
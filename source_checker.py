@@ -85,10 +85,13 @@ SYSTEM_TYPE_TO_HEADER_MAPPING = {
     'std::views::all_t': 'ranges',
     'std::views::join': 'ranges',
     'std::ranges::sentinel_t': 'ranges',
+    'std::ranges::contiguous_range': 'ranges',
+    'std::ranges::data': 'ranges',
     'std::ranges::iterator_t': 'ranges',
     'std::same_as': 'concepts',
     'std::floating_point': 'concepts',
     'std::integral': 'concepts',
+    'std::signed_integral': 'concepts',
     'std::unsigned_integral': 'concepts',
     'std::regular': 'concepts',
     'std::semiregular': 'concepts',
@@ -105,6 +108,7 @@ SYSTEM_TYPE_TO_HEADER_MAPPING = {
     'std::is_lvalue_reference_v': 'type_traits',
     'std::is_reference_v': 'type_traits',
     'std::is_signed_v': 'type_traits',
+    'std::is_constructible_v': 'type_traits',
     'std::is_default_constructible_v': 'type_traits',
     'std::is_copy_constructible_v': 'type_traits',
     'std::is_copy_assignable_v': 'type_traits',
@@ -147,6 +151,12 @@ SYSTEM_TYPE_TO_HEADER_MAPPING = {
     'std::mt19937_64': 'random',
     'std::uniform_int_distribution': 'random',
     'std::uniform_real_distribution': 'random',
+    'std::gcd': 'numeric',
+    'std::countr_zero': 'bit',
+    'std::countl_zero': 'bit',
+    'std::endian::native': 'bit',
+    'std::endian::little': 'bit',
+    'std::memcpy': 'cstring',
     'std::abs': 'cmath',
     'std::hypot': 'cmath',
     'std::isfinite': 'cmath',
@@ -188,6 +198,8 @@ SYSTEM_TYPE_TO_HEADER_MAPPING = {
     'std::declval': 'utility',
     'std::forward': 'utility',
     'std::move': 'utility',
+    'std::swap': 'utility',
+    'std::exchange': 'utility',
     'std::unreachable': 'utility',
     'std::in_place': 'utility',
     'std::in_place_t': 'utility',
@@ -206,6 +218,22 @@ SYSTEM_TYPE_TO_HEADER_MAPPING = {
     'std::visit': 'variant',
     'std::strong_ordering': 'compare',
     'std::vector': 'vector',
+    'std::uintptr_t': 'cstdint',
+    'std::is_trivially_copyable_v': 'type_traits',
+    'std::is_trivially_destructible_v': 'type_traits',
+    'std::bad_alloc': 'new',
+    'std::launder': 'new',
+    'std::byte': 'cstddef',
+    'std::uninitialized_fill_n': 'memory',
+    'std::copy_n': 'algorithm',
+    'std::ranges::reverse': 'algorithm',
+    'std::ranges::binary_search': 'algorithm',
+    'std::ranges::lower_bound': 'algorithm',
+    'std::pmr::vector': 'vector',
+    'std::pmr::memory_resource': 'memory_resource',
+    'std::pmr::get_default_resource': 'memory_resource',
+    'std::pmr::monotonic_buffer_resource': 'memory_resource',
+    'std::pmr::unsynchronized_pool_resource': 'memory_resource',
     'std::deque': 'deque',
     'std::array': 'array',
     'std::map': 'map',
@@ -214,6 +242,9 @@ SYSTEM_TYPE_TO_HEADER_MAPPING = {
     'std::multiset': 'set',
     'std::runtime_error': 'stdexcept',
     'std::exception': 'exception',
+    'std::exception_ptr': 'exception',
+    'std::current_exception': 'exception',
+    'std::rethrow_exception': 'exception',
     'std::cout': 'iostream',
     'std::ofstream': 'fstream',
     'std::ostream': 'ostream',
@@ -231,6 +262,8 @@ SYSTEM_TYPE_TO_HEADER_MAPPING = {
     'std::future_status::timeout': 'future',
     'std::future_status::deferred': 'future',
     'std::promise': 'future',
+    'std::async': 'future',
+    'std::launch::async': 'future',
     'std::jthread': 'thread',
     'std::thread': 'thread',
     'std::thread::hardware_concurrency': 'thread',
@@ -239,6 +272,11 @@ SYSTEM_TYPE_TO_HEADER_MAPPING = {
     'std::this_thread::get_id': 'thread',
     'std::memory_order_acquire': 'atomic',
     'std::memory_order_release': 'atomic',
+    'std::memory_order_relaxed': 'atomic',
+    'std::memory_order_acq_rel': 'atomic',
+    'std::atomic': 'atomic',
+    'std::atomic_ref': 'atomic',
+    'std::latch': 'latch',
     'std::atomic_flag': 'atomic',
     'std::atomic_int64_t': 'atomic',
     'std::any': 'any',
@@ -254,6 +292,14 @@ SYSTEM_TYPE_TO_HEADER_MAPPING = {
     'boost::filesystem::path': 'boost/filesystem.hpp',
     'boost::filesystem::temp_directory_path': 'boost/filesystem.hpp',
     'boost::filesystem::unique_path': 'boost/filesystem.hpp',
+    'boost::filesystem::remove': 'boost/filesystem.hpp',
+    'boost::filesystem::create_directory': 'boost/filesystem.hpp',
+    'boost::filesystem::is_empty': 'boost/filesystem.hpp',
+    'boost::system::error_code': 'boost/filesystem.hpp',
+    'boost::iostreams::mapped_file': 'boost/iostreams/device/mapped_file.hpp',
+    'boost::iostreams::mapped_file_params': 'boost/iostreams/device/mapped_file.hpp',
+    'boost::iostreams::mapped_file_base::readwrite': 'boost/iostreams/device/mapped_file.hpp',
+    'boost::iostreams::stream_offset': 'boost/iostreams/device/mapped_file.hpp',
     'boost::iostreams::mapped_file_source': 'boost/iostreams/device/mapped_file.hpp',
     'boost::iostreams::mapped_file_base::readonly': 'boost/iostreams/device/mapped_file.hpp',
     'boost::safe_numerics': 'boost/safe_numerics/safe_integer.hpp',
@@ -264,6 +310,13 @@ SYSTEM_TYPE_TO_HEADER_MAPPING = {
 }
 
 
+POSIX_FUNCTION_TO_HEADER_MAPPING = {
+    'mmap': 'sys/mman.h',
+    'munmap': 'sys/mman.h',
+    'madvise': 'sys/mman.h',
+}
+
+
 def check_system_includes(path: Path, content: str):
     assert(path.suffix in {'.cpp', '.h'})
     content = content.strip()
@@ -289,6 +342,14 @@ def check_system_includes(path: Path, content: str):
             elif expected_include not in found_includes:
                 print(f'{path}: {usage} requires include {expected_include}')
                 result = CheckResult.FAIL
+        for usage in re.findall(r'\b(\w+)\(', line):
+            expected_include = POSIX_FUNCTION_TO_HEADER_MAPPING.get(usage, None)
+            if expected_include is None:
+                continue
+            expected_includes.add(expected_include)
+            if expected_include not in found_includes:
+                print(f'{path}: {usage} requires include {expected_include}')
+                result = CheckResult.FAIL
     excess_includes = found_includes - expected_includes
     if excess_includes:
         for excess_include in excess_includes: